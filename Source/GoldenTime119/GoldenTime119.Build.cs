@@ -1,5 +1,6 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class GoldenTime119 : ModuleRules
@@ -12,6 +13,33 @@ public class GoldenTime119 : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] { "Slate","SlateCore" });
 
+		// whisper.cpp (in-process STT, CPU only)
+		//   Plugins/WhisperRuntime/ThirdParty/Whisper/include/whisper.h (+ ggml*.h)
+		//   Plugins/WhisperRuntime/ThirdParty/Whisper/lib/<Platform>/ : static libs (whisper, ggml, ggml-base, ggml-cpu)
+		// Build with -DBUILD_SHARED_LIBS=OFF -DGGML_OPENMP=OFF; on Linux against the engine's bundled libc++.
+		// Without them STT falls back to running whisper-cli (UWhisperSTTSubsystem::CliPath) once per request.
+		string WhisperRoot = Path.GetFullPath(Path.Combine(ModuleDirectory, "../../Plugins/WhisperRuntime/ThirdParty/Whisper"));
+		string WhisperInclude = Path.Combine(WhisperRoot, "include");
+		string WhisperLibDir = Path.Combine(WhisperRoot, "lib", Target.Platform.ToString());
+		bool bWithWhisper = File.Exists(Path.Combine(WhisperInclude, "whisper.h")) && Directory.Exists(WhisperLibDir);
+
+		if (bWithWhisper)
+		{
+			PrivateIncludePaths.Add(WhisperInclude);
+
+			string LibPattern = (Target.Platform == UnrealTargetPlatform.Win64) ? "*.lib" : "*.a";
+			foreach (string Lib in Directory.GetFiles(WhisperLibDir, LibPattern))
+			{
+				PublicAdditionalLibraries.Add(Lib);
+			}
+
+			if (Target.Platform == UnrealTargetPlatform.Linux)
+			{
+				PublicSystemLibraries.Add("pthread");
+			}
+		}
+		PrivateDefinitions.Add("WITH_WHISPER_CPP=" + (bWithWhisper ? "1" : "0"));
+
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 		
@@ -49,6 +49,24 @@ float UBreakableComponent::ApplyDamage(float BaseDamage, EBreakToolType ToolUsed
     UE_LOG(LogBreakable, Warning, TEXT("[Breakable] %s hit! Damage:%.1f (Base:%.1f x %.2f) HP:%.1f/%.1f"),
         *GetNameSafe(GetOwner()), FinalDamage, BaseDamage, DamageMultiplier, CurrentHP, MaxHP);
 
+    return FinishDamage(FinalDamage, ToolUsed, HitLocation, HitNormal);
+}
+
+float UBreakableComponent::ApplyBlastDamage(float Damage, FVector HitLocation, FVector HitNormal)
+{
+    if (IsBroken() || bHasBroken || Damage <= 0.f)
+        return 0.f;
+
+    CurrentHP = FMath::Max(0.f, CurrentHP - Damage);
+
+    UE_LOG(LogBreakable, Warning, TEXT("[Breakable] %s blast! Damage:%.1f HP:%.1f/%.1f"),
+        *GetNameSafe(GetOwner()), Damage, CurrentHP, MaxHP);
+
+    return FinishDamage(Damage, EBreakToolType::Any, HitLocation, HitNormal);
+}
+
+float UBreakableComponent::FinishDamage(float FinalDamage, EBreakToolType ToolUsed, FVector HitLocation, FVector HitNormal)
+{
     // Ʈ  ( Ÿ )
     PlayHitEffects(ToolUsed, HitLocation, HitNormal);
 
@@ -3,6 +3,7 @@
 
 #include "RoomActor.h"
 #include "FireActor.h"
+#include "GameplaySpatialIndexSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Components/SceneComponent.h"
@@ -21,6 +22,12 @@ void UCombustibleComponent::BeginPlay()
 
     EnsureFuelInitialized();
 
+    // ȭ/  ε  (   )
+    if (UGameplaySpatialIndexSubsystem* Index = UGameplaySpatialIndexSubsystem::Get(this))
+    {
+        Index->RegisterCombustible(this);
+    }
+
     AActor* Owner = GetOwner();
     if (!IsValid(Owner)) return;
 
@@ -35,6 +42,11 @@ void UCombustibleComponent::BeginPlay()
 
 void UCombustibleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (UGameplaySpatialIndexSubsystem* Index = UGameplaySpatialIndexSubsystem::Get(this))
+    {
+        Index->UnregisterCombustible(this);
+    }
+
     if (IsValid(SteamAudio) && SteamAudio->IsPlaying())
     {
         SteamAudio->Stop();
@@ -195,12 +207,22 @@ void UCombustibleComponent::AddIgnitionPressure(const FGuid& /*SourceFireId*/, f
 {
     if (Pressure <= KINDA_SMALL_NUMBER) return;
     PendingPressure += Pressure;
+    MarkHeatActivity();
 }
 
 void UCombustibleComponent::AddHeat(float HeatDelta)
 {
     if (HeatDelta <= KINDA_SMALL_NUMBER) return;
     PendingHeat += HeatDelta;
+    MarkHeatActivity();
+}
+
+void UCombustibleComponent::MarkHeatActivity()
+{
+    if (bHeatActivityActive) return;
+
+    bHeatActivityActive = true;
+    OnHeatActivityBegin.Broadcast(this);
 }
 
 void UCombustibleComponent::ConsumeFuel(float ConsumeAmount)
@@ -242,6 +264,9 @@ void UCombustibleComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
     if (!bHasActivity && Ignition.IgnitionProgress01 <= KINDA_SMALL_NUMBER)
     {
+        //   ->   Է  ٽ ˸
+        bHeatActivityActive = false;
+
         // Ƽ 嵵 ڿ 
         UpdateSmolderAudio(DeltaTime);
         return;
@@ -403,6 +428,7 @@ void UCombustibleComponent::OnIgnited()
     ActiveFire = NewFire;
     bIsBurning = true;
     Ignition.IgnitionProgress01 = 0.f;
+    MarkHeatActivity();
 
     // Ҳ  ƼҴ  
     if (IsValid(SmolderAudio) && SmolderAudio->IsPlaying())
@@ -2,6 +2,7 @@
 #include "DoorActor.h"
 #include "RoomActor.h"
 #include "BreakableComponent.h"
+#include "VRHapticsSubsystem.h"
 
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -810,6 +811,43 @@ void ADoorActor::ExecuteDelayedBackdraft()
     PendingBackdraftRoom = nullptr;
 }
 
+// ============================ Blast ============================
+float ADoorActor::ReceiveBlastOverpressure(float Overpressure, FVector SourceLocation)
+{
+    if (DoorState == EDoorState::Breached)
+        return 1.f;
+
+    if (Overpressure <= KINDA_SMALL_NUMBER)
+        return ComputeVent01();
+
+    const FVector DoorLoc = CachedDoorMesh ? CachedDoorMesh->GetComponentLocation() : GetActorLocation();
+    const FVector FromSource = (DoorLoc - SourceLocation).GetSafeNormal();
+
+    // 1) ¦ ļ (Breakable -> OnDoorDamagedByAxe/OnDoorBrokenByAxe η /ı ó)
+    if (bIsBreakable && Breakable && !Breakable->IsBroken())
+    {
+        Breakable->ApplyBlastDamage(Overpressure * BlastDamageScale, DoorLoc, -FromSource);
+    }
+
+    // 2)   ϸ  
+    if (DoorState == EDoorState::Closed && Overpressure >= BlastBlowOpenPressure)
+    {
+        if (bIsGrabbed)
+        {
+            OnReleased_Implementation(GrabbingController, true);
+        }
+
+        UE_LOG(LogDoorActor, Warning, TEXT("[Door] %s blown open by blast (%.1f)"), *GetName(), Overpressure);
+        SetOpenAmount01(1.f);
+    }
+
+    if (DoorState == EDoorState::Breached)
+        return 1.f;
+
+    //   + ȯ (ComputeVent01 ),  ־ ƴ  
+    return FMath::Clamp(FMath::Max(ComputeVent01(), BlastClosedTransmission), 0.f, 1.f);
+}
+
 // ============================ Door VFX ============================
 void ADoorActor::EnsureDoorVfx()
 {
@@ -1188,16 +1226,14 @@ void ADoorActor::TryPlayGrabFeedback(bool bIsLeftHand)
         UGameplayStatics::PlaySoundAtLocation(this, LatchGrabOneShotSound, SfxLoc, 1.0f, Pitch);
     }
 
-    // 2) ƽ( )
-    // -   : PlayerController PlayHapticEffect
-    // - VR pawn/hand ý θ ű⿡ ° ٲ  
+    // 2) ƽ( ) - ÷̾ ƽ ͼ  (Warning 켱)
     if (BackdraftGrabHaptic)
     {
-        APlayerController* PC = W->GetFirstPlayerController();
-        if (PC)
+        if (UVRHapticsSubsystem* Haptics = UVRHapticsSubsystem::Get(this))
         {
             const EControllerHand Hand = bIsLeftHand ? EControllerHand::Left : EControllerHand::Right;
-            PC->PlayHapticEffect(BackdraftGrabHaptic, Hand, BackdraftGrabHapticScale, false);
+            Haptics->PlayEffect(TEXT("Door.BackdraftGrab"), Hand, EVRHapticPriority::Warning,
+                BackdraftGrabHaptic, BackdraftGrabHapticScale);
         }
     }
 }
\ No newline at end of file
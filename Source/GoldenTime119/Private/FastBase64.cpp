@@ -0,0 +1,191 @@
+// ============================ FastBase64.cpp ============================
+#include "FastBase64.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY && (PLATFORM_ALWAYS_HAS_SSE4_1 || defined(__SSSE3__))
+	#include <tmmintrin.h>
+	#define FAST_BASE64_SSSE3 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+	#include <arm_neon.h>
+	#define FAST_BASE64_NEON 1
+#endif
+
+#ifndef FAST_BASE64_SSSE3
+	#define FAST_BASE64_SSSE3 0
+#endif
+#ifndef FAST_BASE64_NEON
+	#define FAST_BASE64_NEON 0
+#endif
+
+namespace
+{
+	const ANSICHAR EncodeTable[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	// 0xFF = Base64 문자 아님
+	struct FDecodeTable
+	{
+		uint8 Values[256];
+
+		FDecodeTable()
+		{
+			FMemory::Memset(Values, 0xFF, sizeof(Values));
+			for (int32 i = 0; i < 64; ++i)
+			{
+				Values[(uint8)EncodeTable[i]] = (uint8)i;
+			}
+		}
+	};
+
+	const uint8* GetDecodeTable()
+	{
+		static const FDecodeTable Table;
+		return Table.Values;
+	}
+}
+
+void FastBase64::Encode(const uint8* Src, int32 NumBytes, ANSICHAR* Dst)
+{
+	int32 i = 0;
+
+#if FAST_BASE64_SSSE3
+	// 12바이트 -> 16문자. 로드는 16바이트라서 끝에서 4바이트 여유가 있을 때까지만
+	{
+		const __m128i Shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+		const __m128i ShiftLut = _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+		for (; i + 16 <= NumBytes; i += 12)
+		{
+			const __m128i In = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + i)), Shuffle);
+
+			// 24비트 그룹마다 6비트 인덱스 4개로 분리
+			const __m128i T0 = _mm_and_si128(In, _mm_set1_epi32(0x0fc0fc00));
+			const __m128i T1 = _mm_mulhi_epu16(T0, _mm_set1_epi32(0x04000040));
+			const __m128i T2 = _mm_and_si128(In, _mm_set1_epi32(0x003f03f0));
+			const __m128i T3 = _mm_mullo_epi16(T2, _mm_set1_epi32(0x01000010));
+			const __m128i Indices = _mm_or_si128(T1, T3);
+
+			// 인덱스 구간(A-Z, a-z, 0-9, +, /)별 오프셋을 더해 ASCII로
+			__m128i Range = _mm_subs_epu8(Indices, _mm_set1_epi8(51));
+			const __m128i IsUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), Indices);
+			Range = _mm_or_si128(Range, _mm_and_si128(IsUpper, _mm_set1_epi8(13)));
+			const __m128i Chars = _mm_add_epi8(_mm_shuffle_epi8(ShiftLut, Range), Indices);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), Chars);
+			Dst += 16;
+		}
+	}
+#elif FAST_BASE64_NEON
+	// 48바이트 -> 64문자 (vld3 디인터리브 + 64바이트 테이블 조회)
+	{
+		uint8x16x4_t Lut;
+		Lut.val[0] = vld1q_u8(reinterpret_cast<const uint8*>(EncodeTable));
+		Lut.val[1] = vld1q_u8(reinterpret_cast<const uint8*>(EncodeTable) + 16);
+		Lut.val[2] = vld1q_u8(reinterpret_cast<const uint8*>(EncodeTable) + 32);
+		Lut.val[3] = vld1q_u8(reinterpret_cast<const uint8*>(EncodeTable) + 48);
+		const uint8x16_t Mask6 = vdupq_n_u8(0x3F);
+
+		for (; i + 48 <= NumBytes; i += 48)
+		{
+			const uint8x16x3_t In = vld3q_u8(Src + i);
+
+			uint8x16x4_t Idx;
+			Idx.val[0] = vshrq_n_u8(In.val[0], 2);
+			Idx.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(In.val[0], 4), vshrq_n_u8(In.val[1], 4)), Mask6);
+			Idx.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(In.val[1], 2), vshrq_n_u8(In.val[2], 6)), Mask6);
+			Idx.val[3] = vandq_u8(In.val[2], Mask6);
+
+			uint8x16x4_t Out;
+			Out.val[0] = vqtbl4q_u8(Lut, Idx.val[0]);
+			Out.val[1] = vqtbl4q_u8(Lut, Idx.val[1]);
+			Out.val[2] = vqtbl4q_u8(Lut, Idx.val[2]);
+			Out.val[3] = vqtbl4q_u8(Lut, Idx.val[3]);
+
+			vst4q_u8(reinterpret_cast<uint8*>(Dst), Out);
+			Dst += 64;
+		}
+	}
+#endif
+
+	for (; i + 3 <= NumBytes; i += 3)
+	{
+		const uint32 V = (uint32(Src[i]) << 16) | (uint32(Src[i + 1]) << 8) | uint32(Src[i + 2]);
+		Dst[0] = EncodeTable[(V >> 18) & 0x3F];
+		Dst[1] = EncodeTable[(V >> 12) & 0x3F];
+		Dst[2] = EncodeTable[(V >> 6) & 0x3F];
+		Dst[3] = EncodeTable[V & 0x3F];
+		Dst += 4;
+	}
+
+	const int32 Rem = NumBytes - i;
+	if (Rem == 1)
+	{
+		const uint32 V = uint32(Src[i]) << 16;
+		Dst[0] = EncodeTable[(V >> 18) & 0x3F];
+		Dst[1] = EncodeTable[(V >> 12) & 0x3F];
+		Dst[2] = '=';
+		Dst[3] = '=';
+	}
+	else if (Rem == 2)
+	{
+		const uint32 V = (uint32(Src[i]) << 16) | (uint32(Src[i + 1]) << 8);
+		Dst[0] = EncodeTable[(V >> 18) & 0x3F];
+		Dst[1] = EncodeTable[(V >> 12) & 0x3F];
+		Dst[2] = EncodeTable[(V >> 6) & 0x3F];
+		Dst[3] = '=';
+	}
+}
+
+int32 FastBase64::Decode(const ANSICHAR* Src, int32 NumChars, uint8* Dst)
+{
+	if (NumChars == 0)
+		return 0;
+
+	if (!Src || (NumChars % 4) != 0)
+		return INDEX_NONE;
+
+	const uint8* T = GetDecodeTable();
+	const uint8* In = reinterpret_cast<const uint8*>(Src);
+
+	const int32 Pad = (In[NumChars - 1] == '=') ? ((In[NumChars - 2] == '=') ? 2 : 1) : 0;
+	const int32 FullChars = (Pad > 0) ? NumChars - 4 : NumChars;
+
+	uint8* Out = Dst;
+	for (int32 i = 0; i < FullChars; i += 4)
+	{
+		const uint32 A = T[In[i]];
+		const uint32 B = T[In[i + 1]];
+		const uint32 C = T[In[i + 2]];
+		const uint32 D = T[In[i + 3]];
+
+		// 무효 문자는 0xFF라서 OR 한 번으로 검사
+		if ((A | B | C | D) & 0x80)
+			return INDEX_NONE;
+
+		const uint32 V = (A << 18) | (B << 12) | (C << 6) | D;
+		Out[0] = (uint8)(V >> 16);
+		Out[1] = (uint8)(V >> 8);
+		Out[2] = (uint8)V;
+		Out += 3;
+	}
+
+	if (Pad > 0)
+	{
+		const uint8* Last = In + FullChars;
+		const uint32 A = T[Last[0]];
+		const uint32 B = T[Last[1]];
+		const uint32 C = (Pad == 1) ? T[Last[2]] : 0;
+
+		if ((A | B | C) & 0x80)
+			return INDEX_NONE;
+
+		const uint32 V = (A << 18) | (B << 12) | (C << 6);
+		*Out++ = (uint8)(V >> 16);
+		if (Pad == 1)
+		{
+			*Out++ = (uint8)(V >> 8);
+		}
+	}
+
+	return (int32)(Out - Dst);
+}
@@ -2,6 +2,7 @@
 #include "FireHose_VR.h"
 
 #include "CombustibleComponent.h"
+#include "VRHapticsSubsystem.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
@@ -646,29 +647,48 @@ void AFireHose_VR::TryPlayImpactOneShot(const TArray<FVector>& WaterPath)
 }
 
 // ============================================================
-// Haptics (Dynamic)
+// Haptics (Dynamic) - routed through the per-player mixer
 // ============================================================
 
+static const FName HoseSprayHapticSource(TEXT("Hose.Spray"));
+static const FName HoseNozzleHapticSource(TEXT("Hose.Nozzle"));
+
+UVRHapticsSubsystem* AFireHose_VR::GetHaptics()
+{
+	if (!CachedHaptics.IsValid())
+	{
+		CachedHaptics = UVRHapticsSubsystem::Get(this);
+	}
+	return CachedHaptics.Get();
+}
+
 void AFireHose_VR::SetHandHaptics(bool bLeft, float Frequency01, float Amplitude01)
 {
 	if (!bEnableHaptics) return;
 
-	APlayerController* PC = CachedPC.IsValid()
-		? CachedPC.Get()
-		: (GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr);
-
-	if (!PC) return;
+	UVRHapticsSubsystem* Haptics = GetHaptics();
+	if (!Haptics) return;
 
-	const float F = FMath::Clamp(Frequency01, 0.f, 1.f);
-	const float A = FMath::Clamp(Amplitude01, 0.f, 1.f);
+	// Spray feel is continuous: refresh a short-lived ambient layer every tick.
+	// The mixer only talks to the device when the mixed value changes.
+	FVRHapticRequest R;
+	R.Source = HoseSprayHapticSource;
+	R.Priority = EVRHapticPriority::Ambient;
+	R.Frequency01 = FMath::Clamp(Frequency01, 0.f, 1.f);
+	R.Amplitude01 = FMath::Clamp(Amplitude01, 0.f, 1.f);
+	R.Duration = SprayHapticHoldSec;
 
-	PC->SetHapticsByValue(F, A, bLeft ? EControllerHand::Left : EControllerHand::Right);
+	Haptics->SubmitRequest(bLeft ? EControllerHand::Left : EControllerHand::Right, R);
 }
 
 void AFireHose_VR::StopHandHaptics(bool bLeft)
 {
 	if (!bEnableHaptics) return;
-	SetHandHaptics(bLeft, 0.f, 0.f);
+
+	if (UVRHapticsSubsystem* Haptics = GetHaptics())
+	{
+		Haptics->ClearRequest(HoseSprayHapticSource, bLeft ? EControllerHand::Left : EControllerHand::Right);
+	}
 }
 
 void AFireHose_VR::PulseLeftHandOnNozzleTurn(float Strength01)
@@ -684,7 +704,11 @@ void AFireHose_VR::PulseLeftHandOnNozzleTurn(float Strength01)
 	const float Amp = FMath::Clamp(NozzleTurnPulseAmp * Strength01, 0.f, 1.f);
 	const float Freq = FMath::Clamp(NozzleTurnPulseFreq, 0.f, 1.f);
 
-	SetHandHaptics(true, Freq, Amp);
+	if (UVRHapticsSubsystem* Haptics = GetHaptics())
+	{
+		Haptics->PlayPulse(HoseNozzleHapticSource, EControllerHand::Left, EVRHapticPriority::Feedback,
+			Freq, Amp, NozzleTurnPulseDuration);
+	}
 	LastNozzlePulseTime = Now;
 }
 
@@ -701,10 +725,23 @@ void AFireHose_VR::UpdateHaptics(float DeltaSeconds)
 
 		SetHandHaptics(true, Freq, Amp);
 		SetHandHaptics(false, Freq, Amp);
+		bSprayHapticsActive = true;
 	}
-	else
+	else if (bSprayHapticsActive)
 	{
 		StopHandHaptics(true);
 		StopHandHaptics(false);
+		bSprayHapticsActive = false;
+	}
+}
+
+void AFireHose_VR::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UVRHapticsSubsystem* Haptics = CachedHaptics.Get())
+	{
+		Haptics->ClearSource(HoseSprayHapticSource);
+		Haptics->ClearSource(HoseNozzleHapticSource);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
@@ -1,13 +1,24 @@
 // ============================ FireAxeActor.cpp ============================
 #include "FireAxeActor.h"
 #include "BreakableComponent.h"
+#include "VRHapticsSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "MotionControllerComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
 #include "Engine/World.h"
+#include "DrawDebugHelpers.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFireAxe, Log, All);
 
+namespace
+{
+    // SetControllerVelocity  ġ  ӵ 켱ϴ ð
+    constexpr float ControllerVelocityHoldSec = 0.1f;
+}
+
 AFireAxeActor::AFireAxeActor()
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -37,7 +48,8 @@ void AFireAxeActor::BeginPlay()
 {
     Super::BeginPlay();
 
-    LastPosition = GetActorLocation();
+    ResetPoseHistory();
+    PushPoseSample(BladeCollision->GetComponentLocation(), BladeCollision->GetComponentQuat(), GetWorld()->GetTimeSeconds());
 
     // 浹 ̺Ʈ ε
     BladeCollision->OnComponentBeginOverlap.AddDynamic(this, &AFireAxeActor::OnBladeOverlapBegin);
@@ -50,38 +62,107 @@ void AFireAxeActor::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    // ̹    
+    PushPoseSample(BladeCollision->GetComponentLocation(), BladeCollision->GetComponentQuat(), GetWorld()->GetTimeSeconds());
+
     UpdateVelocityTracking();
+
+    if (bSweptHitDetection)
+    {
+        SweepPendingPoses();
+    }
+    else
+    {
+        SweptSerial = PoseSerialEnd - 1;
+    }
 }
 
-void AFireAxeActor::UpdateVelocityTracking()
+// =====   =====
+
+void AFireAxeActor::PushPoseSample(const FVector& BladeLocation, const FQuat& BladeRotation, double Time)
 {
-    if (!bTrackControllerVelocity)
+    // ð   
+    if (PoseCount > 0 && Time <= GetPoseBySerial(PoseSerialEnd - 1).Time)
         return;
 
-    // ġ  ӵ 
-    const FVector CurrentPosition = GetActorLocation();
-    const FVector FrameVelocity = (CurrentPosition - LastPosition) / GetWorld()->GetDeltaSeconds();
-    LastPosition = CurrentPosition;
+    FAxePoseSample& Slot = PoseHistory[PoseSerialEnd % PoseHistoryCapacity];
+    Slot.BladeLocation = BladeLocation;
+    Slot.BladeRotation = BladeRotation;
+    Slot.Time = Time;
+
+    ++PoseSerialEnd;
+    PoseCount = FMath::Min(PoseCount + 1, PoseHistoryCapacity);
+}
+
+void AFireAxeActor::ResetPoseHistory()
+{
+    // ȣ  ̾ ϸ  ->     
+    PoseCount = 0;
+    SweptSerial = PoseSerialEnd - 1;
+    CurrentVelocity = FVector::ZeroVector;
+}
+
+void AFireAxeActor::GetHolderActors(TArray<AActor*, TInlineAllocator<8>>& OutHolders) const
+{
+    OutHolders.Reset();
 
-    //  
-    VelocitySamples.Add(FrameVelocity);
-    if (VelocitySamples.Num() > VelocitySampleCount)
+    auto AddHolder = [&OutHolders](AActor* Actor)
     {
-        VelocitySamples.RemoveAt(0);
-    }
+        if (IsValid(Actor))
+        {
+            OutHolders.AddUnique(Actor);
+        }
+    };
+
+    AddHolder(GetOwner());
+    AddHolder(GetInstigator());
 
-    //  ӵ 
-    FVector AverageVelocity = FVector::ZeroVector;
-    for (const FVector& Sample : VelocitySamples)
+    //   پ  Ϳ پ  ü ü
+    for (AActor* Parent = GetAttachParentActor(); Parent; Parent = Parent->GetAttachParentActor())
     {
-        AverageVelocity += Sample;
+        AddHolder(Parent);
+        AddHolder(Parent->GetOwner());
+        AddHolder(Parent->GetInstigator());
     }
-    if (VelocitySamples.Num() > 0)
+
+    // ڰ Ʈѷ  Ʈѷ  (߰Ǵ   Ȯ)
+    for (int32 Index = 0; Index < OutHolders.Num(); ++Index)
     {
-        AverageVelocity /= VelocitySamples.Num();
+        if (const AController* Controller = Cast<AController>(OutHolders[Index]))
+        {
+            AddHolder(Controller->GetPawn());
+        }
     }
+}
+
+void AFireAxeActor::UpdateVelocityTracking()
+{
+    if (!bTrackControllerVelocity)
+        return;
 
-    CurrentVelocity = AverageVelocity;
+    // Ʈѷ  ˷ ӵ ֱ ̸ ״ 
+    const float Now = GetWorld()->GetTimeSeconds();
+    const bool bHasControllerVelocity = ControllerVelocityTime >= 0.f && Now - ControllerVelocityTime <= ControllerVelocityHoldSec;
+
+    if (!bHasControllerVelocity)
+    {
+        // ֱ N   = (ֽ ġ - N  ġ) /   ð
+        const int32 Window = FMath::Min(FMath::Clamp(VelocitySampleCount, 1, PoseHistoryCapacity - 1), PoseCount - 1);
+        if (Window > 0)
+        {
+            const FAxePoseSample& Newest = GetPoseBySerial(PoseSerialEnd - 1);
+            const FAxePoseSample& Oldest = GetPoseBySerial(PoseSerialEnd - 1 - Window);
+            const double Dt = Newest.Time - Oldest.Time;
+
+            CurrentVelocity = Dt > UE_KINDA_SMALL_NUMBER
+                ? FVector((Newest.BladeLocation - Oldest.BladeLocation) / Dt)
+                : FVector::ZeroVector;
+        }
+        else
+        {
+            CurrentVelocity = FVector::ZeroVector;
+        }
+    }
 
     //  
     const float Speed = CurrentVelocity.Size();
@@ -94,13 +175,115 @@ void AFireAxeActor::UpdateVelocityTracking()
 void AFireAxeActor::SetControllerVelocity(FVector Velocity)
 {
     CurrentVelocity = Velocity;
-    VelocitySamples.Add(Velocity);
-    if (VelocitySamples.Num() > VelocitySampleCount)
+    ControllerVelocityTime = GetWorld()->GetTimeSeconds();
+}
+
+// =====   =====
+
+void AFireAxeActor::SweepPendingPoses()
+{
+    const int32 Newest = PoseSerialEnd - 1;
+    const int32 Oldest = PoseSerialEnd - PoseCount;
+
+    // ۰    ִ   
+    for (int32 Serial = FMath::Max(SweptSerial, Oldest); Serial >= 0 && Serial < Newest; ++Serial)
+    {
+        SweepBetweenPoses(GetPoseBySerial(Serial), GetPoseBySerial(Serial + 1));
+    }
+
+    SweptSerial = Newest;
+}
+
+void AFireAxeActor::SweepBetweenPoses(const FAxePoseSample& From, const FAxePoseSample& To)
+{
+    const double SegmentTime = To.Time - From.Time;
+    if (SegmentTime <= UE_KINDA_SMALL_NUMBER)
+        return;
+
+    const FVector Delta = To.BladeLocation - From.BladeLocation;
+    if (Delta.SizeSquared() > FMath::Square(MaxSweepDistance))
+    {
+        UE_LOG(LogFireAxe, Verbose, TEXT("[FireAxe] Pose jump %.1fcm - sweep skipped"), Delta.Size());
+        return;
+    }
+
+    //  ӵ/ӵ (ִ ȸ)
+    FQuat DeltaRot = To.BladeRotation * From.BladeRotation.Inverse();
+    if (DeltaRot.W < 0.f)
+    {
+        DeltaRot = FQuat(-DeltaRot.X, -DeltaRot.Y, -DeltaRot.Z, -DeltaRot.W);
+    }
+    const float Angle = DeltaRot.GetAngle();
+    const FVector Axis = DeltaRot.GetRotationAxis();
+
+    const FVector LinearVelocity = Delta / SegmentTime;
+    const FVector AngularVelocity = Axis * (Angle / SegmentTime);
+
+    //    MinSwingSpeed  ġ ¾Ƶ   ->  
+    const FVector Extent = BladeCollision->GetScaledBoxExtent();
+    const float MaxPointSpeed = LinearVelocity.Size() + AngularVelocity.Size() * Extent.Size();
+    if (MaxPointSpeed < MinSwingSpeed)
+        return;
+
+    // ȸ ũ     ߰ ȸ 
+    const int32 Steps = FMath::Clamp(FMath::CeilToInt(FMath::RadiansToDegrees(Angle) / FMath::Max(MaxSweepStepDegrees, 1.f)), 1, FMath::Max(MaxSweepSubsteps, 1));
+
+    const FCollisionShape BladeShape = FCollisionShape::MakeBox(Extent);
+    const FCollisionObjectQueryParams ObjectParams(FCollisionObjectQueryParams::AllObjects);
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(FireAxeBladeSweep), false, this);
+
+    //  (/ )   -> ApplyDamage  ÷̾  
+    TArray<AActor*, TInlineAllocator<8>> Holders;
+    GetHolderActors(Holders);
+    for (AActor* Holder : Holders)
+    {
+        Params.AddIgnoredActor(Holder);
+    }
+
+    UWorld* World = GetWorld();
+
+    for (int32 Step = 0; Step < Steps; ++Step)
     {
-        VelocitySamples.RemoveAt(0);
+        const float T0 = float(Step) / Steps;
+        const float T1 = float(Step + 1) / Steps;
+        const FVector Start = From.BladeLocation + Delta * T0;
+        const FVector End = From.BladeLocation + Delta * T1;
+        const FQuat Rot = FQuat::Slerp(From.BladeRotation, To.BladeRotation, (T0 + T1) * 0.5f);
+
+        SweepHits.Reset();
+        World->SweepMultiByObjectType(SweepHits, Start, End, Rot, ObjectParams, BladeShape, Params);
+
+#if ENABLE_DRAW_DEBUG
+        if (bDebugDrawSweep)
+        {
+            DrawDebugBox(World, End, Extent, Rot, SweepHits.Num() > 0 ? FColor::Red : FColor::Green, false, 1.f);
+        }
+#endif
+
+        for (const FHitResult& Hit : SweepHits)
+        {
+            //  ۺ  ִ    ̹ 
+            if (Hit.bStartPenetrating)
+                continue;
+
+            AActor* HitActor = Hit.GetActor();
+            if (!IsValid(HitActor))
+                continue;
+
+            // Ÿ   ӵ = ӵ + ӵ x ( -  ߽)
+            const FVector BladeCenter = FMath::Lerp(Start, End, Hit.Time);
+            const FVector PointVelocity = LinearVelocity + (AngularVelocity ^ (Hit.ImpactPoint - BladeCenter));
+
+            const float HitTime = float(From.Time + SegmentTime * FMath::Lerp(T0, T1, Hit.Time));
+
+            // Ÿ ̹Ƿ   ͸ ó ( ٿ ɸ)
+            if (TryRegisterHit(HitActor, Hit, PointVelocity.Size(), HitTime))
+                return;
+        }
     }
 }
 
+
 float AFireAxeActor::GetCurrentSwingSpeed() const
 {
     return CurrentVelocity.Size();
@@ -108,7 +291,11 @@ float AFireAxeActor::GetCurrentSwingSpeed() const
 
 float AFireAxeActor::GetSwingIntensity() const
 {
-    const float Speed = GetCurrentSwingSpeed();
+    return GetIntensityForSpeed(GetCurrentSwingSpeed());
+}
+
+float AFireAxeActor::GetIntensityForSpeed(float Speed) const
+{
     if (Speed < MinSwingSpeed)
         return 0.f;
 
@@ -118,28 +305,12 @@ float AFireAxeActor::GetSwingIntensity() const
 void AFireAxeActor::OnBladeOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-    if (!IsValid(OtherActor) || OtherActor == this)
-        return;
-
-    // ٿ üũ
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
-    if (CurrentTime - LastHitTime < HitCooldown)
+    //   ߿   ( Ÿ  ӵ  ä ʵ)
+    if (bSweptHitDetection)
         return;
 
-    //    Ʈ 
-    if (LastHitActor.IsValid() && LastHitActor.Get() == OtherActor)
-    {
-        if (CurrentTime - LastHitActorTime < HitCooldown * 2.f)
-            return;
-    }
-
-    //  ӵ üũ
-    const float SwingSpeed = GetCurrentSwingSpeed();
-    if (SwingSpeed < MinSwingSpeed)
-    {
-        UE_LOG(LogFireAxe, Verbose, TEXT("[FireAxe] Swing too slow: %.1f < %.1f"), SwingSpeed, MinSwingSpeed);
+    if (!IsValid(OtherActor) || OtherActor == this)
         return;
-    }
 
     // HitResult 
     FHitResult HitResult = SweepResult;
@@ -150,31 +321,62 @@ void AFireAxeActor::OnBladeOverlapBegin(UPrimitiveComponent* OverlappedComp, AAc
         HitResult.ImpactNormal = -CurrentVelocity.GetSafeNormal();
     }
 
-    //  
-    const float DamageDealt = CalculateAndApplyDamage(OtherActor, HitResult);
+    TryRegisterHit(OtherActor, HitResult, GetCurrentSwingSpeed(), GetWorld()->GetTimeSeconds());
+}
 
-    if (DamageDealt > 0.f)
-    {
-        LastHitTime = CurrentTime;
-        LastHitActor = OtherActor;
-        LastHitActorTime = CurrentTime;
+bool AFireAxeActor::TryRegisterHit(AActor* HitActor, const FHitResult& HitResult, float ImpactSpeed, float HitTime)
+{
+    //   ε   
+    TArray<AActor*, TInlineAllocator<8>> Holders;
+    GetHolderActors(Holders);
+    if (Holders.Contains(HitActor))
+        return false;
 
-        // ̺Ʈ
-        OnAxeHit.Broadcast(OtherActor, HitResult.ImpactPoint, DamageDealt);
+    // ٿ üũ
+    if (HitTime - LastHitTime < HitCooldown)
+        return false;
 
-        // ƽ
-        const float HapticScale = FMath::Clamp(DamageDealt / (BaseDamage * MaxSpeedDamageMultiplier), 0.3f, 1.f);
-        PlayHitHaptic(HitHapticIntensity * HapticScale, HitHapticDuration);
+    //    Ʈ 
+    if (LastHitActor.IsValid() && LastHitActor.Get() == HitActor)
+    {
+        if (HitTime - LastHitActorTime < HitCooldown * 2.f)
+            return false;
+    }
 
-        UE_LOG(LogFireAxe, Warning, TEXT("[FireAxe] HIT %s! Speed:%.1f Damage:%.1f"),
-            *OtherActor->GetName(), SwingSpeed, DamageDealt);
+    //  ӵ üũ
+    if (ImpactSpeed < MinSwingSpeed)
+    {
+        UE_LOG(LogFireAxe, Verbose, TEXT("[FireAxe] Swing too slow: %.1f < %.1f"), ImpactSpeed, MinSwingSpeed);
+        return false;
     }
+
+    //  
+    const float DamageDealt = CalculateAndApplyDamage(HitActor, HitResult, ImpactSpeed);
+
+    if (DamageDealt <= 0.f)
+        return false;
+
+    LastHitTime = HitTime;
+    LastHitActor = HitActor;
+    LastHitActorTime = HitTime;
+
+    // ̺Ʈ
+    OnAxeHit.Broadcast(HitActor, HitResult.ImpactPoint, DamageDealt);
+
+    // ƽ
+    const float HapticScale = FMath::Clamp(DamageDealt / (BaseDamage * MaxSpeedDamageMultiplier), 0.3f, 1.f);
+    PlayHitHaptic(HitHapticIntensity * HapticScale, HitHapticDuration);
+
+    UE_LOG(LogFireAxe, Warning, TEXT("[FireAxe] HIT %s! Speed:%.1f Damage:%.1f"),
+        *HitActor->GetName(), ImpactSpeed, DamageDealt);
+
+    return true;
 }
 
-float AFireAxeActor::CalculateAndApplyDamage(AActor* HitActor, const FHitResult& HitResult)
+float AFireAxeActor::CalculateAndApplyDamage(AActor* HitActor, const FHitResult& HitResult, float ImpactSpeed)
 {
-    //   
-    const float SwingIntensity = GetSwingIntensity();
+    //    (Ÿ  ӵ )
+    const float SwingIntensity = GetIntensityForSpeed(ImpactSpeed);
     const float SpeedMultiplier = FMath::Lerp(1.f, MaxSpeedDamageMultiplier, SwingIntensity);
     const float CalculatedDamage = BaseDamage * SpeedMultiplier;
 
@@ -229,15 +431,38 @@ void AFireAxeActor::PlayHitEffects(const FHitResult& HitResult, EBreakableMateri
     }
 }
 
+bool AFireAxeActor::GetHoldingHand(EControllerHand& OutHand) const
+{
+    // /    ҵ  θ   Ʈѷ Ʈŷ ҽ Ǵ
+    for (const USceneComponent* Parent = GetRootComponent() ? GetRootComponent()->GetAttachParent() : nullptr;
+        Parent; Parent = Parent->GetAttachParent())
+    {
+        if (const UMotionControllerComponent* Controller = Cast<UMotionControllerComponent>(Parent))
+        {
+            OutHand = (Controller->MotionSource == FName(TEXT("Left"))) ? EControllerHand::Left : EControllerHand::Right;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AFireAxeActor::PlayHitHaptic_Implementation(float Intensity, float Duration)
+{
+    EControllerHand Hand;
+    if (!GetHoldingHand(Hand))
+        return;
+
+    if (UVRHapticsSubsystem* Haptics = UVRHapticsSubsystem::Get(this))
+    {
+        Haptics->PlayPulse(TEXT("Axe.Hit"), Hand, EVRHapticPriority::Impact,
+            HitHapticFrequency, Intensity, Duration);
+    }
+}
+
 void AFireAxeActor::SimulateSwing(float Speed)
 {
     // ׽Ʈ  ùķ̼
     CurrentVelocity = GetActorForwardVector() * Speed;
-    VelocitySamples.Empty();
-    for (int32 i = 0; i < VelocitySampleCount; i++)
-    {
-        VelocitySamples.Add(CurrentVelocity);
-    }
 
     UE_LOG(LogFireAxe, Warning, TEXT("[FireAxe] Simulated swing at speed %.1f"), Speed);
 
@@ -249,11 +474,18 @@ void AFireAxeActor::SimulateSwing(float Speed)
     FCollisionQueryParams Params;
     Params.AddIgnoredActor(this);
 
+    TArray<AActor*, TInlineAllocator<8>> Holders;
+    GetHolderActors(Holders);
+    for (AActor* Holder : Holders)
+    {
+        Params.AddIgnoredActor(Holder);
+    }
+
     if (GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_WorldDynamic, Params))
     {
         if (IsValid(HitResult.GetActor()))
         {
-            const float DamageDealt = CalculateAndApplyDamage(HitResult.GetActor(), HitResult);
+            const float DamageDealt = CalculateAndApplyDamage(HitResult.GetActor(), HitResult, Speed);
             OnAxeHit.Broadcast(HitResult.GetActor(), HitResult.ImpactPoint, DamageDealt);
         }
     }
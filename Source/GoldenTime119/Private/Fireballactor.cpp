@@ -1,7 +1,11 @@
 // ============================ FireballActor.cpp ============================
 #include "FireballActor.h"
 #include "CombustibleComponent.h"
+#include "GameplaySpatialIndexSubsystem.h"
+#include "RoomActor.h"
+#include "DoorActor.h"
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
@@ -16,8 +20,10 @@ AFireballActor::AFireballActor()
 
     DamageSphere = CreateDefaultSubobject<USphereComponent>(TEXT("DamageSphere"));
     DamageSphere->SetupAttachment(Root);
-    DamageSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-    DamageSphere->SetCollisionResponseToAllChannels(ECR_Overlap);
+    // 판정은 UGameplaySpatialIndexSubsystem으로 한다. 구체는 반경 표시용으로만 남김
+    // (커지는 오버랩 구체는 주변 정적 지오메트리 수만큼 매 틱 비용이 든다)
+    DamageSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    DamageSphere->SetGenerateOverlapEvents(false);
     DamageSphere->SetSphereRadius(100.f);
 
     FireballPSC = CreateDefaultSubobject<UParticleSystemComponent>(TEXT("FireballPSC"));
@@ -44,6 +50,12 @@ void AFireballActor::InitFireball(float InRadius, float InDuration, float InBlas
 
     UE_LOG(LogFireball, Warning, TEXT("[Fireball] Init: Radius=%.1f Duration=%.1f Blast=%.1f"),
         MaxRadius, TotalDuration, BlastIntensity);
+
+    // 스폰 후에 불렸으면 BeginPlay가 기본 반경으로 모은 후보를 실제 도달 범위로 다시 모음
+    if (HasActorBegunPlay())
+    {
+        GatherCandidates();
+    }
 }
 
 void AFireballActor::BeginPlay()
@@ -71,6 +83,8 @@ void AFireballActor::BeginPlay()
         RoarAudio->Play();
     }
 
+    GatherCandidates();
+
     ApplyBlastWave();
     TryIgniteNearby();
 
@@ -104,8 +118,11 @@ void AFireballActor::Tick(float DeltaTime)
     ApplyRadiationDamage(DeltaTime);
     UpdateVFX();
 
-#if WITH_EDITOR
-    DrawDebugSphere(GetWorld(), GetActorLocation(), CurrentRadius, 24, FColor::Orange, false, -1.f, 0, 3.f);
+#if ENABLE_DRAW_DEBUG
+    if (bDebugDraw)
+    {
+        DrawDebugSphere(GetWorld(), GetActorLocation(), CurrentRadius, 24, FColor::Orange, false, -1.f, 0, 3.f);
+    }
 #endif
 }
 
@@ -154,44 +171,255 @@ void AFireballActor::UpdateDissipating(float DeltaTime)
     }
 }
 
+float AFireballActor::GetMaxReach() const
+{
+    // 수명 동안 가장 넓은 판정 범위 + 상승 거리 (중심이 위로 이동하므로)
+    const float RadiationReach = MaxRadius * 1.1f * RadiationDamageRangeMultiplier;
+    const float BlastReach = MaxRadius * BlastDamageRangeMultiplier;
+    const float IgniteReach = MaxRadius * 1.5f;
+    const float RiseReach = RiseSpeed * TotalDuration;
+
+    return FMath::Max3(RadiationReach, BlastReach, IgniteReach) + RiseReach;
+}
+
+void AFireballActor::GatherCandidates()
+{
+    CandidatePawns.Reset();
+    CandidateCombustibles.Reset();
+
+    UGameplaySpatialIndexSubsystem* Index = UGameplaySpatialIndexSubsystem::Get(this);
+    if (!Index)
+    {
+        UE_LOG(LogFireball, Warning, TEXT("[Fireball] No spatial index; fireball will not damage or ignite anything"));
+        return;
+    }
+
+    const float Reach = GetMaxReach();
+
+    TArray<APawn*> Pawns;
+    Index->QueryPawns(StartLocation, Reach, Pawns);
+    CandidatePawns.Append(Pawns);
+
+    TArray<UCombustibleComponent*> Combs;
+    Index->QueryCombustibles(StartLocation, Reach, Combs);
+    CandidateCombustibles.Append(Combs);
+
+    UE_LOG(LogFireball, Log, TEXT("[Fireball] Candidates: Pawns=%d Combustibles=%d (Reach=%.0f)"),
+        CandidatePawns.Num(), CandidateCombustibles.Num(), Reach);
+}
+
 void AFireballActor::ApplyBlastWave()
 {
+    const FVector Origin = GetActorLocation();
     const float BlastRange = MaxRadius * BlastDamageRangeMultiplier;
 
-    TArray<FOverlapResult> Overlaps;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(this);
+    // 방 목록은 공간 인덱스가 들고 있음 (폭발마다 월드 액터를 훑지 않음)
+    UGameplaySpatialIndexSubsystem* Index = UGameplaySpatialIndexSubsystem::Get(this);
 
-    GetWorld()->OverlapMultiByChannel(
-        Overlaps,
-        GetActorLocation(),
-        FQuat::Identity,
-        ECC_WorldDynamic,
-        FCollisionShape::MakeSphere(BlastRange),
-        Params
-    );
+    TArray<ARoomActor*> Rooms;
+    ARoomActor* OriginRoom = nullptr;
 
-    for (const FOverlapResult& Overlap : Overlaps)
+    if (Index)
     {
-        AActor* HitActor = Overlap.GetActor();
-        if (!IsValid(HitActor)) continue;
-        if (DamagedActors.Contains(HitActor)) continue;
+        OriginRoom = Index->FindRoomContaining(Origin);
+        if (IsValid(OriginRoom))
+        {
+            Index->GetRooms(Rooms);
+        }
+    }
+
+    if (IsValid(OriginRoom))
+    {
+        PropagateBlastThroughRooms(OriginRoom, Rooms, Origin, BaseBlastDamage * BlastIntensity);
+    }
+    else
+    {
+        // 방 밖(실외) 폭발: 막는 벽이 없으므로 구형 감쇠
+        ApplySphericalBlast(Origin, BlastRange);
+    }
+
+    UE_LOG(LogFireball, Warning, TEXT("[Fireball] BlastWave applied to %d actors"), DamagedActors.Num());
+}
+
+float AFireballActor::BlastFalloff(float Dist) const
+{
+    return 1.f / (1.f + Dist / FMath::Max(BlastAttenuationLength, 1.f));
+}
+
+void AFireballActor::GatherBlastTargets(TArray<AActor*>& OutTargets) const
+{
+    for (const TWeakObjectPtr<APawn>& Pawn : CandidatePawns)
+    {
+        if (APawn* P = Pawn.Get())
+        {
+            OutTargets.AddUnique(P);
+        }
+    }
+    for (const TWeakObjectPtr<UCombustibleComponent>& Comb : CandidateCombustibles)
+    {
+        if (AActor* Owner = Comb.IsValid() ? Comb->GetOwner() : nullptr)
+        {
+            OutTargets.AddUnique(Owner);
+        }
+    }
+}
+
+void AFireballActor::ApplyBlastDamageTo(AActor* HitActor, float Damage)
+{
+    if (!IsValid(HitActor) || HitActor == this) return;
+    if (DamagedActors.Contains(HitActor)) return;
+    if (Damage <= 0.f) return;
+
+    UGameplayStatics::ApplyDamage(HitActor, Damage, nullptr, this, nullptr);
+    DamagedActors.Add(HitActor);
+    OnFireballDamage.Broadcast(HitActor, Damage);
+
+    UE_LOG(LogFireball, Log, TEXT("[Fireball] BlastDamage to %s: %.1f"), *GetNameSafe(HitActor), Damage);
+}
+
+void AFireballActor::ApplySphericalBlast(const FVector& Origin, float BlastRange)
+{
+    TArray<AActor*> Targets;
+    GatherBlastTargets(Targets);
+
+    for (AActor* HitActor : Targets)
+    {
+        const float Dist = FVector::Dist(Origin, HitActor->GetActorLocation());
+        if (Dist > BlastRange) continue;
 
-        const float Dist = FVector::Dist(GetActorLocation(), HitActor->GetActorLocation());
         const float DistAlpha = 1.f - FMath::Clamp(Dist / BlastRange, 0.f, 1.f);
-        const float Damage = BaseBlastDamage * BlastIntensity * DistAlpha;
+        ApplyBlastDamageTo(HitActor, BaseBlastDamage * BlastIntensity * DistAlpha);
+    }
+}
+
+namespace
+{
+    struct FBlastFront
+    {
+        ARoomActor* Room = nullptr;
+        FVector Entry = FVector::ZeroVector;   // 과압이 방에 들어온 지점 (원점 또는 문)
+        float Pressure = 0.f;
+        int32 Hops = 0;
+    };
+
+    struct FBlastRoomHit
+    {
+        FVector Entry = FVector::ZeroVector;
+        float Pressure = 0.f;
+    };
+
+    struct FStrongerFront
+    {
+        bool operator()(const FBlastFront& A, const FBlastFront& B) const { return A.Pressure > B.Pressure; }
+    };
+}
 
-        if (Damage > 0.f)
+void AFireballActor::PropagateBlastThroughRooms(ARoomActor* OriginRoom, const TArray<ARoomActor*>& AllRooms,
+    const FVector& Origin, float SourcePressure)
+{
+    // 가장 센 전선부터 처리(최대 압력 경로). 감쇠 계수 <= 1이므로 각 방/문은 첫 도달이 가장 세다
+    TMap<ARoomActor*, FBlastRoomHit> Reached;
+    TSet<ADoorActor*> DoorsHit;
+
+    FBlastRoomHit Outside;   // 밖으로 새어 나간 가장 센 과압
+
+    TArray<FBlastFront> Open;
+    Open.HeapPush(FBlastFront{ OriginRoom, Origin, SourcePressure, 0 }, FStrongerFront());
+
+    while (Open.Num() > 0)
+    {
+        FBlastFront Front;
+        Open.HeapPop(Front, FStrongerFront(), false);
+
+        if (Reached.Contains(Front.Room)) continue;
+
+        const TArray<TWeakObjectPtr<ADoorActor>>& Doors = Front.Room->GetDoors();
+
+        // 밖으로 열린 문/구멍이 많을수록 방 안 압력이 빨리 빠진다
+        float OutsideVent = 0.f;
+        for (const TWeakObjectPtr<ADoorActor>& W : Doors)
         {
-            UGameplayStatics::ApplyDamage(HitActor, Damage, nullptr, this, nullptr);
-            DamagedActors.Add(HitActor);
-            OnFireballDamage.Broadcast(HitActor, Damage);
+            const ADoorActor* D = W.Get();
+            if (IsValid(D) && D->IsOutsideConnectionFor(Front.Room))
+            {
+                OutsideVent += D->ComputeVent01();
+            }
+        }
+        Front.Pressure /= (1.f + OutsideVentRelief * OutsideVent);
+
+        Reached.Add(Front.Room, FBlastRoomHit{ Front.Entry, Front.Pressure });
+
+        UE_LOG(LogFireball, Log, TEXT("[Fireball] Blast reached %s: %.1f (hops=%d)"),
+            *GetNameSafe(Front.Room), Front.Pressure, Front.Hops);
+
+        if (Front.Hops >= MaxBlastRoomHops) continue;
 
-            UE_LOG(LogFireball, Log, TEXT("[Fireball] BlastDamage to %s: %.1f"), *GetNameSafe(HitActor), Damage);
+        for (const TWeakObjectPtr<ADoorActor>& W : Doors)
+        {
+            ADoorActor* Door = W.Get();
+            if (!IsValid(Door) || DoorsHit.Contains(Door)) continue;
+
+            const FVector DoorLoc = Door->GetActorLocation();
+            const float AtDoor = Front.Pressure * BlastFalloff(FVector::Dist(Front.Entry, DoorLoc));
+            if (AtDoor < MinBlastPressure) continue;
+
+            DoorsHit.Add(Door);
+
+            // 문 파손/개방 처리 후 반대편으로 넘어가는 비율
+            const float Through = AtDoor * Door->ReceiveBlastOverpressure(AtDoor, Front.Entry);
+            if (Through < MinBlastPressure) continue;
+
+            if (Door->IsOutsideConnectionFor(Front.Room))
+            {
+                if (Through > Outside.Pressure)
+                {
+                    Outside = FBlastRoomHit{ DoorLoc, Through };
+                }
+                continue;
+            }
+
+            ARoomActor* Next = Door->GetOtherRoom(Front.Room);
+            if (IsValid(Next) && !Reached.Contains(Next))
+            {
+                Open.HeapPush(FBlastFront{ Next, DoorLoc, Through, Front.Hops + 1 }, FStrongerFront());
+            }
         }
     }
 
-    UE_LOG(LogFireball, Warning, TEXT("[Fireball] BlastWave applied to %d actors"), DamagedActors.Num());
+    // 대상별로 자기가 있는 방의 과압을 받는다. 도달하지 못한 방 안이면 벽이 막아 줌
+    TArray<AActor*> Targets;
+    GatherBlastTargets(Targets);
+
+    for (AActor* HitActor : Targets)
+    {
+        const FVector Loc = HitActor->GetActorLocation();
+
+        const FBlastRoomHit* Hit = nullptr;
+        bool bInsideAnyRoom = false;
+
+        for (ARoomActor* Room : AllRooms)
+        {
+            if (!IsValid(Room) || !Room->ContainsPoint(Loc)) continue;
+
+            bInsideAnyRoom = true;
+            Hit = Reached.Find(Room);
+            if (Hit) break;
+        }
+
+        if (!Hit && !bInsideAnyRoom && Outside.Pressure > 0.f)
+        {
+            Hit = &Outside;
+        }
+        if (!Hit) continue;
+
+        const float Damage = Hit->Pressure * BlastFalloff(FVector::Dist(Hit->Entry, Loc));
+        if (Damage < 1.f) continue;
+
+        ApplyBlastDamageTo(HitActor, Damage);
+    }
+
+    UE_LOG(LogFireball, Warning, TEXT("[Fireball] Blast propagated through %d rooms, %d doors"),
+        Reached.Num(), DoorsHit.Num());
 }
 
 void AFireballActor::ApplyRadiationDamage(float DeltaTime)
@@ -200,19 +428,11 @@ void AFireballActor::ApplyRadiationDamage(float DeltaTime)
         return;
 
     const float RadRange = CurrentRadius * RadiationDamageRangeMultiplier;
+    if (RadRange <= KINDA_SMALL_NUMBER)
+        return;
 
-    TArray<FOverlapResult> Overlaps;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(this);
-
-    GetWorld()->OverlapMultiByChannel(
-        Overlaps,
-        GetActorLocation(),
-        FQuat::Identity,
-        ECC_Pawn,
-        FCollisionShape::MakeSphere(RadRange),
-        Params
-    );
+    const FVector Center = GetActorLocation();
+    const float RadRangeSq = FMath::Square(RadRange);
 
     float RadiationIntensity = 1.f;
     if (Phase == EFireballPhase::Expanding)
@@ -220,12 +440,15 @@ void AFireballActor::ApplyRadiationDamage(float DeltaTime)
     else if (Phase == EFireballPhase::Dissipating)
         RadiationIntensity = FMath::Lerp(1.f, 0.2f, (ElapsedTime - RisingEndTime) / (TotalDuration - RisingEndTime));
 
-    for (const FOverlapResult& Overlap : Overlaps)
+    for (const TWeakObjectPtr<APawn>& Pawn : CandidatePawns)
     {
-        AActor* HitActor = Overlap.GetActor();
+        APawn* HitActor = Pawn.Get();
         if (!IsValid(HitActor)) continue;
 
-        const float Dist = FVector::Dist(GetActorLocation(), HitActor->GetActorLocation());
+        const float DistSq = FVector::DistSquared(Center, HitActor->GetActorLocation());
+        if (DistSq > RadRangeSq) continue;
+
+        const float Dist = FMath::Sqrt(DistSq);
         const float DistAlpha = 1.f - FMath::Clamp(Dist / RadRange, 0.f, 1.f);
         const float DamagePerSec = BaseRadiationDamage * RadiationIntensity * DistAlpha;
         const float Damage = DamagePerSec * DeltaTime;
@@ -240,32 +463,22 @@ void AFireballActor::ApplyRadiationDamage(float DeltaTime)
 void AFireballActor::TryIgniteNearby()
 {
     const float IgniteRange = MaxRadius * 1.5f;
-
-    TArray<FOverlapResult> Overlaps;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(this);
-
-    GetWorld()->OverlapMultiByChannel(
-        Overlaps,
-        GetActorLocation(),
-        FQuat::Identity,
-        ECC_WorldDynamic,
-        FCollisionShape::MakeSphere(IgniteRange),
-        Params
-    );
+    const FVector Center = GetActorLocation();
 
     int32 IgnitedCount = 0;
 
-    for (const FOverlapResult& Overlap : Overlaps)
+    for (const TWeakObjectPtr<UCombustibleComponent>& CombPtr : CandidateCombustibles)
     {
-        AActor* HitActor = Overlap.GetActor();
-        if (!IsValid(HitActor)) continue;
-
-        UCombustibleComponent* Comb = HitActor->FindComponentByClass<UCombustibleComponent>();
+        UCombustibleComponent* Comb = CombPtr.Get();
         if (!IsValid(Comb)) continue;
         if (Comb->IsBurning()) continue;
 
-        const float Dist = FVector::Dist(GetActorLocation(), HitActor->GetActorLocation());
+        AActor* HitActor = Comb->GetOwner();
+        if (!IsValid(HitActor)) continue;
+
+        const float Dist = FVector::Dist(Center, HitActor->GetActorLocation());
+        if (Dist > IgniteRange) continue;
+
         const float DistAlpha = 1.f - FMath::Clamp(Dist / IgniteRange, 0.f, 1.f);
         const float ChanceThisActor = IgnitionChance * DistAlpha;
 
@@ -15,8 +15,8 @@ DEFINE_LOG_CATEGORY_STATIC(LogGameManager, Log, All);
 
 AGameManager::AGameManager()
 {
-    PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.TickInterval = 0.1f; // 0.1ʸ Ʈ
+    // ǥ/Ż/̼ Ϸ ̺Ʈ ϹǷ ƽ 
+    PrimaryActorTick.bCanEverTick = false;
 }
 
 void AGameManager::BeginPlay()
@@ -43,31 +43,20 @@ void AGameManager::BeginPlay()
     }
 }
 
-void AGameManager::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    if (!bIsInitialized) return;
-
-    //     Ʈ
-    if (CurrentGameState == EGameState::InProgress)
-    {
-        //  ǥ Ʈ
-        UpdateAllObjectives(DeltaTime);
-
-        // ÷̾ Ż üũ
-        CheckPlayerVitals(DeltaTime);
-
-        // ̼ Ϸ/ üũ
-        CheckMissionCompletion();
-    }
-}
-
 void AGameManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // Ÿ̸ 
     GetWorld()->GetTimerManager().ClearTimer(FireStartTimerHandle);
 
+    // Ż ̺Ʈ 
+    if (IsValid(PlayerCharacter))
+    {
+        if (UVitalComponent* Vital = PlayerCharacter->FindComponentByClass<UVitalComponent>())
+        {
+            Vital->OnVitals01Changed.RemoveDynamic(this, &AGameManager::OnPlayerVitalsChanged);
+        }
+    }
+
     Super::EndPlay(EndPlayReason);
 }
 
@@ -551,17 +540,16 @@ float AGameManager::GetPlayerTemperature() const
     return Vital->GetTemp01();
 }
 
-void AGameManager::CheckPlayerVitals(float DeltaTime)
+void AGameManager::OnPlayerVitalsChanged(float Hp01, float Temp01, float O201)
 {
-    if (!IsValid(PlayerCharacter)) return;
-
-    UVitalComponent* Vital = PlayerCharacter->FindComponentByClass<UVitalComponent>();
-    if (!IsValid(Vital)) return;
+    if (!bIsInitialized) return;
+    if (CurrentGameState != EGameState::InProgress) return;
 
-    const float HP = Vital->GetHp01();
-    const float O2 = Vital->GetO201();
-    const float Temp = Vital->GetTemp01();
+    CheckPlayerVitals(Hp01, Temp01, O201);
+}
 
+void AGameManager::CheckPlayerVitals(float HP, float Temp, float O2)
+{
     // ÷̾  üũ
     if (HP <= 0.f)
     {
@@ -578,10 +566,10 @@ void AGameManager::CheckPlayerVitals(float DeltaTime)
         return;
     }
 
-    // Ż  ٿ 
-    if (VitalWarningCooldown > 0.f)
+    // Ż  ٿ
+    const float Now = GetWorld()->GetTimeSeconds();
+    if (Now < NextVitalWarningTime)
     {
-        VitalWarningCooldown -= DeltaTime;
         return;
     }
 
@@ -589,28 +577,28 @@ void AGameManager::CheckPlayerVitals(float DeltaTime)
     if (HP < VitalCriticalThreshold)
     {
         OnVitalWarning.Broadcast(TEXT("Health"), HP);
-        VitalWarningCooldown = VitalWarningInterval;
+        NextVitalWarningTime = Now + VitalWarningInterval;
     }
     else if (O2 < VitalCriticalThreshold)
     {
         OnVitalWarning.Broadcast(TEXT("Oxygen"), O2);
-        VitalWarningCooldown = VitalWarningInterval;
+        NextVitalWarningTime = Now + VitalWarningInterval;
     }
     else if (Temp > 0.7f) // 70% ̻  ü
     {
         OnVitalWarning.Broadcast(TEXT("Temperature"), Temp);
-        VitalWarningCooldown = VitalWarningInterval;
+        NextVitalWarningTime = Now + VitalWarningInterval;
     }
     //   üũ
     else if (HP < VitalWarningThreshold)
     {
         OnVitalWarning.Broadcast(TEXT("Health"), HP);
-        VitalWarningCooldown = VitalWarningInterval * 2.f;
+        NextVitalWarningTime = Now + VitalWarningInterval * 2.f;
     }
     else if (O2 < VitalWarningThreshold)
     {
         OnVitalWarning.Broadcast(TEXT("Oxygen"), O2);
-        VitalWarningCooldown = VitalWarningInterval * 2.f;
+        NextVitalWarningTime = Now + VitalWarningInterval * 2.f;
     }
 }
 
@@ -654,7 +642,13 @@ void AGameManager::BindRoomActorEvents(ARoomActor* Room)
 
 void AGameManager::BindPlayerEvents()
 {
-    // ÷̾ Ż ̺Ʈ CheckPlayerVitals   üũ
+    if (!IsValid(PlayerCharacter)) return;
+
+    // Ż  ٲ   (/ üũ)
+    if (UVitalComponent* Vital = PlayerCharacter->FindComponentByClass<UVitalComponent>())
+    {
+        Vital->OnVitals01Changed.AddUniqueDynamic(this, &AGameManager::OnPlayerVitalsChanged);
+    }
 }
 
 void AGameManager::OnObjectiveProgressChanged(UMissionObjective* Objective, float Progress01, FString ProgressText)
@@ -707,22 +701,17 @@ void AGameManager::OnObjectiveStatusChanged(UMissionObjective* Objective, EMissi
             }
         }
     }
+
+    // ǥ ° ٲ  ̼ Ϸ üũ
+    CheckMissionCompletion();
 }
 
 void AGameManager::OnFireExtinguished(AFireActor* Fire)
 {
     if (!IsValid(Fire)) return;
 
+    // ǥ  ̺Ʈ   (⼭ ٽ ˸ ߺ )
     UE_LOG(LogGameManager, Log, TEXT("[GameManager] Fire Extinguished: %s"), *Fire->GetName());
-
-    //  ǥ ˸
-    for (UMissionObjective* Obj : ActiveObjectives)
-    {
-        if (IsValid(Obj))
-        {
-            Obj->NotifyFireExtinguished();
-        }
-    }
 }
 
 void AGameManager::OnFireSpawned(AFireActor* Fire)
@@ -737,16 +726,8 @@ void AGameManager::OnFireSpawned(AFireActor* Fire)
 
 void AGameManager::OnBackdraftOccurred()
 {
+    // ǥ  OnBackdraft  
     UE_LOG(LogGameManager, Warning, TEXT("[GameManager] Backdraft Occurred!"));
-
-    //  ǥ ˸
-    for (UMissionObjective* Obj : ActiveObjectives)
-    {
-        if (IsValid(Obj))
-        {
-            Obj->NotifyBackdraftOccurred();
-        }
-    }
 }
 
 void AGameManager::CheckMissionCompletion()
@@ -775,17 +756,6 @@ void AGameManager::CheckMissionCompletion()
     }
 }
 
-void AGameManager::UpdateAllObjectives(float DeltaTime)
-{
-    for (UMissionObjective* Obj : ActiveObjectives)
-    {
-        if (IsValid(Obj) && Obj->IsInProgress())
-        {
-            Obj->UpdateProgress(DeltaTime, GetWorld());
-        }
-    }
-}
-
 void AGameManager::FindPlayerCharacter()
 {
     // VR Template : BP_VRPawn "Player" ±׸ 
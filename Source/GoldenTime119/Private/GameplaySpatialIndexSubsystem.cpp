@@ -0,0 +1,337 @@
+// ============================ GameplaySpatialIndexSubsystem.cpp ============================
+#include "GameplaySpatialIndexSubsystem.h"
+#include "CombustibleComponent.h"
+#include "RoomActor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "Components/SceneComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpatialIndex, Log, All);
+
+UGameplaySpatialIndexSubsystem* UGameplaySpatialIndexSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UGameplaySpatialIndexSubsystem>() : nullptr;
+}
+
+bool UGameplaySpatialIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGameplaySpatialIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UWorld* World = GetWorld())
+    {
+        ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+            FOnActorSpawned::FDelegate::CreateUObject(this, &UGameplaySpatialIndexSubsystem::HandleActorSpawned));
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+
+    Combustibles.Reset();
+    CombIndex.Reset();
+    Cells.Reset();
+    MovableEntries.Reset();
+    Pawns.Reset();
+    Rooms.Reset();
+
+    Super::Deinitialize();
+}
+
+void UGameplaySpatialIndexSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Pawns and rooms placed in the level never go through the spawn handler
+    for (TActorIterator<APawn> It(&InWorld); It; ++It)
+    {
+        AddPawn(*It);
+    }
+    for (TActorIterator<ARoomActor> It(&InWorld); It; ++It)
+    {
+        AddRoom(*It);
+    }
+
+    UE_LOG(LogSpatialIndex, Log, TEXT("[SpatialIndex] BeginPlay: %d combustibles in %d cells, %d pawns, %d rooms"),
+        Combustibles.Num(), Cells.Num(), Pawns.Num(), Rooms.Num());
+}
+
+// ===== Pawns =====
+
+void UGameplaySpatialIndexSubsystem::HandleActorSpawned(AActor* Actor)
+{
+    if (APawn* Pawn = Cast<APawn>(Actor))
+    {
+        AddPawn(Pawn);
+    }
+    else if (ARoomActor* Room = Cast<ARoomActor>(Actor))
+    {
+        AddRoom(Room);
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::AddPawn(APawn* Pawn)
+{
+    if (!IsValid(Pawn)) return;
+
+    for (const TWeakObjectPtr<APawn>& Existing : Pawns)
+    {
+        if (Existing.Get() == Pawn) return;
+    }
+    Pawns.Add(Pawn);
+}
+
+void UGameplaySpatialIndexSubsystem::QueryPawns(const FVector& Center, float Radius, TArray<APawn*>& OutPawns)
+{
+    const float RadiusSq = FMath::Square(Radius);
+
+    for (int32 i = Pawns.Num() - 1; i >= 0; --i)
+    {
+        APawn* Pawn = Pawns[i].Get();
+        if (!IsValid(Pawn))
+        {
+            Pawns.RemoveAtSwap(i, 1, false);
+            continue;
+        }
+
+        if (FVector::DistSquared(Center, Pawn->GetActorLocation()) <= RadiusSq)
+        {
+            OutPawns.Add(Pawn);
+        }
+    }
+}
+
+// ===== Rooms =====
+
+void UGameplaySpatialIndexSubsystem::AddRoom(ARoomActor* Room)
+{
+    if (!IsValid(Room)) return;
+
+    for (const TWeakObjectPtr<ARoomActor>& Existing : Rooms)
+    {
+        if (Existing.Get() == Room) return;
+    }
+    Rooms.Add(Room);
+}
+
+void UGameplaySpatialIndexSubsystem::PruneRooms()
+{
+    for (int32 i = Rooms.Num() - 1; i >= 0; --i)
+    {
+        if (!Rooms[i].IsValid())
+        {
+            Rooms.RemoveAtSwap(i, 1, false);
+        }
+    }
+}
+
+ARoomActor* UGameplaySpatialIndexSubsystem::FindRoomContaining(const FVector& Point)
+{
+    PruneRooms();
+
+    for (const TWeakObjectPtr<ARoomActor>& Weak : Rooms)
+    {
+        ARoomActor* Room = Weak.Get();
+        if (IsValid(Room) && Room->ContainsPoint(Point))
+        {
+            return Room;
+        }
+    }
+    return nullptr;
+}
+
+void UGameplaySpatialIndexSubsystem::GetRooms(TArray<ARoomActor*>& OutRooms)
+{
+    PruneRooms();
+
+    OutRooms.Reserve(OutRooms.Num() + Rooms.Num());
+    for (const TWeakObjectPtr<ARoomActor>& Weak : Rooms)
+    {
+        if (ARoomActor* Room = Weak.Get())
+        {
+            OutRooms.Add(Room);
+        }
+    }
+}
+
+// ===== Combustibles =====
+
+FIntPoint UGameplaySpatialIndexSubsystem::CellOf(const FVector& Location) const
+{
+    const float Inv = 1.f / FMath::Max(CellSize, 1.f);
+    return FIntPoint(FMath::FloorToInt(Location.X * Inv), FMath::FloorToInt(Location.Y * Inv));
+}
+
+void UGameplaySpatialIndexSubsystem::AddToCell(int32 EntryIndex)
+{
+    FCombustibleEntry& Entry = Combustibles[EntryIndex];
+    Entry.Cell = CellOf(Entry.Location);
+    Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+}
+
+void UGameplaySpatialIndexSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+    const FIntPoint Cell = Combustibles[EntryIndex].Cell;
+    if (TArray<int32>* Bucket = Cells.Find(Cell))
+    {
+        Bucket->RemoveSingleSwap(EntryIndex, false);
+        if (Bucket->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::RegisterCombustible(UCombustibleComponent* Comb)
+{
+    if (!IsValid(Comb) || CombIndex.Contains(Comb)) return;
+
+    const AActor* Owner = Comb->GetOwner();
+    if (!IsValid(Owner)) return;
+
+    const USceneComponent* RootComp = Owner->GetRootComponent();
+
+    const int32 Index = Combustibles.AddDefaulted();
+    FCombustibleEntry& Entry = Combustibles[Index];
+    Entry.Comb = Comb;
+    Entry.Key = Comb;
+    Entry.Location = Owner->GetActorLocation();
+    Entry.bMovable = !RootComp || RootComp->Mobility == EComponentMobility::Movable;
+
+    CombIndex.Add(Comb, Index);
+    AddToCell(Index);
+
+    if (Entry.bMovable)
+    {
+        MovableEntries.Add(Index);
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::UnregisterCombustible(UCombustibleComponent* Comb)
+{
+    if (!Comb) return;
+
+    if (const int32* Found = CombIndex.Find(Comb))
+    {
+        RemoveCombustibleAt(*Found);
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::RemoveCombustibleAt(int32 EntryIndex)
+{
+    RemoveFromCell(EntryIndex);
+    MovableEntries.RemoveSingleSwap(EntryIndex, false);
+    CombIndex.Remove(Combustibles[EntryIndex].Key);
+
+    // Swap the last entry into the hole and patch every reference to it
+    const int32 LastIndex = Combustibles.Num() - 1;
+    if (EntryIndex != LastIndex)
+    {
+        FCombustibleEntry& Last = Combustibles[LastIndex];
+
+        if (TArray<int32>* Bucket = Cells.Find(Last.Cell))
+        {
+            if (int32* Slot = Bucket->FindByKey(LastIndex))
+            {
+                *Slot = EntryIndex;
+            }
+        }
+        if (Last.bMovable)
+        {
+            if (int32* Slot = MovableEntries.FindByKey(LastIndex))
+            {
+                *Slot = EntryIndex;
+            }
+        }
+        CombIndex.Add(Last.Key, EntryIndex);
+    }
+
+    Combustibles.RemoveAtSwap(EntryIndex, 1, false);
+}
+
+void UGameplaySpatialIndexSubsystem::RefreshMovableCombustibles()
+{
+    const float RebucketSq = FMath::Square(RebucketDistance);
+
+    for (int32 i = MovableEntries.Num() - 1; i >= 0; --i)
+    {
+        const int32 EntryIndex = MovableEntries[i];
+        FCombustibleEntry& Entry = Combustibles[EntryIndex];
+
+        const UCombustibleComponent* Comb = Entry.Comb.Get();
+        const AActor* Owner = Comb ? Comb->GetOwner() : nullptr;
+        if (!IsValid(Owner)) continue;
+
+        const FVector Now = Owner->GetActorLocation();
+        if (FVector::DistSquared(Now, Entry.Location) < RebucketSq) continue;
+
+        Entry.Location = Now;
+        if (CellOf(Now) != Entry.Cell)
+        {
+            RemoveFromCell(EntryIndex);
+            AddToCell(EntryIndex);
+        }
+    }
+}
+
+void UGameplaySpatialIndexSubsystem::QueryCombustibles(const FVector& Center, float Radius, TArray<UCombustibleComponent*>& OutCombustibles)
+{
+    if (Combustibles.Num() == 0) return;
+
+    RefreshMovableCombustibles();
+
+    const float RadiusSq = FMath::Square(Radius);
+
+    auto TestEntry = [&](const FCombustibleEntry& Entry)
+    {
+        UCombustibleComponent* Comb = Entry.Comb.Get();
+        if (!IsValid(Comb)) return;
+
+        const AActor* Owner = Comb->GetOwner();
+        if (!IsValid(Owner)) return;
+
+        if (FVector::DistSquared(Center, Owner->GetActorLocation()) <= RadiusSq)
+        {
+            OutCombustibles.Add(Comb);
+        }
+    };
+
+    const FIntPoint MinCell = CellOf(Center - FVector(Radius));
+    const FIntPoint MaxCell = CellOf(Center + FVector(Radius));
+    const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+    // Huge radius over a sparse grid: walking the entries is cheaper than walking empty cells
+    if (NumCells > Combustibles.Num())
+    {
+        for (const FCombustibleEntry& Entry : Combustibles)
+        {
+            TestEntry(Entry);
+        }
+        return;
+    }
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            if (const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y)))
+            {
+                for (const int32 EntryIndex : *Bucket)
+                {
+                    TestEntry(Combustibles[EntryIndex]);
+                }
+            }
+        }
+    }
+}
@@ -13,6 +13,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogGasTank, Log, All);
 AGasTankActor::AGasTankActor()
 {
     PrimaryActorTick.bCanEverTick = true; //  ġ Ʈ
+    PrimaryActorTick.bStartWithTickEnabled = false; //  ۵  Ҵ
 
     Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
     SetRootComponent(Root);
@@ -44,6 +45,7 @@ void AGasTankActor::BeginPlay()
     if (IsValid(PressureVessel))
     {
         PressureVessel->OnBLEVE.AddDynamic(this, &AGasTankActor::OnBLEVETriggered);
+        PressureVessel->OnVesselStateChanged.AddDynamic(this, &AGasTankActor::OnVesselStateChanged);
     }
 
     UE_LOG(LogGasTank, Warning, TEXT("[GasTank] BeginPlay: %s Type=%d"),
@@ -57,6 +59,21 @@ void AGasTankActor::Tick(float DeltaSeconds)
     UpdateGasLeakAudio(DeltaSeconds);
 }
 
+void AGasTankActor::OnVesselStateChanged(EPressureVesselState NewState)
+{
+    const bool bLeakState =
+        (NewState == EPressureVesselState::Venting) ||
+        (NewState == EPressureVesselState::Critical);
+
+    if (!bLeakState)
+    {
+        //  ̵ƿ  Ʈ ˾Ƽ ó
+        UpdateGasLeakAudio(0.f);
+    }
+
+    SetActorTickEnabled(bLeakState && !bHasExploded);
+}
+
 void AGasTankActor::ApplyTankTypeParameters()
 {
     if (!IsValid(PressureVessel))
@@ -181,6 +198,7 @@ void AGasTankActor::OnBLEVETriggered(FVector ExplosionLocation)
         return;
 
     bHasExploded = true;
+    SetActorTickEnabled(false);
 
     UE_LOG(LogGasTank, Error, TEXT("[GasTank] ====== BLEVE! ====== %s at %s"),
         *GetName(), *ExplosionLocation.ToString());
@@ -5,11 +5,28 @@
 #include "VitalComponent.h"
 #include "EngineUtils.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
+#include "Components/SceneComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMissionObjective, Log, All);
 
+namespace
+{
+    //  ؽƮ     Ű (SetProgressValue ٲ  )
+    int64 MakeDisplayKey(int32 Primary, int32 Secondary = 0)
+    {
+        return ((int64)Primary << 32) | (uint32)Secondary;
+    }
+
+    // FormatTimeText  ػ (  )
+    int32 WholeSecondsLeft(float Seconds)
+    {
+        return FMath::FloorToInt(FMath::Max(0.f, Seconds));
+    }
+}
+
 UMissionObjective::UMissionObjective()
 {
     ObjectiveID = FGuid::NewGuid().ToString();
@@ -27,6 +44,8 @@ void UMissionObjective::StartObjective(UWorld* World)
 
     StartTime = World->GetTimeSeconds();
     Progress01 = 0.f;
+    NotifiedProgress01 = -1.f;
+    NotifiedDisplayKey = 0;
     CurrentCount = 0;
     RescuedNPCCount = 0;
 
@@ -34,6 +53,17 @@ void UMissionObjective::StartObjective(UWorld* World)
 
     UE_LOG(LogMissionObjective, Warning, TEXT("[Objective] Started: %s (%s)"),
         *ObjectiveTitle.ToString(), *UEnum::GetValueAsString(ObjectiveType));
+
+    //  򰡴  ̺Ʈ θ.  ´ ⼭  
+    BindEvents(World);
+    Reevaluate();
+
+    // üũ Լ  ˸ ʴ ŸԵ  ؽƮ   
+    if (Status == EMissionObjectiveStatus::InProgress && NotifiedProgress01 < 0.f)
+    {
+        NotifiedProgress01 = Progress01;
+        OnProgressChanged.Broadcast(this, Progress01, GetProgressText());
+    }
 }
 
 void UMissionObjective::UpdateProgress(float DeltaSeconds, UWorld* World)
@@ -124,6 +154,7 @@ void UMissionObjective::CompleteObjective()
 {
     if (Status == EMissionObjectiveStatus::Completed) return;
 
+    UnbindEvents();
     ChangeStatus(EMissionObjectiveStatus::Completed);
     UpdateProgressValue(1.0f, TEXT("Complete!"));
 
@@ -141,6 +172,7 @@ void UMissionObjective::FailObjective(const FString& Reason)
     if (Status == EMissionObjectiveStatus::Failed) return;
     if (!bCanFail) return;
 
+    UnbindEvents();
     ChangeStatus(EMissionObjectiveStatus::Failed);
     UpdateProgressValue(0.f, FString::Printf(TEXT("Failed: %s"), *Reason));
 
@@ -150,8 +182,12 @@ void UMissionObjective::FailObjective(const FString& Reason)
 
 void UMissionObjective::ResetObjective()
 {
+    UnbindEvents();
+
     Status = EMissionObjectiveStatus::NotStarted;
     Progress01 = 0.f;
+    NotifiedProgress01 = -1.f;
+    NotifiedDisplayKey = 0;
     CurrentCount = 0;
     RescuedNPCCount = 0;
     StartTime = 0.f;
@@ -266,19 +302,8 @@ void UMissionObjective::NotifyPlayerDeath()
 
 void UMissionObjective::CheckExtinguishAllFires(UWorld* World)
 {
-    TArray<ARoomActor*> AllRooms;
-    FindAllRooms(World, AllRooms);
-
-    int32 TotalFires = 0;
-    for (ARoomActor* Room : AllRooms)
-    {
-        if (IsValid(Room))
-        {
-            TotalFires += Room->GetActiveFireCount();
-        }
-    }
-
-    if (TotalFires == 0)
+    // RemainingFires  OnFireStarted/OnFireExtinguished 
+    if (RemainingFires <= 0)
     {
         CompleteObjective();
     }
@@ -288,26 +313,20 @@ void UMissionObjective::CheckExtinguishAllFires(UWorld* World)
         // ʱ  TargetCount ߴٰ 
         if (TargetCount > 0)
         {
-            const float Prog = 1.f - (float)TotalFires / (float)TargetCount;
-            UpdateProgressValue(FMath::Clamp(Prog, 0.f, 1.f),
-                FString::Printf(TEXT("Fires remaining: %d"), TotalFires));
+            const float Prog = 1.f - (float)RemainingFires / (float)TargetCount;
+            if (SetProgressValue(Prog, RemainingFires))
+            {
+                OnProgressChanged.Broadcast(this, Progress01,
+                    FString::Printf(TEXT("Fires remaining: %d"), RemainingFires));
+            }
         }
     }
 }
 
 void UMissionObjective::CheckExtinguishFiresInRoom(UWorld* World)
 {
-    int32 TotalFires = 0;
-
-    for (ARoomActor* Room : TargetRooms)
-    {
-        if (IsValid(Room))
-        {
-            TotalFires += Room->GetActiveFireCount();
-        }
-    }
-
-    if (TotalFires == 0)
+    // TargetRooms ϹǷ RemainingFires = Ÿ   
+    if (RemainingFires <= 0)
     {
         CompleteObjective();
     }
@@ -315,9 +334,12 @@ void UMissionObjective::CheckExtinguishFiresInRoom(UWorld* World)
     {
         if (TargetCount > 0)
         {
-            const float Prog = 1.f - (float)TotalFires / (float)TargetCount;
-            UpdateProgressValue(FMath::Clamp(Prog, 0.f, 1.f),
-                FString::Printf(TEXT("Fires remaining: %d"), TotalFires));
+            const float Prog = 1.f - (float)RemainingFires / (float)TargetCount;
+            if (SetProgressValue(Prog, RemainingFires))
+            {
+                OnProgressChanged.Broadcast(this, Progress01,
+                    FString::Printf(TEXT("Fires remaining: %d"), RemainingFires));
+            }
         }
     }
 }
@@ -333,7 +355,10 @@ void UMissionObjective::CheckExtinguishFireCount(UWorld* World)
     else
     {
         const float Prog = (float)CurrentCount / (float)FMath::Max(1, TargetCount);
-        UpdateProgressValue(Prog, FormatProgressText(CurrentCount, TargetCount));
+        if (SetProgressValue(Prog, CurrentCount))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatProgressText(CurrentCount, TargetCount));
+        }
     }
 }
 
@@ -369,7 +394,10 @@ void UMissionObjective::CheckClearRoomSmoke(UWorld* World)
         {
             // ൵ = 1 - (  / Ӱ谪)
             const float Prog = FMath::Clamp(1.f - (AvgSmoke / FMath::Max(0.01f, ThresholdValue)), 0.f, 1.f);
-            UpdateProgressValue(Prog, FString::Printf(TEXT("Smoke: %.1f%%"), AvgSmoke * 100.f));
+            if (SetProgressValue(Prog))
+            {
+                OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("Smoke: %.1f%%"), AvgSmoke * 100.f));
+            }
         }
     }
 }
@@ -408,9 +436,9 @@ void UMissionObjective::CheckStabilizeRoomEnvironment(UWorld* World)
         {
             CompleteObjective();
         }
-        else
+        else if (SetProgressValue(AvgStability))
         {
-            UpdateProgressValue(AvgStability, FString::Printf(TEXT("Stability: %.1f%%"), AvgStability * 100.f));
+            OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("Stability: %.1f%%"), AvgStability * 100.f));
         }
     }
 }
@@ -428,7 +456,10 @@ void UMissionObjective::CheckPreventBackdraft(UWorld* World)
     else
     {
         const float Prog = Elapsed / FMath::Max(0.01f, DurationSeconds);
-        UpdateProgressValue(Prog, FormatTimeText(DurationSeconds - Elapsed));
+        if (SetProgressValue(Prog, WholeSecondsLeft(DurationSeconds - Elapsed)))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatTimeText(DurationSeconds - Elapsed));
+        }
     }
 }
 
@@ -443,19 +474,17 @@ void UMissionObjective::CheckSurviveForDuration(UWorld* World)
     else
     {
         const float Prog = Elapsed / FMath::Max(0.01f, DurationSeconds);
-        UpdateProgressValue(Prog, FormatTimeText(DurationSeconds - Elapsed));
+        if (SetProgressValue(Prog, WholeSecondsLeft(DurationSeconds - Elapsed)))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatTimeText(DurationSeconds - Elapsed));
+        }
     }
 }
 
 void UMissionObjective::CheckKeepHealthAbove(UWorld* World)
 {
-    APlayerController* PC = World->GetFirstPlayerController();
-    if (!PC) return;
-
-    APawn* PlayerPawn = PC->GetPawn();
-    if (!IsValid(PlayerPawn)) return;
-
-    UVitalComponent* Vital = PlayerPawn->FindComponentByClass<UVitalComponent>();
+    //    VitalComponent (BindPlayerPawn ĳ)
+    const UVitalComponent* Vital = PlayerVital.Get();
     if (!IsValid(Vital)) return;
 
     const float HP = Vital->GetHp01();
@@ -475,21 +504,18 @@ void UMissionObjective::CheckKeepHealthAbove(UWorld* World)
         else
         {
             const float Prog = Elapsed / FMath::Max(0.01f, DurationSeconds);
-            UpdateProgressValue(Prog, FString::Printf(TEXT("HP: %.1f%% / %s"),
-                HP * 100.f, *FormatTimeText(DurationSeconds - Elapsed)));
+            if (SetProgressValue(Prog, MakeDisplayKey(WholeSecondsLeft(DurationSeconds - Elapsed), FMath::RoundToInt(HP * 1000.f))))
+            {
+                OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("HP: %.1f%% / %s"),
+                    HP * 100.f, *FormatTimeText(DurationSeconds - Elapsed)));
+            }
         }
     }
 }
 
 void UMissionObjective::CheckKeepOxygenAbove(UWorld* World)
 {
-    APlayerController* PC = World->GetFirstPlayerController();
-    if (!PC) return;
-
-    APawn* PlayerPawn = PC->GetPawn();
-    if (!IsValid(PlayerPawn)) return;
-
-    UVitalComponent* Vital = PlayerPawn->FindComponentByClass<UVitalComponent>();
+    const UVitalComponent* Vital = PlayerVital.Get();
     if (!IsValid(Vital)) return;
 
     const float O2 = Vital->GetO201();
@@ -508,8 +534,11 @@ void UMissionObjective::CheckKeepOxygenAbove(UWorld* World)
         else
         {
             const float Prog = Elapsed / FMath::Max(0.01f, DurationSeconds);
-            UpdateProgressValue(Prog, FString::Printf(TEXT("O2: %.1f%% / %s"),
-                O2 * 100.f, *FormatTimeText(DurationSeconds - Elapsed)));
+            if (SetProgressValue(Prog, MakeDisplayKey(WholeSecondsLeft(DurationSeconds - Elapsed), FMath::RoundToInt(O2 * 1000.f))))
+            {
+                OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("O2: %.1f%% / %s"),
+                    O2 * 100.f, *FormatTimeText(DurationSeconds - Elapsed)));
+            }
         }
     }
 }
@@ -517,82 +546,55 @@ void UMissionObjective::CheckKeepOxygenAbove(UWorld* World)
 void UMissionObjective::CheckPreventGasTankExplosion(UWorld* World)
 {
     // ũ BLEVE ߻  NotifyGasTankExplosion() ȣ  ó
-    //  Ÿ ũ ϸ 
-
-    bool bAllSafe = true;
-    int32 DangerCount = 0;
-
-    for (AActor* Actor : TargetActors)
-    {
-        AGasTankActor* Tank = Cast<AGasTankActor>(Actor);
-        if (IsValid(Tank))
-        {
-            if (Tank->IsInDanger())
-            {
-                bAllSafe = false;
-                DangerCount++;
-            }
-        }
-    }
+    //  Ÿ ũ ϸ  (DangerTankCount   ȭ  RecountTanks)
 
     const float Elapsed = GetElapsedTime(World);
-    if (Elapsed >= DurationSeconds && bAllSafe)
+    if (Elapsed >= DurationSeconds && DangerTankCount == 0)
     {
         CompleteObjective();
     }
     else
     {
         const float Prog = Elapsed / FMath::Max(0.01f, DurationSeconds);
-        UpdateProgressValue(Prog, FString::Printf(TEXT("Danger tanks: %d / %s"),
-            DangerCount, *FormatTimeText(DurationSeconds - Elapsed)));
+        if (SetProgressValue(Prog, MakeDisplayKey(WholeSecondsLeft(DurationSeconds - Elapsed), DangerTankCount)))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("Danger tanks: %d / %s"),
+                DangerTankCount, *FormatTimeText(DurationSeconds - Elapsed)));
+        }
     }
 }
 
 void UMissionObjective::CheckOpenVentHolesInDoor(UWorld* World)
 {
-    int32 TotalHoles = 0;
-
-    for (AActor* Actor : TargetActors)
-    {
-        ADoorActor* Door = Cast<ADoorActor>(Actor);
-        if (IsValid(Door))
-        {
-            TotalHoles += Door->GetVentHoleCount();
-        }
-    }
-
-    if (TotalHoles >= TargetCount)
+    // DoorVentHoles OnVentHoleCreated  RecountDoors
+    if (DoorVentHoles >= TargetCount)
     {
         CompleteObjective();
     }
     else
     {
-        const float Prog = (float)TotalHoles / (float)FMath::Max(1, TargetCount);
-        UpdateProgressValue(Prog, FormatProgressText(TotalHoles, TargetCount));
+        const float Prog = (float)DoorVentHoles / (float)FMath::Max(1, TargetCount);
+        if (SetProgressValue(Prog, DoorVentHoles))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatProgressText(DoorVentHoles, TargetCount));
+        }
     }
 }
 
 void UMissionObjective::CheckBreachDoor(UWorld* World)
 {
-    int32 BreachedCount = 0;
-
-    for (AActor* Actor : TargetActors)
-    {
-        ADoorActor* Door = Cast<ADoorActor>(Actor);
-        if (IsValid(Door) && Door->DoorState == EDoorState::Breached)
-        {
-            BreachedCount++;
-        }
-    }
-
-    if (BreachedCount >= TargetCount)
+    // BreachedDoors OnDoorStateChanged  RecountDoors
+    if (BreachedDoors >= TargetCount)
     {
         CompleteObjective();
     }
     else
     {
-        const float Prog = (float)BreachedCount / (float)FMath::Max(1, TargetCount);
-        UpdateProgressValue(Prog, FormatProgressText(BreachedCount, TargetCount));
+        const float Prog = (float)BreachedDoors / (float)FMath::Max(1, TargetCount);
+        if (SetProgressValue(Prog, BreachedDoors))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatProgressText(BreachedDoors, TargetCount));
+        }
     }
 }
 
@@ -606,6 +608,14 @@ void UMissionObjective::CheckCompleteBeforeTime(UWorld* World)
     {
         FailObjective(TEXT("Time limit exceeded"));
     }
+    else
+    {
+        const float Prog = GetElapsedTime(World) / FMath::Max(0.01f, DurationSeconds);
+        if (SetProgressValue(Prog, WholeSecondsLeft(Remaining)))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatTimeText(Remaining));
+        }
+    }
 }
 
 void UMissionObjective::CheckRescueNPC(UWorld* World)
@@ -626,7 +636,10 @@ void UMissionObjective::CheckRescueNPC(UWorld* World)
     else
     {
         const float Prog = (float)RescuedNPCCount / (float)TotalNPCs;
-        UpdateProgressValue(Prog, FormatProgressText(RescuedNPCCount, TotalNPCs));
+        if (SetProgressValue(Prog, RescuedNPCCount))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FormatProgressText(RescuedNPCCount, TotalNPCs));
+        }
     }
 }
 
@@ -638,14 +651,12 @@ void UMissionObjective::CheckEscapeToExitPoint(UWorld* World)
         return;
     }
 
-    APlayerController* PC = World->GetFirstPlayerController();
-    if (!PC) return;
-
-    APawn* PlayerPawn = PC->GetPawn();
-    if (!IsValid(PlayerPawn)) return;
+    //    Ʈ (BindPlayerPawn ĳ)
+    const USceneComponent* Root = PlayerRoot.Get();
+    if (!IsValid(Root)) return;
 
     // ÷̾ Żⱸ Ÿ üũ
-    const float Distance = FVector::Dist(PlayerPawn->GetActorLocation(), ExitPoint->GetActorLocation());
+    const float Distance = FVector::Dist(Root->GetComponentLocation(), ExitPoint->GetActorLocation());
 
     if (Distance <= ExitReachDistance)
     {
@@ -656,7 +667,10 @@ void UMissionObjective::CheckEscapeToExitPoint(UWorld* World)
         // Ÿ  ൵ ( )
         // ִ Ÿ 0%, Ż   100% 
         const float Prog = FMath::Clamp(1.f - (Distance / MaxDistanceForProgress), 0.f, 0.95f);
-        UpdateProgressValue(Prog, FString::Printf(TEXT("%.1fm to exit"), Distance / 100.f));
+        if (SetProgressValue(Prog))
+        {
+            OnProgressChanged.Broadcast(this, Progress01, FString::Printf(TEXT("%.1fm to exit"), Distance / 100.f));
+        }
     }
 }
 
@@ -664,13 +678,27 @@ void UMissionObjective::CheckEscapeToExitPoint(UWorld* World)
 
 void UMissionObjective::UpdateProgressValue(float NewProgress, const FString& ProgressText)
 {
-    const float OldProgress = Progress01;
+    // Ϸ/ ˸: ൵  Ƶ ؽƮ ׻ 
     Progress01 = FMath::Clamp(NewProgress, 0.f, 1.f);
+    NotifiedProgress01 = Progress01;
+    OnProgressChanged.Broadcast(this, Progress01, ProgressText);
+}
 
-    if (!FMath::IsNearlyEqual(OldProgress, Progress01, 0.01f))
+bool UMissionObjective::SetProgressValue(float NewProgress, int64 DisplayKey)
+{
+    Progress01 = FMath::Clamp(NewProgress, 0.f, 1.f);
+
+    //  ˸   ( ȭ 1% ̸ ˸). ؽƮ ̴  ٲ ˸
+    if (NotifiedProgress01 >= 0.f
+        && FMath::IsNearlyEqual(NotifiedProgress01, Progress01, 0.01f)
+        && NotifiedDisplayKey == DisplayKey)
     {
-        OnProgressChanged.Broadcast(this, Progress01, ProgressText);
+        return false;
     }
+
+    NotifiedProgress01 = Progress01;
+    NotifiedDisplayKey = DisplayKey;
+    return true;
 }
 
 void UMissionObjective::ChangeStatus(EMissionObjectiveStatus NewStatus)
@@ -719,4 +747,351 @@ FString UMissionObjective::FormatTimeText(float Seconds) const
     const int32 Minutes = FMath::FloorToInt(Seconds / 60.f);
     const int32 Secs = FMath::FloorToInt(Seconds) % 60;
     return FString::Printf(TEXT("%02d:%02d"), Minutes, Secs);
+}
+
+// ============================ ̺Ʈ  ============================
+
+bool UMissionObjective::IsTimeDriven() const
+{
+    if (bFailOnTimeout && DurationSeconds > 0.f)
+        return true;
+
+    switch (ObjectiveType)
+    {
+    case EMissionObjectiveType::PreventBackdraft:
+    case EMissionObjectiveType::SurviveForDuration:
+    case EMissionObjectiveType::KeepHealthAbove:
+    case EMissionObjectiveType::KeepOxygenAbove:
+    case EMissionObjectiveType::PreventGasTankExplosion:
+    case EMissionObjectiveType::CompleteBeforeTime:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void UMissionObjective::BindEvents(UWorld* World)
+{
+    UnbindEvents();
+    BoundWorld = World;
+
+    // ---- : ȭ  / 巡Ʈ ----
+    const bool bAllRoomFires = ObjectiveType == EMissionObjectiveType::ExtinguishAllFires ||
+        ObjectiveType == EMissionObjectiveType::ExtinguishFireCount;
+    const bool bTargetRoomFires = ObjectiveType == EMissionObjectiveType::ExtinguishFiresInRoom;
+
+    TArray<ARoomActor*> AllRooms;
+    if (bAllRoomFires || bFailOnBackdraft)
+    {
+        FindAllRooms(World, AllRooms);
+    }
+
+    TArray<ARoomActor*> FireRooms;
+    if (bAllRoomFires)
+    {
+        FireRooms = AllRooms;
+    }
+    else if (bTargetRoomFires)
+    {
+        for (ARoomActor* Room : TargetRooms)
+        {
+            if (IsValid(Room)) FireRooms.AddUnique(Room);
+        }
+    }
+
+    RemainingFires = 0;
+    for (ARoomActor* Room : FireRooms)
+    {
+        Room->OnFireStarted.AddUniqueDynamic(this, &UMissionObjective::HandleRoomFireStarted);
+        Room->OnFireExtinguished.AddUniqueDynamic(this, &UMissionObjective::HandleRoomFireExtinguished);
+        ObservedRooms.AddUnique(Room);
+
+        RemainingFires += Room->GetActiveFireCount();
+    }
+
+    if (bFailOnBackdraft)
+    {
+        for (ARoomActor* Room : AllRooms)
+        {
+            Room->OnBackdraft.AddUniqueDynamic(this, &UMissionObjective::HandleRoomBackdraft);
+            ObservedRooms.AddUnique(Room);
+        }
+    }
+
+    // ---- : ȯ (//µ) ----
+    if (ObjectiveType == EMissionObjectiveType::ClearRoomSmoke ||
+        ObjectiveType == EMissionObjectiveType::StabilizeRoomEnvironment)
+    {
+        for (ARoomActor* Room : TargetRooms)
+        {
+            if (!IsValid(Room) || EnvRooms.Contains(Room)) continue;
+
+            Room->OnEnvChanged.AddUObject(this, &UMissionObjective::HandleRoomEnvChanged);
+            EnvRooms.Add(Room);
+        }
+    }
+
+    // ----  / ũ (TargetActors) ----
+    const bool bDoors = ObjectiveType == EMissionObjectiveType::OpenVentHolesInDoor ||
+        ObjectiveType == EMissionObjectiveType::BreachDoor;
+    const bool bTanks = ObjectiveType == EMissionObjectiveType::PreventGasTankExplosion || bFailOnGasTankExplosion;
+
+    for (AActor* Actor : TargetActors)
+    {
+        if (bDoors)
+        {
+            ADoorActor* Door = Cast<ADoorActor>(Actor);
+            if (IsValid(Door) && !ObservedDoors.Contains(Door))
+            {
+                Door->OnDoorStateChanged.AddUniqueDynamic(this, &UMissionObjective::HandleDoorStateChanged);
+                Door->OnVentHoleCreated.AddUniqueDynamic(this, &UMissionObjective::HandleDoorVentHoleCreated);
+                ObservedDoors.Add(Door);
+            }
+        }
+
+        if (bTanks)
+        {
+            AGasTankActor* Tank = Cast<AGasTankActor>(Actor);
+            UPressureVesselComponent* Vessel = IsValid(Tank) ? Tank->PressureVessel.Get() : nullptr;
+            if (IsValid(Vessel) && !ObservedVessels.Contains(Vessel))
+            {
+                Vessel->OnVesselStateChanged.AddUniqueDynamic(this, &UMissionObjective::HandleVesselStateChanged);
+                Vessel->OnBLEVE.AddUniqueDynamic(this, &UMissionObjective::HandleVesselBLEVE);
+                ObservedVessels.Add(Vessel);
+            }
+        }
+    }
+
+    RecountDoors();
+    RecountTanks();
+
+    // ---- ÷̾ (Ż / ġ).  ٲ ٽ  ----
+    if (ObjectiveType == EMissionObjectiveType::KeepHealthAbove ||
+        ObjectiveType == EMissionObjectiveType::KeepOxygenAbove ||
+        ObjectiveType == EMissionObjectiveType::EscapeToExitPoint)
+    {
+        if (APlayerController* PC = World->GetFirstPlayerController())
+        {
+            PC->OnPossessedPawnChanged.AddUniqueDynamic(this, &UMissionObjective::HandlePossessedPawnChanged);
+            ObservedController = PC;
+
+            BindPlayerPawn(PC->GetPawn());
+        }
+    }
+
+    // ---- ð:  ؽƮ 1 ð, Ϸ/ð ʰ  Ÿ̸ ----
+    if (IsTimeDriven())
+    {
+        FTimerManager& TM = World->GetTimerManager();
+        TM.SetTimer(ClockTimer, this, &UMissionObjective::HandleClock, 1.f, true);
+
+        if (DurationSeconds > 0.f)
+        {
+            TM.SetTimer(DeadlineTimer, this, &UMissionObjective::Reevaluate, DurationSeconds, false);
+        }
+    }
+}
+
+void UMissionObjective::UnbindEvents()
+{
+    for (const TWeakObjectPtr<ARoomActor>& Room : ObservedRooms)
+    {
+        if (!Room.IsValid()) continue;
+        Room->OnFireStarted.RemoveAll(this);
+        Room->OnFireExtinguished.RemoveAll(this);
+        Room->OnBackdraft.RemoveAll(this);
+    }
+    ObservedRooms.Reset();
+
+    for (const TWeakObjectPtr<ARoomActor>& Room : EnvRooms)
+    {
+        if (Room.IsValid())
+            Room->OnEnvChanged.RemoveAll(this);
+    }
+    EnvRooms.Reset();
+
+    for (const TWeakObjectPtr<ADoorActor>& Door : ObservedDoors)
+    {
+        if (!Door.IsValid()) continue;
+        Door->OnDoorStateChanged.RemoveAll(this);
+        Door->OnVentHoleCreated.RemoveAll(this);
+    }
+    ObservedDoors.Reset();
+
+    for (const TWeakObjectPtr<UPressureVesselComponent>& Vessel : ObservedVessels)
+    {
+        if (!Vessel.IsValid()) continue;
+        Vessel->OnVesselStateChanged.RemoveAll(this);
+        Vessel->OnBLEVE.RemoveAll(this);
+    }
+    ObservedVessels.Reset();
+
+    if (ObservedController.IsValid())
+    {
+        ObservedController->OnPossessedPawnChanged.RemoveAll(this);
+    }
+    ObservedController.Reset();
+    UnbindPlayerPawn();
+
+    if (UWorld* World = BoundWorld.Get())
+    {
+        World->GetTimerManager().ClearTimer(ClockTimer);
+        World->GetTimerManager().ClearTimer(DeadlineTimer);
+    }
+    BoundWorld.Reset();
+}
+
+void UMissionObjective::BindPlayerPawn(APawn* Pawn)
+{
+    UnbindPlayerPawn();
+
+    if (!IsValid(Pawn)) return;
+
+    if (ObjectiveType == EMissionObjectiveType::KeepHealthAbove ||
+        ObjectiveType == EMissionObjectiveType::KeepOxygenAbove)
+    {
+        if (UVitalComponent* Vital = Pawn->FindComponentByClass<UVitalComponent>())
+        {
+            Vital->OnVitals01Changed.AddUniqueDynamic(this, &UMissionObjective::HandlePlayerVitalsChanged);
+            PlayerVital = Vital;
+        }
+    }
+
+    if (ObjectiveType == EMissionObjectiveType::EscapeToExitPoint)
+    {
+        if (USceneComponent* Root = Pawn->GetRootComponent())
+        {
+            PlayerMovedHandle = Root->TransformUpdated.AddUObject(this, &UMissionObjective::HandlePlayerMoved);
+            PlayerRoot = Root;
+        }
+    }
+}
+
+void UMissionObjective::UnbindPlayerPawn()
+{
+    if (PlayerVital.IsValid())
+    {
+        PlayerVital->OnVitals01Changed.RemoveAll(this);
+    }
+    PlayerVital.Reset();
+
+    if (PlayerRoot.IsValid())
+    {
+        PlayerRoot->TransformUpdated.Remove(PlayerMovedHandle);
+    }
+    PlayerRoot.Reset();
+    PlayerMovedHandle.Reset();
+}
+
+void UMissionObjective::RecountDoors()
+{
+    DoorVentHoles = 0;
+    BreachedDoors = 0;
+
+    for (const TWeakObjectPtr<ADoorActor>& Door : ObservedDoors)
+    {
+        if (!Door.IsValid()) continue;
+
+        DoorVentHoles += Door->GetVentHoleCount();
+        if (Door->DoorState == EDoorState::Breached)
+        {
+            BreachedDoors++;
+        }
+    }
+}
+
+void UMissionObjective::RecountTanks()
+{
+    DangerTankCount = 0;
+
+    for (const TWeakObjectPtr<UPressureVesselComponent>& Vessel : ObservedVessels)
+    {
+        if (!Vessel.IsValid()) continue;
+
+        // AGasTankActor::IsInDanger  
+        if (Vessel->VesselState == EPressureVesselState::Critical ||
+            Vessel->VesselState == EPressureVesselState::Venting)
+        {
+            DangerTankCount++;
+        }
+    }
+}
+
+void UMissionObjective::Reevaluate()
+{
+    UpdateProgress(0.f, BoundWorld.Get());
+}
+
+void UMissionObjective::HandleRoomFireStarted(AFireActor* Fire)
+{
+    RemainingFires++;
+    Reevaluate();
+}
+
+void UMissionObjective::HandleRoomFireExtinguished(AFireActor* Fire)
+{
+    RemainingFires = FMath::Max(0, RemainingFires - 1);
+
+    // CurrentCount  (ExtinguishFireCount  ȿ )
+    NotifyFireExtinguished();
+
+    if (ObjectiveType != EMissionObjectiveType::ExtinguishFireCount)
+    {
+        Reevaluate();
+    }
+}
+
+void UMissionObjective::HandleRoomBackdraft()
+{
+    NotifyBackdraftOccurred();
+}
+
+void UMissionObjective::HandleRoomEnvChanged(ARoomActor* Room)
+{
+    Reevaluate();
+}
+
+void UMissionObjective::HandleDoorStateChanged(EDoorState NewState)
+{
+    RecountDoors();
+    Reevaluate();
+}
+
+void UMissionObjective::HandleDoorVentHoleCreated(int32 TotalHoleCount)
+{
+    RecountDoors();
+    Reevaluate();
+}
+
+void UMissionObjective::HandleVesselStateChanged(EPressureVesselState NewState)
+{
+    RecountTanks();
+    Reevaluate();
+}
+
+void UMissionObjective::HandleVesselBLEVE(FVector ExplosionLocation)
+{
+    NotifyGasTankExplosion();
+}
+
+void UMissionObjective::HandlePlayerVitalsChanged(float Hp01, float Temp01, float O201)
+{
+    Reevaluate();
+}
+
+void UMissionObjective::HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+    BindPlayerPawn(NewPawn);
+    Reevaluate();
+}
+
+void UMissionObjective::HandlePlayerMoved(USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport)
+{
+    Reevaluate();
+}
+
+void UMissionObjective::HandleClock()
+{
+    Reevaluate();
 }
\ No newline at end of file
@@ -0,0 +1,743 @@
+// ============================ MockRealtimeServer.cpp ============================
+#include "MockRealtimeServer.h"
+#include "FastBase64.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMockRealtime, Log, All);
+
+namespace
+{
+	const ANSICHAR AppendType[] = "\"input_audio_buffer.append\"";
+
+	// 서비스는 100ms 미만 commit을 거절함
+	constexpr double MinCommitSec = 0.1;
+
+	// 녹음 앞쪽 무음은 잘라서 "첫 델타 = 첫 소리"가 되게 함
+	constexpr int32 LeadingSilenceThreshold = 64;
+
+	bool ContainsWithin(const uint8* Data, int32 Size, const ANSICHAR* Needle, int32 NeedleLen, int32 ScanLimit)
+	{
+		const int32 Limit = FMath::Min(Size, ScanLimit) - NeedleLen;
+		for (int32 i = 0; i <= Limit; ++i)
+		{
+			if (FMemory::Memcmp(Data + i, Needle, NeedleLen) == 0)
+				return true;
+		}
+		return false;
+	}
+
+	bool ReadWavPcm16(const TArray<uint8>& File, int32& OutRate, int32& OutChannels, TArray<int16>& OutPcm)
+	{
+		if (File.Num() < 12 || FMemory::Memcmp(File.GetData(), "RIFF", 4) != 0 || FMemory::Memcmp(File.GetData() + 8, "WAVE", 4) != 0)
+			return false;
+
+		auto Read16 = [&File](int32 At) { return (int32)(uint16)(File[At] | (File[At + 1] << 8)); };
+		auto Read32 = [&File](int32 At) { return (int32)((uint32)File[At] | ((uint32)File[At + 1] << 8) | ((uint32)File[At + 2] << 16) | ((uint32)File[At + 3] << 24)); };
+
+		int32 Bits = 0;
+		OutRate = 0;
+		OutChannels = 0;
+		for (int32 Pos = 12; Pos + 8 <= File.Num();)
+		{
+			const int32 ChunkSize = Read32(Pos + 4);
+			const int32 Body = Pos + 8;
+			if (ChunkSize < 0 || Body + ChunkSize > File.Num())
+				return false;
+
+			if (FMemory::Memcmp(File.GetData() + Pos, "fmt ", 4) == 0 && ChunkSize >= 16)
+			{
+				if (Read16(Body) != 1)
+					return false;   // PCM만
+				OutChannels = Read16(Body + 2);
+				OutRate = Read32(Body + 4);
+				Bits = Read16(Body + 14);
+			}
+			else if (FMemory::Memcmp(File.GetData() + Pos, "data", 4) == 0)
+			{
+				if (Bits != 16 || OutChannels <= 0)
+					return false;
+				OutPcm.SetNumUninitialized(ChunkSize / (int32)sizeof(int16));
+				FMemory::Memcpy(OutPcm.GetData(), File.GetData() + Body, OutPcm.Num() * sizeof(int16));
+				return true;
+			}
+
+			Pos = Body + ChunkSize + (ChunkSize & 1);
+		}
+		return false;
+	}
+}
+
+// ===== Server =====
+
+FMockRealtimeServer::FMockRealtimeServer(const FMockRealtimeSettings& InSettings)
+	: Settings(InSettings)
+{
+	Settings.SampleRate = FMath::Max(8000, Settings.SampleRate);
+	Settings.AudioChunkMs = FMath::Max(10.f, Settings.AudioChunkMs);
+	Settings.SendSpeed = FMath::Max(0.25f, Settings.SendSpeed);
+}
+
+FMockRealtimeServer::~FMockRealtimeServer()
+{
+	Shutdown();
+}
+
+bool FMockRealtimeServer::Start()
+{
+	if (Thread)
+		return true;
+
+	LoadReply();
+	InputRate = Settings.SampleRate;
+	Rng.Initialize(Settings.RandomSeed != 0 ? Settings.RandomSeed : (int32)(FPlatformTime::Cycles() & 0x7fffffff));
+
+	// 연결 수립 후 바로 session.created (서비스와 같은 순서)
+	const double ConnectedSec = FPlatformTime::Seconds() + Settings.ConnectDelayMs / 1000.0;
+	Schedule(ConnectedSec, EOutboundKind::Connected, 0, FString());
+	Schedule(ConnectedSec, EOutboundKind::Message, 0, FString::Printf(
+		TEXT("{\"type\":\"session.created\",\"event_id\":\"event_mock_%u\",\"session\":{\"id\":\"sess_mock\",\"object\":\"realtime.session\"}}"),
+		++EventCounter));
+
+	bStopRequested.store(false);
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("MockRealtimeServer"), 0, TPri_Normal);
+	if (!Thread)
+	{
+		UE_LOG(LogMockRealtime, Error, TEXT("[MockRealtime] Failed to create worker thread."));
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FMockRealtimeServer::Shutdown()
+{
+	if (!Thread)
+		return;
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+
+	Pending.Reset();
+	Inbound.Empty();
+	Outbound.Empty();
+}
+
+void FMockRealtimeServer::Stop()
+{
+	bStopRequested.store(true);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FMockRealtimeServer::Receive(const void* Data, SIZE_T Size)
+{
+	if (!Thread || !Data || Size == 0)
+		return;
+
+	TArray<uint8> Message;
+	Message.Append(static_cast<const uint8*>(Data), (int32)Size);
+	Inbound.Enqueue(MoveTemp(Message));
+	WakeEvent->Trigger();
+}
+
+uint32 FMockRealtimeServer::Run()
+{
+	while (!bStopRequested.load())
+	{
+		TArray<uint8> Message;
+		while (Inbound.Dequeue(Message))
+		{
+			HandleClientEvent(Message);
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		FlushDue(Now);
+
+		// 다음 전달 시각까지 대기 (ms 단위라 최대 1ms 늦게 나감)
+		double WaitMs = 50.0;
+		if (Pending.Num() > 0)
+		{
+			WaitMs = FMath::Clamp((Pending[0].DueSec - Now) * 1000.0, 0.0, 50.0);
+		}
+		if (WaitMs > 0.0)
+		{
+			WakeEvent->Wait((uint32)FMath::CeilToInt(WaitMs));
+		}
+	}
+	return 0;
+}
+
+void FMockRealtimeServer::LoadReply()
+{
+	ReplyPcm.Reset();
+	ReplyWire.Reset();
+
+	if (!Settings.ReplyWavPath.IsEmpty())
+	{
+		const FString Path = FPaths::IsRelative(Settings.ReplyWavPath)
+			? FPaths::Combine(FPaths::ProjectDir(), Settings.ReplyWavPath)
+			: Settings.ReplyWavPath;
+
+		TArray<uint8> File;
+		int32 Rate = 0, Channels = 0;
+		if (!FFileHelper::LoadFileToArray(File, *Path))
+		{
+			UE_LOG(LogMockRealtime, Warning, TEXT("[MockRealtime] Reply WAV not found: %s (using synthetic reply)"), *Path);
+		}
+		else if (!ReadWavPcm16(File, Rate, Channels, ReplyPcm) || Rate != Settings.SampleRate || Channels != 1)
+		{
+			UE_LOG(LogMockRealtime, Warning, TEXT("[MockRealtime] Reply WAV must be PCM16 mono %d Hz (got %d Hz x%d): %s (using synthetic reply)"),
+				Settings.SampleRate, Rate, Channels, *Path);
+			ReplyPcm.Reset();
+		}
+		else
+		{
+			int32 First = 0;
+			while (First < ReplyPcm.Num() && FMath::Abs((int32)ReplyPcm[First]) < LeadingSilenceThreshold)
+			{
+				++First;
+			}
+			ReplyPcm.RemoveAt(0, First, false);
+		}
+	}
+
+	if (ReplyPcm.Num() == 0)
+	{
+		// 유성음 비슷한 합성 응답 (180 Hz + 배음, 4 Hz 음절 포락선). 첫 샘플부터 소리가 남
+		const int32 Num = FMath::Max(1, (int32)(Settings.SyntheticReplySec * Settings.SampleRate));
+		ReplyPcm.SetNumUninitialized(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const double T = (double)i / Settings.SampleRate;
+			const double Phase = 2.0 * PI * 180.0 * T + 0.5;
+			const double Env = 0.6 + 0.4 * FMath::Sin(2.0 * PI * 4.0 * T);
+			const double V = Env * 0.2 * (FMath::Sin(Phase) + 0.5 * FMath::Sin(2.0 * Phase) + 0.3 * FMath::Sin(3.0 * Phase));
+			ReplyPcm[i] = (int16)FMath::Clamp(FMath::RoundToInt(V * 32767.0), -32768, 32767);
+		}
+	}
+
+	TranscriptWords.Reset();
+	Settings.ReplyTranscript.ParseIntoArrayWS(TranscriptWords);
+}
+
+void FMockRealtimeServer::HandleClientEvent(const TArray<uint8>& Message)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	// append는 크고 자주 오므로 DOM 없이 길이만 셈 (인코더가 type을 맨 앞에 씀)
+	if (ContainsWithin(Message.GetData(), Message.Num(), AppendType, UE_ARRAY_COUNT(AppendType) - 1, 64))
+	{
+		InputAudioBytes += FastBase64::GetMaxDecodedLength(Message.Num());
+		return;
+	}
+
+	FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Message.GetData()), Message.Num());
+	const FString Text(Conv.Length(), Conv.Get());
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+	FString Type;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetStringField(TEXT("type"), Type))
+	{
+		Schedule(Now + Settings.ControlReplyDelayMs / 1000.0, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"error\",\"event_id\":\"event_mock_%u\",\"error\":{\"type\":\"invalid_request_error\",\"code\":\"invalid_json\",\"message\":\"Malformed client event\"}}"),
+			++EventCounter));
+		return;
+	}
+
+	const double ReplySec = Now + (Settings.ControlReplyDelayMs + Rng.FRandRange(0.f, Settings.JitterMs)) / 1000.0;
+
+	if (Type == TEXT("session.update"))
+	{
+		ApplySessionUpdate(Root, ReplySec);
+	}
+	else if (Type == TEXT("input_audio_buffer.commit"))
+	{
+		const int32 BytesPerSample = VoiceAudioCodecs::Get(InputCodec).GetMaxEncodedBytes(1);
+		const double BufferedSec = (double)InputAudioBytes / (double)(InputRate * BytesPerSample);
+		InputAudioBytes = 0;
+
+		if (BufferedSec < MinCommitSec)
+		{
+			Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+				TEXT("{\"type\":\"error\",\"event_id\":\"event_mock_%u\",\"error\":{\"type\":\"invalid_request_error\",\"code\":\"input_audio_buffer_commit_empty\",\"message\":\"Error committing input audio buffer: buffer too small. Expected at least 100ms of audio, but buffer only has %.2fms of audio.\"}}"),
+				++EventCounter, BufferedSec * 1000.0));
+		}
+		else
+		{
+			const uint32 Id = ++EventCounter;
+			Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+				TEXT("{\"type\":\"input_audio_buffer.committed\",\"event_id\":\"event_mock_%u\",\"item_id\":\"item_mock_in_%u\"}"),
+				Id, Id));
+		}
+	}
+	else if (Type == TEXT("input_audio_buffer.clear"))
+	{
+		InputAudioBytes = 0;
+		Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"input_audio_buffer.cleared\",\"event_id\":\"event_mock_%u\"}"), ++EventCounter));
+	}
+	else if (Type == TEXT("conversation.item.create"))
+	{
+		const uint32 Id = ++EventCounter;
+		Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"conversation.item.created\",\"event_id\":\"event_mock_%u\",\"item\":{\"id\":\"item_mock_in_%u\",\"type\":\"message\",\"role\":\"user\"}}"),
+			Id, Id));
+	}
+	else if (Type == TEXT("response.create"))
+	{
+		ScheduleResponse(Now);
+	}
+	else if (Type == TEXT("response.cancel"))
+	{
+		CancelResponse(Now);
+	}
+	else
+	{
+		Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"error\",\"event_id\":\"event_mock_%u\",\"error\":{\"type\":\"invalid_request_error\",\"code\":\"unknown_event\",\"message\":\"Unsupported event type '%s' (mock server)\"}}"),
+			++EventCounter, *Type));
+	}
+}
+
+void FMockRealtimeServer::ApplySessionUpdate(const TSharedPtr<FJsonObject>& Root, double ReplySec)
+{
+	// session.audio.<Dir>.format -> 코덱 (필드가 없으면 이전 값 유지)
+	const TSharedPtr<FJsonObject>* Session = nullptr;
+	const TSharedPtr<FJsonObject>* Audio = nullptr;
+	const bool bHasAudio = Root->TryGetObjectField(TEXT("session"), Session) && (*Session)->TryGetObjectField(TEXT("audio"), Audio);
+
+	auto ReadFormat = [bHasAudio, Audio](const TCHAR* Dir, ERealtimeAudioCodec& InOutCodec, int32* OutRate) -> bool
+	{
+		const TSharedPtr<FJsonObject>* DirObj = nullptr;
+		const TSharedPtr<FJsonObject>* Format = nullptr;
+		FString WireFormat;
+		if (!bHasAudio || !(*Audio)->TryGetObjectField(Dir, DirObj) || !(*DirObj)->TryGetObjectField(TEXT("format"), Format) ||
+			!(*Format)->TryGetStringField(TEXT("type"), WireFormat))
+			return true;
+
+		const IVoiceAudioCodec* Codec = VoiceAudioCodecs::FindByWireFormat(WireFormat);
+		if (!Codec)
+			return false;
+
+		InOutCodec = Codec->GetId();
+		if (OutRate)
+		{
+			int32 Rate = 0;
+			if (Codec->GetWireSampleRate() > 0)
+			{
+				*OutRate = Codec->GetWireSampleRate();
+			}
+			else if ((*Format)->TryGetNumberField(TEXT("rate"), Rate) && Rate > 0)
+			{
+				*OutRate = Rate;
+			}
+		}
+		return true;
+	};
+
+	ERealtimeAudioCodec NewInput = InputCodec;
+	ERealtimeAudioCodec NewOutput = OutputCodec;
+	int32 NewInputRate = InputRate;
+	if (!ReadFormat(TEXT("input"), NewInput, &NewInputRate) || !ReadFormat(TEXT("output"), NewOutput, nullptr))
+	{
+		Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"error\",\"event_id\":\"event_mock_%u\",\"error\":{\"type\":\"invalid_request_error\",\"code\":\"invalid_value\",\"message\":\"Unsupported audio format (mock server supports audio/pcm, audio/pcmu, audio/pcma)\"}}"),
+			++EventCounter));
+		return;
+	}
+
+	InputCodec = NewInput;
+	OutputCodec = NewOutput;
+	InputRate = NewInputRate;
+
+	const IVoiceAudioCodec& Out = VoiceAudioCodecs::Get(OutputCodec);
+	const int32 OutRate = (Out.GetWireSampleRate() > 0) ? Out.GetWireSampleRate() : Settings.SampleRate;
+
+	Schedule(ReplySec, EOutboundKind::Message, 0, FString::Printf(
+		TEXT("{\"type\":\"session.updated\",\"event_id\":\"event_mock_%u\",\"session\":{\"id\":\"sess_mock\",\"object\":\"realtime.session\",")
+		TEXT("\"audio\":{\"input\":{\"format\":{\"type\":\"%s\",\"rate\":%d}},\"output\":{\"format\":{\"type\":\"%s\",\"rate\":%d}}}}}"),
+		++EventCounter, VoiceAudioCodecs::GetWireFormat(InputCodec), InputRate, Out.GetWireFormat(), OutRate));
+}
+
+void FMockRealtimeServer::PrepareReplyWire()
+{
+	const IVoiceAudioCodec& Codec = VoiceAudioCodecs::Get(OutputCodec);
+	const int32 WireRate = (Codec.GetWireSampleRate() > 0) ? Codec.GetWireSampleRate() : Settings.SampleRate;
+	if (ReplyWire.Num() > 0 && ReplyWireCodec == OutputCodec && ReplyWireRate == WireRate)
+		return;
+
+	// 서비스처럼 응답 전체를 한 번에 변환해두고 잘라서 보냄
+	FVoiceCodecEncoder Encoder;
+	Encoder.Init(OutputCodec, Settings.SampleRate);
+
+	ReplyWire.Reset();
+	Encoder.Encode(ReplyPcm.GetData(), ReplyPcm.Num(), ReplyWire);
+	ReplyWireCodec = OutputCodec;
+	ReplyWireRate = WireRate;
+}
+
+void FMockRealtimeServer::ScheduleResponse(double NowSec)
+{
+	if (bResponseActive)
+	{
+		Schedule(NowSec + Settings.ControlReplyDelayMs / 1000.0, EOutboundKind::Message, 0, FString::Printf(
+			TEXT("{\"type\":\"error\",\"event_id\":\"event_mock_%u\",\"error\":{\"type\":\"invalid_request_error\",\"code\":\"conversation_already_has_active_response\",\"message\":\"Conversation already has an active response\"}}"),
+			++EventCounter));
+		return;
+	}
+
+	const uint32 Serial = ++ResponseSerial;
+	bResponseActive = true;
+	LastResponseDueSec = NowSec;
+
+	const FString Ids = FString::Printf(TEXT("\"response_id\":\"resp_mock_%u\",\"item_id\":\"item_mock_out_%u\",\"output_index\":0,\"content_index\":0"), Serial, Serial);
+
+	Schedule(Jittered(NowSec + Settings.ControlReplyDelayMs / 1000.0), EOutboundKind::ResponseCreated, Serial, FString::Printf(
+		TEXT("{\"type\":\"response.created\",\"event_id\":\"event_mock_%u\",\"response\":{\"id\":\"resp_mock_%u\",\"object\":\"realtime.response\",\"status\":\"in_progress\"}}"),
+		++EventCounter, Serial));
+
+	PrepareReplyWire();
+
+	const int32 BytesPerSample = VoiceAudioCodecs::Get(ReplyWireCodec).GetMaxEncodedBytes(1);
+	const int32 ChunkBytes = BytesPerSample * FMath::Max(1, (int32)(Settings.AudioChunkMs * ReplyWireRate / 1000.f));
+	const int32 NumChunks = FMath::DivideAndRoundUp(ReplyWire.Num(), ChunkBytes);
+	const double IntervalSec = Settings.AudioChunkMs / 1000.0 / Settings.SendSpeed;
+
+	TArray<ANSICHAR> B64;
+	B64.SetNumUninitialized(FastBase64::GetEncodedLength(ChunkBytes) + 1);
+
+	double IdealSec = NowSec + Settings.FirstAudioDelayMs / 1000.0;
+	int32 NextWord = 0;
+	for (int32 c = 0; c < NumChunks; ++c)
+	{
+		if (Settings.SpikeProbability > 0.f && Rng.FRand() < Settings.SpikeProbability)
+		{
+			IdealSec += Settings.SpikeMs / 1000.0;
+		}
+
+		const double DueSec = Jittered(IdealSec);
+
+		// 자막은 오디오 진행에 비례해서 먼저 (서비스도 transcript 델타가 오디오를 약간 앞섬)
+		const int32 WordsDue = (int32)((int64)TranscriptWords.Num() * (c + 1) / NumChunks);
+		for (; NextWord < WordsDue; ++NextWord)
+		{
+			FString Word = (NextWord > 0 ? TEXT(" ") : TEXT("")) + TranscriptWords[NextWord];
+			Word.ReplaceInline(TEXT("\\"), TEXT("\\\\"));
+			Word.ReplaceInline(TEXT("\""), TEXT("\\\""));
+			Schedule(DueSec, EOutboundKind::Message, Serial, FString::Printf(
+				TEXT("{\"type\":\"response.output_audio_transcript.delta\",\"event_id\":\"event_mock_%u\",%s,\"delta\":\"%s\"}"),
+				++EventCounter, *Ids, *Word));
+		}
+
+		const int32 Offset = c * ChunkBytes;
+		const int32 Num = FMath::Min(ChunkBytes, ReplyWire.Num() - Offset);
+		const int32 B64Len = FastBase64::GetEncodedLength(Num);
+		FastBase64::Encode(ReplyWire.GetData() + Offset, Num, B64.GetData());
+		B64[B64Len] = '\0';
+
+		Schedule(DueSec, EOutboundKind::AudioDelta, Serial, FString::Printf(
+			TEXT("{\"type\":\"response.output_audio.delta\",\"event_id\":\"event_mock_%u\",%s,\"delta\":\"%s\"}"),
+			++EventCounter, *Ids, ANSI_TO_TCHAR(B64.GetData())));
+
+		IdealSec += IntervalSec;
+	}
+
+	FString Transcript = Settings.ReplyTranscript;
+	Transcript.ReplaceInline(TEXT("\\"), TEXT("\\\\"));
+	Transcript.ReplaceInline(TEXT("\""), TEXT("\\\""));
+
+	const double TailSec = Jittered(IdealSec);
+	Schedule(TailSec, EOutboundKind::AudioDone, Serial, FString::Printf(
+		TEXT("{\"type\":\"response.output_audio.done\",\"event_id\":\"event_mock_%u\",%s}"), ++EventCounter, *Ids));
+	Schedule(TailSec, EOutboundKind::Message, Serial, FString::Printf(
+		TEXT("{\"type\":\"response.output_audio_transcript.done\",\"event_id\":\"event_mock_%u\",%s,\"transcript\":\"%s\"}"),
+		++EventCounter, *Ids, *Transcript));
+	Schedule(TailSec, EOutboundKind::ResponseDone, Serial, FString::Printf(
+		TEXT("{\"type\":\"response.done\",\"event_id\":\"event_mock_%u\",\"response\":{\"id\":\"resp_mock_%u\",\"object\":\"realtime.response\",\"status\":\"completed\"}}"),
+		++EventCounter, Serial));
+}
+
+void FMockRealtimeServer::CancelResponse(double NowSec)
+{
+	// 서비스는 진행 중인 응답이 없으면 에러를 주지만, 클라이언트가 턴마다 습관적으로 보내므로 조용히 무시
+	if (!bResponseActive)
+		return;
+
+	const uint32 Serial = ResponseSerial;
+	Pending.RemoveAll([Serial](const FScheduled& S) { return S.Item.ResponseSerial == Serial; });
+	bResponseActive = false;
+
+	Schedule(Jittered(NowSec + Settings.ControlReplyDelayMs / 1000.0), EOutboundKind::ResponseCancelled, Serial, FString::Printf(
+		TEXT("{\"type\":\"response.done\",\"event_id\":\"event_mock_%u\",\"response\":{\"id\":\"resp_mock_%u\",\"object\":\"realtime.response\",\"status\":\"cancelled\"}}"),
+		++EventCounter, Serial));
+}
+
+double FMockRealtimeServer::Jittered(double IdealSec)
+{
+	const double Jitter = (Settings.JitterMs > 0.f) ? Rng.FRandRange(-Settings.JitterMs, Settings.JitterMs) / 1000.0 : 0.0;
+	LastResponseDueSec = FMath::Max(LastResponseDueSec, IdealSec + Jitter);
+	return LastResponseDueSec;
+}
+
+void FMockRealtimeServer::Schedule(double DueSec, EOutboundKind Kind, uint32 Serial, const FString& Json)
+{
+	FScheduled Entry;
+	Entry.DueSec = DueSec;
+	Entry.Item.Kind = Kind;
+	Entry.Item.ResponseSerial = Serial;
+	if (!Json.IsEmpty())
+	{
+		FTCHARToUTF8 Utf8(*Json);
+		Entry.Item.Utf8.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	// 같은 시각이면 먼저 예약한 것이 먼저
+	const int32 At = Algo::UpperBoundBy(Pending, DueSec, &FScheduled::DueSec);
+	Pending.Insert(MoveTemp(Entry), At);
+}
+
+void FMockRealtimeServer::FlushDue(double NowSec)
+{
+	int32 NumDue = 0;
+	while (NumDue < Pending.Num() && Pending[NumDue].DueSec <= NowSec)
+	{
+		FScheduled& Entry = Pending[NumDue++];
+		if (Entry.Item.ResponseSerial == ResponseSerial && Entry.Item.Kind == EOutboundKind::ResponseDone)
+		{
+			bResponseActive = false;
+		}
+		Outbound.Enqueue(MoveTemp(Entry.Item));
+	}
+
+	if (NumDue > 0)
+	{
+		Pending.RemoveAt(0, NumDue, false);
+	}
+}
+
+// ===== Socket =====
+
+FMockRealtimeWebSocket::FMockRealtimeWebSocket(const FMockRealtimeSettings& InSettings, bool bInAutoTick)
+	: Settings(InSettings)
+	, bAutoTick(bInAutoTick)
+{
+}
+
+FMockRealtimeWebSocket::~FMockRealtimeWebSocket()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+	Server.Reset();
+}
+
+void FMockRealtimeWebSocket::Connect()
+{
+	if (Server.IsValid() || bPendingConnectError)
+		return;
+
+	if (bAutoTick && !TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMockRealtimeWebSocket::Tick));
+	}
+
+	// 시드가 고정이어도 재연결 시도마다 결과가 달라지게 연결 순번을 섞음
+	if (Settings.ConnectFailureProbability > 0.f)
+	{
+		static std::atomic<int32> ConnectSerial{ 0 };
+		const int32 Serial = ++ConnectSerial;
+		FRandomStream FaultRng(Settings.RandomSeed != 0 ? Settings.RandomSeed * 7919 + Serial : (int32)(FPlatformTime::Cycles() & 0x7fffffff));
+		if (FaultRng.FRand() < Settings.ConnectFailureProbability)
+		{
+			// 실패도 엔진 구현처럼 다음 펌프에서
+			bPendingConnectError = true;
+			return;
+		}
+	}
+
+	Server = MakeUnique<FMockRealtimeServer>(Settings);
+	if (!Server->Start())
+	{
+		Server.Reset();
+		ConnectionErrorEvent.Broadcast(TEXT("Mock realtime server failed to start"));
+		return;
+	}
+}
+
+void FMockRealtimeWebSocket::Close(int32 Code, const FString& Reason)
+{
+	Server.Reset();
+
+	// 엔진 구현처럼 닫힘 콜백은 다음 펌프에서 (그 사이 소켓을 버리면 오지 않음)
+	if (bConnected)
+	{
+		bConnected = false;
+		bPendingClosed = true;
+		PendingCloseCode = Code;
+		PendingCloseReason = Reason;
+	}
+}
+
+void FMockRealtimeWebSocket::Send(const FString& Data)
+{
+	if (!bConnected || !Server.IsValid() || bStalled)
+		return;
+
+	FTCHARToUTF8 Utf8(*Data);
+	Server->Receive(Utf8.Get(), Utf8.Length());
+
+	if (MessageSentEvent.IsBound())
+	{
+		MessageSentEvent.Broadcast(Data);
+	}
+}
+
+void FMockRealtimeWebSocket::Send(const void* Data, SIZE_T Size, bool bIsBinary)
+{
+	if (!bConnected || !Server.IsValid() || bIsBinary || bStalled)
+		return;
+
+	Server->Receive(Data, Size);
+}
+
+bool FMockRealtimeWebSocket::Tick(float DeltaTime)
+{
+	Pump();
+	return true;
+}
+
+void FMockRealtimeWebSocket::Pump()
+{
+	// 콜백 안에서 소켓을 놓아도 이 호출이 끝날 때까지는 살아 있게
+	const TSharedRef<FMockRealtimeWebSocket, ESPMode::ThreadSafe> KeepAlive = AsShared();
+
+	if (bPendingClosed)
+	{
+		bPendingClosed = false;
+		ClosedEvent.Broadcast(PendingCloseCode, PendingCloseReason, true);
+		return;
+	}
+
+	if (bPendingConnectError)
+	{
+		bPendingConnectError = false;
+		ConnectionErrorEvent.Broadcast(TEXT("Mock realtime server refused the connection (simulated)"));
+		return;
+	}
+
+	if (bConnected)
+	{
+		const double ConnectedFor = FPlatformTime::Seconds() - ConnectedSec;
+
+		if (Settings.DropAfterSec > 0.f && ConnectedFor >= Settings.DropAfterSec)
+		{
+			Server.Reset();
+			bConnected = false;
+			ClosedEvent.Broadcast(1006, TEXT("Simulated network drop"), false);
+			return;
+		}
+
+		bStalled = (Settings.StallAfterSec > 0.f && ConnectedFor >= Settings.StallAfterSec);
+	}
+
+	FMockRealtimeServer::FOutbound Item;
+	while (Server.IsValid() && Server->PopOutbound(Item))
+	{
+		// 멈춘 연결: 서버는 계속 보내지만 아무것도 도착하지 않음
+		if (!bStalled)
+		{
+			Deliver(Item);
+		}
+	}
+}
+
+void FMockRealtimeWebSocket::Deliver(const FMockRealtimeServer::FOutbound& Item)
+{
+	typedef FMockRealtimeServer::EOutboundKind EKind;
+
+	const double Now = FPlatformTime::Seconds();
+
+	switch (Item.Kind)
+	{
+	case EKind::Connected:
+		bConnected = true;
+		ConnectedSec = Now;
+		ConnectedEvent.Broadcast();
+		return;
+
+	case EKind::ResponseCreated:
+		LastResponse = FMockRealtimeResponseTiming();
+		LastResponse.ResponseSerial = Item.ResponseSerial;
+		LastResponse.CreatedSec = Now;
+		break;
+
+	case EKind::AudioDelta:
+		if (Item.ResponseSerial == LastResponse.ResponseSerial)
+		{
+			if (LastResponse.AudioDeltas++ == 0)
+			{
+				LastResponse.FirstAudioSec = Now;
+			}
+			LastResponse.AudioWireBytes += Item.Utf8.Num();
+		}
+		break;
+
+	case EKind::AudioDone:
+		if (Item.ResponseSerial == LastResponse.ResponseSerial)
+		{
+			LastResponse.AudioDoneSec = Now;
+		}
+		break;
+
+	case EKind::ResponseCancelled:
+		if (Item.ResponseSerial == LastResponse.ResponseSerial)
+		{
+			LastResponse.bCancelled = true;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	if (!bConnected || Item.Utf8.Num() == 0)
+		return;
+
+	if (RawMessageEvent.IsBound())
+	{
+		const int32 Total = Item.Utf8.Num();
+		const int32 Fragment = (Settings.MaxFragmentBytes > 0) ? Settings.MaxFragmentBytes : Total;
+		for (int32 Offset = 0; Offset < Total; Offset += Fragment)
+		{
+			const int32 Num = FMath::Min(Fragment, Total - Offset);
+			RawMessageEvent.Broadcast(Item.Utf8.GetData() + Offset, (SIZE_T)Num, (SIZE_T)(Total - Offset - Num));
+		}
+	}
+
+	if (MessageEvent.IsBound())
+	{
+		FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Item.Utf8.GetData()), Item.Utf8.Num());
+		MessageEvent.Broadcast(FString(Conv.Length(), Conv.Get()));
+	}
+}
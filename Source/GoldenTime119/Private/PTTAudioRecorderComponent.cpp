@@ -1,162 +1,261 @@
 ﻿#include "PTTAudioRecorderComponent.h"
 
 #include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
 #include "Misc/Paths.h"
-#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/DateTime.h"
 
-int16 UPTTAudioRecorderComponent::FloatToPcm16(float S)
+DEFINE_LOG_CATEGORY_STATIC(LogPTTRecorder, Log, All);
+
+namespace
 {
-	S = FMath::Clamp(S, -1.0f, 1.0f);
-	const int32 V = FMath::RoundToInt(S * 32767.0f);
-	return (int16)FMath::Clamp(V, -32768, 32767);
+	// 발화 버퍼 초기 확보량. 더 긴 발화가 한 번 오면 풀의 버퍼가 그 크기로 자라서 재사용됨
+	constexpr float ExpectedUtteranceSec = 10.f;
 }
 
-void UPTTAudioRecorderComponent::DownmixToMono(
-	const float* InInterleaved,
-	int32 NumFrames,
-	int32 NumChannels,
-	TArray<float>& OutMono
-)
+UPTTAudioRecorderComponent::UPTTAudioRecorderComponent()
 {
-	OutMono.Reset();
-	if (!InInterleaved || NumFrames <= 0 || NumChannels <= 0)
-		return;
+	// 캡처 중에만 틱 (링버퍼 드레인)
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
 
-	OutMono.AddUninitialized(NumFrames);
+// ====== Capture thread ======
 
-	if (NumChannels == 1)
-	{
-		FMemory::Memcpy(OutMono.GetData(), InInterleaved, NumFrames * sizeof(float));
+void UPTTAudioRecorderComponent::FCaptureImpl::ProcessInput(const float* InInterleaved, int32 NumFrames, int32 NumChannels, int32 SampleRate)
+{
+	if (!InInterleaved || NumFrames <= 0 || NumChannels <= 0 || SampleRate < MinInputSampleRate)
 		return;
+
+	// 필터는 StartPTT에서 디바이스 SR로 미리 만들어 둠.
+	// 콜백 SR이 다르면(디바이스 정보가 틀린 경우) 여기서 한 번만 다시 만듦 - 이때만 할당 발생
+	if (SampleRate != Resampler.GetInputSampleRate())
+	{
+		Resampler.Init(SampleRate, OutSampleRate);
 	}
+	InSampleRate = SampleRate;
+	InNumChannels = NumChannels;
 
-	for (int32 f = 0; f < NumFrames; ++f)
+	for (int32 Offset = 0; Offset < NumFrames; Offset += CaptureChunkFrames)
 	{
-		double Acc = 0.0;
-		const int32 Base = f * NumChannels;
-		for (int32 c = 0; c < NumChannels; ++c)
+		const int32 Num = FMath::Min(CaptureChunkFrames, NumFrames - Offset);
+		const float* Src = InInterleaved + Offset * NumChannels;
+
+		// mono면 downmix 복사 생략
+		const float* Mono = Src;
+		if (NumChannels > 1)
 		{
-			Acc += (double)InInterleaved[Base + c];
+			VoiceAudioDSP::DownmixToMono(Src, Num, NumChannels, MonoScratch.GetData());
+			Mono = MonoScratch.GetData();
 		}
-		OutMono[f] = (float)(Acc / (double)NumChannels);
+
+		const int32 NumOut = Resampler.Process(Mono, Num, ResampleScratch.GetData());
+		PushOutputSamples(ResampleScratch.GetData(), NumOut);
 	}
 }
 
-// InMono는 "이번 콜백 분량의 mono"이고,
-// InOutMonoAccum는 "Output sample rate 기준으로 resample된 누적 버퍼"로 씁니다.
-void UPTTAudioRecorderComponent::ResampleMono(
-	const TArray<float>& InMono,
-	int32 InSampleRate,
-	TArray<float>& InOutMonoAccum,
-	int32 OutSampleRate
-)
+void UPTTAudioRecorderComponent::FCaptureImpl::PushOutputSamples(const float* Samples, int32 Num)
 {
-	if (InMono.Num() == 0 || InSampleRate <= 0 || OutSampleRate <= 0)
-		return;
-
-	// Fast path: 48000 -> 24000 (downsample by 2)
-	if (InSampleRate == 48000 && OutSampleRate == 24000)
+	while (Num > 0)
 	{
-		const int32 InN = InMono.Num();
-		const int32 OutN = InN / 2;
-		const int32 Old = InOutMonoAccum.Num();
-		InOutMonoAccum.AddUninitialized(OutN);
+		const int32 Take = FMath::Min(Num, OutFrameSamples - FrameAccumNum);
+		FMemory::Memcpy(FrameAccum.GetData() + FrameAccumNum, Samples, Take * sizeof(float));
+
+		FrameAccumNum += Take;
+		Samples += Take;
+		Num -= Take;
 
-		for (int32 i = 0; i < OutN; ++i)
+		if (FrameAccumNum == OutFrameSamples)
 		{
-			// simple pick (could average 2 samples if desired)
-			InOutMonoAccum[Old + i] = InMono[i * 2];
+			PublishFrame();
 		}
-		return;
 	}
+}
 
-	// General linear resample
-	const double Ratio = (double)OutSampleRate / (double)InSampleRate; // out per in
-	const int32 InN = InMono.Num();
-	const int32 OutN = FMath::Max(1, (int32)FMath::FloorToInt((double)InN * Ratio));
+void UPTTAudioRecorderComponent::FCaptureImpl::PublishFrame()
+{
+	// 링이 가득 차도 VAD 상태(노이즈 바닥/행오버)는 계속 갱신
+	const uint32 VadFlags = bVadEnabled ? Vad.Process(FrameAccum.GetData(), OutFrameSamples) : 0u;
 
-	const int32 Old = InOutMonoAccum.Num();
-	InOutMonoAccum.AddUninitialized(OutN);
+	if (int16* Slot = FrameRing.BeginWrite())
+	{
+		VoiceAudioDSP::FloatToPcm16(FrameAccum.GetData(), Slot, OutFrameSamples);
+		FrameRing.SetWriteTag(VadFlags);
+		FrameRing.CommitWrite();
+		TotalOutSamples.fetch_add(OutFrameSamples, std::memory_order_relaxed);
+	}
+	else
+	{
+		// 게임 스레드가 밀려 링이 가득 참: 캡처 스레드는 기다리지 않고 버림
+		DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	FrameAccumNum = 0;
+}
+
+// ====== Game thread ======
+
+void UPTTAudioRecorderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	for (int32 i = 0; i < OutN; ++i)
+	DrainFrames();
+
+	if (bStopWhenSourceEnds && Capture.IsValid() && Capture->Source.IsValid() && Capture->Source->IsFinished() &&
+		Capture->bCapturing.load(std::memory_order_acquire))
 	{
-		const double InPos = (double)i / Ratio; // position in input
-		const int32 i0 = FMath::Clamp((int32)FMath::FloorToInt(InPos), 0, InN - 1);
-		const int32 i1 = FMath::Clamp(i0 + 1, 0, InN - 1);
-		const double t = InPos - (double)i0;
-
-		const float s0 = InMono[i0];
-		const float s1 = InMono[i1];
-		InOutMonoAccum[Old + i] = FMath::Lerp(s0, s1, (float)t);
+		StopPTT();
 	}
 }
 
-void UPTTAudioRecorderComponent::EmitFrames_Locked()
+void UPTTAudioRecorderComponent::DrainFrames()
 {
 	if (!Capture.IsValid())
 		return;
 
-	// accum = output SR mono float
-	const int32 FrameSamples = Capture->OutFrameSamples;
-	if (FrameSamples <= 0)
+	FCaptureImpl& C = *Capture;
+	const int32 NumBytes = C.OutFrameSamples * sizeof(int16);
+	if (C.FrameBytes.Num() != NumBytes)
 		return;
 
-	while (Capture->MonoFloatAccum.Num() >= FrameSamples)
+	while (const int16* Slot = C.FrameRing.Peek())
 	{
-		// Pop first FrameSamples from accum
-		TArray<uint8> Bytes;
-		Bytes.Reserve(FrameSamples * sizeof(int16));
+		const bool bSpeech = !C.bVadEnabled || (C.FrameRing.PeekTag() & FVoiceActivityDetector::FlagSpeech) != 0;
 
-		for (int32 i = 0; i < FrameSamples; ++i)
+		if (C.bVadEnabled && bSpeech != C.bInSpeech)
 		{
-			const int16 P = FloatToPcm16(Capture->MonoFloatAccum[i]);
-			Bytes.Append(reinterpret_cast<const uint8*>(&P), sizeof(int16));
+			C.bInSpeech = bSpeech;
+			if (bSpeech)
+			{
+				++C.SpeechSegments;
+			}
+			OnVoiceActivity.Broadcast(bSpeech);
+
+			if (bSpeech)
+			{
+				FlushPreRoll();
+			}
 		}
 
-		// Remove used samples
-		Capture->MonoFloatAccum.RemoveAt(0, FrameSamples, false);
+		if (bSpeech)
+		{
+			++C.SpeechFrames;
+		}
+
+		if (bSpeech || !bGateSilence)
+		{
+			EmitFrame(reinterpret_cast<const uint8*>(Slot));
+		}
+		else if (C.PreRollSlots > 0)
+		{
+			// 게이트 닫힘: 최근 프레임만 프리롤 링에 남김
+			FMemory::Memcpy(C.PreRoll.GetData() + C.PreRollHead * NumBytes, Slot, NumBytes);
+			C.PreRollHead = (C.PreRollHead + 1) % C.PreRollSlots;
+			C.PreRollCount = FMath::Min(C.PreRollCount + 1, C.PreRollSlots);
+		}
 
-		Capture->TotalOutSamples += FrameSamples;
+		C.FrameRing.Pop();
+	}
+}
+
+void UPTTAudioRecorderComponent::EmitFrame(const uint8* Pcm16)
+{
+	FCaptureImpl& C = *Capture;
+
+	// PCM16 LE (모든 대상 플랫폼이 little-endian)
+	FMemory::Memcpy(C.FrameBytes.GetData(), Pcm16, C.FrameBytes.Num());
+	C.Utterance.Append(Pcm16, C.FrameBytes.Num());
+
+	OnPcm16FrameReady.Broadcast(C.FrameBytes, C.OutSampleRate, 1, C.FrameDurationSec);
+}
+
+void UPTTAudioRecorderComponent::FlushPreRoll()
+{
+	FCaptureImpl& C = *Capture;
+	if (!bGateSilence || C.PreRollCount == 0)
+		return;
 
-		// NOTE: Broadcasting while holding lock is okay if receivers are lightweight,
-		// but safer is unlock then broadcast. 여기선 간단히 "복사본"만 만들어서 락 풀고 브로드캐스트.
-		const int32 SR = Capture->OutSampleRate;
-		const float Dur = Capture->FrameDurationSec;
+	const int32 NumBytes = C.FrameBytes.Num();
+	const int32 First = (C.PreRollHead - C.PreRollCount + C.PreRollSlots) % C.PreRollSlots;
+	const int32 Count = C.PreRollCount;
+	C.PreRollCount = 0;
 
-		// unlock-broadcast pattern
-		Capture->Mutex.Unlock();
-		OnPcm16FrameReady.Broadcast(Bytes, SR, 1, Dur);
-		Capture->Mutex.Lock();
+	for (int32 k = 0; k < Count; ++k)
+	{
+		EmitFrame(C.PreRoll.GetData() + ((First + k) % C.PreRollSlots) * NumBytes);
 	}
 }
 
-void UPTTAudioRecorderComponent::WriteWaveFilePCM16(const TArray<int16>& Pcm16, int32 SampleRate, int32 NumChannels, TArray<uint8>& OutWavBytes)
+int32 UPTTAudioRecorderComponent::GetDroppedFrameCount() const
 {
-	const int16 BitsPerSample = 16;
-	const int32 ByteRate = SampleRate * NumChannels * (BitsPerSample / 8);
-	const int16 BlockAlign = NumChannels * (BitsPerSample / 8);
+	return Capture.IsValid() ? Capture->DroppedFrames.load(std::memory_order_relaxed) : 0;
+}
 
-	const int32 DataSize = Pcm16.Num() * sizeof(int16);
-	const int32 RiffChunkSize = 36 + DataSize;
+FString UPTTAudioRecorderComponent::MakeWavPath(const FString& OptionalWavPath) const
+{
+	if (!OptionalWavPath.IsEmpty())
+		return OptionalWavPath;
 
-	auto AppendStr4 = [&](const char* S) { OutWavBytes.Append(reinterpret_cast<const uint8*>(S), 4); };
-	auto Append32 = [&](int32 V) { OutWavBytes.Append(reinterpret_cast<uint8*>(&V), 4); };
-	auto Append16 = [&](int16 V) { OutWavBytes.Append(reinterpret_cast<uint8*>(&V), 2); };
+	const FString Dir = DiagnosticWavDir.IsEmpty() ? FPaths::ProjectSavedDir() / TEXT("PTT") : DiagnosticWavDir;
+	return Dir / FString::Printf(TEXT("PTT_%s.wav"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S_%s")));
+}
 
-	OutWavBytes.Reset();
+void UPTTAudioRecorderComponent::SetCaptureSource(const FVoiceCaptureSourcePtr& InSource)
+{
+	CaptureSourceOverride = InSource;
+	CaptureWavClip.Reset();
+}
 
-	AppendStr4("RIFF"); Append32(RiffChunkSize); AppendStr4("WAVE");
+bool UPTTAudioRecorderComponent::UseWavCaptureSource(const FString& WavPath, float Speed, bool bLoop)
+{
+	FVoiceBufferSourceSettings Settings;
+	Settings.Speed = Speed;
+	Settings.bLoop = bLoop;
+
+	// 지금 한 번 디코딩해 두고 PTT마다 재사용 (경로 오류도 여기서 드러남)
+	FString Error;
+	FVoiceUtterancePtr Clip = FVoiceBufferCaptureSource::LoadWavClip(WavPath, Error);
+	if (!Clip.IsValid())
+	{
+		UE_LOG(LogPTTRecorder, Error, TEXT("[PTT] %s"), *Error);
+		return false;
+	}
+
+	CaptureSourceOverride.Reset();
+	CaptureWavClip = MoveTemp(Clip);
+	CaptureWavSettings = Settings;
+	return true;
+}
 
-	AppendStr4("fmt "); Append32(16);
-	Append16(1); // PCM
-	Append16((int16)NumChannels);
-	Append32(SampleRate);
-	Append32(ByteRate);
-	Append16(BlockAlign);
-	Append16(BitsPerSample);
+FVoiceCaptureSourcePtr UPTTAudioRecorderComponent::CreateCaptureSource()
+{
+	if (CaptureSourceOverride.IsValid())
+		return CaptureSourceOverride;
+
+	// 헤드리스 실행: -PTTCaptureWav=Tests/Audio/report.wav [-PTTCaptureSpeed=4]
+	// 명령줄은 첫 PTT에서 한 번만 보고, 파일도 그때 한 번만 디코딩
+	if (!bCaptureWavCmdLineChecked)
+	{
+		bCaptureWavCmdLineChecked = true;
 
-	AppendStr4("data"); Append32(DataSize);
-	OutWavBytes.Append(reinterpret_cast<const uint8*>(Pcm16.GetData()), DataSize);
+		FString WavPath;
+		if (!CaptureWavClip.IsValid() && FParse::Value(FCommandLine::Get(), TEXT("PTTCaptureWav="), WavPath))
+		{
+			float Speed = 1.f;
+			FParse::Value(FCommandLine::Get(), TEXT("PTTCaptureSpeed="), Speed);
+
+			if (!UseWavCaptureSource(WavPath, Speed))
+			{
+				UE_LOG(LogPTTRecorder, Error, TEXT("[PTT] -PTTCaptureWav unusable. Falling back to the capture device."));
+			}
+		}
+	}
+
+	if (CaptureWavClip.IsValid())
+		return MakeShared<FVoiceBufferCaptureSource, ESPMode::ThreadSafe>(CaptureWavClip, CaptureWavSettings);
+
+	return MakeShared<FVoiceDeviceCaptureSource, ESPMode::ThreadSafe>();
 }
 
 void UPTTAudioRecorderComponent::StartPTT()
@@ -166,75 +265,113 @@ void UPTTAudioRecorderComponent::StartPTT()
 		Capture = MakeUnique<FCaptureImpl>();
 	}
 
+	if (Capture->bCapturing.load(std::memory_order_acquire))
+		return;
+
+	// 스트림이 닫혀 있으므로 캡처 스레드 쪽 상태도 여기서 안전하게 준비 가능
 	{
-		FScopeLock Lock(&Capture->Mutex);
-		if (Capture->bCapturing)
-			return;
+		FCaptureImpl& C = *Capture;
 
-		Capture->bCapturing = false;
-		Capture->InSampleRate = 0;
-		Capture->InNumChannels = 0;
+		C.Source = CreateCaptureSource();
 
-		Capture->OutSampleRate = FMath::Max(8000, OutputSampleRate);
-		Capture->OutNumChannels = 1;
+		C.InSampleRate = 0;
+		C.InNumChannels = 0;
 
-		Capture->FrameDurationSec = FMath::Clamp(FrameDurationSec, 0.01f, 0.08f);
-		Capture->OutFrameSamples = FMath::Max(1, (int32)FMath::RoundToInt((float)Capture->OutSampleRate * Capture->FrameDurationSec));
+		C.OutSampleRate = FMath::Max(8000, OutputSampleRate);
+		C.OutNumChannels = 1;
 
-		Capture->MonoFloatAccum.Reset();
-		Capture->TotalOutSamples = 0;
-	}
+		C.FrameDurationSec = FMath::Clamp(FrameDurationSec, 0.01f, 0.08f);
+		C.OutFrameSamples = FMath::Max(1, (int32)FMath::RoundToInt((float)C.OutSampleRate * C.FrameDurationSec));
 
-	Audio::FAudioCaptureDeviceParams Params;
-	Params.DeviceIndex = INDEX_NONE;
-
-	Audio::FOnAudioCaptureFunction OnCapture =
-		[this](const void* InAudio, int32 NumFrames, int32 NumChannels, int32 SampleRate, double /*StreamTime*/, bool /*bOverflow*/)
+		// 안티앨리어싱 필터는 디바이스 SR 기준으로 여기서 생성 (캡처 스레드에서 할당하지 않도록)
+		int32 ExpectedInRate = DesiredSampleRate;
+		if (C.Source->GetExpectedSampleRate() > 0)
 		{
-			if (!Capture.IsValid())
-				return;
+			ExpectedInRate = C.Source->GetExpectedSampleRate();
+		}
+		C.Resampler.Init(FMath::Max(MinInputSampleRate, ExpectedInRate), C.OutSampleRate);
 
-			FScopeLock Lock(&Capture->Mutex);
+		// 최악의 경우(MinInputSampleRate 입력)까지 담을 수 있게 미리 할당
+		C.MonoScratch.SetNumUninitialized(CaptureChunkFrames);
+		C.ResampleScratch.SetNumUninitialized(FVoicePolyphaseResampler::GetMaxOutput(CaptureChunkFrames, MinInputSampleRate, C.OutSampleRate));
+		C.FrameAccum.SetNumZeroed(C.OutFrameSamples);
+		C.FrameAccumNum = 0;
 
-			if (!Capture->bCapturing)
-				return;
+		const int32 RingSlots = FMath::CeilToInt(FMath::Clamp(CaptureRingSeconds, 0.1f, 5.0f) / C.FrameDurationSec);
+		C.FrameRing.Init(RingSlots, C.OutFrameSamples);
+		C.FrameBytes.SetNumUninitialized(C.OutFrameSamples * sizeof(int16));
 
-			Capture->InSampleRate = SampleRate;
-			Capture->InNumChannels = NumChannels;
+		C.TotalOutSamples.store(0, std::memory_order_relaxed);
+		C.DroppedFrames.store(0, std::memory_order_relaxed);
 
-			const float* AudioFloats = static_cast<const float*>(InAudio);
+		// VAD: 노이즈 바닥은 이전 송신에서 배운 값을 이어 씀
+		C.bVadEnabled = bEnableVAD;
+		if (bEnableVAD)
+		{
+			FVoiceActivityDetector::FSettings VadSettings;
+			VadSettings.MarginDb = VADMarginDb;
+			VadSettings.HangoverSec = VADHangoverSec;
+			C.Vad.Init(VadSettings, C.FrameDurationSec);
+		}
 
-			// 1) downmix to mono float
-			TArray<float> Mono;
-			DownmixToMono(AudioFloats, NumFrames, NumChannels, Mono);
+		C.PreRollSlots = (bEnableVAD && bGateSilence) ? FMath::RoundToInt(FMath::Clamp(VADPreRollSec, 0.f, 0.5f) / C.FrameDurationSec) : 0;
+		C.PreRoll.SetNumUninitialized(C.PreRollSlots * C.OutFrameSamples * sizeof(int16));
+		C.PreRollHead = 0;
+		C.PreRollCount = 0;
+		C.bInSpeech = false;
+		C.SpeechFrames = 0;
+		C.SpeechSegments = 0;
+		LastSpeechSec = 0.f;
+
+		// 발화 버퍼는 풀에서 (이전 발화를 STT가 아직 들고 있으면 다른 버퍼)
+		if (bKeepUtterance)
+		{
+			C.Utterance.Begin(C.OutSampleRate, 1, ExpectedUtteranceSec, MaxUtteranceSec);
+		}
+		else
+		{
+			C.Utterance.Reset();
+		}
+	}
 
-			// 2) resample mono -> output sample rate, append into accum
-			ResampleMono(Mono, SampleRate, Capture->MonoFloatAccum, Capture->OutSampleRate);
+	FVoiceCaptureCallback OnCapture =
+		[this](const float* InAudio, int32 NumFrames, int32 NumChannels, int32 SampleRate)
+		{
+			// 캡처 스레드: 할당/락/브로드캐스트 없음. 프레임은 TickComponent에서 게임 스레드로 전달
+			FCaptureImpl* C = Capture.Get();
+			if (!C || !C->bCapturing.load(std::memory_order_acquire))
+				return;
 
-			// 3) emit frames if enough
-			// lock is held. EmitFrames_Locked will unlock-broadcast-lock internally.
-			EmitFrames_Locked();
+			C->ProcessInput(InAudio, NumFrames, NumChannels, SampleRate);
 		};
 
-	constexpr uint32 NumFramesDesired = 1024;
+	constexpr int32 NumFramesDesired = 1024;
 
-	if (!Capture->AudioCapture.OpenAudioCaptureStream(Params, MoveTemp(OnCapture), NumFramesDesired))
+	FString OpenError;
+	if (!Capture->Source->Open(MoveTemp(OnCapture), NumFramesDesired, OpenError))
 	{
-		OnCaptureFinalized.Broadcast(false, 0.f, TEXT("Failed to open audio capture stream"));
+		Capture->Source.Reset();
+		Capture->Utterance.Reset();
+		OnCaptureFinalized.Broadcast(false, 0.f, OpenError);
 		return;
 	}
 
-	if (!Capture->AudioCapture.StartStream())
+	// 콜백이 시작되기 전에 켜 둠
+	Capture->bCapturing.store(true, std::memory_order_release);
+
+	if (!Capture->Source->Start())
 	{
-		Capture->AudioCapture.CloseStream();
+		Capture->bCapturing.store(false, std::memory_order_release);
+		Capture->Source->Stop();
+		Capture->Source.Reset();
+		Capture->Utterance.Reset();
 		OnCaptureFinalized.Broadcast(false, 0.f, TEXT("Failed to start audio capture stream"));
 		return;
 	}
 
-	{
-		FScopeLock Lock(&Capture->Mutex);
-		Capture->bCapturing = true;
-	}
+	UE_LOG(LogPTTRecorder, Verbose, TEXT("[PTT] Capture started (source=%s)"), Capture->Source->GetName());
+
+	SetComponentTickEnabled(true);
 }
 
 void UPTTAudioRecorderComponent::StopPTT()
@@ -257,12 +394,7 @@ void UPTTAudioRecorderComponent::StopInternal(bool bSaveWav, const FString& Opti
 		return;
 	}
 
-	bool bWasCapturing = false;
-	{
-		FScopeLock Lock(&Capture->Mutex);
-		bWasCapturing = Capture->bCapturing;
-		Capture->bCapturing = false;
-	}
+	const bool bWasCapturing = Capture->bCapturing.exchange(false, std::memory_order_acq_rel);
 
 	if (!bWasCapturing)
 	{
@@ -272,61 +404,75 @@ void UPTTAudioRecorderComponent::StopInternal(bool bSaveWav, const FString& Opti
 		return;
 	}
 
-	// Stop/Close stream
-	Capture->AudioCapture.StopStream();
-	Capture->AudioCapture.CloseStream();
+	// Stop/Close stream (반환 후에는 콜백이 오지 않음)
+	Capture->Source->Stop();
+	Capture->Source.Reset();
 
-	// Flush remainder (optional)
-	float TotalDurationSec = 0.f;
-	TArray<int16> AllPcm16; // only for legacy save (optional)
-	int32 SR = OutputSampleRate;
+	// 여기부터 캡처 스레드는 멈춰 있으므로 producer 상태를 게임 스레드에서 만져도 됨
+	FCaptureImpl& C = *Capture;
 
+	// Flush remainder (optional): 남은 샘플을 0으로 패딩해서 1프레임 방출
+	if (bFlushRemainderOnStop && C.FrameAccumNum > 0)
 	{
-		FScopeLock Lock(&Capture->Mutex);
+		FMemory::Memzero(C.FrameAccum.GetData() + C.FrameAccumNum, (C.OutFrameSamples - C.FrameAccumNum) * sizeof(float));
+		C.PublishFrame();
+	}
+	C.FrameAccumNum = 0;
 
-		SR = Capture->OutSampleRate;
-		const int32 FrameSamples = Capture->OutFrameSamples;
+	DrainFrames();
+	SetComponentTickEnabled(false);
 
-		if (bFlushRemainderOnStop && Capture->MonoFloatAccum.Num() > 0)
-		{
-			// emit full frames already possible
-			EmitFrames_Locked();
-
-			// if still has remainder < FrameSamples, you can choose:
-			// (a) pad to full frame and emit one last frame
-			// (b) drop remainder
-			// 여기서는 "패딩 후 1프레임 방출"로 처리
-			if (Capture->MonoFloatAccum.Num() > 0)
-			{
-				const int32 Rem = Capture->MonoFloatAccum.Num();
-				const int32 Pad = FMath::Max(0, FrameSamples - Rem);
-				if (Pad > 0)
-				{
-					Capture->MonoFloatAccum.AddZeroed(Pad);
-				}
-				EmitFrames_Locked();
-			}
-		}
+	// 발화 경계 닫기
+	if (C.bVadEnabled && C.bInSpeech)
+	{
+		C.bInSpeech = false;
+		OnVoiceActivity.Broadcast(false);
+	}
 
-		TotalDurationSec = (SR > 0) ? ((float)Capture->TotalOutSamples / (float)SR) : 0.f;
+	const int32 SR = C.OutSampleRate;
+	const float TotalDurationSec = (SR > 0) ? ((float)C.TotalOutSamples.load(std::memory_order_relaxed) / (float)SR) : 0.f;
 
-		if (bSaveWav)
-		{
-			// For wav save: we don't have "all samples" unless we also accumulated them.
-			// 간단하게: frame을 뿌리는 누적 과정에서 전체를 쌓지 않았기 때문에
-			// 여기서는 "Stop 직전 accum을 포함해 남아있는 샘플만"으로는 부족함.
-			// => WAV 저장 기능을 계속 쓰려면, 별도 FullAccum을 두거나, 기존 방식으로 Buffer를 따로 유지해야 함.
-			// 실무에서는 보통 Realtime 모드에서 WAV 저장을 끄므로, 명확히 실패 처리.
-			AllPcm16.Reset();
-		}
+	LastSpeechSec = C.SpeechFrames * C.FrameDurationSec;
+	if (C.bVadEnabled)
+	{
+		UE_LOG(LogPTTRecorder, Log, TEXT("[PTT] VAD: speech %.2fs of %.2fs, segments=%d, noise floor %.1f dBFS%s"),
+			LastSpeechSec, TotalDurationSec, C.SpeechSegments, C.Vad.GetNoiseFloorDb(), bGateSilence ? TEXT(" (silence gated)") : TEXT(""));
+	}
+
+	const int32 Dropped = C.DroppedFrames.load(std::memory_order_relaxed);
+	if (Dropped > 0)
+	{
+		UE_LOG(LogPTTRecorder, Warning, TEXT("[PTT] %d frame(s) dropped: capture ring full (CaptureRingSeconds=%.2f)"), Dropped, CaptureRingSeconds);
 	}
 
 	OnCaptureFinalized.Broadcast(true, TotalDurationSec, FString::Printf(TEXT("Captured %.2fs @ %dHz mono"), TotalDurationSec, SR));
 
-	// Legacy WAV save: 명시적으로 비활성 처리(설계상 충돌 방지)
-	if (bSaveWav)
+	const FVoiceUtterancePtr Utterance = C.Utterance.Finish();
+	if (Utterance.IsValid())
 	{
-		OnWavReady.Broadcast(false, TEXT("WAV save disabled in Realtime-streaming mode (no full buffer)."));
+		OnUtteranceReady.Broadcast(Utterance);
+	}
+
+	// WAV는 요청했을 때만, 백그라운드에서. 게임 스레드는 디스크를 기다리지 않음
+	if (bSaveWav || bSaveDiagnosticWav)
+	{
+		if (!Utterance.IsValid())
+		{
+			if (bSaveWav)
+				OnWavReady.Broadcast(false, bKeepUtterance ? TEXT("No audio captured") : TEXT("bKeepUtterance is off (no full buffer)"));
+			return;
+		}
+
+		TWeakObjectPtr<UPTTAudioRecorderComponent> WeakThis(this);
+		VoiceUtteranceIO::WriteWavAsync(Utterance, MakeWavPath(OptionalWavPath),
+			[WeakThis, bSaveWav](bool bOk, const FString& PathOrError)
+			{
+				UPTTAudioRecorderComponent* Self = WeakThis.Get();
+				if (Self && bSaveWav)
+				{
+					Self->OnWavReady.Broadcast(bOk, PathOrError);
+				}
+			});
 	}
 }
 
@@ -334,18 +480,12 @@ void UPTTAudioRecorderComponent::EndPlay(const EEndPlayReason::Type EndPlayReaso
 {
 	if (Capture.IsValid())
 	{
-		bool bWasCapturing = false;
-		{
-			FScopeLock Lock(&Capture->Mutex);
-			bWasCapturing = Capture->bCapturing;
-			Capture->bCapturing = false;
-		}
-
-		if (bWasCapturing)
+		if (Capture->bCapturing.exchange(false, std::memory_order_acq_rel))
 		{
-			Capture->AudioCapture.StopStream();
-			Capture->AudioCapture.CloseStream();
+			Capture->Source->Stop();
 		}
+		Capture->Source.Reset();
+		Capture->Utterance.Reset();
 	}
 
 	Super::EndPlay(EndPlayReason);
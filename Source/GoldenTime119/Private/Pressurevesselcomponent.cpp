@@ -11,7 +11,17 @@ DEFINE_LOG_CATEGORY_STATIC(LogPressureVessel, Log, All);
 UPressureVesselComponent::UPressureVesselComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.bStartWithTickEnabled = true;
+    //   ޱ   ִ (OnHeatActivityBegin )
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+namespace
+{
+    // FInterpTo(Cur, Target, dt, Speed) dt -> 0   .  ũ 
+    float ExpApproach(float Current, float Target, float Step, float Rate)
+    {
+        return Target + (Current - Target) * FMath::Exp(-Rate * Step);
+    }
 }
 
 void UPressureVesselComponent::BeginPlay()
@@ -25,6 +35,7 @@ void UPressureVesselComponent::BeginPlay()
         if (IsValid(Comb))
         {
             LinkedCombustible = Comb;
+            Comb->OnHeatActivityBegin.AddDynamic(this, &UPressureVesselComponent::HandleCombustibleHeatActivity);
             UE_LOG(LogPressureVessel, Warning, TEXT("[Vessel] LinkedCombustible found: %s"), *GetNameSafe(Owner));
         }
         else
@@ -39,10 +50,87 @@ void UPressureVesselComponent::BeginPlay()
     InternalTemperature = 25.0f;
     WallTemperature = 25.0f;
 
+    LastSimTime = GetWorldTime();
+    bSleeping = true;
+
+    // ̹ ޱ   ġ 
+    if (IsValid(LinkedCombustible) && LinkedCombustible->HasHeatActivity())
+    {
+        WakeUp();
+    }
+
     UE_LOG(LogPressureVessel, Warning, TEXT("[Vessel] BeginPlay Owner=%s Capacity=%.1fL Fill=%.1f%%"),
         *GetNameSafe(Owner), VesselCapacityLiters, LiquidFillLevel01 * 100.f);
 }
 
+void UPressureVesselComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (IsValid(LinkedCombustible))
+    {
+        LinkedCombustible->OnHeatActivityBegin.RemoveDynamic(this, &UPressureVesselComponent::HandleCombustibleHeatActivity);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+float UPressureVesselComponent::GetWorldTime() const
+{
+    return GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+}
+
+void UPressureVesselComponent::ApplySimulationTickInterval()
+{
+    SetComponentTickInterval(SimulationHz > KINDA_SMALL_NUMBER ? 1.f / SimulationHz : 0.f);
+}
+
+// ===== Sleep / Wake =====
+
+void UPressureVesselComponent::HandleCombustibleHeatActivity(UCombustibleComponent* /*Combustible*/)
+{
+    WakeUp();
+}
+
+void UPressureVesselComponent::WakeUp()
+{
+    if (!bSleeping || VesselState == EPressureVesselState::Ruptured)
+        return;
+
+    //    Է Ƿ ð   
+    const float Now = GetWorldTime();
+    CoolTowardAmbient(FMath::Max(0.f, Now - LastSimTime));
+    LastSimTime = Now;
+
+    bSleeping = false;
+    ApplySimulationTickInterval();
+    SetComponentTickEnabled(true);
+
+    UE_LOG(LogPressureVessel, Verbose, TEXT("[Vessel] Wake: %s"), *GetNameSafe(GetOwner()));
+}
+
+bool UPressureVesselComponent::CanSleep(bool bIsBeingHeated) const
+{
+    if (bIsBeingHeated || bSafetyValveOpen)
+        return false;
+
+    if (VesselState != EPressureVesselState::Normal)
+        return false;
+
+    //   Ȱ̸  ˸  Ƿ  ִ´
+    if (IsValid(LinkedCombustible) && LinkedCombustible->HasHeatActivity())
+        return false;
+
+    return true;
+}
+
+void UPressureVesselComponent::GoToSleep(float Now)
+{
+    LastSimTime = Now;
+    bSleeping = true;
+    SetComponentTickEnabled(false);
+
+    UE_LOG(LogPressureVessel, Verbose, TEXT("[Vessel] Sleep: %s (WallTemp=%.1f)"), *GetNameSafe(GetOwner()), WallTemperature);
+}
+
 void UPressureVesselComponent::EnsureComponentsCreated()
 {
     AActor* Owner = GetOwner();
@@ -108,19 +196,52 @@ void UPressureVesselComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
     if (VesselState == EPressureVesselState::Ruptured)
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    StepSimulation(GetWorldTime());
+}
+
+void UPressureVesselComponent::StepSimulation(float Now)
+{
+    // ƽ     ¶ . ġ ߶󳽴
+    const float Step = FMath::Clamp(Now - LastSimTime, 0.f, 0.5f);
+    LastSimTime = Now;
+
+    if (Step <= 0.f)
         return;
 
-    DetectHeatFromCombustible(DeltaTime);
-    UpdatePressureAndTemperature(DeltaTime);
-    UpdateSafetyValve(DeltaTime);
-    UpdateVesselState();
+    const float HeatInputRate = DetectHeatFromCombustible();
+    if (HeatInputRate > KINDA_SMALL_NUMBER)
+    {
+        LastHeatInputTime = Now;
+
+        if (HeatingStartTime < 0.f)
+        {
+            HeatingStartTime = Now;
+            UE_LOG(LogPressureVessel, Warning, TEXT("[Vessel] Heating started!"));
+        }
+    }
+
+    const bool bIsBeingHeated = (Now - LastHeatInputTime) < HeatMemorySec;
+
+    UpdatePressureAndTemperature(Step, HeatInputRate, bIsBeingHeated);
+    UpdateSafetyValve(Step);
+    UpdateVesselState(bIsBeingHeated);
     CheckBLEVECondition();
+
+    if (VesselState != EPressureVesselState::Ruptured && CanSleep(bIsBeingHeated))
+    {
+        GoToSleep(Now);
+    }
 }
 
-void UPressureVesselComponent::DetectHeatFromCombustible(float DeltaTime)
+float UPressureVesselComponent::DetectHeatFromCombustible()
 {
     if (!IsValid(LinkedCombustible))
-        return;
+        return 0.f;
 
     float HeatInput = 0.f;
 
@@ -138,28 +259,24 @@ void UPressureVesselComponent::DetectHeatFromCombustible(float DeltaTime)
             HeatInput, IgnitionProgress, LinkedCombustible->IsBurning());
     }
 
-    if (HeatInput > KINDA_SMALL_NUMBER)
-    {
-        AccumulatedHeat += HeatInput * ExternalHeatMultiplier * DeltaTime;
-        LastHeatInputTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-
-        if (HeatingStartTime < 0.f)
-        {
-            HeatingStartTime = LastHeatInputTime;
-            UE_LOG(LogPressureVessel, Warning, TEXT("[Vessel] Heating started!"));
-        }
-    }
+    return FMath::Max(0.f, HeatInput * ExternalHeatMultiplier);
 }
 
-void UPressureVesselComponent::UpdatePressureAndTemperature(float DeltaTime)
+void UPressureVesselComponent::UpdatePressureAndTemperature(float Step, float HeatInputRate, bool bIsBeingHeated)
 {
-    const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-    const bool bIsBeingHeated = (CurrentTime - LastHeatInputTime) < 1.0f;
-
-    if (bIsBeingHeated && AccumulatedHeat > 0.f)
+    if (bIsBeingHeated && (AccumulatedHeat > 0.f || HeatInputRate > 0.f))
     {
-        const float HeatThisFrame = AccumulatedHeat * DeltaTime * 0.1f;
-        AccumulatedHeat *= 0.95f;
+        // dA/dt = I - k*A    Ȯ  (I   )
+        //   A(t)   = A* + (A0 - A*) e^{-kt},  A* = I/k
+        //   A dt  = A*h + (A0 - A*)(1 - e^{-kh})/k
+        const float K = FMath::Max(HeatAbsorbRatePerSec, 0.01f);
+        const float SteadyHeat = HeatInputRate / K;
+        const float Decay = FMath::Exp(-K * Step);
+        const float HeatIntegral = SteadyHeat * Step + (AccumulatedHeat - SteadyHeat) * (1.f - Decay) / K;
+
+        AccumulatedHeat = SteadyHeat + (AccumulatedHeat - SteadyHeat) * Decay;
+
+        const float HeatThisFrame = HeatIntegral * 0.1f;
 
         WallTemperature += HeatThisFrame * TempRisePerHeat * (1.f - LiquidFillLevel01 * 0.3f);
 
@@ -179,9 +296,7 @@ void UPressureVesselComponent::UpdatePressureAndTemperature(float DeltaTime)
     }
     else
     {
-        WallTemperature = FMath::FInterpTo(WallTemperature, 25.f, DeltaTime, 0.02f);
-        InternalTemperature = FMath::FInterpTo(InternalTemperature, 25.f, DeltaTime, 0.01f);
-        InternalPressure = FMath::FInterpTo(InternalPressure, BasePressure, DeltaTime, 0.05f);
+        CoolTowardAmbient(Step);
     }
 
     WallTemperature = FMath::Clamp(WallTemperature, -50.f, 800.f);
@@ -189,9 +304,24 @@ void UPressureVesselComponent::UpdatePressureAndTemperature(float DeltaTime)
     InternalPressure = FMath::Clamp(InternalPressure, 0.f, 50.f);
 }
 
+void UPressureVesselComponent::CoolTowardAmbient(float Step)
+{
+    if (Step <= 0.f)
+        return;
+
+    WallTemperature = ExpApproach(WallTemperature, 25.f, Step, 0.02f);
+    InternalTemperature = ExpApproach(InternalTemperature, 25.f, Step, 0.01f);
+    InternalPressure = ExpApproach(InternalPressure, BasePressure, Step, 0.05f);
+
+    WallTemperature = FMath::Clamp(WallTemperature, -50.f, 800.f);
+    InternalTemperature = FMath::Clamp(InternalTemperature, -50.f, 500.f);
+    InternalPressure = FMath::Clamp(InternalPressure, 0.f, 50.f);
+}
+
 void UPressureVesselComponent::UpdateSafetyValve(float DeltaTime)
 {
     const bool bShouldVent = !bSafetyValveFailed && (InternalPressure >= SafetyValveActivationPressure);
+    bSafetyValveOpen = bShouldVent;
 
     if (bShouldVent)
     {
@@ -203,6 +333,10 @@ void UPressureVesselComponent::UpdateSafetyValve(float DeltaTime)
             0.f, 1.f
         );
 
+        //  Ⱑ ǹ ְ ٲ 쿡 ƼŬ Ķ/̺Ʈ 
+        const bool bPushVentStrength = LastPushedVentStrength01 < 0.f
+            || FMath::Abs(SafetyValveVentStrength01 - LastPushedVentStrength01) >= VentStrengthPushStep;
+
         // ƼŬ
         if (IsValid(SafetyValvePSC))
         {
@@ -210,7 +344,10 @@ void UPressureVesselComponent::UpdateSafetyValve(float DeltaTime)
             {
                 SafetyValvePSC->ActivateSystem(true);
             }
-            SafetyValvePSC->SetFloatParameter(TEXT("VentStrength"), SafetyValveVentStrength01);
+            if (bPushVentStrength)
+            {
+                SafetyValvePSC->SetFloatParameter(TEXT("VentStrength"), SafetyValveVentStrength01);
+            }
         }
 
         // :    & ġ Ʈ
@@ -236,22 +373,41 @@ void UPressureVesselComponent::UpdateSafetyValve(float DeltaTime)
                 TargetPitch = FMath::Lerp(TargetPitch, SafetyValvePitchMax, Boost);
             }
 
-            const float CurrentPitch = SafetyValveAudioComp->PitchMultiplier;
-            const float NewPitch = FMath::FInterpTo(
-                CurrentPitch,
+            //  ü  (Ʈ    ٲ -> Ӵ  ȭ   ̴  )
+            if (SafetyValvePitch < 0.f)
+            {
+                SafetyValvePitch = SafetyValveAudioComp->PitchMultiplier;
+            }
+            SafetyValvePitch = FMath::FInterpTo(
+                SafetyValvePitch,
                 TargetPitch,
                 DeltaTime,
                 SafetyValvePitchInterpSpeed
             );
 
-            SafetyValveAudioComp->SetPitchMultiplier(NewPitch);
+            // ġ     Ƿ     ־ 
+            const bool bPushPitch = LastPushedSafetyValvePitch < 0.f
+                || FMath::Abs(SafetyValvePitch - LastPushedSafetyValvePitch) >= SafetyValvePitchPushStep
+                || (FMath::IsNearlyEqual(SafetyValvePitch, TargetPitch, SafetyValvePitchPushStep)
+                    && SafetyValvePitch != LastPushedSafetyValvePitch);
+
+            if (bPushPitch)
+            {
+                SafetyValveAudioComp->SetPitchMultiplier(SafetyValvePitch);
+                LastPushedSafetyValvePitch = SafetyValvePitch;
+            }
         }
 
-        OnSafetyValveVenting.Broadcast(SafetyValveVentStrength01);
+        if (bPushVentStrength)
+        {
+            LastPushedVentStrength01 = SafetyValveVentStrength01;
+            OnSafetyValveVenting.Broadcast(SafetyValveVentStrength01);
+        }
     }
     else
     {
         SafetyValveVentStrength01 = 0.f;
+        LastPushedVentStrength01 = -1.f;
 
         if (IsValid(SafetyValvePSC) && SafetyValvePSC->IsActive())
         {
@@ -265,16 +421,13 @@ void UPressureVesselComponent::UpdateSafetyValve(float DeltaTime)
     }
 }
 
-void UPressureVesselComponent::UpdateVesselState()
+void UPressureVesselComponent::UpdateVesselState(bool bIsBeingHeated)
 {
     if (VesselState == EPressureVesselState::Ruptured)
         return;
 
     EPressureVesselState NewState = VesselState;
 
-    const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
-    const bool bIsBeingHeated = (CurrentTime - LastHeatInputTime) < 1.0f;
-
     if (InternalPressure >= CriticalPressure)
     {
         NewState = EPressureVesselState::Critical;
@@ -360,6 +513,7 @@ void UPressureVesselComponent::CheckBLEVECondition()
 void UPressureVesselComponent::ExecuteBLEVE()
 {
     SetVesselState(EPressureVesselState::Ruptured);
+    SetComponentTickEnabled(false);
 
     AActor* Owner = GetOwner();
     if (!IsValid(Owner)) return;
@@ -385,15 +539,15 @@ void UPressureVesselComponent::ExecuteBLEVE()
 
     if (FireballClass && GetWorld())
     {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-        AFireballActor* Fireball = GetWorld()->SpawnActor<AFireballActor>(
-            FireballClass, ExplosionLoc, FRotator::ZeroRotator, SpawnParams);
+        // BeginPlay ĺ /ǳ ϹǷ ݰ/ӽð  ְ  Ϸ
+        AFireballActor* Fireball = GetWorld()->SpawnActorDeferred<AFireballActor>(
+            FireballClass, FTransform(FRotator::ZeroRotator, ExplosionLoc), nullptr, nullptr,
+            ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 
         if (IsValid(Fireball))
         {
             Fireball->InitFireball(FireballRadius, FireballDuration, BlastWaveIntensity);
+            UGameplayStatics::FinishSpawningActor(Fireball, FTransform(FRotator::ZeroRotator, ExplosionLoc));
         }
     }
 
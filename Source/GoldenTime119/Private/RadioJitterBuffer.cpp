@@ -0,0 +1,280 @@
+// ============================ RadioJitterBuffer.cpp ============================
+#include "RadioJitterBuffer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRadioJitter, Log, All);
+
+namespace
+{
+	// RFC 3550 지터 평활 계수
+	constexpr double JitterGain = 1.0 / 16.0;
+	constexpr double JitterMultiplier = 3.0;
+	constexpr double UnderrunBoostStepSec = 0.04;
+}
+
+FRadioJitterBuffer::FRadioJitterBuffer(const FRealtimePcmStreamPtr& InStream, const FSettings& InSettings)
+	: Stream(InStream)
+	, Settings(InSettings)
+{
+	Settings.SampleRate = FMath::Max(8000, Settings.SampleRate);
+	Settings.NumChannels = FMath::Clamp(Settings.NumChannels, 1, 2);
+	Settings.MinPrebufferMs = FMath::Max(0.f, Settings.MinPrebufferMs);
+	Settings.MaxPrebufferMs = FMath::Max(Settings.MinPrebufferMs, Settings.MaxPrebufferMs);
+
+	const int32 CapacitySamples = FMath::Max(1, (int32)(FMath::Max(0.5f, Settings.CapacitySec) * Settings.SampleRate * Settings.NumChannels));
+	Ring.SetNumZeroed((int32)FMath::RoundUpToPowerOfTwo((uint32)CapacitySamples));
+	RingMask = (uint32)Ring.Num() - 1;
+
+	if (Stream.IsValid())
+	{
+		DiscardBeforeSerial = Stream->GetPushedCount();
+		DroppedAtStart = Stream->GetDroppedChunks();
+	}
+
+	StatTargetMs.store(Settings.MinPrebufferMs);
+}
+
+FRadioJitterBuffer::~FRadioJitterBuffer()
+{
+	if (PendingChunk && Stream.IsValid())
+	{
+		Stream->Recycle(PendingChunk);
+	}
+	PendingChunk = nullptr;
+}
+
+void FRadioJitterBuffer::ClearEndOfStream()
+{
+	bEndOfStream.store(false, std::memory_order_release);
+	bDrained.store(false, std::memory_order_release);
+}
+
+FRadioJitterStats FRadioJitterBuffer::GetStats() const
+{
+	const float SamplesPerMs = (float)(Settings.SampleRate * Settings.NumChannels) / 1000.f;
+
+	FRadioJitterStats S;
+	S.Underruns = StatUnderruns.load(std::memory_order_relaxed);
+	S.UnderrunSilenceMs = (float)StatUnderrunSilenceSamples.load(std::memory_order_relaxed) / SamplesPerMs;
+	S.OverrunChunks = Stream.IsValid() ? Stream->GetDroppedChunks() - DroppedAtStart : 0;
+	S.RingFullEvents = StatRingFull.load(std::memory_order_relaxed);
+	S.JitterMs = StatJitterMs.load(std::memory_order_relaxed);
+	S.TargetPrebufferMs = StatTargetMs.load(std::memory_order_relaxed);
+	S.BufferedMs = (float)StatBufferedSamples.load(std::memory_order_relaxed) / SamplesPerMs;
+	S.PeakBufferedMs = (float)StatPeakBufferedSamples.load(std::memory_order_relaxed) / SamplesPerMs;
+	return S;
+}
+
+int32 FRadioJitterBuffer::GetTargetSamples() const
+{
+	const double TargetMs = FMath::Clamp(
+		(double)Settings.MinPrebufferMs + (JitterMultiplier * JitterSec + UnderrunBoostSec) * 1000.0,
+		(double)Settings.MinPrebufferMs,
+		(double)Settings.MaxPrebufferMs);
+
+	const int32 Samples = (int32)(TargetMs * 0.001 * Settings.SampleRate) * Settings.NumChannels;
+	return FMath::Min(Samples, Ring.Num() / 2);
+}
+
+// ===== Audio render thread =====
+
+void FRadioJitterBuffer::UpdateJitter(const FRealtimePcmChunk& Chunk)
+{
+	const int32 Ch = (Chunk.NumChannels > 0) ? Chunk.NumChannels : Settings.NumChannels;
+	const int32 Sr = (Chunk.SampleRate > 0) ? Chunk.SampleRate : Settings.SampleRate;
+	const double Duration = (double)(Chunk.Bytes.Num() / (int32)sizeof(int16) / Ch) / (double)Sr;
+
+	if (!bHaveFirstArrival)
+	{
+		bHaveFirstArrival = true;
+		FirstArrival = Chunk.ArrivalTime;
+		MediaSecondsBefore = Duration;
+		MinTransit = 0.0;
+		LastLateness = 0.0;
+		return;
+	}
+
+	// 전송 지연 = (도착 - 첫 도착) - 앞선 미디어 길이.
+	// 서버는 실시간보다 빨리 보내므로 일찍 온 건 무시하고, 가장 빨랐던 시점 대비 "늦음"의 변화량만 지터로 봄
+	const double Transit = (Chunk.ArrivalTime - FirstArrival) - MediaSecondsBefore;
+	MinTransit = FMath::Min(MinTransit, Transit);
+	const double Lateness = Transit - MinTransit;
+
+	JitterSec += (FMath::Abs(Lateness - LastLateness) - JitterSec) * JitterGain;
+	LastLateness = Lateness;
+	MediaSecondsBefore += Duration;
+}
+
+bool FRadioJitterBuffer::CopyChunkToRing(const FRealtimePcmChunk& Chunk, int32& InOutOffsetBytes)
+{
+	const int32 SrcCh = (Chunk.NumChannels > 0) ? FMath::Clamp(Chunk.NumChannels, 1, 2) : Settings.NumChannels;
+	const int32 DstCh = Settings.NumChannels;
+
+	if (!bWarnedFormat && Chunk.SampleRate > 0 && Chunk.SampleRate != Settings.SampleRate)
+	{
+		bWarnedFormat = true;
+		UE_LOG(LogRadioJitter, Warning, TEXT("[RadioJitter] Chunk rate %d Hz != playback rate %d Hz (played as-is)"),
+			Chunk.SampleRate, Settings.SampleRate);
+	}
+
+	const int16* Src = reinterpret_cast<const int16*>(Chunk.Bytes.GetData());
+	const int32 SrcSamples = Chunk.Bytes.Num() / (int32)sizeof(int16);
+	int32 SrcPos = InOutOffsetBytes / (int32)sizeof(int16);
+
+	if (SrcCh == DstCh)
+	{
+		const int32 Num = FMath::Min(SrcSamples - SrcPos, GetFreeSamples());
+		const uint32 Start = (uint32)WritePos & RingMask;
+		const int32 First = FMath::Min(Num, Ring.Num() - (int32)Start);
+		FMemory::Memcpy(Ring.GetData() + Start, Src + SrcPos, First * sizeof(int16));
+		FMemory::Memcpy(Ring.GetData(), Src + SrcPos + First, (Num - First) * sizeof(int16));
+		WritePos += Num;
+		SrcPos += Num;
+	}
+	else if (SrcCh == 2)
+	{
+		// stereo -> mono
+		while (SrcPos + 1 < SrcSamples && GetFreeSamples() > 0)
+		{
+			Ring[(uint32)WritePos & RingMask] = (int16)(((int32)Src[SrcPos] + (int32)Src[SrcPos + 1]) / 2);
+			++WritePos;
+			SrcPos += 2;
+		}
+		if (SrcPos + 1 == SrcSamples)
+		{
+			++SrcPos; // 홀수 꼬리
+		}
+	}
+	else
+	{
+		// mono -> stereo
+		while (SrcPos < SrcSamples && GetFreeSamples() >= 2)
+		{
+			Ring[(uint32)WritePos & RingMask] = Src[SrcPos];
+			Ring[(uint32)(WritePos + 1) & RingMask] = Src[SrcPos];
+			WritePos += 2;
+			++SrcPos;
+		}
+	}
+
+	InOutOffsetBytes = SrcPos * (int32)sizeof(int16);
+	return SrcPos >= SrcSamples;
+}
+
+void FRadioJitterBuffer::PullFromStream()
+{
+	if (!Stream.IsValid())
+		return;
+
+	while (true)
+	{
+		if (!PendingChunk)
+		{
+			FRealtimePcmChunk* Chunk = Stream->Pop();
+			if (!Chunk)
+				break;
+
+			// 이 송출 시작 전에 들어와 있던 조각
+			if (Chunk->Serial < DiscardBeforeSerial)
+			{
+				Stream->Recycle(Chunk);
+				continue;
+			}
+
+			UpdateJitter(*Chunk);
+			PendingChunk = Chunk;
+			PendingOffsetBytes = 0;
+		}
+
+		if (!CopyChunkToRing(*PendingChunk, PendingOffsetBytes))
+		{
+			// 링이 가득 참: 나머지는 다음 콜백에서 (스트림 큐가 역압을 받음)
+			StatRingFull.fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+
+		Stream->Recycle(PendingChunk);
+		PendingChunk = nullptr;
+	}
+}
+
+void FRadioJitterBuffer::Render(int16* Out, int32 NumSamples)
+{
+	if (NumSamples <= 0)
+		return;
+
+	if (bRetired.load(std::memory_order_acquire))
+	{
+		FMemory::Memzero(Out, NumSamples * sizeof(int16));
+		return;
+	}
+
+	// EOS를 먼저 읽어야 EOS 이전에 Push된 조각이 아래 Pull에서 보장됨
+	const bool bEos = bEndOfStream.load(std::memory_order_acquire);
+	PullFromStream();
+
+	const bool bNothingMoreComing = bEos && !PendingChunk && (!Stream.IsValid() || Stream->IsEmpty());
+	int32 Written = 0;
+
+	if (!bPlaying)
+	{
+		const int32 Buffered = GetBufferedSamples();
+		if (Buffered >= GetTargetSamples() || (bNothingMoreComing && Buffered > 0))
+		{
+			bPlaying = true;
+		}
+		else if (bNothingMoreComing)
+		{
+			bDrained.store(true, std::memory_order_release);
+		}
+		else if (bHasPlayed)
+		{
+			StatUnderrunSilenceSamples.fetch_add(NumSamples, std::memory_order_relaxed);
+		}
+	}
+
+	if (bPlaying)
+	{
+		Written = FMath::Min(GetBufferedSamples(), NumSamples);
+
+		const uint32 Start = (uint32)ReadPos & RingMask;
+		const int32 First = FMath::Min(Written, Ring.Num() - (int32)Start);
+		FMemory::Memcpy(Out, Ring.GetData() + Start, First * sizeof(int16));
+		FMemory::Memcpy(Out + First, Ring.GetData(), (Written - First) * sizeof(int16));
+		ReadPos += Written;
+		bHasPlayed = true;
+
+		if (Written < NumSamples)
+		{
+			bPlaying = false;
+
+			if (bNothingMoreComing)
+			{
+				bDrained.store(true, std::memory_order_release);
+			}
+			else
+			{
+				// 언더런: 다시 버퍼링 + 목표치 상향
+				StatUnderruns.fetch_add(1, std::memory_order_relaxed);
+				StatUnderrunSilenceSamples.fetch_add(NumSamples - Written, std::memory_order_relaxed);
+				UnderrunBoostSec = FMath::Min(UnderrunBoostSec + UnderrunBoostStepSec, (double)(Settings.MaxPrebufferMs - Settings.MinPrebufferMs) * 0.001);
+			}
+		}
+
+		// 빈 자리가 생겼으니 밀려 있던 조각을 미리 당겨둠
+		PullFromStream();
+	}
+
+	if (Written < NumSamples)
+	{
+		FMemory::Memzero(Out + Written, (NumSamples - Written) * sizeof(int16));
+	}
+
+	const int32 Buffered = GetBufferedSamples();
+	StatBufferedSamples.store(Buffered, std::memory_order_relaxed);
+	if (Buffered > StatPeakBufferedSamples.load(std::memory_order_relaxed))
+	{
+		StatPeakBufferedSamples.store(Buffered, std::memory_order_relaxed);
+	}
+	StatJitterMs.store((float)(JitterSec * 1000.0), std::memory_order_relaxed);
+	StatTargetMs.store(SamplesToMs(GetTargetSamples()), std::memory_order_relaxed);
+}
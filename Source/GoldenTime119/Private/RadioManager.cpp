@@ -6,10 +6,21 @@
 #include "Engine/World.h"
 
 #include "Sound/SoundBase.h"
-#include "Sound/SoundWaveProcedural.h"
+#include "RadioStreamSoundWave.h"
+#include "RadioVoiceFx.h"
+#include "RadioReplyCache.h"
+#include "Sound/SoundEffectSource.h"
 
 #include "RadioLineData.h" // URadioLineData
 
+DEFINE_LOG_CATEGORY_STATIC(LogRadioManager, Log, All);
+
+namespace
+{
+	// 캐시 클립 끝 + 렌더 지연 (마지막 버퍼가 나갈 시간)
+	constexpr float ClipTailPadSec = 0.1f;
+}
+
 ARadioManager::ARadioManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -32,12 +43,78 @@ ARadioManager::ARadioManager()
 	SfxAudioComp->bAutoActivate = false;
 	SfxAudioComp->bIsUISound = true;
 
+	BedAudioComp = CreateDefaultSubobject<UAudioComponent>(TEXT("BedAudioComp"));
+	BedAudioComp->SetupAttachment(RootComponent);
+	BedAudioComp->bAutoActivate = false;
+	BedAudioComp->bIsUISound = true;
+
 	VoiceAudioComp->OnAudioFinished.AddDynamic(this, &ARadioManager::OnVoiceFinished);
 }
 
 void ARadioManager::BeginPlay()
 {
 	Super::BeginPlay();
+
+	SetupRadioFx();
+}
+
+void ARadioManager::SetupRadioFx()
+{
+	// 보이스: 소스 이펙트 체인 (클립/실시간 웨이브 모두 VoiceAudioComp로 나가므로 한 번만)
+	if (bEnableVoiceFx && VoiceAudioComp)
+	{
+		VoiceFxPreset = NewObject<USourceEffectRadioPreset>(this);
+		VoiceFxPreset->SetSettings(VoiceFx);
+
+		FSourceEffectChainEntry Entry;
+		Entry.Preset = VoiceFxPreset;
+		Entry.bBypass = false;
+
+		VoiceFxChain = NewObject<USoundEffectSourcePresetChain>(this);
+		VoiceFxChain->Chain.Add(Entry);
+
+		VoiceAudioComp->SourceEffectChain = VoiceFxChain;
+	}
+
+	// 스컬치 베드: 무음일 땐 렌더 스레드에서 0만 씀. 16 kHz면 무전 대역(~3 kHz)에 충분
+	if (bEnableSquelchBed && BedAudioComp)
+	{
+		constexpr int32 BedSampleRate = 16000;
+
+		SquelchBed = MakeShared<FRadioSquelchBed, ESPMode::ThreadSafe>();
+		SquelchBed->Init((float)BedSampleRate, VoiceFx, BedLevelDb, TailLevelDb, TailSec);
+
+		BedWave = NewObject<URadioBedSoundWave>(this, TEXT("RadioBedWave"));
+		BedWave->SoundGroup = SOUNDGROUP_Voice;
+		BedWave->bCanProcessAsync = false;
+		BedWave->bLooping = true;
+		BedWave->Duration = INDEFINITELY_LOOPING_DURATION;
+		BedWave->NumChannels = 1;
+		BedWave->SetSampleRate(BedSampleRate);
+		BedWave->SetSquelchBed(SquelchBed);
+
+		BedAudioComp->SetSound(BedWave);
+		BedAudioComp->Play();
+	}
+}
+
+void ARadioManager::StartLoopNoise()
+{
+	if (!LoopNoiseSound || SquelchBed.IsValid())
+		return;
+
+	LoopAudioComp->SetSound(LoopNoiseSound);
+	LoopAudioComp->Play();
+}
+
+void ARadioManager::SetPlayState(ERadioPlayState NewState)
+{
+	PlayState = NewState;
+
+	if (SquelchBed.IsValid())
+	{
+		SquelchBed->SetKeyed(PlayState != ERadioPlayState::Idle);
+	}
 }
 
 ARadioManager* ARadioManager::GetRadioManager(UObject* WorldContextObject)
@@ -65,6 +142,34 @@ void ARadioManager::EnqueueRadioLine(URadioLineData* LineData)
 	}
 }
 
+bool ARadioManager::PlayReplyText(const FString& Text, const FRadioSubtitleInfomation& Subtitle)
+{
+	URadioReplyCacheSubsystem* Cache = URadioReplyCacheSubsystem::Get(this);
+	const FVoiceUtterancePtr Clip = Cache ? Cache->FindReply(Text) : nullptr;
+	if (!Clip.IsValid())
+		return false;
+
+	URadioClipSoundWave* Wave = NewObject<URadioClipSoundWave>(this);
+	Wave->SoundGroup = SOUNDGROUP_Voice;
+	Wave->bCanProcessAsync = false;
+	Wave->bLooping = true;
+	Wave->Duration = INDEFINITELY_LOOPING_DURATION;
+	Wave->SetClip(Clip);
+
+	URadioLineData* Line = NewObject<URadioLineData>(this);
+	Line->VoiceSound = Wave;
+	Line->Subtitle = Subtitle;
+	if (Line->Subtitle.SubtitleText.IsEmpty())
+	{
+		Line->Subtitle.SubtitleText = FText::FromString(Text);
+	}
+
+	UE_LOG(LogRadioManager, Log, TEXT("[Radio] Cached reply (%.2fs): %s"), Clip->GetDurationSec(), *Text);
+
+	EnqueueRadioLine(Line);
+	return true;
+}
+
 void ARadioManager::TryPlayNextFromQueue()
 {
 	if (bRealtimeActive)
@@ -75,7 +180,7 @@ void ARadioManager::TryPlayNextFromQueue()
 		bIsPlaying = false;
 		OnBusyChanged.Broadcast(false);
 		CurrentLine = nullptr;
-		PlayState = ERadioPlayState::Idle;
+		SetPlayState(ERadioPlayState::Idle);
 		return;
 	}
 
@@ -85,7 +190,7 @@ void ARadioManager::TryPlayNextFromQueue()
 	CurrentLine = Queue[0];
 	Queue.RemoveAt(0);
 
-	PlayState = ERadioPlayState::StartTone;
+	SetPlayState(ERadioPlayState::StartTone);
 	PlayStartTone();
 }
 
@@ -111,7 +216,7 @@ void ARadioManager::PlayStartTone()
 
 void ARadioManager::OnStartToneFinished()
 {
-	PlayState = ERadioPlayState::PreDelay;
+	SetPlayState(ERadioPlayState::PreDelay);
 	PlayPreDelay();
 }
 
@@ -131,7 +236,7 @@ void ARadioManager::PlayPreDelay()
 
 void ARadioManager::OnPreDelayFinished()
 {
-	PlayState = ERadioPlayState::Voice;
+	SetPlayState(ERadioPlayState::Voice);
 	PlayVoice();
 }
 
@@ -145,16 +250,31 @@ void ARadioManager::PlayVoice()
 		return;
 	}
 
-	if (LoopNoiseSound)
-	{
-		LoopAudioComp->SetSound(LoopNoiseSound);
-		LoopAudioComp->Play();
-	}
+	StartLoopNoise();
 
 	OnSubtitleBegin.Broadcast(CurrentLine->Subtitle);
 
 	VoiceAudioComp->SetSound(CurrentLine->VoiceSound);
 	VoiceAudioComp->Play();
+
+	if (const URadioClipSoundWave* ClipWave = Cast<URadioClipSoundWave>(CurrentLine->VoiceSound))
+	{
+		const float Duration = (float)ClipWave->GetClipDurationSec() + ClipTailPadSec;
+		GetWorldTimerManager().SetTimer(StateTimerHandle, this, &ARadioManager::OnClipVoiceFinished, Duration, false);
+	}
+}
+
+void ARadioManager::OnClipVoiceFinished()
+{
+	// Stop -> OnAudioFinished -> OnVoiceFinished (일반 클립과 같은 경로)
+	if (VoiceAudioComp->IsPlaying())
+	{
+		VoiceAudioComp->Stop();
+	}
+	else
+	{
+		OnVoiceFinished();
+	}
 }
 
 void ARadioManager::OnVoiceFinished()
@@ -173,7 +293,7 @@ void ARadioManager::OnVoiceFinished()
 		LoopAudioComp->Stop();
 	}
 
-	PlayState = ERadioPlayState::PostDelay;
+	SetPlayState(ERadioPlayState::PostDelay);
 	PlayPostDelay();
 }
 
@@ -193,7 +313,7 @@ void ARadioManager::PlayPostDelay()
 
 void ARadioManager::OnPostDelayFinished()
 {
-	PlayState = ERadioPlayState::EndTone;
+	SetPlayState(ERadioPlayState::EndTone);
 	PlayEndTone();
 }
 
@@ -226,7 +346,7 @@ void ARadioManager::FinishCurrentAndContinue()
 {
 	ClearStateTimer();
 	CurrentLine = nullptr;
-	PlayState = ERadioPlayState::Idle;
+	SetPlayState(ERadioPlayState::Idle);
 	TryPlayNextFromQueue();
 }
 
@@ -239,13 +359,13 @@ void ARadioManager::ClearStateTimer()
 }
 
 // =======================
-// Realtime streaming (fixed)
+// Realtime streaming
 // =======================
 
 void ARadioManager::InterruptAllPlayback_Internal(bool bClearQueue)
 {
 	ClearStateTimer();
-	StopFlushTimer();
+	StopDrainTimer();
 
 	if (VoiceAudioComp && VoiceAudioComp->IsPlaying())
 	{
@@ -273,7 +393,7 @@ void ARadioManager::InterruptAllPlayback_Internal(bool bClearQueue)
 		Queue.Reset();
 	}
 
-	PlayState = ERadioPlayState::Idle;
+	SetPlayState(ERadioPlayState::Idle);
 	bIsPlaying = false;
 	OnBusyChanged.Broadcast(false);
 }
@@ -288,46 +408,21 @@ int32 ARadioManager::GetUseChannels(int32 InChannels) const
 	return Use;
 }
 
-int32 ARadioManager::CalcPrebufferBytes(int32 SampleRate, int32 NumChannels) const
+URadioStreamSoundWave* ARadioManager::CreateRealtimeWave(int32 SampleRate, int32 NumChannels)
 {
-	const float Sec = FMath::Max(0.0f, RealtimePrebufferMs) / 1000.0f;
-	const int32 SR = FMath::Max(8000, SampleRate);
-	const int32 CH = FMath::Clamp(NumChannels, 1, 2);
-	const int32 Samples = (int32)FMath::RoundToInt(Sec * (float)SR);
-	return Samples * CH * 2; // PCM16
-}
+	URadioStreamSoundWave* W = NewObject<URadioStreamSoundWave>(this, TEXT("RadioRealtimeWave"));
+	W->SoundGroup = SOUNDGROUP_Voice;
 
-USoundWaveProcedural* ARadioManager::EnsureRealtimeWave(int32 SampleRate, int32 NumChannels)
-{
-	const int32 TargetSR = FMath::Max(8000, SampleRate);
-	const int32 TargetCH = FMath::Clamp(NumChannels, 1, 2);
+	// GeneratePCMData는 오디오 렌더 스레드에서 바로 (게임 스레드/비동기 태스크 경유 안 함)
+	W->bCanProcessAsync = false;
 
-	auto CreateWave = [&](const TCHAR* Name) -> USoundWaveProcedural*
-		{
-			USoundWaveProcedural* W = NewObject<USoundWaveProcedural>(this, Name);
-			W->SoundGroup = SOUNDGROUP_Voice;
-			W->bCanProcessAsync = true;
-
-			// "비면 끝" 판정 완화
-			W->bLooping = true;
-			W->Duration = INDEFINITELY_LOOPING_DURATION;
-
-			W->NumChannels = (uint32)TargetCH;
-			W->SetSampleRate(TargetSR);
-			return W;
-		};
+	// 데이터가 없으면 무음을 내므로 소스는 송출 끝까지 유지됨
+	W->bLooping = true;
+	W->Duration = INDEFINITELY_LOOPING_DURATION;
 
-	if (!RealtimeWave)
-	{
-		RealtimeWave = CreateWave(TEXT("RadioRealtimeWave"));
-		return RealtimeWave;
-	}
-
-	if ((int32)RealtimeWave->GetSampleRateForCurrentPlatform() != TargetSR || (int32)RealtimeWave->NumChannels != TargetCH)
-	{
-		RealtimeWave = CreateWave(TEXT("RadioRealtimeWave_Recreate"));
-	}
-	return RealtimeWave;
+	W->NumChannels = (uint32)FMath::Clamp(NumChannels, 1, 2);
+	W->SetSampleRate(FMath::Max(8000, SampleRate));
+	return W;
 }
 
 bool ARadioManager::BeginRealtimeTransmission(const FRadioSubtitleInfomation& SubtitleInfo, bool bInterruptIfBusy)
@@ -335,6 +430,16 @@ bool ARadioManager::BeginRealtimeTransmission(const FRadioSubtitleInfomation& Su
 	if (bRealtimeActive)
 	{
 		RealtimeSubtitle = SubtitleInfo;
+
+		// 이전 응답 꼬리를 재생(드레인) 중이면 끊지 않고 같은 버퍼로 이어 받음
+		if (bRealtimeDraining)
+		{
+			StopDrainTimer();
+			if (RealtimeJitter.IsValid())
+			{
+				RealtimeJitter->ClearEndOfStream();
+			}
+		}
 		return true;
 	}
 
@@ -353,18 +458,32 @@ bool ARadioManager::BeginRealtimeTransmission(const FRadioSubtitleInfomation& Su
 
 	RealtimeSubtitle = SubtitleInfo;
 
-	RealtimeSampleRate = RealtimeDefaultSampleRate;
-	RealtimeNumChannels = RealtimeDefaultNumChannels;
+	// 웨이브 포맷은 송출 시작 시 고정 (다른 포맷의 조각은 지터 버퍼가 채널 변환)
+	RealtimeSampleRate = FMath::Max(8000, RealtimeDefaultSampleRate);
+	RealtimeNumChannels = GetUseChannels(RealtimeDefaultNumChannels);
 
-	PendingPcm.Reset();
-	bRealtimeVoiceStarted = false;
-	RealtimeWave = nullptr;
-
-	PlayState = ERadioPlayState::RealtimeStartTone;
+	SetPlayState(ERadioPlayState::RealtimeStartTone);
 	PlayRealtimeStartTone();
+
+	// 시작 톤과 동시에 소스를 띄워둠: 프리버퍼가 찰 때까지는 무음
+	StartRealtimeVoice();
 	return true;
 }
 
+FRealtimePcmStreamPtr ARadioManager::GetRealtimePcmStream()
+{
+	if (!RealtimePcmStream.IsValid())
+	{
+		RealtimePcmStream = MakeShared<FRealtimePcmStream, ESPMode::ThreadSafe>();
+	}
+	return RealtimePcmStream;
+}
+
+FRadioJitterStats ARadioManager::GetRealtimeJitterStats() const
+{
+	return RealtimeJitter.IsValid() ? RealtimeJitter->GetStats() : FRadioJitterStats();
+}
+
 void ARadioManager::PlayRealtimeStartTone()
 {
 	ClearStateTimer();
@@ -386,161 +505,151 @@ void ARadioManager::PlayRealtimeStartTone()
 
 void ARadioManager::OnRealtimeStartToneFinished()
 {
-	PlayState = ERadioPlayState::RealtimeVoice;
+	SetPlayState(ERadioPlayState::RealtimeVoice);
 
-	if (LoopNoiseSound)
-	{
-		LoopAudioComp->SetSound(LoopNoiseSound);
-		LoopAudioComp->Play();
-	}
+	StartLoopNoise();
 
 	OnSubtitleBegin.Broadcast(RealtimeSubtitle);
-
-	// ✅ 여기서 VoiceAudioComp->Play() 금지
-	// 프리버퍼 찼을 때 StartRealtimeVoiceIfNeeded에서 시작
 }
 
-void ARadioManager::StartFlushTimerIfNeeded()
+void ARadioManager::StartRealtimeVoice()
 {
-	if (!GetWorld()) return;
-	if (RealtimeFlushIntervalSec <= 0.0f) return;
+	if (!VoiceAudioComp)
+		return;
 
-	if (!RealtimeFlushTimerHandle.IsValid())
+	// 이전 버퍼는 더 이상 스트림을 소비하지 않게 (정지된 소스의 마지막 콜백과 겹쳐도 안전)
+	if (RealtimeJitter.IsValid())
 	{
-		FTimerDelegate D;
-		D.BindWeakLambda(this, [this]()
-			{
-				FlushPendingPcm(false);
-			});
-
-		GetWorldTimerManager().SetTimer(
-			RealtimeFlushTimerHandle,
-			D,
-			RealtimeFlushIntervalSec,
-			true
-		);
+		RealtimeJitter->Retire();
 	}
-}
 
+	FRadioJitterBuffer::FSettings Settings;
+	Settings.SampleRate = RealtimeSampleRate;
+	Settings.NumChannels = RealtimeNumChannels;
+	Settings.MinPrebufferMs = RealtimePrebufferMs;
+	Settings.MaxPrebufferMs = RealtimeMaxPrebufferMs;
+	Settings.CapacitySec = RealtimeJitterBufferSec;
 
-void ARadioManager::StopFlushTimer()
-{
-	if (RealtimeFlushTimerHandle.IsValid() && GetWorld())
-	{
-		GetWorldTimerManager().ClearTimer(RealtimeFlushTimerHandle);
-	}
-	RealtimeFlushTimerHandle.Invalidate();
+	// 생성 전에 스트림에 있던 조각(이전 응답 잔여분)은 버퍼가 알아서 버림
+	RealtimeJitter = MakeShared<FRadioJitterBuffer, ESPMode::ThreadSafe>(GetRealtimePcmStream(), Settings);
+
+	RealtimeWave = CreateRealtimeWave(RealtimeSampleRate, RealtimeNumChannels);
+	RealtimeWave->SetJitterBuffer(RealtimeJitter);
+
+	VoiceAudioComp->SetSound(RealtimeWave);
+	VoiceAudioComp->Play();
+
+	bRealtimeVoiceStarted = true;
 }
 
-void ARadioManager::FlushPendingPcm(bool bForceAll)
+void ARadioManager::AppendRealtimePcm16(const TArray<uint8>& Pcm16LE, int32 SampleRate, int32 NumChannels)
 {
-	if (!bRealtimeActive)
-		return;
-
-	if (!RealtimeWave)
+	// Blueprint/델리게이트 경로: 게임 스레드가 스트림 producer가 됨.
+	// 스트림은 SPSC라 디코더 워커가 같은 스트림에 쓰는 동안에는 쓰면 안 됨 (SetOutputAudioStream 사용 시 델리게이트는 오지 않음)
+	if (!bRealtimeActive || bRealtimeDraining)
 		return;
 
-	if (PendingPcm.Num() <= 0)
+	if (Pcm16LE.Num() <= 0)
 		return;
 
-	int32 BytesToFlush = PendingPcm.Num();
+	const FRealtimePcmStreamPtr Stream = GetRealtimePcmStream();
 
-	if (!bForceAll)
-	{
-		// 40ms chunk
-		const int32 SR = FMath::Max(8000, RealtimeSampleRate);
-		const int32 CH = FMath::Clamp(RealtimeNumChannels, 1, 2);
-		const int32 TargetBytes = (int32)FMath::RoundToInt(0.04f * (float)SR) * CH * 2;
-		BytesToFlush = FMath::Min(BytesToFlush, TargetBytes);
-	}
+	FRealtimePcmChunk* Chunk = Stream->AcquireChunk();
+	Chunk->Bytes.Append(Pcm16LE.GetData(), Pcm16LE.Num());
+	Chunk->SampleRate = (SampleRate > 0) ? SampleRate : RealtimeDefaultSampleRate;
+	Chunk->NumChannels = (NumChannels > 0) ? NumChannels : RealtimeDefaultNumChannels;
+	Stream->Push(Chunk);
+}
 
-	RealtimeWave->QueueAudio(PendingPcm.GetData(), BytesToFlush);
+void ARadioManager::StopRealtimeVoice_Internal()
+{
+	StopDrainTimer();
 
-	if (BytesToFlush == PendingPcm.Num())
+	if (RealtimeJitter.IsValid())
 	{
-		PendingPcm.Reset();
+		RealtimeJitter->Retire();
 	}
-	else
+
+	if (VoiceAudioComp && VoiceAudioComp->IsPlaying())
 	{
-		PendingPcm.RemoveAt(0, BytesToFlush, false);
+		VoiceAudioComp->Stop();
 	}
+	bRealtimeVoiceStarted = false;
 }
 
-void ARadioManager::StartRealtimeVoiceIfNeeded()
+void ARadioManager::EndRealtimeTransmission(bool bFlushAndStop)
 {
-	if (bRealtimeVoiceStarted)
+	if (!bRealtimeActive || PlayState == ERadioPlayState::RealtimeEndTone)
 		return;
 
-	const int32 NeedBytes = CalcPrebufferBytes(RealtimeSampleRate, RealtimeNumChannels);
-	if (PendingPcm.Num() < NeedBytes)
+	// 이미 꼬리 재생 중: 즉시 종료 요청만 반영
+	if (bRealtimeDraining)
+	{
+		if (!bFlushAndStop)
+		{
+			FinishRealtimeVoice();
+		}
 		return;
+	}
 
-	RealtimeWave = EnsureRealtimeWave(RealtimeSampleRate, RealtimeNumChannels);
-	if (!RealtimeWave || !VoiceAudioComp)
-		return;
+	if (bFlushAndStop && bRealtimeVoiceStarted && RealtimeJitter.IsValid() && GetWorld())
+	{
+		// 응답 끝: 버퍼에 남은 음성을 끝까지 재생한 뒤 종료 톤
+		RealtimeJitter->MarkEndOfStream();
+		bRealtimeDraining = true;
 
-	// 시작 전 한 번 크게 밀어넣고 Play
-	FlushPendingPcm(true);
+		RealtimeDrainLastBufferedMs = -1.f;
+		RealtimeDrainLastProgressSec = GetWorld()->GetRealTimeSeconds();
 
-	VoiceAudioComp->SetSound(RealtimeWave);
-	if (!VoiceAudioComp->IsPlaying())
-	{
-		VoiceAudioComp->Play();
+		GetWorldTimerManager().SetTimer(RealtimeDrainTimerHandle, this, &ARadioManager::PollRealtimeDrain, 0.05f, true);
+		return;
 	}
 
-	bRealtimeVoiceStarted = true;
-	StartFlushTimerIfNeeded();
+	FinishRealtimeVoice();
 }
 
-void ARadioManager::AppendRealtimePcm16(const TArray<uint8>& Pcm16LE, int32 SampleRate, int32 NumChannels)
+void ARadioManager::PollRealtimeDrain()
 {
-	if (!bRealtimeActive)
-		return;
-
-	if (Pcm16LE.Num() <= 0)
-		return;
-
-	const int32 UseSR = (SampleRate > 0) ? SampleRate : RealtimeDefaultSampleRate;
-	const int32 UseCH = GetUseChannels((NumChannels > 0) ? NumChannels : RealtimeDefaultNumChannels);
-
-	RealtimeSampleRate = UseSR;
-	RealtimeNumChannels = UseCH;
-
-	// Pending 누적
-	const int32 OldNum = PendingPcm.Num();
-	PendingPcm.SetNumUninitialized(OldNum + Pcm16LE.Num());
-	FMemory::Memcpy(PendingPcm.GetData() + OldNum, Pcm16LE.GetData(), Pcm16LE.Num());
-
-	// 재생 시작 전이면 프리버퍼 확인 후 시작
-	if (!bRealtimeVoiceStarted)
+	if (!RealtimeJitter.IsValid() || RealtimeJitter->IsDrained())
 	{
-		StartRealtimeVoiceIfNeeded();
+		FinishRealtimeVoice();
 		return;
 	}
 
-	// 재생 중이면 타이머 flush가 처리(너무 쌓이면 조금 빨리 밀어넣기)
-	const int32 NeedBytes = CalcPrebufferBytes(RealtimeSampleRate, RealtimeNumChannels);
-	if (PendingPcm.Num() >= NeedBytes * 2)
+	// 오디오 디바이스가 멈춰 렌더가 안 도는 경우 대비: 버퍼가 1초 넘게 줄지 않으면 그냥 끝냄
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	const float BufferedMs = RealtimeJitter->GetStats().BufferedMs;
+	if (BufferedMs != RealtimeDrainLastBufferedMs)
 	{
-		FlushPendingPcm(false);
+		RealtimeDrainLastBufferedMs = BufferedMs;
+		RealtimeDrainLastProgressSec = Now;
+	}
+	else if (Now - RealtimeDrainLastProgressSec > 1.0)
+	{
+		FinishRealtimeVoice();
 	}
 }
 
-void ARadioManager::StopRealtimeVoice_Internal()
+void ARadioManager::StopDrainTimer()
 {
-	StopFlushTimer();
-
-	if (VoiceAudioComp && VoiceAudioComp->IsPlaying())
+	if (RealtimeDrainTimerHandle.IsValid() && GetWorld())
 	{
-		VoiceAudioComp->Stop();
+		GetWorldTimerManager().ClearTimer(RealtimeDrainTimerHandle);
 	}
-	bRealtimeVoiceStarted = false;
+	RealtimeDrainTimerHandle.Invalidate();
+	bRealtimeDraining = false;
 }
 
-void ARadioManager::EndRealtimeTransmission(bool bFlushAndStop)
+void ARadioManager::FinishRealtimeVoice()
 {
-	if (!bRealtimeActive)
-		return;
+	StopDrainTimer();
+
+	if (bLogRealtimeJitterStats && RealtimeJitter.IsValid())
+	{
+		const FRadioJitterStats S = RealtimeJitter->GetStats();
+		UE_LOG(LogRadioManager, Log, TEXT("[Radio] Realtime jitter: underruns=%d (%.0f ms silence) overrun=%d ringFull=%d jitter=%.1f ms target=%.0f ms peak=%.0f ms"),
+			S.Underruns, S.UnderrunSilenceMs, S.OverrunChunks, S.RingFullEvents, S.JitterMs, S.TargetPrebufferMs, S.PeakBufferedMs);
+	}
 
 	OnSubtitleEnd.Broadcast(RealtimeSubtitle);
 
@@ -549,20 +658,9 @@ void ARadioManager::EndRealtimeTransmission(bool bFlushAndStop)
 		LoopAudioComp->Stop();
 	}
 
-	if (bFlushAndStop)
-	{
-		if (RealtimeWave && PendingPcm.Num() > 0)
-		{
-			FlushPendingPcm(true);
-		}
-		StopRealtimeVoice_Internal();
-	}
-	else
-	{
-		StopRealtimeVoice_Internal();
-	}
+	StopRealtimeVoice_Internal();
 
-	PlayState = ERadioPlayState::RealtimeEndTone;
+	SetPlayState(ERadioPlayState::RealtimeEndTone);
 	PlayRealtimeEndTone();
 }
 
@@ -590,13 +688,13 @@ void ARadioManager::OnRealtimeEndToneFinished()
 {
 	bRealtimeActive = false;
 
-	StopFlushTimer();
+	StopDrainTimer();
 
-	PendingPcm.Reset();
 	RealtimeWave = nullptr;
+	RealtimeJitter.Reset();
 	bRealtimeVoiceStarted = false;
 
-	PlayState = ERadioPlayState::Idle;
+	SetPlayState(ERadioPlayState::Idle);
 
 	bIsPlaying = false;
 	OnBusyChanged.Broadcast(false);
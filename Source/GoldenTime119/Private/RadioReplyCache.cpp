@@ -0,0 +1,392 @@
+// ============================ RadioReplyCache.cpp ============================
+#include "RadioReplyCache.h"
+#include "VoiceCommandGrammar.h"
+
+#include "Audio.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRadioReplyCache, Log, All);
+
+namespace
+{
+	FString KeyFromNormalized(const FString& Normalized, const FString& VoiceProfile)
+	{
+		// 텍스트와 프로필 사이에 줄바꿈: 정규화된 텍스트에는 공백 하나 말고는 구분자가 없음
+		const FTCHARToUTF8 Utf8(*(Normalized + TEXT("\n") + VoiceProfile));
+
+		uint8 Hash[20];
+		FSHA1::HashBuffer(Utf8.Get(), Utf8.Length(), Hash);
+		return BytesToHex(Hash, UE_ARRAY_COUNT(Hash)).ToLower();
+	}
+
+	// 워커 스레드. 실패하면 null
+	FVoiceUtterancePtr ReadCachedWav(const FString& Path)
+	{
+		TArray<uint8> WavBytes;
+		if (!FFileHelper::LoadFileToArray(WavBytes, *Path, FILEREAD_Silent))
+			return nullptr;
+
+		FWaveModInfo WaveInfo;
+		if (!WaveInfo.ReadWaveInfo(WavBytes.GetData(), WavBytes.Num()) || *WaveInfo.pBitsPerSample != 16)
+		{
+			UE_LOG(LogRadioReplyCache, Warning, TEXT("[ReplyCache] Invalid cache file, removing: %s"), *Path);
+			IFileManager::Get().Delete(*Path, false, false, true);
+			return nullptr;
+		}
+
+		TSharedRef<FVoiceUtterance, ESPMode::ThreadSafe> Clip = MakeShared<FVoiceUtterance, ESPMode::ThreadSafe>();
+		Clip->Pcm16LE.Append(WaveInfo.SampleDataStart, (int32)WaveInfo.SampleDataSize);
+		Clip->SampleRate = (int32)*WaveInfo.pSamplesPerSec;
+		Clip->NumChannels = (int32)*WaveInfo.pChannels;
+
+		// 디스크 정리는 오래 안 쓴 순서 (시작할 때 ScanDiskAsync)
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+		return Clip;
+	}
+}
+
+URadioReplyCacheSubsystem* URadioReplyCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	return GI ? GI->GetSubsystem<URadioReplyCacheSubsystem>() : nullptr;
+}
+
+FString URadioReplyCacheSubsystem::NormalizeText(const FString& Text)
+{
+	TArray<FString> Tokens;
+	FVoiceCommandMatcher::Tokenize(Text, Tokens);
+	return FString::Join(Tokens, TEXT(" "));
+}
+
+FString URadioReplyCacheSubsystem::MakeKey(const FString& Text, const FString& InVoiceProfile)
+{
+	return KeyFromNormalized(NormalizeText(Text), InVoiceProfile);
+}
+
+void URadioReplyCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (bEnabled && bPersistToDisk)
+	{
+		ScanDiskAsync();
+	}
+	else
+	{
+		bDiskScanned = true;
+	}
+}
+
+void URadioReplyCacheSubsystem::Deinitialize()
+{
+	// 진행 중인 백그라운드 작업은 약참조라 결과만 버려짐
+	Entries.Empty();
+	MemoryBytes = 0;
+	PendingLoads.Empty();
+	PreloadedLines.Empty();
+
+	Super::Deinitialize();
+}
+
+FString URadioReplyCacheSubsystem::GetCacheDir() const
+{
+	return FPaths::ProjectSavedDir() / CacheDirectory;
+}
+
+FString URadioReplyCacheSubsystem::GetCachePath(const FString& Key) const
+{
+	return GetCacheDir() / (Key + TEXT(".wav"));
+}
+
+void URadioReplyCacheSubsystem::SetVoiceProfile(const FString& InProfile)
+{
+	if (VoiceProfile == InProfile)
+		return;
+
+	VoiceProfile = InProfile;
+	UE_LOG(LogRadioReplyCache, Log, TEXT("[ReplyCache] Voice profile: %s"), *VoiceProfile);
+
+	PreloadKeys();
+}
+
+FVoiceUtterancePtr URadioReplyCacheSubsystem::FindReply(const FString& Text)
+{
+	if (!bEnabled || Text.IsEmpty())
+		return nullptr;
+
+	const FString Key = MakeKey(Text, VoiceProfile);
+
+	if (FEntry* Entry = Entries.Find(Key))
+	{
+		Entry->LastUse = ++UseCounter;
+		++Hits;
+		return Entry->Clip;
+	}
+
+	++Misses;
+
+	if (DiskKeys.Contains(Key))
+	{
+		LoadFromDiskAsync(Key);
+	}
+	return nullptr;
+}
+
+bool URadioReplyCacheSubsystem::IsReplyCached(const FString& Text) const
+{
+	return bEnabled && !Text.IsEmpty() && Entries.Contains(MakeKey(Text, VoiceProfile));
+}
+
+bool URadioReplyCacheSubsystem::StoreReply(const FString& Text, TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels)
+{
+	if (!bEnabled || Pcm16LE.Num() == 0 || SampleRate <= 0 || NumChannels <= 0)
+		return false;
+
+	const FString Normalized = NormalizeText(Text);
+	if (Normalized.IsEmpty() || Normalized.Len() > MaxCachedChars)
+		return false;
+
+	const FString Key = KeyFromNormalized(Normalized, VoiceProfile);
+
+	if (FEntry* Existing = Entries.Find(Key))
+	{
+		Existing->LastUse = ++UseCounter;
+		return true;
+	}
+
+	TSharedRef<FVoiceUtterance, ESPMode::ThreadSafe> Clip = MakeShared<FVoiceUtterance, ESPMode::ThreadSafe>();
+	Clip->Pcm16LE = MoveTemp(Pcm16LE);
+	Clip->SampleRate = SampleRate;
+	Clip->NumChannels = NumChannels;
+
+	AddEntry(Key, Clip);
+
+	UE_LOG(LogRadioReplyCache, Log, TEXT("[ReplyCache] Stored %s (%.2fs): %s"), *Key, Clip->GetDurationSec(), *Normalized);
+
+	if (bPersistToDisk && !DiskKeys.Contains(Key))
+	{
+		DiskKeys.Add(Key);
+
+		TWeakObjectPtr<URadioReplyCacheSubsystem> WeakThis(this);
+		VoiceUtteranceIO::WriteWavAsync(Clip, GetCachePath(Key), [WeakThis, Key](bool bSuccess, const FString&)
+			{
+				if (!bSuccess)
+				{
+					if (URadioReplyCacheSubsystem* Self = WeakThis.Get())
+					{
+						Self->DiskKeys.Remove(Key);
+					}
+				}
+			});
+	}
+
+	return true;
+}
+
+void URadioReplyCacheSubsystem::AddEntry(const FString& Key, const FVoiceUtterancePtr& Clip)
+{
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Clip = Clip;
+	Entry.LastUse = ++UseCounter;
+	MemoryBytes += Clip->Pcm16LE.Num();
+
+	EvictToBudget();
+}
+
+void URadioReplyCacheSubsystem::EvictToBudget()
+{
+	const int64 BudgetBytes = (int64)FMath::Max(1, MemoryBudgetMB) * 1024 * 1024;
+
+	// 항목 수가 수백 개 수준이라 선형 탐색으로 충분. 재생 중인 클립은 웨이브가 핸들을 들고 있어 안전
+	while (MemoryBytes > BudgetBytes && Entries.Num() > 1)
+	{
+		const FString* Oldest = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FString, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUse < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUse;
+				Oldest = &Pair.Key;
+			}
+		}
+
+		const FString Key = *Oldest;
+		MemoryBytes -= Entries[Key].Clip->Pcm16LE.Num();
+		Entries.Remove(Key);
+	}
+}
+
+void URadioReplyCacheSubsystem::ClearMemory()
+{
+	Entries.Empty();
+	MemoryBytes = 0;
+	PreloadedLines.Reset();
+}
+
+void URadioReplyCacheSubsystem::PreloadReplySet(URadioReplySet* Set)
+{
+	if (Set)
+	{
+		PreloadLines(Set->Lines);
+	}
+}
+
+void URadioReplyCacheSubsystem::PreloadLines(const TArray<FString>& Lines)
+{
+	if (!bEnabled)
+		return;
+
+	for (const FString& Line : Lines)
+	{
+		if (!Line.IsEmpty())
+		{
+			PreloadedLines.AddUnique(Line);
+		}
+	}
+
+	PreloadKeys();
+}
+
+void URadioReplyCacheSubsystem::PreloadKeys()
+{
+	// 디스크 스캔이 끝나면 다시 불림
+	if (!bDiskScanned || PreloadedLines.Num() == 0)
+		return;
+
+	int32 NumLoading = 0;
+	int32 NumMissing = 0;
+
+	for (const FString& Line : PreloadedLines)
+	{
+		const FString Key = MakeKey(Line, VoiceProfile);
+		if (Entries.Contains(Key))
+			continue;
+
+		if (DiskKeys.Contains(Key))
+		{
+			LoadFromDiskAsync(Key);
+			++NumLoading;
+		}
+		else
+		{
+			++NumMissing;
+		}
+	}
+
+	// 없는 대사는 Realtime이 처음 말할 때 채워짐
+	UE_LOG(LogRadioReplyCache, Log, TEXT("[ReplyCache] Preload: lines=%d loading=%d notCached=%d"),
+		PreloadedLines.Num(), NumLoading, NumMissing);
+}
+
+void URadioReplyCacheSubsystem::LoadFromDiskAsync(const FString& Key)
+{
+	if (PendingLoads.Contains(Key))
+		return;
+
+	PendingLoads.Add(Key);
+
+	TWeakObjectPtr<URadioReplyCacheSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Key, Path = GetCachePath(Key)]()
+		{
+			FVoiceUtterancePtr Clip = ReadCachedWav(Path);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Key, Clip = MoveTemp(Clip)]()
+				{
+					URadioReplyCacheSubsystem* Self = WeakThis.Get();
+					if (!Self)
+						return;
+
+					Self->PendingLoads.Remove(Key);
+
+					if (!Clip.IsValid())
+					{
+						Self->DiskKeys.Remove(Key);
+						return;
+					}
+
+					if (!Self->Entries.Contains(Key))
+					{
+						Self->AddEntry(Key, Clip);
+					}
+				});
+		});
+}
+
+void URadioReplyCacheSubsystem::ScanDiskAsync()
+{
+	const FString Dir = GetCacheDir();
+	const int64 MaxDiskBytes = (int64)FMath::Max(1, MaxDiskMB) * 1024 * 1024;
+
+	TWeakObjectPtr<URadioReplyCacheSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Dir, MaxDiskBytes]()
+		{
+			IFileManager& FM = IFileManager::Get();
+
+			TArray<FString> FileNames;
+			FM.FindFiles(FileNames, *(Dir / TEXT("*.wav")), true, false);
+
+			struct FDiskFile
+			{
+				FString Key;
+				FDateTime TimeStamp;
+				int64 Size = 0;
+			};
+
+			TArray<FDiskFile> Files;
+			int64 TotalBytes = 0;
+			for (const FString& Name : FileNames)
+			{
+				const FString Path = Dir / Name;
+				FDiskFile& File = Files.AddDefaulted_GetRef();
+				File.Key = FPaths::GetBaseFilename(Name);
+				File.TimeStamp = FM.GetTimeStamp(*Path);
+				File.Size = FMath::Max<int64>(0, FM.FileSize(*Path));
+				TotalBytes += File.Size;
+			}
+
+			// 예산을 넘으면 오래 안 쓴 것부터 삭제
+			int32 NumDeleted = 0;
+			if (TotalBytes > MaxDiskBytes)
+			{
+				Files.Sort([](const FDiskFile& A, const FDiskFile& B) { return A.TimeStamp < B.TimeStamp; });
+
+				int32 i = 0;
+				for (; i < Files.Num() && TotalBytes > MaxDiskBytes; ++i)
+				{
+					FM.Delete(*(Dir / (Files[i].Key + TEXT(".wav"))), false, false, true);
+					TotalBytes -= Files[i].Size;
+				}
+				NumDeleted = i;
+				Files.RemoveAt(0, i);
+			}
+
+			TArray<FString> Keys;
+			Keys.Reserve(Files.Num());
+			for (FDiskFile& File : Files)
+			{
+				Keys.Add(MoveTemp(File.Key));
+			}
+
+			UE_LOG(LogRadioReplyCache, Log, TEXT("[ReplyCache] Disk: %d replies (%.1f MB), pruned %d. dir=%s"),
+				Keys.Num(), (double)TotalBytes / (1024.0 * 1024.0), NumDeleted, *Dir);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Keys = MoveTemp(Keys)]()
+				{
+					if (URadioReplyCacheSubsystem* Self = WeakThis.Get())
+					{
+						// 스캔 중에 저장된 키와 합침
+						Self->DiskKeys.Append(Keys);
+						Self->bDiskScanned = true;
+						Self->PreloadKeys();
+					}
+				});
+		});
+}
@@ -0,0 +1,70 @@
+// ============================ RadioStreamSoundWave.cpp ============================
+#include "RadioStreamSoundWave.h"
+
+int32 URadioStreamSoundWave::GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded)
+{
+	int16* Out = reinterpret_cast<int16*>(PCMData);
+
+	if (JitterBuffer.IsValid())
+	{
+		JitterBuffer->Render(Out, SamplesNeeded);
+	}
+	else
+	{
+		FMemory::Memzero(Out, SamplesNeeded * sizeof(int16));
+	}
+
+	// 언더런이어도 무음으로 꽉 채워서 소스가 끝나지 않게 함
+	return SamplesNeeded * (int32)sizeof(int16);
+}
+
+int32 URadioBedSoundWave::GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded)
+{
+	int16* Out = reinterpret_cast<int16*>(PCMData);
+
+	if (Bed.IsValid())
+	{
+		Bed->RenderPcm16(Out, SamplesNeeded);
+	}
+	else
+	{
+		FMemory::Memzero(Out, SamplesNeeded * sizeof(int16));
+	}
+
+	return SamplesNeeded * (int32)sizeof(int16);
+}
+
+void URadioClipSoundWave::SetClip(const FVoiceUtterancePtr& InClip)
+{
+	Clip = InClip;
+	ReadOffsetBytes = 0;
+
+	if (Clip.IsValid())
+	{
+		NumChannels = (uint32)FMath::Clamp(Clip->NumChannels, 1, 2);
+		SetSampleRate(FMath::Max(8000, Clip->SampleRate));
+	}
+}
+
+int32 URadioClipSoundWave::GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded)
+{
+	const int32 BytesNeeded = SamplesNeeded * (int32)sizeof(int16);
+
+	int32 Copied = 0;
+	if (Clip.IsValid())
+	{
+		Copied = FMath::Clamp(Clip->Pcm16LE.Num() - ReadOffsetBytes, 0, BytesNeeded);
+		if (Copied > 0)
+		{
+			FMemory::Memcpy(PCMData, Clip->Pcm16LE.GetData() + ReadOffsetBytes, Copied);
+			ReadOffsetBytes += Copied;
+		}
+	}
+
+	if (Copied < BytesNeeded)
+	{
+		FMemory::Memzero(PCMData + Copied, BytesNeeded - Copied);
+	}
+
+	return BytesNeeded;
+}
@@ -0,0 +1,256 @@
+// ============================ RadioVoiceFx.cpp ============================
+#include "RadioVoiceFx.h"
+
+namespace
+{
+	float DbToLinear(float Db)
+	{
+		return FMath::Pow(10.f, Db / 20.f);
+	}
+
+	// VoiceAudioDSP::SoftClip과 같은 곡선 (게인 보정용)
+	float SoftClipCurve(float X)
+	{
+		X = FMath::Clamp(X, -3.f, 3.f);
+		const float X2 = X * X;
+		return X * (27.f + X2) / (27.f + 9.f * X2);
+	}
+
+	// 무음 바닥 (-60 dB)까지
+	constexpr float TailFloorDb = -60.f;
+}
+
+// ===== FRadioVoiceFx =====
+
+void FRadioVoiceFx::Init(float InSampleRate, const FSourceEffectRadioSettings& InSettings)
+{
+	SampleRate = FMath::Max(1000.f, InSampleRate);
+	Scratch.SetNumZeroed(ScratchFrames);
+	SetSettings(InSettings);
+	Reset();
+}
+
+void FRadioVoiceFx::SetSettings(const FSourceEffectRadioSettings& InSettings)
+{
+	const float HighCut = FMath::Min(InSettings.HighCutHz, 0.45f * SampleRate);
+	const float LowCut = FMath::Min(InSettings.LowCutHz, 0.5f * HighCut);
+
+	for (int32 s = 0; s < 2; ++s)
+	{
+		HighPass[s].SetCoefficients(FVoiceBiquad::EType::HighPass, LowCut, SampleRate);
+		LowPass[s].SetCoefficients(FVoiceBiquad::EType::LowPass, HighCut, SampleRate);
+	}
+
+	// 풀스케일 입력이 OutputGainDb로 나오도록 드라이브만큼 되돌림
+	Drive = DbToLinear(InSettings.DriveDb);
+	OutGain = DbToLinear(InSettings.OutputGainDb) / FMath::Max(0.01f, SoftClipCurve(Drive));
+}
+
+void FRadioVoiceFx::Reset()
+{
+	for (int32 s = 0; s < 2; ++s)
+	{
+		HighPass[s].Reset();
+		LowPass[s].Reset();
+	}
+}
+
+void FRadioVoiceFx::ProcessBand(float* InOut, int32 Num)
+{
+	if (!InOut || Num <= 0)
+		return;
+
+	HighPass[0].Process(InOut, Num);
+	HighPass[1].Process(InOut, Num);
+	LowPass[0].Process(InOut, Num);
+	LowPass[1].Process(InOut, Num);
+}
+
+void FRadioVoiceFx::ProcessMono(float* InOut, int32 Num)
+{
+	if (!InOut || Num <= 0)
+		return;
+
+	ProcessBand(InOut, Num);
+	VoiceAudioDSP::SoftClip(InOut, Num, Drive, OutGain);
+}
+
+void FRadioVoiceFx::ProcessInterleaved(const float* In, float* Out, int32 NumFrames, int32 NumChannels)
+{
+	if (!In || !Out || NumFrames <= 0 || NumChannels <= 0)
+		return;
+
+	if (NumChannels == 1)
+	{
+		if (In != Out)
+		{
+			FMemory::Memcpy(Out, In, NumFrames * sizeof(float));
+		}
+		ProcessMono(Out, NumFrames);
+		return;
+	}
+
+	if (Scratch.Num() < ScratchFrames)
+	{
+		// Init 전 호출: 할당하지 않고 통과
+		if (In != Out)
+		{
+			FMemory::Memcpy(Out, In, NumFrames * NumChannels * sizeof(float));
+		}
+		return;
+	}
+
+	float* Mono = Scratch.GetData();
+	for (int32 Start = 0; Start < NumFrames; Start += ScratchFrames)
+	{
+		const int32 N = FMath::Min(ScratchFrames, NumFrames - Start);
+
+		VoiceAudioDSP::DownmixToMono(In + Start * NumChannels, N, NumChannels, Mono);
+		ProcessMono(Mono, N);
+
+		float* Dst = Out + Start * NumChannels;
+		for (int32 f = 0; f < N; ++f)
+		{
+			for (int32 c = 0; c < NumChannels; ++c)
+			{
+				Dst[f * NumChannels + c] = Mono[f];
+			}
+		}
+	}
+}
+
+// ===== FRadioSquelchBed =====
+
+void FRadioSquelchBed::Init(float InSampleRate, const FSourceEffectRadioSettings& InBand, float InBedLevelDb, float InTailLevelDb, float InTailSec)
+{
+	SampleRate = FMath::Max(1000.f, InSampleRate);
+	Band.Init(SampleRate, InBand);
+	Scratch.SetNumZeroed(ScratchFrames);
+
+	// 균일 잡음 [-1, 1)의 RMS는 1/sqrt(3): 레벨은 대역 필터 전 RMS 기준 dBFS
+	const float UniformToRms = FMath::Sqrt(3.f);
+	BedGain = DbToLinear(InBedLevelDb) * UniformToRms;
+	TailGain = DbToLinear(InTailLevelDb) * UniformToRms;
+
+	TailSamples = FMath::Max(1, FMath::RoundToInt(FMath::Max(0.01f, InTailSec) * SampleRate));
+	TailDecayPerSample = DbToLinear((TailFloorDb - InTailLevelDb) / (float)TailSamples);
+
+	bWasKeyed = false;
+	bActive = false;
+	CurrentGain = 0.f;
+	TailRemaining = 0;
+}
+
+void FRadioSquelchBed::Render(float* Out, int32 Num)
+{
+	if (!Out || Num <= 0)
+		return;
+
+	const bool bNowKeyed = bKeyed.load(std::memory_order_acquire);
+
+	if (bNowKeyed)
+	{
+		if (!bActive)
+		{
+			Band.Reset();
+			CurrentGain = 0.f;
+			bActive = true;
+		}
+		TailRemaining = 0;
+	}
+	else if (bWasKeyed && bActive)
+	{
+		// 키 뗌: 스컬치 꼬리 시작 (베드보다 크게 터졌다가 감쇠)
+		CurrentGain = TailGain;
+		TailRemaining = TailSamples;
+		StatTails.fetch_add(1, std::memory_order_relaxed);
+	}
+	bWasKeyed = bNowKeyed;
+
+	if (!bActive)
+	{
+		FMemory::Memzero(Out, Num * sizeof(float));
+		return;
+	}
+
+	float EndGain;
+	int32 Produced = Num;
+
+	if (bNowKeyed)
+	{
+		// 키 잡을 때 / 꼬리 도중 다시 잡을 때 한 블록에 걸쳐 베드 레벨로
+		EndGain = BedGain;
+	}
+	else
+	{
+		Produced = FMath::Min(Num, TailRemaining);
+		EndGain = CurrentGain * FMath::Pow(TailDecayPerSample, (float)Produced);
+		TailRemaining -= Produced;
+	}
+
+	if (Produced > 0)
+	{
+		VoiceAudioDSP::GenerateNoise(NoiseState, Out, Produced, CurrentGain, EndGain);
+		Band.ProcessBand(Out, Produced);
+		CurrentGain = EndGain;
+	}
+
+	if (Produced < Num)
+	{
+		FMemory::Memzero(Out + Produced, (Num - Produced) * sizeof(float));
+	}
+
+	if (!bNowKeyed && TailRemaining <= 0)
+	{
+		bActive = false;
+		CurrentGain = 0.f;
+	}
+}
+
+void FRadioSquelchBed::RenderPcm16(int16* Out, int32 Num)
+{
+	if (!Out || Num <= 0)
+		return;
+
+	if (Scratch.Num() < ScratchFrames)
+	{
+		FMemory::Memzero(Out, Num * sizeof(int16));
+		return;
+	}
+
+	for (int32 Start = 0; Start < Num; Start += ScratchFrames)
+	{
+		const int32 N = FMath::Min(ScratchFrames, Num - Start);
+		Render(Scratch.GetData(), N);
+		VoiceAudioDSP::FloatToPcm16(Scratch.GetData(), Out + Start, N);
+	}
+}
+
+// ===== Source effect =====
+
+void FSourceEffectRadio::Init(const FSoundEffectSourceInitData& InInitData)
+{
+	bIsActive = true;
+	NumChannels = FMath::Max(1, InInitData.NumSourceChannels);
+
+	GET_EFFECT_SETTINGS(SourceEffectRadio);
+	Fx.Init(InInitData.SampleRate, Settings);
+}
+
+void FSourceEffectRadio::OnPresetChanged()
+{
+	GET_EFFECT_SETTINGS(SourceEffectRadio);
+	Fx.SetSettings(Settings);
+}
+
+void FSourceEffectRadio::ProcessAudio(const FSoundEffectSourceInputData& InData, float* OutAudioBufferData)
+{
+	// NumSamples = 프레임 x 채널 (인터리브)
+	const int32 NumFrames = InData.NumSamples / NumChannels;
+	Fx.ProcessInterleaved(InData.InputSourceEffectBufferPtr, OutAudioBufferData, NumFrames, NumChannels);
+}
+
+void USourceEffectRadioPreset::SetSettings(const FSourceEffectRadioSettings& InSettings)
+{
+	UpdateSettings(InSettings);
+}
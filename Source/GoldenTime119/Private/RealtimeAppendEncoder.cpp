@@ -0,0 +1,69 @@
+// ============================ RealtimeAppendEncoder.cpp ============================
+#include "RealtimeAppendEncoder.h"
+#include "FastBase64.h"
+
+namespace
+{
+	const ANSICHAR AppendPrefix[] = "{\"type\":\"input_audio_buffer.append\",\"audio\":\"";
+	const ANSICHAR AppendSuffix[] = "\"}";
+
+	constexpr int32 PrefixLen = UE_ARRAY_COUNT(AppendPrefix) - 1;
+	constexpr int32 SuffixLen = UE_ARRAY_COUNT(AppendSuffix) - 1;
+
+	int32 GetMessageLength(int32 PcmBytes)
+	{
+		return PrefixLen + FastBase64::GetEncodedLength(PcmBytes) + SuffixLen;
+	}
+}
+
+void FRealtimeAppendEncoder::Reserve(int32 MaxPcmBytes)
+{
+	PendingPcm.Reserve(MaxPcmBytes);
+	Message.Reserve(GetMessageLength(MaxPcmBytes));
+}
+
+void FRealtimeAppendEncoder::AddPcm(const uint8* Data, int32 NumBytes)
+{
+	if (!Data || NumBytes <= 0)
+		return;
+
+	if (PendingPcm.Num() + NumBytes > PendingPcm.Max())
+	{
+		++GrowthCount;
+	}
+
+	PendingPcm.Append(Data, NumBytes);
+	++PendingFrames;
+}
+
+TArrayView<const uint8> FRealtimeAppendEncoder::BuildMessage()
+{
+	const int32 Len = GetMessageLength(PendingPcm.Num());
+	if (Len > Message.Max())
+	{
+		++GrowthCount;
+	}
+
+	// Num만 조정 (capacity 유지, shrink 없음)
+	Message.SetNumUninitialized(Len, false);
+
+	ANSICHAR* Dst = reinterpret_cast<ANSICHAR*>(Message.GetData());
+	FMemory::Memcpy(Dst, AppendPrefix, PrefixLen);
+	Dst += PrefixLen;
+
+	FastBase64::Encode(PendingPcm.GetData(), PendingPcm.Num(), Dst);
+	Dst += FastBase64::GetEncodedLength(PendingPcm.Num());
+
+	FMemory::Memcpy(Dst, AppendSuffix, SuffixLen);
+
+	PendingPcm.Reset();
+	PendingFrames = 0;
+
+	return TArrayView<const uint8>(Message.GetData(), Message.Num());
+}
+
+void FRealtimeAppendEncoder::Reset()
+{
+	PendingPcm.Reset();
+	PendingFrames = 0;
+}
@@ -0,0 +1,355 @@
+// ============================ RealtimeConnection.cpp ============================
+#include "RealtimeConnection.h"
+
+#include "IWebSocket.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRealtimeConnection, Log, All);
+
+namespace
+{
+	// 가장 작은 session.update (바뀌는 필드 없음) -> session.updated. Realtime에는 ping 이벤트가 없음
+	const ANSICHAR GRealtimeKeepaliveProbe[] = "{\"type\":\"session.update\",\"session\":{\"type\":\"realtime\"}}";
+}
+
+FRealtimeConnection::~FRealtimeConnection()
+{
+	ReleaseSocket();
+	Retired.Empty();
+}
+
+void FRealtimeConnection::Configure(const FRealtimeConnectionSettings& InSettings, FSocketFactory&& InFactory)
+{
+	Settings = InSettings;
+	Factory = MoveTemp(InFactory);
+}
+
+bool FRealtimeConnection::IsOpen() const
+{
+	return State == ERealtimeLinkState::Open && Socket.IsValid() && Socket->IsConnected();
+}
+
+void FRealtimeConnection::Open(double NowSec)
+{
+	if (State != ERealtimeLinkState::Offline)
+		return;
+
+	Now = NowSec;
+	Rng.Initialize((int32)(FPlatformTime::Cycles() & 0x7fffffff));
+
+	Attempts = 0;
+	bEverOpened = false;
+	bSessionReady = false;
+	OutageStartSec = 0.0;
+	ClearDeferred();
+
+	StartAttempt(NowSec);
+}
+
+void FRealtimeConnection::Close()
+{
+	ReleaseSocket();
+
+	State = ERealtimeLinkState::Offline;
+	bEverOpened = false;
+	bSessionReady = false;
+	bProbeOutstanding = false;
+	OutageStartSec = 0.0;
+	ClearDeferred();
+}
+
+void FRealtimeConnection::StartAttempt(double NowSec)
+{
+	ReleaseSocket();
+
+	Socket = Factory ? Factory() : nullptr;
+	if (!Socket.IsValid())
+	{
+		// 키가 없거나 설정이 잘못됨: 다시 해도 같으니 재시도하지 않음
+		State = ERealtimeLinkState::Offline;
+		OutageStartSec = 0.0;
+		ClearDeferred();
+		OnLost.ExecuteIfBound(TEXT("No socket (connection is not configured)"), false);
+		return;
+	}
+
+	State = ERealtimeLinkState::Connecting;
+	AttemptStartSec = NowSec;
+
+	Socket->OnConnected().AddRaw(this, &FRealtimeConnection::HandleSocketConnected);
+	Socket->OnConnectionError().AddRaw(this, &FRealtimeConnection::HandleSocketError);
+	Socket->OnClosed().AddRaw(this, &FRealtimeConnection::HandleSocketClosed);
+	// 텍스트 메시지도 UTF-8 그대로 받음 (FString 변환/파싱은 디코더 워커에서)
+	Socket->OnRawMessage().AddRaw(this, &FRealtimeConnection::HandleSocketRaw);
+
+	Socket->Connect();
+}
+
+void FRealtimeConnection::ReleaseSocket()
+{
+	if (!Socket.IsValid())
+		return;
+
+	// 닫힘 콜백이 다시 들어오지 않게 먼저 풀고 닫음
+	Socket->OnConnected().RemoveAll(this);
+	Socket->OnConnectionError().RemoveAll(this);
+	Socket->OnClosed().RemoveAll(this);
+	Socket->OnRawMessage().RemoveAll(this);
+	Socket->Close();
+
+	// 이 소켓의 콜백 안일 수 있음: 해제는 다음 Tick에
+	Retired.Add(MoveTemp(Socket));
+	Socket.Reset();
+
+	bProbeOutstanding = false;
+}
+
+void FRealtimeConnection::HandleLost(const FString& Reason, bool bRetry)
+{
+	const bool bWasOpen = (State == ERealtimeLinkState::Open);
+	ReleaseSocket();
+
+	// 열려 있던 링크가 끊긴 시각부터 복구 구간 (재시도 실패가 이어져도 그대로)
+	if (bWasOpen && OutageStartSec <= 0.0)
+	{
+		OutageStartSec = FMath::Max(Now, UE_SMALL_NUMBER);
+	}
+	bSessionReady = false;
+
+	const bool bWillRetry = bRetry && Settings.bAutoReconnect &&
+		(Settings.MaxReconnectAttempts <= 0 || Attempts < Settings.MaxReconnectAttempts);
+
+	if (bWillRetry)
+	{
+		ScheduleRetry(Now);
+	}
+	else
+	{
+		State = ERealtimeLinkState::Offline;
+		OutageStartSec = 0.0;
+		ClearDeferred();
+	}
+
+	UE_LOG(LogRealtimeConnection, Warning, TEXT("[Realtime][Link] Lost: %s (%s)"), *Reason,
+		bWillRetry ? *FString::Printf(TEXT("retry #%d in %.2fs"), Attempts, RetryAtSec - Now) : TEXT("giving up"));
+
+	OnLost.ExecuteIfBound(Reason, bWillRetry);
+}
+
+void FRealtimeConnection::ScheduleRetry(double NowSec)
+{
+	++Attempts;
+
+	// 지수 백오프 + 지터: 같은 장애로 끊긴 클라이언트들이 같은 순간에 다시 몰리지 않게
+	const double Base = FMath::Min((double)Settings.MaxBackoffSec,
+		(double)Settings.InitialBackoffSec * FMath::Pow(2.0, (double)FMath::Min(Attempts - 1, 16)));
+	const double Delay = Base * (1.0 - (double)Settings.BackoffJitter * (double)Rng.FRand());
+
+	State = ERealtimeLinkState::Backoff;
+	RetryAtSec = NowSec + Delay;
+}
+
+void FRealtimeConnection::Tick(double NowSec)
+{
+	Now = NowSec;
+	Retired.Reset();
+
+	switch (State)
+	{
+	case ERealtimeLinkState::Connecting:
+		if (NowSec - AttemptStartSec > Settings.ConnectTimeoutSec)
+		{
+			++Stats.FailedAttempts;
+			HandleLost(FString::Printf(TEXT("Connect timed out (%.1fs)"), Settings.ConnectTimeoutSec), true);
+		}
+		break;
+
+	case ERealtimeLinkState::Backoff:
+		if (NowSec >= RetryAtSec)
+		{
+			StartAttempt(NowSec);
+		}
+		break;
+
+	case ERealtimeLinkState::Open:
+		// 열린 척하는 죽은 연결 (NAT 타임아웃, 절전 복귀): 프로브 응답이 없으면 끊고 다시
+		if (bProbeOutstanding && NowSec - ProbeSentSec > Settings.KeepaliveTimeoutSec)
+		{
+			++Stats.DeadLinks;
+			++Stats.Drops;
+			HandleLost(FString::Printf(TEXT("No reply to keepalive in %.1fs"), Settings.KeepaliveTimeoutSec), true);
+			break;
+		}
+
+		if (!bProbeOutstanding && bSessionReady && Settings.KeepaliveIntervalSec > 0.f &&
+			NowSec - LastRxSec > Settings.KeepaliveIntervalSec)
+		{
+			SendProbe();
+			break;
+		}
+
+		// 세션 수명이 다 돼 가면 쉬는 동안 미리 새 세션으로 (말하는 중에 만료되지 않게)
+		if (bSessionReady && Settings.SessionRefreshSec > 0.f && NowSec - OpenedSec > Settings.SessionRefreshSec &&
+			(!IsIdle || IsIdle()))
+		{
+			++Stats.Refreshes;
+			HandleLost(TEXT("Session refresh"), true);
+			RetryAtSec = NowSec;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	ExpireDeferred(NowSec);
+}
+
+void FRealtimeConnection::SendProbe()
+{
+	bProbeOutstanding = true;
+	ProbeSentSec = Now;
+	++Stats.KeepaliveProbes;
+
+	Socket->Send(GRealtimeKeepaliveProbe, sizeof(GRealtimeKeepaliveProbe) - 1, false);
+}
+
+bool FRealtimeConnection::CanDefer() const
+{
+	return IsRecovering() && State != ERealtimeLinkState::Offline && Settings.OutageHoldSec > 0.f &&
+		(Now - OutageStartSec) <= Settings.OutageHoldSec;
+}
+
+bool FRealtimeConnection::Send(const FString& Text, bool bDeferIfOffline)
+{
+	if (IsRecovering() && bDeferIfOffline)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		return Defer(Utf8.Get(), Utf8.Length());
+	}
+
+	if (!IsOpen())
+		return false;
+
+	Socket->Send(Text);
+	return true;
+}
+
+bool FRealtimeConnection::Send(const void* Utf8, int32 Size, bool bDeferIfOffline)
+{
+	if (IsRecovering() && bDeferIfOffline)
+		return Defer(Utf8, Size);
+
+	if (!IsOpen())
+		return false;
+
+	Socket->Send(Utf8, (SIZE_T)Size, false);
+	return true;
+}
+
+bool FRealtimeConnection::Defer(const void* Utf8, int32 Size)
+{
+	if (!CanDefer() || Size <= 0)
+		return false;
+
+	if (DeferredBytes + Size > Settings.OutageBufferKB * 1024)
+	{
+		++Stats.DeferredDropped;
+		return false;
+	}
+
+	TArray<uint8>& Frame = Deferred.AddDefaulted_GetRef();
+	Frame.Append(static_cast<const uint8*>(Utf8), Size);
+	DeferredBytes += Size;
+	return true;
+}
+
+void FRealtimeConnection::ClearDeferred()
+{
+	Deferred.Reset();
+	DeferredBytes = 0;
+}
+
+void FRealtimeConnection::ExpireDeferred(double NowSec)
+{
+	if (Deferred.Num() == 0 || !IsRecovering() || NowSec - OutageStartSec <= Settings.OutageHoldSec)
+		return;
+
+	UE_LOG(LogRealtimeConnection, Warning, TEXT("[Realtime][Link] Outage longer than %.1fs: dropping %d held events (%d bytes)"),
+		Settings.OutageHoldSec, Deferred.Num(), DeferredBytes);
+
+	Stats.DeferredDropped += Deferred.Num();
+	ClearDeferred();
+}
+
+void FRealtimeConnection::MarkSessionReady()
+{
+	bSessionReady = true;
+	Attempts = 0;
+
+	if (!IsRecovering())
+		return;
+
+	Stats.LastOutageSec = Now - OutageStartSec;
+	OutageStartSec = 0.0;
+
+	if (Deferred.Num() > 0 && IsOpen())
+	{
+		UE_LOG(LogRealtimeConnection, Log, TEXT("[Realtime][Link] Session restored after %.2fs: sending %d held events (%d bytes)"),
+			Stats.LastOutageSec, Deferred.Num(), DeferredBytes);
+
+		for (const TArray<uint8>& Frame : Deferred)
+		{
+			Socket->Send(Frame.GetData(), (SIZE_T)Frame.Num(), false);
+		}
+		Stats.DeferredSent += Deferred.Num();
+	}
+	ClearDeferred();
+}
+
+// ===== Socket callbacks =====
+
+void FRealtimeConnection::HandleSocketConnected()
+{
+	const bool bReconnect = bEverOpened;
+
+	State = ERealtimeLinkState::Open;
+	bEverOpened = true;
+	bSessionReady = false;
+	bProbeOutstanding = false;
+	OpenedSec = Now;
+	LastRxSec = Now;
+
+	++Stats.Connects;
+	Stats.LastConnectMs = (Now - AttemptStartSec) * 1000.0;
+
+	OnOpened.ExecuteIfBound(bReconnect);
+}
+
+void FRealtimeConnection::HandleSocketError(const FString& Error)
+{
+	++Stats.FailedAttempts;
+	HandleLost(Error, true);
+}
+
+void FRealtimeConnection::HandleSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+	// 우리가 닫은 소켓은 먼저 풀어서 여기 오지 않음: 서버 쪽 종료(세션 만료 포함)나 망 끊김
+	if (State == ERealtimeLinkState::Open)
+	{
+		++Stats.Drops;
+	}
+	else
+	{
+		++Stats.FailedAttempts;
+	}
+	HandleLost(FString::Printf(TEXT("Closed by peer (code=%d clean=%d%s%s)"), StatusCode, bWasClean ? 1 : 0,
+		Reason.IsEmpty() ? TEXT("") : TEXT(" "), *Reason), true);
+}
+
+void FRealtimeConnection::HandleSocketRaw(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+	LastRxSec = Now;
+	bProbeOutstanding = false;
+
+	OnRawMessage.ExecuteIfBound(Data, Size, BytesRemaining);
+}
@@ -0,0 +1,584 @@
+// ============================ RealtimeEventDecoder.cpp ============================
+#include "RealtimeEventDecoder.h"
+#include "FastBase64.h"
+
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRealtimeDecode, Log, All);
+
+namespace
+{
+	constexpr uint32 InboundCapacity = 1024;
+
+	const ANSICHAR AudioDeltaType[] = "response.output_audio.delta";
+	const ANSICHAR AudioDoneType[] = "response.output_audio.done";
+	const ANSICHAR ResponseCreatedType[] = "response.created";
+	const ANSICHAR ResponseDoneType[] = "response.done";
+
+	// ===== Minimal JSON scanner =====
+	// DOM 없이 최상위 객체의 문자열 필드 위치만 찾음. 중첩 값은 구조만 따라가며 건너뜀.
+	struct FJsonSpan
+	{
+		int32 Begin = 0;        // 여는 따옴표 다음
+		int32 End = 0;          // 닫는 따옴표 위치
+		bool bHasEscapes = false;
+
+		int32 Len() const { return End - Begin; }
+	};
+
+	FORCEINLINE bool IsJsonSpace(uint8 C)
+	{
+		return C == ' ' || C == '\t' || C == '\n' || C == '\r';
+	}
+
+	FORCEINLINE int32 SkipSpace(const uint8* D, int32 N, int32 i)
+	{
+		while (i < N && IsJsonSpace(D[i]))
+		{
+			++i;
+		}
+		return i;
+	}
+
+	// i = 여는 따옴표. 반환: 닫는 따옴표 인덱스 (없으면 INDEX_NONE)
+	int32 ScanString(const uint8* D, int32 N, int32 i, bool& bOutEscapes)
+	{
+		bOutEscapes = false;
+		for (int32 j = i + 1; j < N; ++j)
+		{
+			if (D[j] == '\\')
+			{
+				bOutEscapes = true;
+				++j;
+			}
+			else if (D[j] == '"')
+			{
+				return j;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// i = 값 시작. 반환: 값 바로 다음 인덱스 (실패 시 INDEX_NONE)
+	int32 SkipValue(const uint8* D, int32 N, int32 i)
+	{
+		if (i >= N)
+			return INDEX_NONE;
+
+		bool bEsc = false;
+		if (D[i] == '"')
+		{
+			const int32 Close = ScanString(D, N, i, bEsc);
+			return (Close == INDEX_NONE) ? INDEX_NONE : Close + 1;
+		}
+
+		if (D[i] == '{' || D[i] == '[')
+		{
+			int32 Depth = 0;
+			for (int32 j = i; j < N; ++j)
+			{
+				const uint8 C = D[j];
+				if (C == '"')
+				{
+					j = ScanString(D, N, j, bEsc);
+					if (j == INDEX_NONE)
+						return INDEX_NONE;
+				}
+				else if (C == '{' || C == '[')
+				{
+					++Depth;
+				}
+				else if (C == '}' || C == ']')
+				{
+					if (--Depth == 0)
+						return j + 1;
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		// number / true / false / null
+		int32 j = i;
+		while (j < N && D[j] != ',' && D[j] != '}' && D[j] != ']' && !IsJsonSpace(D[j]))
+		{
+			++j;
+		}
+		return j;
+	}
+
+	bool FindTopLevelString(const uint8* D, int32 N, const ANSICHAR* Key, FJsonSpan& Out)
+	{
+		const int32 KeyLen = FCStringAnsi::Strlen(Key);
+
+		int32 i = SkipSpace(D, N, 0);
+		if (i >= N || D[i] != '{')
+			return false;
+		++i;
+
+		while (true)
+		{
+			i = SkipSpace(D, N, i);
+			if (i >= N || D[i] != '"')
+				return false;
+
+			bool bKeyEsc = false;
+			const int32 KeyClose = ScanString(D, N, i, bKeyEsc);
+			if (KeyClose == INDEX_NONE)
+				return false;
+
+			const bool bMatch = !bKeyEsc && (KeyClose - i - 1) == KeyLen && FMemory::Memcmp(D + i + 1, Key, KeyLen) == 0;
+
+			i = SkipSpace(D, N, KeyClose + 1);
+			if (i >= N || D[i] != ':')
+				return false;
+			i = SkipSpace(D, N, i + 1);
+
+			if (bMatch && i < N && D[i] == '"')
+			{
+				const int32 Close = ScanString(D, N, i, Out.bHasEscapes);
+				if (Close == INDEX_NONE)
+					return false;
+				Out.Begin = i + 1;
+				Out.End = Close;
+				return true;
+			}
+
+			i = SkipValue(D, N, i);
+			if (i == INDEX_NONE)
+				return false;
+
+			i = SkipSpace(D, N, i);
+			if (i < N && D[i] == ',')
+			{
+				++i;
+				continue;
+			}
+			return false;
+		}
+	}
+
+	FORCEINLINE bool SpanEquals(const uint8* D, const FJsonSpan& Span, const ANSICHAR* Literal, int32 LiteralLen)
+	{
+		return !Span.bHasEscapes && Span.Len() == LiteralLen && FMemory::Memcmp(D + Span.Begin, Literal, LiteralLen) == 0;
+	}
+
+	FString Utf8ToString(const uint8* Data, int32 Size)
+	{
+		const FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Data), Size);
+		return FString(Conv.Length(), Conv.Get());
+	}
+}
+
+FRealtimeEventDecoder::FRealtimeEventDecoder()
+	: Inbound(InboundCapacity)
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FRealtimeEventDecoder::~FRealtimeEventDecoder()
+{
+	Shutdown();
+
+	DiscardPending();
+
+	while (FRawMessage* Msg = RawPool.Pop())
+	{
+		delete Msg;
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+bool FRealtimeEventDecoder::Start(const FConfig& InConfig, const FRealtimePcmStreamPtr& InAudioStream)
+{
+	if (Thread)
+		return true;
+
+	Config = InConfig;
+	AudioStream = InAudioStream;
+
+	bStopRequested.store(false);
+	bAudioStartNotified = false;
+	MessageCounter = 0;
+	ReplyCapture.Reset();
+	bReplyCaptureOverflow = false;
+
+	// 워커 시작 전이라 여기서 초기화 (리샘플러 계수 할당)
+	ActiveCodec = Config.OutputCodec;
+	RequestedCodec.store((uint8)ActiveCodec, std::memory_order_relaxed);
+	CodecDecoder.Init(ActiveCodec, Config.OutputSampleRate);
+
+	AudioDeltaCount.store(0);
+	DecodedAudioBytes.store(0);
+	BacklogPeak = 0;
+
+	Thread = FRunnableThread::Create(this, TEXT("RealtimeEventDecoder"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogRealtimeDecode, Error, TEXT("[RealtimeDecode] Failed to create worker thread."));
+		return false;
+	}
+	return true;
+}
+
+void FRealtimeEventDecoder::Shutdown()
+{
+	if (!Thread)
+		return;
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	// 워커가 끝났으니 남은 입력은 여기서 회수
+	FRawMessage* Msg = nullptr;
+	while (Inbound.Dequeue(Msg))
+	{
+		ReleaseRaw(Msg);
+	}
+
+	AudioStream.Reset();
+}
+
+void FRealtimeEventDecoder::Stop()
+{
+	bStopRequested.store(true);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+uint32 FRealtimeEventDecoder::Run()
+{
+	while (!bStopRequested.load())
+	{
+		FRawMessage* Msg = nullptr;
+		while (Inbound.Dequeue(Msg))
+		{
+			const uint32 StartCycles = FPlatformTime::Cycles();
+			ProcessMessage(Msg->Bytes.GetData(), Msg->Bytes.Num());
+			ReleaseRaw(Msg);
+			BusyCycles.fetch_add(FPlatformTime::Cycles() - StartCycles, std::memory_order_relaxed);
+		}
+
+		// 타임아웃은 깨우기 누락 대비용
+		WakeEvent->Wait(50);
+	}
+	return 0;
+}
+
+// ===== Game thread =====
+
+FRealtimeEventDecoder::FRawMessage* FRealtimeEventDecoder::AcquireRaw()
+{
+	if (FRawMessage* Msg = RawPool.Pop())
+	{
+		return Msg;
+	}
+	return new FRawMessage();
+}
+
+void FRealtimeEventDecoder::ReleaseRaw(FRawMessage* Msg)
+{
+	Msg->Bytes.Reset();
+	RawPool.Push(Msg);
+}
+
+void FRealtimeEventDecoder::FeedFragment(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+	if (!Thread)
+		return;
+
+	if (!Assembling)
+	{
+		Assembling = AcquireRaw();
+		// 첫 조각에서 전체 크기를 알 수 있으면 한 번에 확보
+		Assembling->Bytes.Reserve((int32)(Size + BytesRemaining));
+	}
+
+	if (Data && Size > 0)
+	{
+		Assembling->Bytes.Append(static_cast<const uint8*>(Data), (int32)Size);
+	}
+
+	if (BytesRemaining > 0)
+		return;
+
+	FRawMessage* Complete = Assembling;
+	Assembling = nullptr;
+
+	FlushBacklog();
+	if (Backlog.Num() > 0 || !Inbound.Enqueue(Complete))
+	{
+		// 워커가 밀렸을 때: 순서 유지를 위해 게임 스레드에 보관 후 다음 기회에 재시도
+		Backlog.Add(Complete);
+		BacklogPeak = FMath::Max(BacklogPeak, Backlog.Num());
+	}
+
+	WakeEvent->Trigger();
+}
+
+void FRealtimeEventDecoder::FlushBacklog()
+{
+	int32 NumMoved = 0;
+	while (NumMoved < Backlog.Num() && Inbound.Enqueue(Backlog[NumMoved]))
+	{
+		++NumMoved;
+	}
+
+	if (NumMoved > 0)
+	{
+		Backlog.RemoveAt(0, NumMoved, false);
+		WakeEvent->Trigger();
+	}
+}
+
+bool FRealtimeEventDecoder::PopControlEvent(FRealtimeControlEvent& OutEvent)
+{
+	if (Backlog.Num() > 0)
+	{
+		FlushBacklog();
+	}
+	return ControlEvents.Dequeue(OutEvent);
+}
+
+void FRealtimeEventDecoder::DiscardPending()
+{
+	if (Assembling)
+	{
+		ReleaseRaw(Assembling);
+		Assembling = nullptr;
+	}
+
+	for (FRawMessage* Msg : Backlog)
+	{
+		ReleaseRaw(Msg);
+	}
+	Backlog.Reset();
+
+	ControlEvents.Empty();
+}
+
+// ===== Worker =====
+
+void FRealtimeEventDecoder::ProcessMessage(const uint8* Data, int32 Size)
+{
+	++MessageCounter;
+
+	if (Config.bVerboseLog && Config.bLogIncomingJson)
+	{
+		UE_LOG(LogRealtimeDecode, Verbose, TEXT("[Realtime][RX RAW #%lld] %s"),
+			(long long)MessageCounter, *Utf8ToString(Data, FMath::Min(Size, 5000)));
+	}
+
+	FJsonSpan TypeSpan;
+	if (!FindTopLevelString(Data, Size, "type", TypeSpan))
+	{
+		if (Config.bVerboseLog)
+		{
+			UE_LOG(LogRealtimeDecode, Warning, TEXT("[Realtime][RX #%lld] no top-level type (or malformed JSON). len=%d"),
+				(long long)MessageCounter, Size);
+		}
+		return;
+	}
+
+	if (SpanEquals(Data, TypeSpan, AudioDeltaType, UE_ARRAY_COUNT(AudioDeltaType) - 1))
+	{
+		ProcessAudioDelta(Data, Size);
+		return;
+	}
+
+	// 다음 응답의 첫 델타에서 다시 시작 알림 + 리샘플러 꼬리 비움.
+	// 취소된 응답(response.cancel)은 output_audio.done 없이 response.done만 오므로 응답 경계마다 비움
+	const bool bResponseCreated = SpanEquals(Data, TypeSpan, ResponseCreatedType, UE_ARRAY_COUNT(ResponseCreatedType) - 1);
+	const bool bResponseDone = SpanEquals(Data, TypeSpan, ResponseDoneType, UE_ARRAY_COUNT(ResponseDoneType) - 1);
+	if (bResponseCreated || bResponseDone || SpanEquals(Data, TypeSpan, AudioDoneType, UE_ARRAY_COUNT(AudioDoneType) - 1))
+	{
+		bAudioStartNotified = false;
+		CodecDecoder.Reset();
+	}
+
+	if (bResponseCreated)
+	{
+		ReplyCapture.Reset();
+		bReplyCaptureOverflow = false;
+	}
+
+	if (bResponseDone)
+	{
+		// 응답 델타는 모두 이 메시지보다 먼저 처리됨 (워커 하나, 순서대로)
+		TArray<uint8> Reply;
+		if (!bReplyCaptureOverflow)
+		{
+			Reply = MoveTemp(ReplyCapture);
+		}
+		ReplyCapture.Reset();
+		bReplyCaptureOverflow = false;
+
+		PushControlEvent(Utf8ToString(Data + TypeSpan.Begin, TypeSpan.Len()), Data, Size, &Reply);
+		return;
+	}
+
+	PushControlEvent(Utf8ToString(Data + TypeSpan.Begin, TypeSpan.Len()), Data, Size);
+}
+
+void FRealtimeEventDecoder::ProcessAudioDelta(const uint8* Data, int32 Size)
+{
+	if (!bAcceptAudio.load(std::memory_order_relaxed))
+	{
+		UE_LOG(LogRealtimeDecode, VeryVerbose, TEXT("[Realtime] output_audio.delta ignored (gate closed)"));
+		return;
+	}
+
+	FJsonSpan Delta;
+	if (!FindTopLevelString(Data, Size, "delta", Delta))
+	{
+		UE_LOG(LogRealtimeDecode, Warning, TEXT("[Realtime] output_audio.delta without delta field. len=%d"), Size);
+		return;
+	}
+
+	const ANSICHAR* B64 = reinterpret_cast<const ANSICHAR*>(Data + Delta.Begin);
+	int32 B64Len = Delta.Len();
+
+	// Base64에 나올 수 있는 이스케이프는 "\/" 뿐
+	if (Delta.bHasEscapes)
+	{
+		UnescapeScratch.Reset();
+		for (int32 i = 0; i < B64Len; ++i)
+		{
+			if (B64[i] == '\\' && i + 1 < B64Len)
+			{
+				++i;
+			}
+			UnescapeScratch.Add(B64[i]);
+		}
+		B64 = UnescapeScratch.GetData();
+		B64Len = UnescapeScratch.Num();
+	}
+
+	const ERealtimeAudioCodec Wanted = (ERealtimeAudioCodec)RequestedCodec.load(std::memory_order_relaxed);
+	if (Wanted != ActiveCodec)
+	{
+		ActiveCodec = Wanted;
+		CodecDecoder.Init(ActiveCodec, Config.OutputSampleRate);
+	}
+
+	FRealtimePcmChunk* Chunk = AudioStream.IsValid() ? AudioStream->AcquireChunk() : nullptr;
+	TArray<uint8> LocalBytes;
+	TArray<uint8>& Out = Chunk ? Chunk->Bytes : LocalBytes;
+
+	// PCM이면 청크로 바로, 압축 포맷이면 스크래치에 풀고 청크로 디코드
+	TArray<uint8>& Wire = CodecDecoder.IsPassthrough() ? Out : WireScratch;
+
+	Wire.SetNumUninitialized(FastBase64::GetMaxDecodedLength(B64Len), false);
+	int32 NumBytes = FastBase64::Decode(B64, B64Len, Wire.GetData());
+	if (NumBytes < 0)
+	{
+		UE_LOG(LogRealtimeDecode, Warning, TEXT("[Realtime] output_audio.delta base64 decode failed. deltaLen=%d"), B64Len);
+		if (Chunk)
+		{
+			AudioStream->Recycle(Chunk);
+		}
+		return;
+	}
+	Wire.SetNum(NumBytes, false);
+
+	if (!CodecDecoder.IsPassthrough())
+	{
+		NumBytes = CodecDecoder.Decode(WireScratch.GetData(), NumBytes, Out);
+	}
+
+	CaptureReplyAudio(Out.GetData(), NumBytes);
+
+	const int64 DeltaIndex = AudioDeltaCount.fetch_add(1, std::memory_order_relaxed) + 1;
+	const int64 TotalBytes = DecodedAudioBytes.fetch_add(NumBytes, std::memory_order_relaxed) + NumBytes;
+
+	const bool bLogThis = (Config.LogEveryNAudioDeltas > 0) ? ((DeltaIndex % Config.LogEveryNAudioDeltas) == 0) : false;
+	if (Config.bVerboseLog && bLogThis)
+	{
+		UE_LOG(LogRealtimeDecode, Log, TEXT("[Realtime] AudioDelta #%lld bytes=%d totalOutBytes=%lld deltaLen=%d"),
+			(long long)DeltaIndex, NumBytes, (long long)TotalBytes, B64Len);
+	}
+
+	if (Chunk)
+	{
+		Chunk->SampleRate = Config.OutputSampleRate;
+		Chunk->NumChannels = Config.OutputNumChannels;
+		AudioStream->Push(Chunk);
+
+		// 게임 스레드에는 응답당 한 번만 "시작" 알림
+		if (!bAudioStartNotified)
+		{
+			bAudioStartNotified = true;
+
+			FRealtimeControlEvent Ev;
+			Ev.Type = TEXT("response.output_audio.delta");
+			Ev.RawBytes = Size;
+			ControlEvents.Enqueue(MoveTemp(Ev));
+		}
+		return;
+	}
+
+	// 스트림 미연결: 기존 델리게이트 경로
+	FRealtimeControlEvent Ev;
+	Ev.Type = TEXT("response.output_audio.delta");
+	Ev.Audio = MoveTemp(LocalBytes);
+	Ev.RawBytes = Size;
+	ControlEvents.Enqueue(MoveTemp(Ev));
+}
+
+void FRealtimeEventDecoder::CaptureReplyAudio(const uint8* Pcm, int32 NumBytes)
+{
+	const int32 Limit = ReplyCaptureLimit.load(std::memory_order_relaxed);
+	if (Limit <= 0 || bReplyCaptureOverflow || NumBytes <= 0)
+		return;
+
+	// 긴 응답은 캐시 대상이 아님: 이번 응답은 그만 모음
+	if (ReplyCapture.Num() + NumBytes > Limit)
+	{
+		bReplyCaptureOverflow = true;
+		ReplyCapture.Reset();
+		return;
+	}
+
+	ReplyCapture.Append(Pcm, NumBytes);
+}
+
+void FRealtimeEventDecoder::PushControlEvent(const FString& Type, const uint8* Data, int32 Size, TArray<uint8>* AttachAudio)
+{
+	FRealtimeControlEvent Ev;
+	Ev.Type = Type;
+	Ev.RawBytes = Size;
+
+	if (AttachAudio)
+	{
+		Ev.Audio = MoveTemp(*AttachAudio);
+	}
+
+	const FString Json = Utf8ToString(Data, Size);
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(Reader, Ev.Root) || !Ev.Root.IsValid())
+	{
+		if (Config.bVerboseLog)
+		{
+			UE_LOG(LogRealtimeDecode, Warning, TEXT("[Realtime][RX #%lld] JSON parse failed. type=%s len=%d"),
+				(long long)MessageCounter, *Type, Size);
+		}
+		return;
+	}
+
+	ControlEvents.Enqueue(MoveTemp(Ev));
+}
@@ -0,0 +1,79 @@
+// ============================ RealtimePcmStream.cpp ============================
+#include "RealtimePcmStream.h"
+#include "HAL/PlatformTime.h"
+
+FRealtimePcmStream::FRealtimePcmStream(uint32 InCapacity)
+	: Queue(FMath::Max<uint32>(InCapacity, 2u))
+{
+}
+
+FRealtimePcmStream::~FRealtimePcmStream()
+{
+	FRealtimePcmChunk* Chunk = nullptr;
+	while (Queue.Dequeue(Chunk))
+	{
+		delete Chunk;
+	}
+
+	while (FRealtimePcmChunk* Free = FreeList.Pop())
+	{
+		delete Free;
+	}
+}
+
+FRealtimePcmChunk* FRealtimePcmStream::AcquireChunk()
+{
+	if (FRealtimePcmChunk* Chunk = FreeList.Pop())
+	{
+		return Chunk;
+	}
+
+	NumAllocated.fetch_add(1, std::memory_order_relaxed);
+	return new FRealtimePcmChunk();
+}
+
+bool FRealtimePcmStream::Push(FRealtimePcmChunk* Chunk)
+{
+	if (!Chunk)
+		return false;
+
+	Chunk->Serial = NumPushed.load(std::memory_order_relaxed);
+	Chunk->ArrivalTime = FPlatformTime::Seconds();
+
+	if (!Queue.Enqueue(Chunk))
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		Recycle(Chunk);
+		return false;
+	}
+
+	// 단일 producer라 load + store로 충분
+	NumPushed.store(Chunk->Serial + 1, std::memory_order_release);
+	return true;
+}
+
+FRealtimePcmChunk* FRealtimePcmStream::Pop()
+{
+	FRealtimePcmChunk* Chunk = nullptr;
+	return Queue.Dequeue(Chunk) ? Chunk : nullptr;
+}
+
+void FRealtimePcmStream::Recycle(FRealtimePcmChunk* Chunk)
+{
+	if (!Chunk)
+		return;
+
+	Chunk->Bytes.Reset();
+	FreeList.Push(Chunk);
+}
+
+int32 FRealtimePcmStream::DiscardAll()
+{
+	int32 Num = 0;
+	while (FRealtimePcmChunk* Chunk = Pop())
+	{
+		Recycle(Chunk);
+		++Num;
+	}
+	return Num;
+}
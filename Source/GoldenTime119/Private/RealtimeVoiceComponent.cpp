@@ -1,5 +1,6 @@
 // RealtimeVoiceComponent.cpp
 #include "RealtimeVoiceComponent.h"
+#include "RadioReplyCache.h"
 
 #include "IWebSocket.h"
 #include "WebSocketsModule.h"
@@ -8,7 +9,6 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
-#include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformProcess.h"
@@ -17,7 +17,9 @@ DEFINE_LOG_CATEGORY_STATIC(LogRealtimeVoice, Log, All);
 
 URealtimeVoiceComponent::URealtimeVoiceComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	//  ߿ Tick (ڴ  ̺Ʈ  + 翬/keepalive Ÿ̸)
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
 	BaseInstructions =
 		TEXT("You are an emergency radio operator. ")
@@ -29,6 +31,12 @@ void URealtimeVoiceComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 20ms  x ھ󷹽   ̸ Ȯ -> Ʈ  Ҵ 
+	{
+		const int32 FrameBytes = FMath::Max(1, InputSampleRate / 50) * FMath::Max(1, InputNumChannels) * (int32)sizeof(int16);
+		AppendEncoder.Reserve(FrameBytes * FMath::Max(1, AppendCoalesceFrames));
+	}
+
 	if (bEnableVerboseLog)
 	{
 		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] BeginPlay owner=%s comp=%s"),
@@ -47,12 +55,102 @@ void URealtimeVoiceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	}
 
 	Disconnect();
+	EventDecoder.Reset();
 	Super::EndPlay(EndPlayReason);
 }
 
+void URealtimeVoiceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Connection.Tick(FPlatformTime::Seconds());
+
+	if (EventDecoder)
+	{
+		FRealtimeControlEvent Event;
+		while (EventDecoder->PopControlEvent(Event))
+		{
+			HandleControlEvent(Event);
+
+			// ڵ鷯 Disconnect Ǹ ڴ ť 
+			if (!EventDecoder->IsRunning())
+				break;
+		}
+	}
+
+	// Disconnect() Ǵ õ 
+	if (!Connection.IsActive())
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void URealtimeVoiceComponent::StartEventDecoder()
+{
+	if (!EventDecoder)
+	{
+		EventDecoder = MakeUnique<FRealtimeEventDecoder>();
+	}
+
+	FRealtimeEventDecoder::FConfig Config;
+	Config.OutputSampleRate = OutputSampleRate;
+	Config.OutputNumChannels = OutputNumChannels;
+	Config.OutputCodec = ActiveOutputCodec;
+	Config.bVerboseLog = bEnableVerboseLog;
+	Config.bLogIncomingJson = bLogIncomingJson;
+	Config.bLogIncomingSummary = bLogIncomingSummary;
+	Config.LogEveryNAudioDeltas = LogEveryNAudioDeltas;
+
+	EventDecoder->Start(Config, OutputAudioStream);
+	SyncAudioGate();
+
+	//  ĳ: Ŀ ª  PCM response.done ٿ
+	{
+		const int32 BytesPerSec = FMath::Max(1, OutputSampleRate) * FMath::Max(1, OutputNumChannels) * (int32)sizeof(int16);
+		EventDecoder->SetReplyCaptureLimit(bCacheReplies ? FMath::RoundToInt(MaxCachedReplySec * BytesPerSec) : 0);
+	}
+	SyncReplyCacheProfile();
+}
+
+void URealtimeVoiceComponent::StopEventDecoder()
+{
+	if (EventDecoder)
+	{
+		if (bEnableVerboseLog && EventDecoder->GetBacklogPeak() > 0)
+		{
+			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Decoder fell behind: backlog peak=%d messages"),
+				*NowShort(), EventDecoder->GetBacklogPeak());
+		}
+
+		EventDecoder->Shutdown();
+		EventDecoder->DiscardPending();
+	}
+}
+
+void URealtimeVoiceComponent::SyncAudioGate()
+{
+	if (EventDecoder)
+	{
+		EventDecoder->SetAcceptAudio(!bGateOutputAudioToCreateResponse || bAllowServerAudio);
+	}
+}
+
 bool URealtimeVoiceComponent::IsConnected() const
 {
-	return Socket.IsValid() && Socket->IsConnected();
+	return Connection.IsOpen();
+}
+
+bool URealtimeVoiceComponent::IsAvailable() const
+{
+	return Connection.IsOpen() || Connection.CanDefer();
+}
+
+bool URealtimeVoiceComponent::IsLinkIdle() const
+{
+	//    ƴϰ(    ) ȭ ߵ ƴϸ ѵ ְ  
+	constexpr double IdleBeforeRefreshSec = 10.0;
+	return !bResponseActive && TurnSentAudio.Num() == 0 && !bTurnAudioOverflow && !AppendEncoder.HasPending()
+		&& (FPlatformTime::Seconds() - LastActivitySec) > IdleBeforeRefreshSec;
 }
 
 FString URealtimeVoiceComponent::BuildWebSocketUrl() const
@@ -129,9 +227,9 @@ void URealtimeVoiceComponent::DebugDumpState(const TCHAR* Tag) const
 		(long long)OutgoingEventCounter,
 		(long long)IncomingEventCounter,
 		(long long)AppendCounter,
-		(long long)AudioDeltaCounter,
+		EventDecoder ? (long long)EventDecoder->GetAudioDeltaCount() : 0ll,
 		(long long)TotalAppendedPcmBytes,
-		(long long)TotalReceivedOutAudioBytes
+		EventDecoder ? (long long)EventDecoder->GetDecodedAudioBytes() : 0ll
 	);
 }
 
@@ -179,67 +277,99 @@ FString URealtimeVoiceComponent::LoadApiKeyMaybe(FString& OutResolvedPath, FStri
 
 void URealtimeVoiceComponent::Connect()
 {
-	if (IsConnected())
+	if (Connection.IsActive())
 	{
 		if (bEnableVerboseLog)
 		{
-			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Connect() called but already connected."), *NowShort());
+			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Connect() called but already connected (link state=%d)."),
+				*NowShort(), (int32)Connection.GetState());
 		}
 		return;
 	}
 
+	// 翬ᵵ  丮 (õ   + ڴ )
+	Connection.Configure(ConnectionSettings, [this]() { return CreateSocket(); });
+	Connection.OnOpened.BindUObject(this, &URealtimeVoiceComponent::HandleWsConnected);
+	Connection.OnLost.BindUObject(this, &URealtimeVoiceComponent::HandleWsLost);
+	Connection.OnRawMessage.BindUObject(this, &URealtimeVoiceComponent::HandleWsRawMessage);
+	Connection.IsIdle = [this]() { return IsLinkIdle(); };
+
+	LastActivitySec = FPlatformTime::Seconds();
+	SetComponentTickEnabled(true);
+
+	Connection.Open(FPlatformTime::Seconds());
+}
+
+TSharedPtr<IWebSocket> URealtimeVoiceComponent::CreateSocket()
+{
+	TSharedPtr<IWebSocket> Socket;
+
 	ConnectStartTimeSec = FPlatformTime::Seconds();
 
-	FString ResolvedPath, KeyError;
-	const FString Key = LoadApiKeyMaybe(ResolvedPath, KeyError);
-	if (Key.IsEmpty())
+	ActiveOutputCodec = OutputCodec;
+	InitInputCodec(InputCodec);
+
+	if (bUseMockServer)
 	{
-		const FString Msg = FString::Printf(TEXT("OpenAI API Key missing. %s"), *KeyError);
-		UE_LOG(LogRealtimeVoice, Error, TEXT("[%s][Realtime] %s"), *NowShort(), *Msg);
-		OnError.Broadcast(Msg);
-		return;
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Connecting to local mock server (first audio %.0f ms, jitter +-%.0f ms)"),
+			*NowShort(), MockServer.FirstAudioDelayMs, MockServer.JitterMs);
+
+		FMockRealtimeSettings MockSettings = MockServer;
+		MockSettings.SampleRate = OutputSampleRate;
+		Socket = MakeShared<FMockRealtimeWebSocket>(MockSettings);
 	}
+	else
+	{
+		FString ResolvedPath, KeyError;
+		const FString Key = LoadApiKeyMaybe(ResolvedPath, KeyError);
+		if (Key.IsEmpty())
+		{
+			const FString Msg = FString::Printf(TEXT("OpenAI API Key missing. %s"), *KeyError);
+			UE_LOG(LogRealtimeVoice, Error, TEXT("[%s][Realtime] %s"), *NowShort(), *Msg);
+			OnError.Broadcast(Msg);
+			return nullptr;
+		}
 
-	const FString Url = BuildWebSocketUrl();
+		const FString Url = BuildWebSocketUrl();
 
-	if (bEnableVerboseLog)
-	{
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Connecting... url=%s"), *NowShort(), *Url);
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Key source: %s"),
-			*NowShort(), ApiKey.IsEmpty() ? *ResolvedPath : TEXT("<ApiKey property>"));
-		DebugDumpState(TEXT("PreConnect"));
-	}
+		if (bEnableVerboseLog)
+		{
+			UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Connecting... url=%s"), *NowShort(), *Url);
+			UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Key source: %s"),
+				*NowShort(), ApiKey.IsEmpty() ? *ResolvedPath : TEXT("<ApiKey property>"));
+			DebugDumpState(TEXT("PreConnect"));
+		}
 
-	FWebSocketsModule& WsModule = FWebSocketsModule::Get();
+		FWebSocketsModule& WsModule = FWebSocketsModule::Get();
 
-	TMap<FString, FString> Headers;
-	Headers.Add(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Key));
+		TMap<FString, FString> Headers;
+		Headers.Add(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Key));
 
-	Socket = WsModule.CreateWebSocket(Url, TEXT(""), Headers);
+		Socket = WsModule.CreateWebSocket(Url, TEXT(""), Headers);
+	}
 
-	Socket->OnConnected().AddUObject(this, &URealtimeVoiceComponent::HandleWsConnected);
-	Socket->OnConnectionError().AddUObject(this, &URealtimeVoiceComponent::HandleWsConnectionError);
-	Socket->OnClosed().AddUObject(this, &URealtimeVoiceComponent::HandleWsClosed);
-	Socket->OnMessage().AddUObject(this, &URealtimeVoiceComponent::HandleWsMessage);
+	//  õ  ޽  ʰ õ   ( HandleWsLost )
+	StartEventDecoder();
 
-	Socket->Connect();
+	return Socket;
 }
 
 void URealtimeVoiceComponent::Disconnect()
 {
 	if (bEnableVerboseLog)
 	{
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Disconnect() called. SocketValid=%d Connected=%d"),
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Disconnect() called. LinkState=%d Connected=%d"),
 			*NowShort(),
-			Socket.IsValid() ? 1 : 0,
+			(int32)Connection.GetState(),
 			IsConnected() ? 1 : 0);
 	}
 
-	if (Socket.IsValid())
-	{
-		Socket->Close();
-		Socket.Reset();
-	}
+	// 츮 ݴ  翬 
+	Connection.Close();
+
+	AppendEncoder.Reset();
+	StopEventDecoder();
+	SetComponentTickEnabled(false);
 
 	bAllowServerAudio = false;
 	bDidStartAudio = false;
@@ -255,23 +385,28 @@ void URealtimeVoiceComponent::Disconnect()
 	}
 }
 
-void URealtimeVoiceComponent::HandleWsConnected()
+void URealtimeVoiceComponent::HandleWsConnected(bool bReconnect)
 {
 	const double ElapsedMs = (FPlatformTime::Seconds() - ConnectStartTimeSec) * 1000.0;
 
-	UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] WS Connected. %.1f ms"), *NowShort(), ElapsedMs);
+	UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] WS Connected%s. %.1f ms"),
+		*NowShort(), bReconnect ? TEXT(" (reconnect)") : TEXT(""), ElapsedMs);
 
-	OutgoingEventCounter = 0;
-	IncomingEventCounter = 0;
-	AppendCounter = 0;
-	AudioDeltaCounter = 0;
-	TotalAppendedPcmBytes = 0;
-	TotalReceivedOutAudioBytes = 0;
+	// 翬:   ( append/commit/ û) ̾Ƿ Է īͿ  Ʈ 
+	if (!bReconnect)
+	{
+		OutgoingEventCounter = 0;
+		IncomingEventCounter = 0;
+		AppendCounter = 0;
+		TotalAppendedPcmBytes = 0;
+		bAllowServerAudio = false;
+	}
 
 	bDidStartAudio = false;
-	bAllowServerAudio = false;
+	bResponseActive = false;
+	SyncAudioGate();
 
-	//  Ŭ
+	//  Ŭ ( ̶ /Ʈ/ ¸ session.created ڿ ٽ )
 	bSessionCreated = false;
 	bPendingInitialSessionUpdate = true; // session.created   update 
 
@@ -281,33 +416,44 @@ void URealtimeVoiceComponent::HandleWsConnected()
 	DebugDumpState(TEXT("PostConnected"));
 }
 
-void URealtimeVoiceComponent::HandleWsConnectionError(const FString& Error)
+void URealtimeVoiceComponent::HandleWsLost(const FString& Reason, bool bWillRetry)
 {
-	UE_LOG(LogRealtimeVoice, Error, TEXT("[%s][Realtime] WS ConnectionError: %s"), *NowShort(), *Error);
-	OnError.Broadcast(Error);
-	OnConnected.Broadcast(false);
-	DebugDumpState(TEXT("ConnError"));
-}
+	UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] WS lost: %s (%s)"),
+		*NowShort(), *Reason, bWillRetry ? TEXT("reconnecting") : TEXT("offline"));
 
-void URealtimeVoiceComponent::HandleWsClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
-{
-	UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] WS Closed. code=%d clean=%d reason=%s"),
-		*NowShort(), StatusCode, bWasClean ? 1 : 0, *Reason);
-
-	OnConnected.Broadcast(false);
+	StopEventDecoder();
 
-	bAllowServerAudio = false;
-	bDidStartAudio = false;
+	// ޴  ⼭ :    ä  ʰ
+	if (bDidStartAudio)
+	{
+		bDidStartAudio = false;
+		OnAudioEnded.Broadcast();
+		OnOutputAudioDone.Broadcast();
+	}
+	ReplyTranscript.Reset();
+	bResponseActive = false;
 
 	bSessionCreated = false;
 	bPendingInitialSessionUpdate = false;
 
-	DebugDumpState(TEXT("Closed"));
+	// 翬 ̸ ھ󷹽   flush   ť  (̹   TurnSentAudio )
+	if (!bWillRetry)
+	{
+		AppendEncoder.Reset();
+		TurnSentAudio.Reset();
+		bTurnAudioOverflow = false;
+		bTurnCommitDeferred = false;
+		bAllowServerAudio = false;
+		OnError.Broadcast(Reason);
+	}
+
+	OnConnected.Broadcast(false);
+	DebugDumpState(TEXT("Lost"));
 }
 
-void URealtimeVoiceComponent::SendJsonEvent(const TSharedPtr<FJsonObject>& Obj, const TCHAR* DebugTag)
+void URealtimeVoiceComponent::SendJsonEvent(const TSharedPtr<FJsonObject>& Obj, const TCHAR* DebugTag, bool bDeferIfOffline)
 {
-	if (!IsConnected())
+	if (!IsConnected() && !(bDeferIfOffline && Connection.CanDefer()))
 	{
 		if (bEnableVerboseLog)
 		{
@@ -317,6 +463,8 @@ void URealtimeVoiceComponent::SendJsonEvent(const TSharedPtr<FJsonObject>& Obj,
 	}
 
 	++OutgoingEventCounter;
+	LastActivitySec = FPlatformTime::Seconds();
+	const bool bHeld = bDeferIfOffline && Connection.IsRecovering();
 
 	FString Out = JsonToString(Obj, false);
 
@@ -328,8 +476,8 @@ void URealtimeVoiceComponent::SendJsonEvent(const TSharedPtr<FJsonObject>& Obj,
 			TypeStr = Obj->GetStringField(TEXT("type"));
 		}
 
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime][TX #%lld][%s] type=%s bytes=%d"),
-			*NowShort(), (long long)OutgoingEventCounter, DebugTag, *TypeStr, Out.Len());
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime][TX #%lld][%s] type=%s bytes=%d%s"),
+			*NowShort(), (long long)OutgoingEventCounter, DebugTag, *TypeStr, Out.Len(), bHeld ? TEXT(" (held until session restored)") : TEXT(""));
 
 		if (bLogOutgoingJson)
 		{
@@ -338,7 +486,51 @@ void URealtimeVoiceComponent::SendJsonEvent(const TSharedPtr<FJsonObject>& Obj,
 		}
 	}
 
-	Socket->Send(Out);
+	if (!Connection.Send(Out, bDeferIfOffline))
+	{
+		UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] SendJsonEvent(%s) dropped: outage buffer full or expired."), *NowShort(), DebugTag);
+	}
+}
+
+void URealtimeVoiceComponent::FlushPendingAppend()
+{
+	if (!AppendEncoder.HasPending() || !IsAvailable())
+		return;
+
+	const int32 PcmBytes = AppendEncoder.GetPendingBytes();
+	const int32 Frames = AppendEncoder.GetPendingFrames();
+
+	//  ǿ ٷ  и  ( 翬  ť ).  ѵ  ۿ 
+	if (!Connection.IsRecovering() && !bTurnAudioOverflow)
+	{
+		if (TurnSentAudio.Num() + PcmBytes > ConnectionSettings.OutageBufferKB * 1024)
+		{
+			bTurnAudioOverflow = true;
+			TurnSentAudio.Reset();
+		}
+		else
+		{
+			TurnSentAudio.Append(AppendEncoder.GetPendingPcm());
+		}
+	}
+
+	const TArrayView<const uint8> Message = AppendEncoder.BuildMessage();
+
+	++OutgoingEventCounter;
+	LastActivitySec = FPlatformTime::Seconds();
+
+	if (bEnableVerboseLog && bLogOutgoingJson)
+	{
+		const FString Out(Message.Num(), UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Message.GetData())));
+		UE_LOG(LogRealtimeVoice, Verbose, TEXT("[%s][Realtime][TX JSON #%lld][input_audio_buffer.append] frames=%d pcmBytes=%d\n%s"),
+			*NowShort(), (long long)OutgoingEventCounter, Frames, PcmBytes, *TruncateForLog(Out, 4000));
+	}
+
+	// ̹ UTF-8 JSON̹Ƿ ؽƮ  ״  (FString ȯ ).   ̸  ƿ ڿ
+	if (!Connection.Send(Message.GetData(), Message.Num(), true) && bEnableVerboseLog)
+	{
+		UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] append dropped (%d frames): outage buffer full or expired."), *NowShort(), Frames);
+	}
 }
 
 FString URealtimeVoiceComponent::BuildInstructionsMerged() const
@@ -376,8 +568,14 @@ void URealtimeVoiceComponent::SendSessionUpdate(const TCHAR* ReasonTag)
 		{
 			const TSharedPtr<FJsonObject> In = MakeShared<FJsonObject>();
 			const TSharedPtr<FJsonObject> InFormat = MakeShared<FJsonObject>();
-			InFormat->SetStringField(TEXT("type"), TEXT("audio/pcm"));
-			InFormat->SetNumberField(TEXT("rate"), InputSampleRate);
+			const IVoiceAudioCodec& InWire = VoiceAudioCodecs::Get(ActiveInputCodec);
+			InFormat->SetStringField(TEXT("type"), InWire.GetWireFormat());
+
+			// rate audio/pcm (G.711 8kHz )
+			if (InWire.GetWireSampleRate() == 0)
+			{
+				InFormat->SetNumberField(TEXT("rate"), InputSampleRate);
+			}
 			In->SetObjectField(TEXT("format"), InFormat);
 
 			//  PTT: VAD   
@@ -390,7 +588,7 @@ void URealtimeVoiceComponent::SendSessionUpdate(const TCHAR* ReasonTag)
 		{
 			const TSharedPtr<FJsonObject> Out = MakeShared<FJsonObject>();
 			const TSharedPtr<FJsonObject> OutFormat = MakeShared<FJsonObject>();
-			OutFormat->SetStringField(TEXT("type"), TEXT("audio/pcm"));
+			OutFormat->SetStringField(TEXT("type"), VoiceAudioCodecs::GetWireFormat(ActiveOutputCodec));
 			Out->SetObjectField(TEXT("format"), OutFormat);
 			Out->SetStringField(TEXT("voice"), VoiceName);
 			Audio->SetObjectField(TEXT("output"), Out);
@@ -407,12 +605,12 @@ void URealtimeVoiceComponent::SendSessionUpdate(const TCHAR* ReasonTag)
 
 	if (bEnableVerboseLog)
 	{
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] SendSessionUpdate(%s) model=%s in=%dHz/%dch out=%dHz/%dch voice=%s instrLen=%d"),
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] SendSessionUpdate(%s) model=%s in=%dHz/%dch %s out=%dHz/%dch %s voice=%s instrLen=%d"),
 			*NowShort(),
 			ReasonTag,
 			*RealtimeModel,
-			InputSampleRate, InputNumChannels,
-			OutputSampleRate, OutputNumChannels,
+			InputSampleRate, InputNumChannels, VoiceAudioCodecs::GetWireFormat(ActiveInputCodec),
+			OutputSampleRate, OutputNumChannels, VoiceAudioCodecs::GetWireFormat(ActiveOutputCodec),
 			*VoiceName,
 			Instr.Len());
 	}
@@ -420,8 +618,103 @@ void URealtimeVoiceComponent::SendSessionUpdate(const TCHAR* ReasonTag)
 	SendJsonEvent(Root, TEXT("session.update"));
 }
 
+void URealtimeVoiceComponent::InitInputCodec(ERealtimeAudioCodec Codec)
+{
+	//  ڵ mono  
+	if (Codec != ERealtimeAudioCodec::Pcm16 && InputNumChannels != 1)
+	{
+		UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] %s needs mono input (InputNumChannels=%d). Falling back to audio/pcm."),
+			*NowShort(), VoiceAudioCodecs::GetWireFormat(Codec), InputNumChannels);
+		Codec = ERealtimeAudioCodec::Pcm16;
+	}
+
+	ActiveInputCodec = Codec;
+	InputCodecEncoder.Init(Codec, InputSampleRate);
+}
+
+void URealtimeVoiceComponent::ApplyNegotiatedCodecs(const TSharedPtr<FJsonObject>& Root)
+{
+	const TSharedPtr<FJsonObject>* Session = nullptr;
+	const TSharedPtr<FJsonObject>* Audio = nullptr;
+	if (!Root.IsValid() || !Root->TryGetObjectField(TEXT("session"), Session) || !(*Session)->TryGetObjectField(TEXT("audio"), Audio))
+		return;
+
+	// session.audio.<Dir>.format.type -> ڵ (ų 𸣴 ̸ nullptr)
+	auto FindFormat = [Audio](const TCHAR* Dir) -> const IVoiceAudioCodec*
+	{
+		const TSharedPtr<FJsonObject>* DirObj = nullptr;
+		const TSharedPtr<FJsonObject>* Format = nullptr;
+		FString WireFormat;
+		if (!(*Audio)->TryGetObjectField(Dir, DirObj) || !(*DirObj)->TryGetObjectField(TEXT("format"), Format) ||
+			!(*Format)->TryGetStringField(TEXT("type"), WireFormat))
+			return nullptr;
+
+		const IVoiceAudioCodec* Codec = VoiceAudioCodecs::FindByWireFormat(WireFormat);
+		if (!Codec)
+		{
+			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Unsupported %s audio format from server: %s"), *NowShort(), Dir, *WireFormat);
+		}
+		return Codec;
+	};
+
+	if (const IVoiceAudioCodec* In = FindFormat(TEXT("input")))
+	{
+		if (In->GetId() != ActiveInputCodec)
+		{
+			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Server input format is %s (requested %s). Switching encoder."),
+				*NowShort(), In->GetWireFormat(), VoiceAudioCodecs::GetWireFormat(ActiveInputCodec));
+
+			//      ߸ ؼϹǷ 
+			AppendEncoder.Reset();
+			InitInputCodec(In->GetId());
+		}
+	}
+
+	if (const IVoiceAudioCodec* Out = FindFormat(TEXT("output")))
+	{
+		if (Out->GetId() != ActiveOutputCodec)
+		{
+			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] Server output format is %s (requested %s). Switching decoder."),
+				*NowShort(), Out->GetWireFormat(), VoiceAudioCodecs::GetWireFormat(ActiveOutputCodec));
+
+			ActiveOutputCodec = Out->GetId();
+			if (EventDecoder)
+			{
+				EventDecoder->SetOutputCodec(ActiveOutputCodec);
+			}
+			SyncReplyCacheProfile();
+		}
+	}
+}
+
+void URealtimeVoiceComponent::SendInstructionsUpdate(const TCHAR* ReasonTag)
+{
+	// session.update  ʵ常 ٲ: ؽƮ ſ / /̽ Ź ٽ  ʿ 
+	const TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("type"), TEXT("session.update"));
+
+	const TSharedPtr<FJsonObject> Session = MakeShared<FJsonObject>();
+	Session->SetStringField(TEXT("type"), TEXT("realtime"));
+
+	const FString Instr = BuildInstructionsMerged();
+	Session->SetStringField(TEXT("instructions"), Instr);
+
+	Root->SetObjectField(TEXT("session"), Session);
+
+	if (bEnableVerboseLog)
+	{
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] SendInstructionsUpdate(%s) instrLen=%d contextLen=%d"),
+			*NowShort(), ReasonTag, Instr.Len(), DynamicContext.Len());
+	}
+
+	SendJsonEvent(Root, TEXT("session.update(instructions)"));
+}
+
 void URealtimeVoiceComponent::UpdateDynamicContext(const FString& NewContext)
 {
+	if (NewContext.Equals(DynamicContext, ESearchCase::CaseSensitive))
+		return;
+
 	DynamicContext = NewContext;
 
 	if (bEnableVerboseLog)
@@ -433,7 +726,7 @@ void URealtimeVoiceComponent::UpdateDynamicContext(const FString& NewContext)
 	// session.created Ŀ update (  pending )
 	if (IsConnected() && bSessionCreated)
 	{
-		SendSessionUpdate(TEXT("UpdateDynamicContext"));
+		SendInstructionsUpdate(TEXT("UpdateDynamicContext"));
 	}
 	else
 	{
@@ -448,6 +741,7 @@ void URealtimeVoiceComponent::UpdateDynamicContext(const FString& NewContext)
 void URealtimeVoiceComponent::SetAllowServerAudio(bool bAllow)
 {
 	bAllowServerAudio = bAllow;
+	SyncAudioGate();
 
 	if (bEnableVerboseLog)
 	{
@@ -463,18 +757,27 @@ void URealtimeVoiceComponent::BeginUserTurn(bool bCancelOngoingResponse, bool bC
 			*NowShort(), bCancelOngoingResponse ? 1 : 0, bClearOutputAudio ? 1 : 0, IsConnected() ? 1 : 0);
 	}
 
-	if (!IsConnected())
+	if (!IsAvailable())
 		return;
 
+	//     ȭ  Ͽ ǹ  (cancel/clear  ̸  ʿ䵵 )
+	Connection.ClearDeferred();
+
 	//   (PTT ٿ)    
 	if (bGateOutputAudioToCreateResponse)
 	{
 		bAllowServerAudio = false;
+		SyncAudioGate();
 	}
 
 	//   ̴ Է  ī ( commit )
 	AppendCounter = 0;
 	TotalAppendedPcmBytes = 0;
+	AppendEncoder.Reset();
+	InputCodecEncoder.Reset();
+	TurnSentAudio.Reset();
+	bTurnAudioOverflow = false;
+	bTurnCommitDeferred = false;
 
 	if (bCancelOngoingResponse)
 	{
@@ -500,7 +803,12 @@ void URealtimeVoiceComponent::BeginUserTurn(bool bCancelOngoingResponse, bool bC
 
 void URealtimeVoiceComponent::AppendInputAudioPCM16(const TArray<uint8>& Pcm16Bytes)
 {
-	if (!IsConnected())
+	AppendInputAudioPCM16Raw(Pcm16Bytes.GetData(), Pcm16Bytes.Num());
+}
+
+void URealtimeVoiceComponent::AppendInputAudioPCM16Raw(const uint8* Pcm16Bytes, int32 NumBytes)
+{
+	if (!IsAvailable())
 	{
 		if (bEnableVerboseLog)
 		{
@@ -509,17 +817,23 @@ void URealtimeVoiceComponent::AppendInputAudioPCM16(const TArray<uint8>& Pcm16By
 		return;
 	}
 
-	if (Pcm16Bytes.Num() <= 0)
+	if (!Pcm16Bytes || NumBytes <= 0)
 		return;
 
 	++AppendCounter;
-	TotalAppendedPcmBytes += Pcm16Bytes.Num();
-
-	const FString B64 = FBase64::Encode(Pcm16Bytes);
+	TotalAppendedPcmBytes += NumBytes;
 
-	const TSharedPtr<FJsonObject> Ev = MakeShared<FJsonObject>();
-	Ev->SetStringField(TEXT("type"), TEXT("input_audio_buffer.append"));
-	Ev->SetStringField(TEXT("audio"), B64);
+	if (InputCodecEncoder.IsPassthrough())
+	{
+		AppendEncoder.AddPcm(Pcm16Bytes, NumBytes);
+	}
+	else
+	{
+		//  : ̾ Ʈ  + ڵ Ʈ base64 
+		EncodedInputScratch.Reset();
+		InputCodecEncoder.Encode(reinterpret_cast<const int16*>(Pcm16Bytes), NumBytes / (int32)sizeof(int16), EncodedInputScratch);
+		AppendEncoder.AddPcm(EncodedInputScratch.GetData(), EncodedInputScratch.Num());
+	}
 
 	if (bEnableVerboseLog)
 	{
@@ -527,23 +841,28 @@ void URealtimeVoiceComponent::AppendInputAudioPCM16(const TArray<uint8>& Pcm16By
 		if (bLogThis)
 		{
 			UE_LOG(LogRealtimeVoice, Log,
-				TEXT("[%s][Realtime] Append #%lld pcmBytes=%d totalPcmBytes=%lld b64Len=%d (~%.2fs @ %dHz mono)"),
+				TEXT("[%s][Realtime] Append #%lld pcmBytes=%d totalPcmBytes=%lld pending=%d/%d frames (~%.2fs @ %dHz mono) bufGrowths=%d"),
 				*NowShort(),
 				(long long)AppendCounter,
-				Pcm16Bytes.Num(),
+				NumBytes,
 				(long long)TotalAppendedPcmBytes,
-				B64.Len(),
-				(InputSampleRate > 0) ? (double)(Pcm16Bytes.Num() / 2) / (double)InputSampleRate : 0.0,
-				InputSampleRate);
+				AppendEncoder.GetPendingFrames(),
+				FMath::Max(1, AppendCoalesceFrames),
+				(InputSampleRate > 0) ? (double)(NumBytes / 2) / (double)InputSampleRate : 0.0,
+				InputSampleRate,
+				AppendEncoder.GetGrowthCount());
 		}
 	}
 
-	SendJsonEvent(Ev, TEXT("input_audio_buffer.append"));
+	if (AppendEncoder.GetPendingFrames() >= FMath::Max(1, AppendCoalesceFrames))
+	{
+		FlushPendingAppend();
+	}
 }
 
 void URealtimeVoiceComponent::CommitInputAudio()
 {
-	if (!IsConnected())
+	if (!IsAvailable())
 	{
 		if (bEnableVerboseLog)
 		{
@@ -552,6 +871,9 @@ void URealtimeVoiceComponent::CommitInputAudio()
 		return;
 	}
 
+	// ھ󷹽 ִ  commit  
+	FlushPendingAppend();
+
 	//   commit  (̰ "  " ü  1)
 	if (TotalAppendedPcmBytes <= 0)
 	{
@@ -569,12 +891,63 @@ void URealtimeVoiceComponent::CommitInputAudio()
 		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] CommitInputAudio() bytes=%lld"), *NowShort(), (long long)TotalAppendedPcmBytes);
 	}
 
-	SendJsonEvent(Ev, TEXT("input_audio_buffer.commit"));
+	SendJsonEvent(Ev, TEXT("input_audio_buffer.commit"), true);
+
+	// ٷ    ʿ .  翬  պκ ٽ  ϹǷ 
+	if (Connection.IsRecovering())
+	{
+		bTurnCommitDeferred = true;
+	}
+	else
+	{
+		TurnSentAudio.Reset();
+		bTurnAudioOverflow = false;
+	}
+}
+
+void URealtimeVoiceComponent::ReplayTurnAudio()
+{
+	if (bTurnAudioOverflow)
+	{
+		// պκ    ߸ ȭ commit ʰ  
+		const FString Msg = TEXT("Turn abandoned after reconnect: audio sent before the drop exceeds the outage buffer.");
+		UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] %s"), *NowShort(), *Msg);
+		Connection.ClearDeferred();
+		AppendEncoder.Reset();
+		TurnSentAudio.Reset();
+		bTurnAudioOverflow = false;
+		bTurnCommitDeferred = false;
+		OnError.Broadcast(Msg);
+		return;
+	}
+
+	if (TurnSentAudio.Num() == 0)
+		return;
+
+	//  ť   ϹǷ ٷ  ( ̶   )
+	constexpr int32 ReplayChunkBytes = 32 * 1024;
+	int32 Sent = 0;
+	for (int32 Offset = 0; Offset < TurnSentAudio.Num(); Offset += ReplayChunkBytes)
+	{
+		ReplayEncoder.Reset();
+		ReplayEncoder.AddPcm(TurnSentAudio.GetData() + Offset, FMath::Min(ReplayChunkBytes, TurnSentAudio.Num() - Offset));
+
+		const TArrayView<const uint8> Message = ReplayEncoder.BuildMessage();
+		if (!Connection.Send(Message.GetData(), Message.Num()))
+			break;
+
+		++OutgoingEventCounter;
+		++Sent;
+	}
+	ReplayEncoder.Reset();
+
+	UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] Re-sent %d bytes of the current turn in %d appends after reconnect."),
+		*NowShort(), TurnSentAudio.Num(), Sent);
 }
 
 void URealtimeVoiceComponent::CreateResponse()
 {
-	if (!IsConnected())
+	if (!IsAvailable())
 	{
 		if (bEnableVerboseLog)
 		{
@@ -606,7 +979,7 @@ void URealtimeVoiceComponent::CreateResponse()
 			UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] CreateResponse() with instructions"), *NowShort());
 		}
 
-		SendJsonEvent(Ev, TEXT("response.create+instr"));
+		SendJsonEvent(Ev, TEXT("response.create+instr"), true);
 	}
 	else
 	{
@@ -618,74 +991,216 @@ void URealtimeVoiceComponent::CreateResponse()
 			UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] CreateResponse()"), *NowShort());
 		}
 
-		SendJsonEvent(Ev, TEXT("response.create"));
+		SendJsonEvent(Ev, TEXT("response.create"), true);
 	}
 
 	//   û Ϻ͸    
 	if (bGateOutputAudioToCreateResponse)
 	{
 		bAllowServerAudio = true;
+		SyncAudioGate();
 	}
 }
 
-void URealtimeVoiceComponent::HandleWsMessage(const FString& Message)
+void URealtimeVoiceComponent::SendUserText(const FString& Text)
 {
-	++IncomingEventCounter;
+	if (!IsAvailable() || Text.IsEmpty())
+		return;
+
+	const TSharedPtr<FJsonObject> Content = MakeShared<FJsonObject>();
+	Content->SetStringField(TEXT("type"), TEXT("input_text"));
+	Content->SetStringField(TEXT("text"), Text);
+
+	TArray<TSharedPtr<FJsonValue>> ContentArray;
+	ContentArray.Add(MakeShared<FJsonValueObject>(Content));
+
+	const TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+	Item->SetStringField(TEXT("type"), TEXT("message"));
+	Item->SetStringField(TEXT("role"), TEXT("user"));
+	Item->SetArrayField(TEXT("content"), ContentArray);
 
-	if (bEnableVerboseLog && bLogIncomingJson)
+	const TSharedPtr<FJsonObject> Ev = MakeShared<FJsonObject>();
+	Ev->SetStringField(TEXT("type"), TEXT("conversation.item.create"));
+	Ev->SetObjectField(TEXT("item"), Item);
+
+	if (bEnableVerboseLog)
 	{
-		UE_LOG(LogRealtimeVoice, Verbose, TEXT("[%s][Realtime][RX RAW #%lld] %s"),
-			*NowShort(), (long long)IncomingEventCounter, *TruncateForLog(Message, 5000));
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] SendUserText len=%d"), *NowShort(), Text.Len());
 	}
 
-	TSharedPtr<FJsonObject> Root;
-	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	SendJsonEvent(Ev, TEXT("conversation.item.create"), true);
+}
+
+void URealtimeVoiceComponent::RequestSpokenLine(const FString& Text)
+{
+	if (!IsAvailable() || Text.IsEmpty())
+		return;
+
+	const TSharedPtr<FJsonObject> Ev = MakeShared<FJsonObject>();
+	Ev->SetStringField(TEXT("type"), TEXT("response.create"));
+
+	const TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
+
 	{
-		if (bEnableVerboseLog)
-		{
-			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime][RX #%lld] JSON parse failed. len=%d"),
-				*NowShort(), (long long)IncomingEventCounter, Message.Len());
-		}
+		TArray<TSharedPtr<FJsonValue>> Modalities;
+		Modalities.Add(MakeShared<FJsonValueString>(TEXT("audio")));
+		Resp->SetArrayField(TEXT("output_modalities"), Modalities);
+	}
+
+	//  ̽/丣ҳ ״, ϴ 븸  (transcript ĳ Ű ǹǷ  ڵ ٲ ʰ)
+	Resp->SetStringField(TEXT("instructions"), FString::Printf(
+		TEXT("%s\n\nSay exactly the following radio line, word for word, and nothing else:\n%s"),
+		*BuildInstructionsMerged(), *Text));
+
+	Ev->SetObjectField(TEXT("response"), Resp);
+
+	if (bEnableVerboseLog)
+	{
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] RequestSpokenLine: %s"), *NowShort(), *TruncateForLog(Text, 200));
+	}
+
+	SendJsonEvent(Ev, TEXT("response.create+line"), true);
+
+	if (bGateOutputAudioToCreateResponse)
+	{
+		bAllowServerAudio = true;
+		SyncAudioGate();
+	}
+}
+
+FString URealtimeVoiceComponent::BuildReplyCacheProfile() const
+{
+	//      ̸  
+	return FString::Printf(TEXT("%s|%s|%s|%d|%d"),
+		bUseMockServer ? TEXT("mock") : *RealtimeModel, *VoiceName,
+		VoiceAudioCodecs::GetWireFormat(ActiveOutputCodec), OutputSampleRate, OutputNumChannels);
+}
+
+void URealtimeVoiceComponent::SyncReplyCacheProfile()
+{
+	if (!bCacheReplies)
 		return;
+
+	if (URadioReplyCacheSubsystem* Cache = URadioReplyCacheSubsystem::Get(this))
+	{
+		Cache->SetVoiceProfile(BuildReplyCacheProfile());
 	}
+}
 
-	if (bEnableVerboseLog && bLogIncomingSummary)
+void URealtimeVoiceComponent::HandleResponseDone(FRealtimeControlEvent& Event)
+{
+	// response.status: completed / cancelled / incomplete / failed.   ĳ 
+	FString Status;
+	const TSharedPtr<FJsonObject>* Response = nullptr;
+	if (Event.Root->TryGetObjectField(TEXT("response"), Response))
 	{
-		FString TypeStr = TEXT("<no type>");
-		if (Root->HasTypedField<EJson::String>(TEXT("type")))
+		(*Response)->TryGetStringField(TEXT("status"), Status);
+	}
+
+	const FString Transcript = MoveTemp(ReplyTranscript);
+	ReplyTranscript.Reset();
+	bResponseActive = false;
+
+	// ҵ  output_audio.done   ٷ :  ̴  ⼭ 
+	if (bDidStartAudio)
+	{
+		bDidStartAudio = false;
+		OnAudioEnded.Broadcast();
+		OnOutputAudioDone.Broadcast();
+	}
+	LastActivitySec = FPlatformTime::Seconds();
+
+	if (bEnableVerboseLog)
+	{
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] response.done status=%s audioBytes=%d"),
+			*NowShort(), *Status, Event.Audio.Num());
+	}
+
+	if (!bCacheReplies || Status != TEXT("completed") || Transcript.IsEmpty() || Event.Audio.Num() == 0)
+		return;
+
+	if (URadioReplyCacheSubsystem* Cache = URadioReplyCacheSubsystem::Get(this))
+	{
+		Cache->StoreReply(Transcript, MoveTemp(Event.Audio), OutputSampleRate, OutputNumChannels);
+	}
+}
+
+void URealtimeVoiceComponent::HandleWsRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+	if (BytesRemaining == 0)
+	{
+		++IncomingEventCounter;
+	}
+
+	if (EventDecoder)
+	{
+		EventDecoder->FeedFragment(Data, Size, BytesRemaining);
+	}
+}
+
+void URealtimeVoiceComponent::HandleControlEvent(FRealtimeControlEvent& Event)
+{
+	// ---- Output audio delta ----
+	// PCM Ŀ ̹ OutputAudioStream . ⿣  ù ˸(Ǵ Ʈ ̿  ) 
+	if (Event.Type == TEXT("response.output_audio.delta"))
+	{
+		if (bGateOutputAudioToCreateResponse && !bAllowServerAudio)
+			return;
+
+		if (!bDidStartAudio)
+		{
+			bDidStartAudio = true;
+			OnAudioStarted.Broadcast();
+		}
+
+		if (Event.Audio.Num() > 0)
 		{
-			TypeStr = Root->GetStringField(TEXT("type"));
+			// NOTE:  Ÿ   Hz/ä ̺Ʈ   Ƿ,
+			//  Ʈ(OutputSampleRate/NumChannels) ݴϴ.
+			OnOutputAudioDelta.Broadcast(Event.Audio, OutputSampleRate, OutputNumChannels);
 		}
+		return;
+	}
 
+	if (!Event.Root.IsValid())
+		return;
+
+	if (bEnableVerboseLog && bLogIncomingSummary)
+	{
 		FString Extra;
 
-		if (TypeStr == TEXT("error") && Root->HasField(TEXT("error")))
+		if (Event.Type == TEXT("error") && Event.Root->HasField(TEXT("error")))
 		{
-			const TSharedPtr<FJsonObject> Err = Root->GetObjectField(TEXT("error"));
+			const TSharedPtr<FJsonObject> Err = Event.Root->GetObjectField(TEXT("error"));
 			if (Err.IsValid() && Err->HasTypedField<EJson::String>(TEXT("message")))
 			{
 				Extra = Err->GetStringField(TEXT("message"));
 			}
 		}
-		else if (TypeStr.EndsWith(TEXT(".delta")))
+		else if (Event.Type.EndsWith(TEXT(".delta")))
 		{
-			if (Root->HasTypedField<EJson::String>(TEXT("delta")))
+			if (Event.Root->HasTypedField<EJson::String>(TEXT("delta")))
 			{
-				Extra = FString::Printf(TEXT("deltaLen=%d"), Root->GetStringField(TEXT("delta")).Len());
+				Extra = FString::Printf(TEXT("deltaLen=%d"), Event.Root->GetStringField(TEXT("delta")).Len());
 			}
-			else if (Root->HasTypedField<EJson::String>(TEXT("transcript")))
+			else if (Event.Root->HasTypedField<EJson::String>(TEXT("transcript")))
 			{
-				Extra = FString::Printf(TEXT("transcriptLen=%d"), Root->GetStringField(TEXT("transcript")).Len());
+				Extra = FString::Printf(TEXT("transcriptLen=%d"), Event.Root->GetStringField(TEXT("transcript")).Len());
 			}
 		}
 
-		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime][RX #%lld] type=%s %s"),
-			*NowShort(), (long long)IncomingEventCounter, *TypeStr,
+		UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime][RX] type=%s bytes=%d %s"),
+			*NowShort(), *Event.Type, Event.RawBytes,
 			Extra.IsEmpty() ? TEXT("") : *FString::Printf(TEXT("| %s"), *Extra));
 	}
 
-	HandleServerEvent(Root);
+	if (Event.Type == TEXT("response.done"))
+	{
+		HandleResponseDone(Event);
+		return;
+	}
+
+	HandleServerEvent(Event.Root);
 }
 
 void URealtimeVoiceComponent::HandleServerEvent(const TSharedPtr<FJsonObject>& Root)
@@ -712,61 +1227,35 @@ void URealtimeVoiceComponent::HandleServerEvent(const TSharedPtr<FJsonObject>& R
 
 	if (Type == TEXT("session.updated"))
 	{
-		// α븸
 		if (bEnableVerboseLog)
 		{
 			UE_LOG(LogRealtimeVoice, Log, TEXT("[%s][Realtime] session.updated"), *NowShort());
 		}
-		// TextEvent ״ ְ  Ʒ  
-	}
-
-	// ---- Output audio delta (PCM16 b64) ----
-	if (Type == TEXT("response.output_audio.delta"))
-	{
-		if (bGateOutputAudioToCreateResponse && !bAllowServerAudio)
-		{
-			if (bEnableVerboseLog)
-			{
-				UE_LOG(LogRealtimeVoice, VeryVerbose, TEXT("[%s][Realtime] output_audio.delta ignored (gate closed)"), *NowShort());
-			}
-			return;
-		}
-
-		++AudioDeltaCounter;
-
-		const FString DeltaB64 = Root->GetStringField(TEXT("delta"));
-		TArray<uint8> Bytes;
-		const bool bOk = FBase64::Decode(DeltaB64, Bytes);
-
-		if (!bOk)
-		{
-			UE_LOG(LogRealtimeVoice, Warning, TEXT("[%s][Realtime] output_audio.delta base64 decode failed. deltaLen=%d"),
-				*NowShort(), DeltaB64.Len());
-			return;
-		}
 
-		TotalReceivedOutAudioBytes += Bytes.Num();
+		//  Ȯ   
+		ApplyNegotiatedCodecs(Root);
 
-		const bool bLogThis = (LogEveryNAudioDeltas > 0) ? ((AudioDeltaCounter % LogEveryNAudioDeltas) == 0) : false;
-		if (bEnableVerboseLog && bLogThis)
+		// 翬̸   :   ޾Ҵ ̹   ٽ ,
+		// ̾    ̺Ʈ  (keepalive 䵵  )
+		if (Connection.IsRecovering())
 		{
-			UE_LOG(LogRealtimeVoice, Log,
-				TEXT("[%s][Realtime] AudioDelta #%lld bytes=%d totalOutBytes=%lld"),
-				*NowShort(),
-				(long long)AudioDeltaCounter,
-				Bytes.Num(),
-				(long long)TotalReceivedOutAudioBytes);
+			ReplayTurnAudio();
 		}
+		Connection.MarkSessionReady();
 
-		if (!bDidStartAudio)
+		//  commit   
+		if (bTurnCommitDeferred)
 		{
-			bDidStartAudio = true;
-			OnAudioStarted.Broadcast();
+			bTurnCommitDeferred = false;
+			TurnSentAudio.Reset();
 		}
+		// TextEvent ״ ְ  Ʒ  
+	}
 
-		// NOTE:  Ÿ   Hz/ä ̺Ʈ   Ƿ,
-		//  Ʈ(OutputSampleRate/NumChannels) ݴϴ.
-		OnOutputAudioDelta.Broadcast(Bytes, OutputSampleRate, OutputNumChannels);
+	if (Type == TEXT("response.created"))
+	{
+		ReplyTranscript.Reset();
+		bResponseActive = true;
 		return;
 	}
 
@@ -782,6 +1271,7 @@ void URealtimeVoiceComponent::HandleServerEvent(const TSharedPtr<FJsonObject>& R
 			bDidStartAudio = false;
 			OnAudioEnded.Broadcast();
 		}
+		LastActivitySec = FPlatformTime::Seconds();
 
 		OnOutputAudioDone.Broadcast();
 		return;
@@ -806,6 +1296,11 @@ void URealtimeVoiceComponent::HandleServerEvent(const TSharedPtr<FJsonObject>& R
 		{
 			Payload += TEXT(" | ");
 			Payload += Root->GetStringField(TEXT("transcript"));
+
+			if (Type == TEXT("response.output_audio_transcript.done"))
+			{
+				ReplyTranscript = Root->GetStringField(TEXT("transcript"));
+			}
 		}
 
 		if (bEnableVerboseLog)
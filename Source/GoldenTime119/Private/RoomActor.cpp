@@ -184,6 +184,10 @@ void ARoomActor::Tick(float DeltaSeconds)
     // 10) 누적치 초기화
     ResetAccumulators();
 
+    // 11) 환경 변화 알림 (미션 목표 등)
+    if (OnEnvChanged.IsBound())
+        NotifyEnvIfChanged();
+
 
 }
 
@@ -617,7 +621,7 @@ void ARoomActor::UpdateRoomState()
     }
     else
     {
-        State = (bSmokeDanger || bO2Danger || bHeatDanger) ? ERoomState::Risk : ERoomState::Idle;
+        State = (bForcedRisk || bSmokeDanger || bO2Danger || bHeatDanger) ? ERoomState::Risk : ERoomState::Idle;
     }
 
     if (Prev != State)
@@ -628,7 +632,45 @@ void ARoomActor::UpdateRoomState()
 }
 
 
+void ARoomActor::SetForcedRisk(bool bInForced)
+{
+    if (bForcedRisk == bInForced) return;
+
+    bForcedRisk = bInForced;
+    UpdateRoomState();
+}
+
+void ARoomActor::NotifyEnvIfChanged()
+{
+    if (FMath::Abs(Smoke - NotifiedSmoke) < EnvNotifyStep01 &&
+        FMath::Abs(Oxygen - NotifiedOxygen) < EnvNotifyStep01 &&
+        FMath::Abs(Heat - NotifiedHeat) < EnvNotifyHeatStep &&
+        State == NotifiedState)
+    {
+        return;
+    }
+
+    NotifiedSmoke = Smoke;
+    NotifiedOxygen = Oxygen;
+    NotifiedHeat = Heat;
+    NotifiedState = State;
+
+    OnEnvChanged.Broadcast(this);
+}
+
 // ============================ Geometry / NP ============================
+bool ARoomActor::ContainsPoint(const FVector& WorldPos) const
+{
+    if (!RoomBounds) return false;
+
+    const FVector Local = RoomBounds->GetComponentTransform().InverseTransformPosition(WorldPos);
+    const FVector Extent = RoomBounds->GetScaledBoxExtent();
+
+    return FMath::Abs(Local.X) <= Extent.X
+        && FMath::Abs(Local.Y) <= Extent.Y
+        && FMath::Abs(Local.Z) <= Extent.Z;
+}
+
 bool ARoomActor::IsInsideRoomBox(const UBoxComponent* Box, const FVector& WorldPos)
 {
     if (!Box) return false;
@@ -1120,6 +1162,7 @@ void ARoomActor::TriggerBackdraft(const FTransform& DoorTM, float VentBoost01)
     TotalDoorVentRate = 0.f;
     VentingDoors.Empty();
 
+    BackdraftCount++;
     OnBackdraft.Broadcast();
 
     // 점화도 압력에 비례 (압력 낮으면 점화 확률 감소)
@@ -6,7 +6,9 @@
 #include "RoomActor.h"
 #include "FireActor.h"
 #include "VitalComponent.h"
+#include "GameManager.h"
 
+#include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
 #include "TimerManager.h"
@@ -14,9 +16,36 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogStageSubsystem, Log, All);
 
-static FORCEINLINE bool HasTagExact(const AActor* A, const FName& Tag)
+static bool CondNeedsRoom(EStageCondType Type)
 {
-    return IsValid(A) && A->Tags.Contains(Tag);
+    return Type == EStageCondType::FiresExtinguishedInRoom || Type == EStageCondType::BackdraftTriggeredInRoom;
+}
+
+static bool ActionNeedsRoom(EStageActionType Type)
+{
+    switch (Type)
+    {
+    case EStageActionType::SpawnHostage:
+    case EStageActionType::IgniteRoomRandomFires:
+    case EStageActionType::IgniteRoomAllFires:
+    case EStageActionType::SetRoomRisk:
+    case EStageActionType::SetRoomBackdraftReady:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static uint8 CondSignals(EStageCondType Type)
+{
+    switch (Type)
+    {
+    case EStageCondType::FiresExtinguishedInRoom:  return EStageSignal::Fire;
+    case EStageCondType::BackdraftTriggeredInRoom: return EStageSignal::Backdraft;
+    case EStageCondType::TimeElapsed:              return EStageSignal::Time;
+    case EStageCondType::VitalBelow:               return EStageSignal::Vitals;
+    default:                                       return EStageSignal::None;
+    }
 }
 
 void UStageSubsystem::StartStage(UStageDataAsset* InStage)
@@ -27,31 +56,41 @@ void UStageSubsystem::StartStage(UStageDataAsset* InStage)
         return;
     }
 
+    UWorld* World = GetWorld();
+    if (!World)
+        return;
+
+    //    (ȣ/Ÿ̸)
+    UnbindSignals();
+    World->GetTimerManager().ClearTimer(StepTimerHandle);
+    World->GetTimerManager().ClearTimer(EntryEvalHandle);
+
+    TArray<FString> Errors;
+    if (!CompileStage(World, *InStage, Errors))
+    {
+        for (const FString& E : Errors)
+        {
+            UE_LOG(LogStageSubsystem, Error, TEXT("[Stage] %s: %s"), *GetNameSafe(InStage), *E);
+        }
+        UE_LOG(LogStageSubsystem, Error, TEXT("[Stage] StartStage failed: %s has %d error(s)"), *GetNameSafe(InStage), Errors.Num());
+
+        Graph.Reset();
+        Stage = nullptr;
+        StepIndex = -1;
+        return;
+    }
+
     Stage = InStage;
     StepIndex = -1;
-    StepTimeAcc = 0.f;
     CurrentObjective = FStageObjective{};
 
-    UWorld* World = GetWorld();
-    if (!World)
-        return;
+    BindSignals();
 
-    BuildAutoBindings(World);
+    UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Start: %s Steps=%d Actions=%d Rooms=%d"),
+        *GetNameSafe(Stage), Graph.Steps.Num(), Graph.Actions.Num(), Graph.Rooms.Num());
 
     // ù  
     EnterStep(0);
-
-    // Ÿ̸  (/)
-    World->GetTimerManager().ClearTimer(TickHandle);
-    World->GetTimerManager().SetTimer(
-        TickHandle,
-        this,
-        &UStageSubsystem::TickStage,
-        0.05f,   // 20Hz 
-        true
-    );
-
-    UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Start: %s Steps=%d"), *GetNameSafe(Stage), Stage->Steps.Num());
 }
 
 void UStageSubsystem::AbortStage(bool bFail)
@@ -59,9 +98,12 @@ void UStageSubsystem::AbortStage(bool bFail)
     UWorld* World = GetWorld();
     if (World)
     {
-        World->GetTimerManager().ClearTimer(TickHandle);
+        World->GetTimerManager().ClearTimer(StepTimerHandle);
+        World->GetTimerManager().ClearTimer(EntryEvalHandle);
     }
 
+    UnbindSignals();
+
     // : (HP+O2+(1-Temp))*100
     float FinalScore = 0.f;
     if (Vital.IsValid())
@@ -80,14 +122,18 @@ void UStageSubsystem::AbortStage(bool bFail)
 
     Stage = nullptr;
     StepIndex = -1;
+    Graph.Reset();
 }
 
-void UStageSubsystem::BuildAutoBindings(UWorld* World)
+// ===== compile =====
+bool UStageSubsystem::CompileStage(UWorld* World, const UStageDataAsset& InStage, TArray<FString>& OutErrors)
 {
-    RoomsByTag.Empty();
+    Graph.Reset();
     Vital.Reset();
+    GameManager.Reset();
 
-    // 1) RoomsByTag: RoomActor Tags 
+    // 1)  ±  ( ȸ ⼭  ). "Room.Bedroom"  Ű ״ 
+    TMap<FName, ARoomActor*> RoomsByTag;
     for (TActorIterator<ARoomActor> It(World); It; ++It)
     {
         ARoomActor* Room = *It;
@@ -95,15 +141,117 @@ void UStageSubsystem::BuildAutoBindings(UWorld* World)
 
         for (const FName& Tag : Room->Tags)
         {
-            // "Room.Bedroom"  Ű ״ 
+            if (ARoomActor** Existing = RoomsByTag.Find(Tag))
+            {
+                UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Tag %s on both %s and %s (using %s)"),
+                    *Tag.ToString(), *GetNameSafe(*Existing), *GetNameSafe(Room), *GetNameSafe(Room));
+            }
             RoomsByTag.Add(Tag, Room);
         }
+    }
+
+    TMap<ARoomActor*, int32> RoomIndex;
+    auto ResolveRoom = [&](const FName& Tag, const FString& Where) -> int32
+    {
+        if (Tag.IsNone())
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: TargetTag is empty"), *Where));
+            return INDEX_NONE;
+        }
 
-        BindRoomSignals(Room);
+        ARoomActor* const* Found = RoomsByTag.Find(Tag);
+        if (!Found)
+        {
+            OutErrors.Add(FString::Printf(TEXT("%s: no room tagged %s"), *Where, *Tag.ToString()));
+            return INDEX_NONE;
+        }
+
+        if (const int32* Existing = RoomIndex.Find(*Found))
+            return *Existing;
+
+        const int32 Index = Graph.Rooms.Add(*Found);
+        Graph.RoomSignals.Add(EStageSignal::None);
+        RoomIndex.Add(*Found, Index);
+        return Index;
+    };
+
+    bool bNeedVital = false;
+    bool bNeedGameManager = false;
+
+    // 2) ܺ /׼
+    Graph.Steps.Reserve(InStage.Steps.Num());
+    for (int32 s = 0; s < InStage.Steps.Num(); ++s)
+    {
+        const FStageStep& Step = InStage.Steps[s];
+
+        FStageCompiledStep& Out = Graph.Steps.AddDefaulted_GetRef();
+        Out.FirstAction = Graph.Actions.Num();
+        Out.NumActions = Step.OnEnterActions.Num();
+
+        for (int32 a = 0; a < Step.OnEnterActions.Num(); ++a)
+        {
+            const FStageAction& Src = Step.OnEnterActions[a];
+            const FString Where = FString::Printf(TEXT("Step %d action %d (%s)"), s, a, *UEnum::GetValueAsString(Src.Type));
+
+            FStageCompiledAction& A = Graph.Actions.AddDefaulted_GetRef();
+            A.Type = Src.Type;
+            A.Value = Src.Value;
+            A.Source = a;
+
+            if (ActionNeedsRoom(Src.Type))
+            {
+                A.Room = ResolveRoom(Src.TargetTag, Where);
+            }
+
+            switch (Src.Type)
+            {
+            case EStageActionType::PlayRadio:
+                if (!Src.RadioSound)
+                {
+                    UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] %s: no RadioSound"), *Where);
+                }
+                break;
+
+            case EStageActionType::SpawnHostage:
+                if (!Src.HostageClass)
+                {
+                    OutErrors.Add(FString::Printf(TEXT("%s: HostageClass is not set"), *Where));
+                }
+                bNeedGameManager = true;
+                break;
+
+            case EStageActionType::SetRoomBackdraftReady:
+                UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] %s: not supported yet, ignored"), *Where);
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        const FStageCondition& C = Step.CompleteCondition;
+        const FString Where = FString::Printf(TEXT("Step %d condition (%s)"), s, *UEnum::GetValueAsString(C.Type));
+
+        Out.Complete.Type = C.Type;
+        Out.Complete.Value = C.Value;
+        Out.Complete.Signals = CondSignals(C.Type);
+
+        if (CondNeedsRoom(C.Type))
+        {
+            Out.Complete.Room = ResolveRoom(C.TargetTag, Where);
+            if (Out.Complete.Room != INDEX_NONE)
+            {
+                Graph.RoomSignals[Out.Complete.Room] |= Out.Complete.Signals;
+            }
+        }
+
+        if (C.Type == EStageCondType::VitalBelow)
+        {
+            bNeedVital = true;
+        }
     }
 
-    // 2) Vital ã (忡 ִ ù VitalComponent)
-    //    -   :  Actor VitalComponent ˻
+    // 3) Vital: /ӿ Ƿ ׻ ã (忡 ִ ù VitalComponent)
     for (TActorIterator<AActor> It(World); It; ++It)
     {
         AActor* A = *It;
@@ -112,81 +260,152 @@ void UStageSubsystem::BuildAutoBindings(UWorld* World)
         if (UVitalComponent* VC = A->FindComponentByClass<UVitalComponent>())
         {
             Vital = VC;
-            BindVitalSignals(VC);
             break;
         }
     }
 
-    UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] AutoBindings Rooms=%d Vital=%s"),
-        RoomsByTag.Num(), *GetNameSafe(Vital.Get()));
+    if (bNeedVital && !Vital.IsValid())
+    {
+        OutErrors.Add(TEXT("VitalBelow condition but no VitalComponent in world"));
+    }
+
+    // 4)   ó (  )
+    if (bNeedGameManager)
+    {
+        for (TActorIterator<AGameManager> It(World); It; ++It)
+        {
+            GameManager = *It;
+            break;
+        }
+    }
+
+    UE_LOG(LogStageSubsystem, Log, TEXT("[Stage] Compiled %s: Steps=%d Actions=%d Rooms=%d Vital=%s Errors=%d"),
+        *GetNameSafe(&InStage), Graph.Steps.Num(), Graph.Actions.Num(), Graph.Rooms.Num(),
+        *GetNameSafe(Vital.Get()), OutErrors.Num());
+
+    return OutErrors.Num() == 0;
 }
 
-void UStageSubsystem::BindRoomSignals(ARoomActor* Room)
+void UStageSubsystem::BindSignals()
 {
-    if (!IsValid(Room)) return;
+    //  ϴ 游 
+    for (int32 i = 0; i < Graph.Rooms.Num(); ++i)
+    {
+        ARoomActor* Room = Graph.Rooms[i].Get();
+        if (!IsValid(Room)) continue;
 
-    // ߺ ε 
-    Room->OnBackdraft.RemoveDynamic(this, &UStageSubsystem::HandleBackdraftTriggered);
-    Room->OnFireExtinguished.RemoveDynamic(this, &UStageSubsystem::HandleFireExtinguished);
+        if (Graph.RoomSignals[i] & EStageSignal::Fire)
+        {
+            Room->OnFireExtinguished.AddUniqueDynamic(this, &UStageSubsystem::HandleFireExtinguished);
+        }
+        if (Graph.RoomSignals[i] & EStageSignal::Backdraft)
+        {
+            Room->OnBackdraft.AddUniqueDynamic(this, &UStageSubsystem::HandleBackdraftTriggered);
+        }
+    }
 
-    Room->OnBackdraft.AddDynamic(this, &UStageSubsystem::HandleBackdraftTriggered);
-    Room->OnFireExtinguished.AddDynamic(this, &UStageSubsystem::HandleFireExtinguished);
+    if (Vital.IsValid())
+    {
+        Vital->OnVitals01Changed.AddUniqueDynamic(this, &UStageSubsystem::HandleVitalsChanged);
+    }
 }
 
-void UStageSubsystem::BindVitalSignals(UVitalComponent* InVital)
+void UStageSubsystem::UnbindSignals()
 {
-    if (!InVital) return;
+    for (const TWeakObjectPtr<ARoomActor>& Room : Graph.Rooms)
+    {
+        if (!Room.IsValid()) continue;
+        Room->OnFireExtinguished.RemoveDynamic(this, &UStageSubsystem::HandleFireExtinguished);
+        Room->OnBackdraft.RemoveDynamic(this, &UStageSubsystem::HandleBackdraftTriggered);
+    }
+
+    if (Vital.IsValid())
+    {
+        Vital->OnVitals01Changed.RemoveDynamic(this, &UStageSubsystem::HandleVitalsChanged);
+    }
+}
 
-    InVital->OnVitals01Changed.RemoveDynamic(this, &UStageSubsystem::HandleVitalsChanged);
-    InVital->OnVitals01Changed.AddDynamic(this, &UStageSubsystem::HandleVitalsChanged);
+// ===== steps =====
+ARoomActor* UStageSubsystem::GetRoom(int32 Index) const
+{
+    return Graph.Rooms.IsValidIndex(Index) ? Graph.Rooms[Index].Get() : nullptr;
 }
 
 void UStageSubsystem::EnterStep(int32 NewIndex)
 {
-    if (!Stage || !Stage->Steps.IsValidIndex(NewIndex))
+    if (!Stage || !Graph.Steps.IsValidIndex(NewIndex))
     {
         AbortStage(true);
         return;
     }
 
+    UWorld* World = GetWorld();
+    if (!World)
+        return;
+
     StepIndex = NewIndex;
-    StepTimeAcc = 0.f;
 
-    const FStageStep& Step = Stage->Steps[StepIndex];
+    const FStageCompiledStep& Step = Graph.Steps[StepIndex];
+    const FStageCompiledCondition& C = Step.Complete;
 
-    // OnEnterActions 
-    for (const FStageAction& A : Step.OnEnterActions)
+    //   ( Ŀ Ͼ ͸ )
+    bStepTimeReached = false;
+    StepBackdraftBase = 0;
+    if (C.Type == EStageCondType::BackdraftTriggeredInRoom)
     {
-        ExecuteAction(A);
+        if (ARoomActor* Room = GetRoom(C.Room))
+            StepBackdraftBase = Room->GetBackdraftCount();
+    }
+
+    FTimerManager& TM = World->GetTimerManager();
+    TM.ClearTimer(StepTimerHandle);
+    if (C.Type == EStageCondType::TimeElapsed)
+    {
+        if (C.Value > 0.f)
+            TM.SetTimer(StepTimerHandle, this, &UStageSubsystem::HandleStepTimer, C.Value, false);
+        else
+            bStepTimeReached = true;
     }
 
     UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] EnterStep %d"), StepIndex);
+
+    // OnEnterActions 
+    for (int32 i = 0; i < Step.NumActions; ++i)
+    {
+        ExecuteAction(Graph.Actions[Step.FirstAction + i]);
+        if (StepIndex != NewIndex) return; // ׼   
+    }
+
+    //   ´  ƽ   Ȯ (ȭ  ׼  ݿ ,    )
+    EntryEvalHandle = TM.SetTimerForNextTick(this, &UStageSubsystem::HandleEntryEval);
 }
 
-void UStageSubsystem::ExecuteAction(const FStageAction& A)
+void UStageSubsystem::ExecuteAction(const FStageCompiledAction& A)
 {
     if (!Stage) return;
 
+    const FStageAction& Src = Stage->Steps[StepIndex].OnEnterActions[A.Source];
+
     switch (A.Type)
     {
     case EStageActionType::SetObjective:
-        CurrentObjective = A.Objective;
+        CurrentObjective = Src.Objective;
         OnObjectiveChanged.Broadcast(CurrentObjective);
         UE_LOG(LogStageSubsystem, Log, TEXT("[Stage] Objective updated"));
         break;
 
     case EStageActionType::PlayRadio:
-        if (A.RadioSound)
+        if (Src.RadioSound)
         {
             // 2D ܼ  (VR )
-            UGameplayStatics::PlaySound2D(GetWorld(), A.RadioSound);
+            UGameplayStatics::PlaySound2D(GetWorld(), Src.RadioSound);
         }
         break;
 
     case EStageActionType::IgniteRoomRandomFires:
     {
-        ARoomActor* Room = RoomsByTag.Contains(A.TargetTag) ? RoomsByTag[A.TargetTag].Get() : nullptr;
-        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room not found: %s"), *A.TargetTag.ToString()); break; }
+        ARoomActor* Room = GetRoom(A.Room);
+        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room gone: %s"), *Src.TargetTag.ToString()); break; }
 
         const int32 Count = FMath::Max(0, (int32)A.Value);
         for (int32 i = 0; i < Count; ++i)
@@ -198,44 +417,111 @@ void UStageSubsystem::ExecuteAction(const FStageAction& A)
 
     case EStageActionType::IgniteRoomAllFires:
     {
-        ARoomActor* Room = RoomsByTag.Contains(A.TargetTag) ? RoomsByTag[A.TargetTag].Get() : nullptr;
-        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room not found: %s"), *A.TargetTag.ToString()); break; }
+        ARoomActor* Room = GetRoom(A.Room);
+        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room gone: %s"), *Src.TargetTag.ToString()); break; }
 
         Room->IgniteAllCombustiblesInRoom(/*bAllowElectric=*/true);
         break;
     }
 
-    // SpawnHostage / SetRoomRisk / SetRoomBackdraftReady  
-    // "Room / Pawn API غǴ "  Ȯ 
+    case EStageActionType::SpawnHostage:
+    {
+        ARoomActor* Room = GetRoom(A.Room);
+        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room gone: %s"), *Src.TargetTag.ToString()); break; }
+
+        SpawnHostages(Room, Src, FMath::Max(1, (int32)A.Value));
+        break;
+    }
+
+    case EStageActionType::SetRoomRisk:
+    {
+        ARoomActor* Room = GetRoom(A.Room);
+        if (!IsValid(Room)) { UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] Room gone: %s"), *Src.TargetTag.ToString()); break; }
+
+        Room->SetForcedRisk(A.Value > 0.5f);
+        break;
+    }
+
+    // SetRoomBackdraftReady Room API غǸ Ȯ (  )
     default:
         break;
     }
 }
 
-bool UStageSubsystem::IsStepComplete(float DeltaSeconds)
+void UStageSubsystem::SpawnHostages(ARoomActor* Room, const FStageAction& Src, int32 Count)
 {
-    if (!Stage || !Stage->Steps.IsValidIndex(StepIndex))
-        return false;
+    UWorld* World = GetWorld();
+    if (!World || !Src.HostageClass) return;
 
-    StepTimeAcc += DeltaSeconds;
+    const UBoxComponent* Box = Room->RoomBounds;
 
-    const FStageCondition& C = Stage->Steps[StepIndex].CompleteCondition;
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
+    for (int32 i = 0; i < Count; ++i)
+    {
+        FVector Location = Room->GetActorLocation();
+
+        if (IsValid(Box))
+        {
+            //  ڽ   XY, ٴ ã   
+            const FVector Ext = Box->GetUnscaledBoxExtent();
+            const FTransform& BoxTM = Box->GetComponentTransform();
+            const float X = FMath::FRandRange(-Ext.X, Ext.X) * 0.8f;
+            const float Y = FMath::FRandRange(-Ext.Y, Ext.Y) * 0.8f;
+
+            const FVector Top = BoxTM.TransformPosition(FVector(X, Y, Ext.Z));
+            const FVector Bottom = BoxTM.TransformPosition(FVector(X, Y, -Ext.Z));
+
+            FHitResult Hit;
+            FCollisionQueryParams Query(SCENE_QUERY_STAT(StageSpawnHostage), false, Room);
+            Location = World->LineTraceSingleByChannel(Hit, Top, Bottom, ECC_Visibility, Query)
+                ? Hit.ImpactPoint + FVector(0.f, 0.f, 100.f)
+                : BoxTM.TransformPosition(FVector(X, Y, 0.f));
+        }
+
+        AActor* Hostage = World->SpawnActor<AActor>(Src.HostageClass, Location, FRotator(0.f, FMath::FRandRange(0.f, 360.f), 0.f), Params);
+        if (!IsValid(Hostage))
+        {
+            UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] SpawnHostage failed in %s"), *GetNameSafe(Room));
+            continue;
+        }
+
+        // GameManager "NPC" ±׷   ã
+        Hostage->Tags.AddUnique(FName("NPC"));
+        if (GameManager.IsValid())
+        {
+            GameManager->RegisterNPC(Hostage);
+        }
+
+        UE_LOG(LogStageSubsystem, Log, TEXT("[Stage] Hostage %s spawned in %s"), *GetNameSafe(Hostage), *GetNameSafe(Room));
+    }
+}
+
+bool UStageSubsystem::IsConditionMet(const FStageCompiledCondition& C) const
+{
     switch (C.Type)
     {
     case EStageCondType::None:
         return true;
 
     case EStageCondType::TimeElapsed:
-        return StepTimeAcc >= C.Value;
+        return bStepTimeReached;
 
     case EStageCondType::FiresExtinguishedInRoom:
     {
-        ARoomActor* Room = RoomsByTag.Contains(C.TargetTag) ? RoomsByTag[C.TargetTag].Get() : nullptr;
+        const ARoomActor* Room = GetRoom(C.Room);
         if (!IsValid(Room)) return false;
         return Room->GetActiveFireCount() <= 0;
     }
 
+    case EStageCondType::BackdraftTriggeredInRoom:
+    {
+        const ARoomActor* Room = GetRoom(C.Room);
+        if (!IsValid(Room)) return false;
+        return Room->GetBackdraftCount() > StepBackdraftBase;
+    }
+
     case EStageCondType::VitalBelow:
     {
         // Value ǹ: Hp Ӱ  (ʿϸ Ÿ Ȯ)
@@ -243,19 +529,35 @@ bool UStageSubsystem::IsStepComplete(float DeltaSeconds)
         return Vital->GetHp01() <= C.Value;
     }
 
-    // BackdraftTriggeredInRoom "̺Ʈ "  մϴ.
-    // ⼭  StepRuntimeFlags óϴ   (Ʒ HandleBackdraftTriggered )
     default:
         return false;
     }
 }
 
+void UStageSubsystem::OnSignal(uint8 Signal)
+{
+    if (!Stage || !Graph.Steps.IsValidIndex(StepIndex)) return;
+
+    const FStageCompiledCondition& C = Graph.Steps[StepIndex].Complete;
+    if ((C.Signals & Signal) == 0) return;
+
+    if (IsConditionMet(C))
+    {
+        AdvanceStep();
+    }
+}
+
 void UStageSubsystem::AdvanceStep()
 {
     if (!Stage) return;
 
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(EntryEvalHandle);
+    }
+
     const int32 Next = StepIndex + 1;
-    if (!Stage->Steps.IsValidIndex(Next))
+    if (!Graph.Steps.IsValidIndex(Next))
     {
         // 
         AbortStage(false);
@@ -265,18 +567,23 @@ void UStageSubsystem::AdvanceStep()
     EnterStep(Next);
 }
 
-void UStageSubsystem::TickStage()
+// ===== event handlers =====
+void UStageSubsystem::HandleEntryEval()
 {
-    if (!Stage || StepIndex < 0) return;
+    if (!Stage || !Graph.Steps.IsValidIndex(StepIndex)) return;
 
-    constexpr float Dt = 0.05f;
-    if (IsStepComplete(Dt))
+    if (IsConditionMet(Graph.Steps[StepIndex].Complete))
     {
         AdvanceStep();
     }
 }
 
-// ===== event handlers =====
+void UStageSubsystem::HandleStepTimer()
+{
+    bStepTimeReached = true;
+    OnSignal(EStageSignal::Time);
+}
+
 void UStageSubsystem::HandleVitalsChanged(float Hp01, float Temp01, float O201)
 {
     // ӿ : Hp 0
@@ -284,18 +591,21 @@ void UStageSubsystem::HandleVitalsChanged(float Hp01, float Temp01, float O201)
     {
         UE_LOG(LogStageSubsystem, Warning, TEXT("[Stage] GameOver by HP"));
         AbortStage(true);
+        return;
     }
+
+    OnSignal(EStageSignal::Vitals);
 }
 
 void UStageSubsystem::HandleBackdraftTriggered()
 {
-    // ⼭    BackdraftTriggeredInRoom̸ Ű  Ȯ 
+    //     GetBackdraftCount 
     UE_LOG(LogStageSubsystem, Log, TEXT("[Stage] BackdraftTriggered event"));
+    OnSignal(EStageSignal::Backdraft);
 }
 
 void UStageSubsystem::HandleFireExtinguished(AFireActor* Fire)
 {
-    // FiresExtinguishedInRoom  polling(īƮ 0)ε ؼ
-    // ⼭ α/Ȯ θ 
     UE_LOG(LogStageSubsystem, VeryVerbose, TEXT("[Stage] FireExtinguished %s"), *GetNameSafe(Fire));
+    OnSignal(EStageSignal::Fire);
 }
\ No newline at end of file
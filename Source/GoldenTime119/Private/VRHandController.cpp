@@ -1,5 +1,6 @@
 // VRHandController.cpp
 #include "VRHandController.h"
+#include "FireAxeActor.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Engine/World.h"
 
@@ -89,6 +90,12 @@ void AVRHandController::TryGrab()
         }
         NearestActor->AttachToComponent(MotionController, FAttachmentTransformRules::KeepWorldTransform);
 
+        //       ʰ
+        if (AFireAxeActor* Axe = Cast<AFireAxeActor>(NearestActor))
+        {
+            Axe->ResetPoseHistory();
+        }
+
         UE_LOG(LogVRHand, Warning, TEXT("[VRHand] %s Hand Grabbed: %s"),
             IsLeftHand() ? TEXT("Left") : TEXT("Right"), *GetNameSafe(NearestActor));
     }
@@ -106,6 +113,10 @@ void AVRHandController::TryRelease()
 
     //  
     GrabbedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    if (AFireAxeActor* Axe = Cast<AFireAxeActor>(GrabbedActor))
+    {
+        Axe->ResetPoseHistory();
+    }
 
     //  ٽ Ȱȭ (ɼ)
     if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(GrabbedActor->GetRootComponent()))
@@ -0,0 +1,268 @@
+// VRHapticsSubsystem.cpp
+#include "VRHapticsSubsystem.h"
+
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Haptics/HapticFeedbackEffect_Base.h"
+
+UVRHapticsSubsystem* UVRHapticsSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    if (!World) return nullptr;
+
+    const APlayerController* PC = World->GetFirstPlayerController();
+    const ULocalPlayer* LP = PC ? PC->GetLocalPlayer() : nullptr;
+    return LP ? LP->GetSubsystem<UVRHapticsSubsystem>() : nullptr;
+}
+
+void UVRHapticsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    for (FHandChannel& Channel : Hands)
+    {
+        Channel.Requests.Reset();
+        Channel.SentFrequency = 0.f;
+        Channel.SentAmplitude = 0.f;
+    }
+    bHasActiveWork = false;
+}
+
+void UVRHapticsSubsystem::Deinitialize()
+{
+    // Leave the controllers silent
+    if (APlayerController* PC = GetPlayerController())
+    {
+        PC->SetHapticsByValue(0.f, 0.f, EControllerHand::Left);
+        PC->SetHapticsByValue(0.f, 0.f, EControllerHand::Right);
+    }
+
+    for (FHandChannel& Channel : Hands)
+    {
+        Channel.Requests.Reset();
+    }
+    bHasActiveWork = false;
+
+    Super::Deinitialize();
+}
+
+// ============================================================
+// Requests
+// ============================================================
+
+void UVRHapticsSubsystem::SubmitRequest(EControllerHand Hand, const FVRHapticRequest& Request)
+{
+    if (Request.Duration <= 0.f && !Request.Effect)
+        return;
+
+    FHandChannel& Channel = Hands[HandIndex(Hand)];
+
+    FActiveRequest* Existing = Channel.Requests.FindByPredicate(
+        [&Request](const FActiveRequest& A) { return A.Request.Source == Request.Source; });
+
+    if (Existing && Request.Source != NAME_None)
+    {
+        // Continuous sources refresh in place; effect playback keeps its position if the asset is unchanged
+        const bool bSameEffect = (Existing->Effect.Get() == Request.Effect);
+        Existing->Request = Request;
+        Existing->Request.Effect = nullptr;
+        Existing->Effect = Request.Effect;
+        if (!bSameEffect || !Request.Effect)
+        {
+            Existing->Elapsed = 0.f;
+        }
+    }
+    else
+    {
+        FActiveRequest& New = Channel.Requests.AddDefaulted_GetRef();
+        New.Request = Request;
+        New.Request.Effect = nullptr;
+        New.Effect = Request.Effect;
+    }
+
+    bHasActiveWork = true;
+}
+
+void UVRHapticsSubsystem::PlayPulse(FName Source, EControllerHand Hand, EVRHapticPriority Priority,
+    float Frequency01, float Amplitude01, float Duration)
+{
+    FVRHapticRequest R;
+    R.Source = Source;
+    R.Priority = Priority;
+    R.Frequency01 = Frequency01;
+    R.Amplitude01 = Amplitude01;
+    R.Duration = Duration;
+    SubmitRequest(Hand, R);
+}
+
+void UVRHapticsSubsystem::PlayEffect(FName Source, EControllerHand Hand, EVRHapticPriority Priority,
+    UHapticFeedbackEffect_Base* Effect, float Scale)
+{
+    if (!Effect) return;
+
+    FVRHapticRequest R;
+    R.Source = Source;
+    R.Priority = Priority;
+    R.Amplitude01 = Scale;
+    R.Duration = Effect->GetDuration();
+    R.Effect = Effect;
+
+    // Re-trigger from the start even if the same asset is still playing
+    ClearRequest(Source, Hand);
+    SubmitRequest(Hand, R);
+}
+
+void UVRHapticsSubsystem::ClearRequest(FName Source, EControllerHand Hand)
+{
+    Hands[HandIndex(Hand)].Requests.RemoveAll(
+        [Source](const FActiveRequest& A) { return A.Request.Source == Source; });
+}
+
+void UVRHapticsSubsystem::ClearSource(FName Source)
+{
+    ClearRequest(Source, EControllerHand::Left);
+    ClearRequest(Source, EControllerHand::Right);
+}
+
+// ============================================================
+// Mix
+// ============================================================
+
+void UVRHapticsSubsystem::MixHand(FHandChannel& Channel, float& OutFrequency, float& OutAmplitude) const
+{
+    OutFrequency = 0.f;
+    OutAmplitude = 0.f;
+
+    if (Channel.Requests.Num() == 0)
+        return;
+
+    EVRHapticPriority TopPriority = EVRHapticPriority::Ambient;
+    for (const FActiveRequest& A : Channel.Requests)
+    {
+        TopPriority = FMath::Max(TopPriority, A.Request.Priority);
+    }
+
+    // Loudest contribution decides the frequency
+    float Loudest = -1.f;
+    float Sum = 0.f;
+
+    for (const FActiveRequest& A : Channel.Requests)
+    {
+        const FVRHapticRequest& R = A.Request;
+
+        float Freq = R.Frequency01;
+        float Amp = R.Amplitude01;
+
+        if (UHapticFeedbackEffect_Base* Effect = A.Effect.Get())
+        {
+            FHapticFeedbackValues Values;
+            Effect->GetValues(A.Elapsed, Values);
+            Freq = Values.Frequency;
+            Amp = Values.Amplitude * R.Amplitude01;
+        }
+
+        if (R.Priority < TopPriority)
+        {
+            Amp *= LowerPriorityDuck;
+        }
+
+        Amp = FMath::Clamp(Amp, 0.f, 1.f);
+        Sum += Amp;
+
+        if (Amp > Loudest)
+        {
+            Loudest = Amp;
+            OutFrequency = FMath::Clamp(Freq, 0.f, 1.f);
+        }
+    }
+
+    // Soft sum: the strongest request dominates, the rest only fill up the headroom
+    OutAmplitude = FMath::Clamp(Loudest + (Sum - Loudest) * (1.f - Loudest), 0.f, 1.f);
+}
+
+void UVRHapticsSubsystem::SendToDevice(EControllerHand Hand, FHandChannel& Channel, float Frequency, float Amplitude)
+{
+    const bool bWasSilent = Channel.SentAmplitude <= 0.f;
+    const bool bIsSilent = Amplitude <= 0.f;
+
+    if (bWasSilent && bIsSilent)
+        return;
+
+    // Going silent is always sent exactly once; otherwise only meaningful changes
+    if (!bIsSilent && !bWasSilent
+        && FMath::Abs(Amplitude - Channel.SentAmplitude) < ChangeEpsilon
+        && FMath::Abs(Frequency - Channel.SentFrequency) < ChangeEpsilon)
+    {
+        return;
+    }
+
+    APlayerController* PC = GetPlayerController();
+    if (!PC) return;
+
+    PC->SetHapticsByValue(Frequency, Amplitude, Hand);
+    Channel.SentFrequency = bIsSilent ? 0.f : Frequency;
+    Channel.SentAmplitude = bIsSilent ? 0.f : Amplitude;
+}
+
+// ============================================================
+// Tick
+// ============================================================
+
+void UVRHapticsSubsystem::Tick(float DeltaTime)
+{
+    bool bAnyActive = false;
+
+    for (int32 i = 0; i < 2; ++i)
+    {
+        FHandChannel& Channel = Hands[i];
+
+        float Freq = 0.f;
+        float Amp = 0.f;
+        MixHand(Channel, Freq, Amp);
+        SendToDevice(i == 0 ? EControllerHand::Left : EControllerHand::Right, Channel, Freq, Amp);
+
+        // Advance and expire after mixing so a request always plays at least one frame
+        for (int32 r = Channel.Requests.Num() - 1; r >= 0; --r)
+        {
+            FActiveRequest& A = Channel.Requests[r];
+            A.Elapsed += DeltaTime;
+            if (A.Elapsed >= A.Request.Duration || A.Effect.IsStale())
+            {
+                Channel.Requests.RemoveAtSwap(r, 1, false);
+            }
+        }
+
+        bAnyActive |= (Channel.Requests.Num() > 0) || (Channel.SentAmplitude > 0.f);
+    }
+
+    bHasActiveWork = bAnyActive;
+}
+
+ETickableTickType UVRHapticsSubsystem::GetTickableTickType() const
+{
+    return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UVRHapticsSubsystem::IsTickable() const
+{
+    return bHasActiveWork;
+}
+
+TStatId UVRHapticsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UVRHapticsSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* UVRHapticsSubsystem::GetTickableGameObjectWorld() const
+{
+    const ULocalPlayer* LP = GetLocalPlayer();
+    return LP ? LP->GetWorld() : nullptr;
+}
+
+APlayerController* UVRHapticsSubsystem::GetPlayerController() const
+{
+    const ULocalPlayer* LP = GetLocalPlayer();
+    const UWorld* World = LP ? LP->GetWorld() : nullptr;
+    return World ? LP->GetPlayerController(World) : nullptr;
+}
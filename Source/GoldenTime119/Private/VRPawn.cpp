@@ -1,6 +1,7 @@
 // VRPawn.cpp
 #include "VRPawn.h"
 #include "GrabInteractable.h"
+#include "FireAxeActor.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "GameFramework/PlayerController.h"
@@ -166,6 +167,12 @@ void AVRPawn::TryGrabLeft()
         }
         NearestActor->AttachToComponent(LeftMotionController, FAttachmentTransformRules::KeepWorldTransform);
 
+        //       ʰ
+        if (AFireAxeActor* Axe = Cast<AFireAxeActor>(NearestActor))
+        {
+            Axe->ResetPoseHistory();
+        }
+
         UE_LOG(LogVRPawn, Warning, TEXT("[VRPawn] Left Hand Grabbed: %s"), *GetNameSafe(NearestActor));
     }
 }
@@ -182,6 +189,10 @@ void AVRPawn::TryReleaseLeft()
 
     //  
     LeftGrabbedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    if (AFireAxeActor* Axe = Cast<AFireAxeActor>(LeftGrabbedActor))
+    {
+        Axe->ResetPoseHistory();
+    }
 
     UE_LOG(LogVRPawn, Warning, TEXT("[VRPawn] Left Hand Released: %s"), *GetNameSafe(LeftGrabbedActor));
 
@@ -215,6 +226,12 @@ void AVRPawn::TryGrabRight()
         }
         NearestActor->AttachToComponent(RightMotionController, FAttachmentTransformRules::KeepWorldTransform);
 
+        //       ʰ
+        if (AFireAxeActor* Axe = Cast<AFireAxeActor>(NearestActor))
+        {
+            Axe->ResetPoseHistory();
+        }
+
         UE_LOG(LogVRPawn, Warning, TEXT("[VRPawn] Right Hand Grabbed: %s"), *GetNameSafe(NearestActor));
     }
 }
@@ -231,6 +248,10 @@ void AVRPawn::TryReleaseRight()
 
     //  
     RightGrabbedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    if (AFireAxeActor* Axe = Cast<AFireAxeActor>(RightGrabbedActor))
+    {
+        Axe->ResetPoseHistory();
+    }
 
     UE_LOG(LogVRPawn, Warning, TEXT("[VRPawn] Right Hand Released: %s"), *GetNameSafe(RightGrabbedActor));
 
@@ -0,0 +1,1762 @@
+// ============================ VoiceAudioBenchmarks.cpp ============================
+// Offline benchmarks for the voice pipeline. Console commands, not compiled into shipping builds.
+#include "VoiceAudioDSP.h"
+#include "RealtimeAppendEncoder.h"
+#include "RealtimeEventDecoder.h"
+#include "RadioJitterBuffer.h"
+#include "MockRealtimeServer.h"
+#include "RealtimeConnection.h"
+#include "VoiceAudioCodec.h"
+#include "RadioVoiceFx.h"
+#include "VoiceCaptureSource.h"
+#include "WhisperSpeechEngine.h"
+#include "WhisperSTTSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceBench, Log, All);
+
+namespace VoiceBench
+{
+	// 이전 캡처 경로 (48k->24k 짝수 샘플 선택, 그 외 선형 보간) - 비교 기준
+	struct FLegacyResampler
+	{
+		double Step = 1.0;
+		double Pos = 1.0;
+		float LastSample = 0.f;
+		bool bPick2 = false;
+
+		void Init(int32 InRate, int32 OutRate)
+		{
+			Step = (double)InRate / (double)OutRate;
+			bPick2 = (InRate == 2 * OutRate);
+			Pos = 1.0;
+			LastSample = 0.f;
+		}
+
+		int32 Process(const float* In, int32 NumIn, float* Out)
+		{
+			int32 NumOut = 0;
+			while (Pos <= (double)NumIn)
+			{
+				const int32 I0 = (int32)Pos;
+				const float T = bPick2 ? 0.f : (float)(Pos - (double)I0);
+				const float S0 = (I0 == 0) ? LastSample : In[I0 - 1];
+				const float S1 = (I0 < NumIn) ? In[I0] : S0;
+				Out[NumOut++] = S0 + (S1 - S0) * T;
+				Pos += Step;
+			}
+			Pos -= (double)NumIn;
+			LastSample = In[NumIn - 1];
+			return NumOut;
+		}
+	};
+
+	struct FQuality
+	{
+		double GainDb1k = 0.0;          // 1 kHz 통과 이득
+		double GainDbEdge = 0.0;        // 0.35 x Out 통과 이득 (리플)
+		double SinadDb = 0.0;           // 1 kHz 사인 적합 후 잔차 기준
+		double AliasDb = 0.0;           // 0.75 x Out 입력 톤이 출력에 남은 양 (낮을수록 좋음)
+	};
+
+	constexpr int32 ChunkFrames = 480;
+	constexpr float ToneAmplitude = 0.5f;
+
+	template <typename ResamplerType>
+	void RunChunked(ResamplerType& Resampler, const TArray<float>& In, TArray<float>& Out, int32 InRate, int32 OutRate)
+	{
+		// 청크마다 여유분이 붙으므로 청크 수만큼 더함
+		const int32 NumChunks = FMath::DivideAndRoundUp(In.Num(), ChunkFrames);
+		Out.SetNumUninitialized(NumChunks * FVoicePolyphaseResampler::GetMaxOutput(ChunkFrames, InRate, OutRate));
+		int32 NumOut = 0;
+		for (int32 Offset = 0; Offset < In.Num(); Offset += ChunkFrames)
+		{
+			const int32 Num = FMath::Min(ChunkFrames, In.Num() - Offset);
+			NumOut += Resampler.Process(In.GetData() + Offset, Num, Out.GetData() + NumOut);
+		}
+		Out.SetNum(NumOut, false);
+	}
+
+	void MakeTone(TArray<float>& Out, int32 Rate, double Freq, double Seconds)
+	{
+		const int32 Num = (int32)(Rate * Seconds);
+		Out.SetNumUninitialized(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Out[i] = ToneAmplitude * (float)FMath::Sin(2.0 * PI * Freq * i / Rate);
+		}
+	}
+
+	// 정확히 1초(정수 주기) 창에서 사인 성분을 투영해 진폭/잔차 계산
+	void FitTone(const TArray<float>& Y, int32 Rate, double Freq, double& OutAmplitude, double& OutResidualRms)
+	{
+		const int32 Start = Rate / 2;     // 필터 과도 구간 제외
+		const int32 N = Rate;
+		OutAmplitude = 0.0;
+		OutResidualRms = 0.0;
+		if (Y.Num() < Start + N)
+			return;
+
+		double SumS = 0.0, SumC = 0.0;
+		for (int32 i = 0; i < N; ++i)
+		{
+			const double W = 2.0 * PI * Freq * (Start + i) / Rate;
+			SumS += Y[Start + i] * FMath::Sin(W);
+			SumC += Y[Start + i] * FMath::Cos(W);
+		}
+		const double A = 2.0 * SumS / N;
+		const double B = 2.0 * SumC / N;
+
+		double Res = 0.0;
+		for (int32 i = 0; i < N; ++i)
+		{
+			const double W = 2.0 * PI * Freq * (Start + i) / Rate;
+			const double E = Y[Start + i] - (A * FMath::Sin(W) + B * FMath::Cos(W));
+			Res += E * E;
+		}
+
+		OutAmplitude = FMath::Sqrt(A * A + B * B);
+		OutResidualRms = FMath::Sqrt(Res / N);
+	}
+
+	double ToDb(double Ratio)
+	{
+		return 20.0 * FMath::LogX(10.0, FMath::Max(Ratio, 1e-12));
+	}
+
+	template <typename ResamplerType>
+	FQuality MeasureQuality(int32 InRate, int32 OutRate)
+	{
+		FQuality Q;
+		TArray<float> In, Out;
+		double Amp = 0.0, Res = 0.0;
+
+		// 1 kHz: 이득 + SINAD
+		{
+			ResamplerType R;
+			R.Init(InRate, OutRate);
+			MakeTone(In, InRate, 1000.0, 2.0);
+			RunChunked(R, In, Out, InRate, OutRate);
+			FitTone(Out, OutRate, 1000.0, Amp, Res);
+			Q.GainDb1k = ToDb(Amp / ToneAmplitude);
+			Q.SinadDb = ToDb(Amp / FMath::Max(Res * UE_SQRT_2, 1e-12));
+		}
+
+		// 통과대역 끝
+		{
+			const double Freq = FMath::RoundToDouble(0.35 * OutRate);
+			ResamplerType R;
+			R.Init(InRate, OutRate);
+			MakeTone(In, InRate, Freq, 2.0);
+			RunChunked(R, In, Out, InRate, OutRate);
+			FitTone(Out, OutRate, Freq, Amp, Res);
+			Q.GainDbEdge = ToDb(Amp / ToneAmplitude);
+		}
+
+		// 출력 나이퀴스트 위 톤 -> 접혀 들어온 에너지 (전체 RMS)
+		{
+			const double Freq = FMath::RoundToDouble(0.75 * OutRate);
+			ResamplerType R;
+			R.Init(InRate, OutRate);
+			MakeTone(In, InRate, Freq, 2.0);
+			RunChunked(R, In, Out, InRate, OutRate);
+
+			const int32 Start = OutRate / 2;
+			double Sum = 0.0;
+			int32 N = 0;
+			for (int32 i = Start; i < Out.Num(); ++i, ++N)
+			{
+				Sum += (double)Out[i] * Out[i];
+			}
+			const double Rms = N > 0 ? FMath::Sqrt(Sum / N) : 0.0;
+			Q.AliasDb = ToDb(Rms / (ToneAmplitude / UE_SQRT_2));
+		}
+
+		return Q;
+	}
+
+	// 오디오 1초당 처리 시간 (ms), 3회 중 최소
+	template <typename ResamplerType>
+	double MeasureCostMsPerSecond(int32 InRate, int32 OutRate)
+	{
+		constexpr double Seconds = 10.0;
+		TArray<float> In, Out;
+		In.SetNumUninitialized((int32)(InRate * Seconds));
+		FRandomStream Rng(119);
+		for (float& S : In)
+		{
+			S = Rng.FRandRange(-0.5f, 0.5f);
+		}
+
+		double Best = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < 3; ++Run)
+		{
+			ResamplerType R;
+			R.Init(InRate, OutRate);
+			const double T0 = FPlatformTime::Seconds();
+			RunChunked(R, In, Out, InRate, OutRate);
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - T0);
+		}
+		return Best * 1000.0 / Seconds;
+	}
+
+	void RunResamplerBenchmark()
+	{
+		static const int32 InRates[] = { 44100, 48000, 96000 };
+		static const int32 OutRates[] = { 16000, 24000 };
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] Resampler  (legacy = pick/linear, poly = polyphase FIR)"));
+		UE_LOG(LogVoiceBench, Display, TEXT("  In->Out       taps | gain1k  edge    SINAD   alias   | legacy SINAD  alias  | cost ms/s poly  legacy"));
+
+		for (const int32 InRate : InRates)
+		{
+			for (const int32 OutRate : OutRates)
+			{
+				FVoicePolyphaseResampler Probe;
+				Probe.Init(InRate, OutRate);
+
+				const FQuality Poly = MeasureQuality<FVoicePolyphaseResampler>(InRate, OutRate);
+				const FQuality Legacy = MeasureQuality<FLegacyResampler>(InRate, OutRate);
+				const double PolyCost = MeasureCostMsPerSecond<FVoicePolyphaseResampler>(InRate, OutRate);
+				const double LegacyCost = MeasureCostMsPerSecond<FLegacyResampler>(InRate, OutRate);
+
+				UE_LOG(LogVoiceBench, Display, TEXT("  %5d->%5d  %4d | %+6.2f  %+6.2f  %6.1f  %6.1f  | %6.1f  %6.1f       | %6.3f  %6.3f"),
+					InRate, OutRate, Probe.GetTapsPerPhase(),
+					Poly.GainDb1k, Poly.GainDbEdge, Poly.SinadDb, Poly.AliasDb,
+					Legacy.SinadDb, Legacy.AliasDb,
+					PolyCost, LegacyCost);
+			}
+		}
+	}
+
+	// ===== Realtime append =====
+
+	// 이전 전송 경로: FBase64 -> FJsonObject -> FString(UTF-16) -> UTF-8 (IWebSocket::Send(FString) 내부 변환)
+	// 반환: 최종 UTF-8 바이트 수, OutTransientBytes에 임시 버퍼 크기 누적
+	int32 LegacyBuildAppend(const TArray<uint8>& Pcm, TArray<uint8>* OutUtf8, int64& OutTransientBytes)
+	{
+		const FString B64 = FBase64::Encode(Pcm);
+
+		const TSharedPtr<FJsonObject> Ev = MakeShared<FJsonObject>();
+		Ev->SetStringField(TEXT("type"), TEXT("input_audio_buffer.append"));
+		Ev->SetStringField(TEXT("audio"), B64);
+
+		FString Out;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+		FJsonSerializer::Serialize(Ev.ToSharedRef(), Writer);
+
+		const FTCHARToUTF8 Utf8(*Out);
+		if (OutUtf8)
+		{
+			OutUtf8->Reset();
+			OutUtf8->Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		}
+
+		// B64 + 사본(SetStringField) + 직렬화 문자열 + UTF-8 사본 (FJsonObject/맵 할당은 제외)
+		OutTransientBytes += (int64)B64.GetAllocatedSize() * 2 + Out.GetAllocatedSize() + Utf8.Length();
+		return Utf8.Length();
+	}
+
+	void RunAppendEncoderBenchmark()
+	{
+		constexpr int32 SampleRate = 24000;
+		constexpr int32 FrameBytes = SampleRate / 50 * (int32)sizeof(int16);   // 20ms mono PCM16
+		constexpr int32 NumFrames = 50 * 10;                                      // 10초
+		constexpr double Seconds = NumFrames / 50.0;
+
+		TArray<uint8> Frame;
+		Frame.SetNumUninitialized(FrameBytes);
+		FRandomStream Rng(119);
+		for (uint8& B : Frame)
+		{
+			B = (uint8)Rng.RandRange(0, 255);
+		}
+
+		// 출력 동일성 (코얼레싱 1 = 프레임당 메시지 1개)
+		bool bIdentical = false;
+		{
+			TArray<uint8> LegacyUtf8;
+			int64 Dummy = 0;
+			LegacyBuildAppend(Frame, &LegacyUtf8, Dummy);
+
+			FRealtimeAppendEncoder Encoder;
+			Encoder.AddPcm(Frame.GetData(), Frame.Num());
+			const TArrayView<const uint8> Msg = Encoder.BuildMessage();
+			bIdentical = (Msg.Num() == LegacyUtf8.Num()) && FMemory::Memcmp(Msg.GetData(), LegacyUtf8.GetData(), Msg.Num()) == 0;
+		}
+
+		double LegacyBest = TNumericLimits<double>::Max();
+		int64 LegacyTransient = 0;
+		int64 LegacyWire = 0;
+		for (int32 Run = 0; Run < 3; ++Run)
+		{
+			int64 Transient = 0;
+			int64 Wire = 0;
+			const double T0 = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumFrames; ++i)
+			{
+				Wire += LegacyBuildAppend(Frame, nullptr, Transient);
+			}
+			LegacyBest = FMath::Min(LegacyBest, FPlatformTime::Seconds() - T0);
+			LegacyTransient = Transient;
+			LegacyWire = Wire;
+		}
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] Realtime append  (10 s of 20 ms @ %d Hz mono, identical output=%d)"), SampleRate, bIdentical ? 1 : 0);
+		UE_LOG(LogVoiceBench, Display, TEXT("  path            msgs/s  wire KB/s  cpu us/s  transient KB/s  buf growths"));
+		UE_LOG(LogVoiceBench, Display, TEXT("  legacy          %6.1f  %9.1f  %8.1f  %14.1f  n/a"),
+			NumFrames / Seconds, LegacyWire / Seconds / 1024.0, LegacyBest * 1e6 / Seconds, LegacyTransient / Seconds / 1024.0);
+
+		static const int32 CoalesceCounts[] = { 1, 5 };
+		for (const int32 Coalesce : CoalesceCounts)
+		{
+			double Best = TNumericLimits<double>::Max();
+			int64 Wire = 0;
+			int32 Messages = 0;
+			int32 Growths = 0;
+			for (int32 Run = 0; Run < 3; ++Run)
+			{
+				FRealtimeAppendEncoder Encoder;
+				Encoder.Reserve(FrameBytes * Coalesce);
+				Wire = 0;
+				Messages = 0;
+
+				const double T0 = FPlatformTime::Seconds();
+				for (int32 i = 0; i < NumFrames; ++i)
+				{
+					Encoder.AddPcm(Frame.GetData(), Frame.Num());
+					if (Encoder.GetPendingFrames() >= Coalesce)
+					{
+						Wire += Encoder.BuildMessage().Num();
+						++Messages;
+					}
+				}
+				if (Encoder.HasPending())
+				{
+					Wire += Encoder.BuildMessage().Num();
+					++Messages;
+				}
+				Best = FMath::Min(Best, FPlatformTime::Seconds() - T0);
+				Growths = Encoder.GetGrowthCount();
+			}
+
+			UE_LOG(LogVoiceBench, Display, TEXT("  encoder x%-2d     %6.1f  %9.1f  %8.1f  %14.1f  %d"),
+				Coalesce, Messages / Seconds, Wire / Seconds / 1024.0, Best * 1e6 / Seconds, 0.0, Growths);
+		}
+	}
+}
+
+namespace VoiceBench
+{
+	// 합성 PTT 송신: 방 잡음 -> 마스크 호흡 -> 유성음 -> 쉼 -> 유성음 -> 호흡 -> 방 잡음
+	void MakeVadScenario(TArray<float>& Out, TArray<bool>& OutTruth, int32 Rate, int32 FrameSamples)
+	{
+		struct FSegment { int32 Kind; float Sec; };   // 0 방 잡음, 1 호흡, 2 유성음
+		static const FSegment Segments[] = { {0, 0.4f}, {1, 0.6f}, {2, 1.5f}, {0, 0.5f}, {2, 1.2f}, {1, 0.5f}, {0, 0.8f} };
+
+		FRandomStream Rng(1234);
+		auto Gaussian = [&Rng]() { return (float)(FMath::Sqrt(-2.0 * FMath::Loge(FMath::Max(1e-9f, Rng.FRand()))) * FMath::Cos(2.0 * PI * Rng.FRand())); };
+
+		double Phase = 0.0;
+		Out.Reset();
+		OutTruth.Reset();
+		for (const FSegment& Seg : Segments)
+		{
+			const int32 Num = FMath::RoundToInt(Seg.Sec * Rate / FrameSamples) * FrameSamples;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				float V = 0.001f * Gaussian();
+				if (Seg.Kind == 1)
+				{
+					V += 0.012f * Gaussian();
+				}
+				else if (Seg.Kind == 2)
+				{
+					// 140 Hz 성대음 + 배음, 4 Hz 음절 포락선
+					Phase += 2.0 * PI * 140.0 / Rate;
+					const float Env = 0.6f + 0.4f * (float)FMath::Sin(2.0 * PI * 4.0 * i / Rate);
+					V += Env * 0.08f * (float)(FMath::Sin(Phase) + 0.6 * FMath::Sin(2.0 * Phase) + 0.5 * FMath::Sin(3.0 * Phase) + 0.3 * FMath::Sin(5.0 * Phase));
+				}
+				Out.Add(V);
+			}
+			for (int32 f = 0; f < Num / FrameSamples; ++f)
+			{
+				OutTruth.Add(Seg.Kind == 2);
+			}
+		}
+	}
+
+	void RunVadBenchmark()
+	{
+		const int32 Rate = 24000;
+		const float FrameSec = 0.02f;
+		const int32 FrameSamples = (int32)(Rate * FrameSec);
+
+		TArray<float> Signal;
+		TArray<bool> Truth;
+		MakeVadScenario(Signal, Truth, Rate, FrameSamples);
+		const int32 NumFrames = Truth.Num();
+
+		FVoiceActivityDetector Vad;
+		Vad.Init(FVoiceActivityDetector::FSettings(), FrameSec);
+
+		int32 Kept = 0, SpeechKept = 0, SpeechTotal = 0, NoiseKept = 0, Onsets = 0;
+		bool bPrev = false;
+		for (int32 f = 0; f < NumFrames; ++f)
+		{
+			const bool bSpeech = (Vad.Process(Signal.GetData() + f * FrameSamples, FrameSamples) & FVoiceActivityDetector::FlagSpeech) != 0;
+			Kept += bSpeech ? 1 : 0;
+			SpeechTotal += Truth[f] ? 1 : 0;
+			SpeechKept += (bSpeech && Truth[f]) ? 1 : 0;
+			NoiseKept += (bSpeech && !Truth[f]) ? 1 : 0;
+			Onsets += (bSpeech && !bPrev) ? 1 : 0;
+			bPrev = bSpeech;
+		}
+
+		// CPU: 같은 신호를 반복 (상태는 계속 이어짐)
+		const int32 Runs = 200;
+		const double T0 = FPlatformTime::Seconds();
+		uint32 Sink = 0;
+		for (int32 Run = 0; Run < Runs; ++Run)
+		{
+			for (int32 f = 0; f < NumFrames; ++f)
+			{
+				Sink += Vad.Process(Signal.GetData() + f * FrameSamples, FrameSamples);
+			}
+		}
+		const double Elapsed = FPlatformTime::Seconds() - T0;
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] VAD (%.1f s synthetic PTT @ %d Hz, 20 ms frames, speech %.1f s)"),
+			NumFrames * FrameSec, Rate, SpeechTotal * FrameSec);
+		UE_LOG(LogVoiceBench, Display, TEXT("  speech frames kept   %5.1f %%"), 100.0 * SpeechKept / FMath::Max(1, SpeechTotal));
+		UE_LOG(LogVoiceBench, Display, TEXT("  non-speech kept      %5.1f %% (hangover + breath)"), 100.0 * NoiseKept / FMath::Max(1, NumFrames - SpeechTotal));
+		UE_LOG(LogVoiceBench, Display, TEXT("  upload / STT audio   %5.1f %% of captured, %d segment(s)"), 100.0 * Kept / NumFrames, Onsets);
+		UE_LOG(LogVoiceBench, Display, TEXT("  cpu                  %.0f ns/frame (%.3f ms per 1 s audio) [%u]"),
+			Elapsed * 1e9 / (Runs * NumFrames), Elapsed * 1e3 / (Runs * NumFrames * FrameSec), Sink & 1u);
+	}
+}
+
+namespace VoiceBench
+{
+	// 참조 구현 (Sun g711.c, 세그먼트 테이블 탐색) - 정확성/속도 비교 기준
+	uint8 ReferenceLinearToUlaw(int32 Pcm)
+	{
+		static const int32 SegEnd[8] = { 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF, 0x1FFF };
+		int32 Mask;
+		Pcm >>= 2;
+		if (Pcm < 0) { Pcm = -Pcm; Mask = 0x7F; }
+		else { Mask = 0xFF; }
+		Pcm = FMath::Min(Pcm, 8159) + 0x21;
+
+		int32 Seg = 0;
+		while (Seg < 8 && Pcm > SegEnd[Seg])
+		{
+			++Seg;
+		}
+		if (Seg >= 8)
+			return (uint8)(0x7F ^ Mask);
+		return (uint8)(((Seg << 4) | ((Pcm >> (Seg + 1)) & 0x0F)) ^ Mask);
+	}
+
+	uint8 ReferenceLinearToAlaw(int32 Pcm)
+	{
+		static const int32 SegEnd[8] = { 0x1F, 0x3F, 0x7F, 0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF };
+		int32 Mask;
+		Pcm >>= 3;
+		if (Pcm >= 0) { Mask = 0xD5; }
+		else { Mask = 0x55; Pcm = -Pcm - 1; }
+
+		int32 Seg = 0;
+		while (Seg < 8 && Pcm > SegEnd[Seg])
+		{
+			++Seg;
+		}
+		if (Seg >= 8)
+			return (uint8)(0x7F ^ Mask);
+		const int32 Mant = (Seg < 2) ? (Pcm >> 1) & 0x0F : (Pcm >> Seg) & 0x0F;
+		return (uint8)(((Seg << 4) | Mant) ^ Mask);
+	}
+
+	int16 ReferenceUlawToLinear(uint8 U)
+	{
+		U = ~U;
+		int32 T = ((U & 0x0F) << 3) + 0x84;
+		T <<= (U & 0x70) >> 4;
+		return (int16)((U & 0x80) ? (0x84 - T) : (T - 0x84));
+	}
+
+	int16 ReferenceAlawToLinear(uint8 A)
+	{
+		A ^= 0x55;
+		int32 T = (A & 0x0F) << 4;
+		const int32 Seg = (A & 0x70) >> 4;
+		if (Seg == 0) { T += 8; }
+		else if (Seg == 1) { T += 0x108; }
+		else { T = (T + 0x108) << (Seg - 1); }
+		return (int16)((A & 0x80) ? T : -T);
+	}
+
+	// G.711 커널 (SIMD vs 참조) + 전송 경계 전체 (24k PCM16 -> 리샘플 -> 인코드, 디코드 -> 리샘플 -> 24k)
+	void RunG711Benchmark()
+	{
+		constexpr int32 SampleRate = 24000;
+		constexpr int32 ChunkSamples = SampleRate / 10;     // 100ms (코얼레싱된 append / 응답 델타 하나)
+		constexpr int32 Seconds = 10;
+		constexpr int32 NumChunks = Seconds * 10;
+
+		// 모든 입력/코드에 대해 참조와 비트 단위 비교
+		int32 Mismatches = 0;
+		{
+			TArray<int16> AllPcm;
+			AllPcm.SetNumUninitialized(65536);
+			for (int32 i = 0; i < 65536; ++i)
+			{
+				AllPcm[i] = (int16)(i - 32768);
+			}
+			TArray<uint8> Codes;
+			Codes.SetNumUninitialized(65536);
+
+			VoiceAudioDSP::EncodeMuLaw(AllPcm.GetData(), Codes.GetData(), 65536);
+			for (int32 i = 0; i < 65536; ++i)
+			{
+				Mismatches += (Codes[i] != ReferenceLinearToUlaw(AllPcm[i])) ? 1 : 0;
+			}
+			VoiceAudioDSP::EncodeALaw(AllPcm.GetData(), Codes.GetData(), 65536);
+			for (int32 i = 0; i < 65536; ++i)
+			{
+				Mismatches += (Codes[i] != ReferenceLinearToAlaw(AllPcm[i])) ? 1 : 0;
+			}
+
+			for (int32 i = 0; i < 256; ++i)
+			{
+				Codes[i] = (uint8)i;
+			}
+			VoiceAudioDSP::DecodeMuLaw(Codes.GetData(), AllPcm.GetData(), 256);
+			for (int32 i = 0; i < 256; ++i)
+			{
+				Mismatches += (AllPcm[i] != ReferenceUlawToLinear((uint8)i)) ? 1 : 0;
+			}
+			VoiceAudioDSP::DecodeALaw(Codes.GetData(), AllPcm.GetData(), 256);
+			for (int32 i = 0; i < 256; ++i)
+			{
+				Mismatches += (AllPcm[i] != ReferenceAlawToLinear((uint8)i)) ? 1 : 0;
+			}
+		}
+
+		// 유성음 비슷한 신호 (기본파 + 배음 + 약한 잡음)
+		TArray<int16> Speech;
+		Speech.SetNumUninitialized(ChunkSamples * NumChunks);
+		{
+			FRandomStream Rng(711);
+			for (int32 i = 0; i < Speech.Num(); ++i)
+			{
+				const double T = (double)i / SampleRate;
+				const double V = 0.3 * FMath::Sin(2.0 * PI * 140.0 * T) + 0.15 * FMath::Sin(2.0 * PI * 420.0 * T)
+					+ 0.05 * FMath::Sin(2.0 * PI * 1850.0 * T) + 0.01 * Rng.FRandRange(-1.f, 1.f);
+				Speech[i] = (int16)FMath::Clamp(FMath::RoundToInt(V * 32767.0), -32768, 32767);
+			}
+		}
+
+		TArray<uint8> Codes;
+		Codes.SetNumUninitialized(Speech.Num());
+		TArray<int16> Decoded;
+		Decoded.SetNumUninitialized(Speech.Num());
+
+		auto BestOf3 = [](TFunctionRef<void()> Body)
+		{
+			double Best = TNumericLimits<double>::Max();
+			for (int32 Run = 0; Run < 3; ++Run)
+			{
+				const double T0 = FPlatformTime::Seconds();
+				Body();
+				Best = FMath::Min(Best, FPlatformTime::Seconds() - T0);
+			}
+			return Best;
+		};
+
+		const int32 Num = Speech.Num();
+		const double RefEncU = BestOf3([&]() { for (int32 i = 0; i < Num; ++i) { Codes[i] = ReferenceLinearToUlaw(Speech[i]); } });
+		const double SimdEncU = BestOf3([&]() { VoiceAudioDSP::EncodeMuLaw(Speech.GetData(), Codes.GetData(), Num); });
+		const double RefDecU = BestOf3([&]() { for (int32 i = 0; i < Num; ++i) { Decoded[i] = ReferenceUlawToLinear(Codes[i]); } });
+		const double SimdDecU = BestOf3([&]() { VoiceAudioDSP::DecodeMuLaw(Codes.GetData(), Decoded.GetData(), Num); });
+		const double RefEncA = BestOf3([&]() { for (int32 i = 0; i < Num; ++i) { Codes[i] = ReferenceLinearToAlaw(Speech[i]); } });
+		const double SimdEncA = BestOf3([&]() { VoiceAudioDSP::EncodeALaw(Speech.GetData(), Codes.GetData(), Num); });
+		const double RefDecA = BestOf3([&]() { for (int32 i = 0; i < Num; ++i) { Decoded[i] = ReferenceAlawToLinear(Codes[i]); } });
+		const double SimdDecA = BestOf3([&]() { VoiceAudioDSP::DecodeALaw(Codes.GetData(), Decoded.GetData(), Num); });
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] G.711 kernels (%d s @ %d Hz, bit-exact vs reference: %s)"),
+			Seconds, SampleRate, Mismatches == 0 ? TEXT("yes") : *FString::Printf(TEXT("NO, %d mismatches"), Mismatches));
+		UE_LOG(LogVoiceBench, Display, TEXT("  kernel          reference ns/sample   simd ns/sample   speedup"));
+		auto Row = [Num](const TCHAR* Label, double Ref, double Simd)
+		{
+			UE_LOG(LogVoiceBench, Display, TEXT("  %-14s  %19.2f  %15.2f  %7.1fx"), Label, Ref * 1e9 / Num, Simd * 1e9 / Num, Ref / FMath::Max(Simd, 1e-9));
+		};
+		Row(TEXT("mu-law encode"), RefEncU, SimdEncU);
+		Row(TEXT("mu-law decode"), RefDecU, SimdDecU);
+		Row(TEXT("A-law encode"), RefEncA, SimdEncA);
+		Row(TEXT("A-law decode"), RefDecA, SimdDecA);
+
+		// 실제 경로와 같은 단위로: 송신 100ms씩 인코드, 수신 100ms 델타씩 디코드
+		UE_LOG(LogVoiceBench, Display, TEXT("  transport (24 kHz mono edge)  wire KB/s  up cpu us/s  down cpu us/s"));
+		static const ERealtimeAudioCodec Codecs[] = { ERealtimeAudioCodec::Pcm16, ERealtimeAudioCodec::G711Ulaw, ERealtimeAudioCodec::G711Alaw };
+		for (const ERealtimeAudioCodec Id : Codecs)
+		{
+			FVoiceCodecEncoder Encoder;
+			Encoder.Init(Id, SampleRate);
+			FVoiceCodecDecoder Decoder;
+			Decoder.Init(Id, SampleRate);
+
+			TArray<uint8> Wire;
+			Wire.Reserve(Speech.Num() * (int32)sizeof(int16));
+			TArray<uint8> Pcm;
+			Pcm.Reserve(ChunkSamples * 4 * (int32)sizeof(int16));
+
+			const double Up = BestOf3([&]()
+				{
+					Wire.Reset();
+					Encoder.Reset();
+					for (int32 c = 0; c < NumChunks; ++c)
+					{
+						Encoder.Encode(Speech.GetData() + c * ChunkSamples, ChunkSamples, Wire);
+					}
+				});
+
+			const int32 WireChunk = FMath::Max(1, Wire.Num() / NumChunks);
+			const double Down = BestOf3([&]()
+				{
+					Decoder.Reset();
+					for (int32 Offset = 0; Offset < Wire.Num(); Offset += WireChunk)
+					{
+						Decoder.Decode(Wire.GetData() + Offset, FMath::Min(WireChunk, Wire.Num() - Offset), Pcm);
+					}
+				});
+
+			UE_LOG(LogVoiceBench, Display, TEXT("  %-28s  %9.1f  %11.1f  %13.1f"), VoiceAudioCodecs::GetWireFormat(Id),
+				Wire.Num() / (double)Seconds / 1024.0, Up * 1e6 / Seconds, Down * 1e6 / Seconds);
+		}
+	}
+}
+
+namespace VoiceBench
+{
+	struct FE2EOptions
+	{
+		int32 Turns = 20;
+		float HoldSec = 2.f;            // 턴마다 업로드하는 사용자 발화 길이
+		float GameFrameMs = 16.7f;      // 소켓 펌프 + 제어 이벤트 처리 주기 (게임 스레드 Tick)
+		int32 RenderFrames = 512;       // 오디오 렌더 콜백 크기
+		int32 AppendCoalesceFrames = 5;
+		ERealtimeAudioCodec Codec = ERealtimeAudioCodec::Pcm16;    // 업/다운 같은 코덱
+		FMockRealtimeSettings Mock;
+	};
+
+	double PercentileOf(TArray<double> Values, double P)
+	{
+		if (Values.Num() == 0)
+			return 0.0;
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(P * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Index];
+	}
+
+	void LogLatencyRow(const TCHAR* Label, const TArray<double>& Ms)
+	{
+		UE_LOG(LogVoiceBench, Display, TEXT("  %-24s %7.1f %7.1f %7.1f %7.1f"), Label,
+			PercentileOf(Ms, 0.5), PercentileOf(Ms, 0.9), PercentileOf(Ms, 0.99), PercentileOf(Ms, 1.0));
+	}
+
+	// PTT 릴리스(commit + response.create) -> 첫 오디오 델타 수신 -> 첫 소리 렌더를 턴마다 측정.
+	// 실제 경로와 같은 디코더 워커 / PCM 스트림 / 지터 버퍼를 쓰고, 게임 Tick과 오디오 콜백은 이 루프가 주기대로 흉내냄.
+	// 출력 장치 지연은 포함하지 않음. 끝날 때까지 게임 스레드를 붙잡음
+	void RunRealtimeE2EBenchmark(const TArray<FString>& Args)
+	{
+		FE2EOptions Opt;
+		{
+			const FString Cmd = FString::Join(Args, TEXT(" "));
+			FParse::Value(*Cmd, TEXT("Turns="), Opt.Turns);
+			FParse::Value(*Cmd, TEXT("Hold="), Opt.HoldSec);
+			FParse::Value(*Cmd, TEXT("Frame="), Opt.GameFrameMs);
+			FParse::Value(*Cmd, TEXT("Render="), Opt.RenderFrames);
+			FParse::Value(*Cmd, TEXT("FirstAudio="), Opt.Mock.FirstAudioDelayMs);
+			FParse::Value(*Cmd, TEXT("Jitter="), Opt.Mock.JitterMs);
+			FParse::Value(*Cmd, TEXT("Chunk="), Opt.Mock.AudioChunkMs);
+			FParse::Value(*Cmd, TEXT("Speed="), Opt.Mock.SendSpeed);
+			FParse::Value(*Cmd, TEXT("Spike="), Opt.Mock.SpikeProbability);
+			FParse::Value(*Cmd, TEXT("Reply="), Opt.Mock.SyntheticReplySec);
+			FParse::Value(*Cmd, TEXT("Wav="), Opt.Mock.ReplyWavPath);
+			FParse::Value(*Cmd, TEXT("Seed="), Opt.Mock.RandomSeed);
+
+			// Codec=pcm|pcmu|pcma
+			FString CodecName;
+			if (FParse::Value(*Cmd, TEXT("Codec="), CodecName))
+			{
+				const IVoiceAudioCodec* Codec = VoiceAudioCodecs::FindByWireFormat(TEXT("audio/") + CodecName);
+				if (!Codec)
+				{
+					UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] Unknown codec '%s' (pcm, pcmu, pcma)."), *CodecName);
+					return;
+				}
+				Opt.Codec = Codec->GetId();
+			}
+			Opt.Turns = FMath::Clamp(Opt.Turns, 1, 1000);
+			Opt.GameFrameMs = FMath::Max(1.f, Opt.GameFrameMs);
+			Opt.RenderFrames = FMath::Clamp(Opt.RenderFrames, 64, 8192);
+		}
+
+		const int32 SampleRate = Opt.Mock.SampleRate;
+		const double FrameSec = Opt.GameFrameMs / 1000.0;
+		const double RenderSec = (double)Opt.RenderFrames / SampleRate;
+		constexpr double TurnTimeoutSec = 30.0;
+
+		FRealtimePcmStreamPtr Stream = MakeShared<FRealtimePcmStream, ESPMode::ThreadSafe>();
+		FRealtimeEventDecoder Decoder;
+		{
+			FRealtimeEventDecoder::FConfig Config;
+			Config.OutputSampleRate = SampleRate;
+			Config.OutputNumChannels = 1;
+			Config.OutputCodec = Opt.Codec;
+			if (!Decoder.Start(Config, Stream))
+				return;
+		}
+
+		const TSharedRef<FMockRealtimeWebSocket, ESPMode::ThreadSafe> Socket = MakeShared<FMockRealtimeWebSocket, ESPMode::ThreadSafe>(Opt.Mock, false);
+		Socket->OnRawMessage().AddLambda([&Decoder](const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+			{
+				Decoder.FeedFragment(Data, Size, BytesRemaining);
+			});
+		Socket->Connect();
+
+		// 연결 + session.created
+		{
+			const double Deadline = FPlatformTime::Seconds() + 5.0;
+			bool bSession = false;
+			while (!bSession && FPlatformTime::Seconds() < Deadline)
+			{
+				Socket->Pump();
+				FRealtimeControlEvent Event;
+				while (Decoder.PopControlEvent(Event))
+				{
+					bSession |= (Event.Type == TEXT("session.created"));
+				}
+				FPlatformProcess::Sleep(0.001f);
+			}
+			if (!bSession)
+			{
+				UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] Mock realtime server did not open a session."));
+				Socket->Close();
+				Decoder.Shutdown();
+				return;
+			}
+			const TCHAR* Format = VoiceAudioCodecs::GetWireFormat(Opt.Codec);
+			Socket->Send(FString::Printf(
+				TEXT("{\"type\":\"session.update\",\"session\":{\"type\":\"realtime\",\"audio\":{\"input\":{\"format\":{\"type\":\"%s\",\"rate\":%d}},\"output\":{\"format\":{\"type\":\"%s\"}}}}}"),
+				Format, SampleRate, Format));
+		}
+
+		// 업로드할 20ms 마이크 프레임 (내용은 무관, 크기만 실제와 같게)
+		const int32 MicFrameBytes = SampleRate / 50 * (int32)sizeof(int16);
+		TArray<uint8> MicFrame;
+		MicFrame.SetNumUninitialized(MicFrameBytes);
+		{
+			FRandomStream Rng(40);
+			for (uint8& B : MicFrame)
+			{
+				B = (uint8)Rng.RandRange(0, 255);
+			}
+		}
+		FRealtimeAppendEncoder Encoder;
+		Encoder.Reserve(MicFrameBytes * Opt.AppendCoalesceFrames);
+
+		// 컴포넌트와 같은 송신 경계 (PCM이면 그대로)
+		FVoiceCodecEncoder MicCodec;
+		MicCodec.Init(Opt.Codec, SampleRate);
+		TArray<uint8> MicWire;
+		MicWire.Reserve(MicFrameBytes);
+
+		FRadioJitterBuffer::FSettings JitterSettings;
+		JitterSettings.SampleRate = SampleRate;
+		JitterSettings.NumChannels = 1;
+
+		TArray<int16> RenderBuffer;
+		RenderBuffer.SetNumZeroed(Opt.RenderFrames);
+
+		TArray<double> ReleaseToFirstByteMs, FirstByteToAudibleMs, ReleaseToAudibleMs;
+		double UploadSec = 0.0, PumpSec = 0.0, RenderCpuSec = 0.0, ReplyAudioSec = 0.0;
+		int64 UpWireBytes = 0, DownWireBytes = 0;
+		int32 Underruns = 0, Timeouts = 0, Errors = 0;
+		const double DecodeBusyStart = Decoder.GetBusySeconds();
+		const double BenchStart = FPlatformTime::Seconds();
+
+		for (int32 Turn = 0; Turn < Opt.Turns; ++Turn)
+		{
+			// ---- PTT hold: clear + append (서버는 길이만 셈. 업로드 비용만 측정하고 실제로 기다리진 않음) ----
+			{
+				const uint32 C0 = FPlatformTime::Cycles();
+				Socket->Send(TEXT("{\"type\":\"input_audio_buffer.clear\"}"));
+				MicCodec.Reset();
+				const int32 NumFrames = FMath::Max(1, FMath::RoundToInt(Opt.HoldSec * 50.f));
+				for (int32 f = 0; f < NumFrames; ++f)
+				{
+					if (MicCodec.IsPassthrough())
+					{
+						Encoder.AddPcm(MicFrame.GetData(), MicFrame.Num());
+					}
+					else
+					{
+						MicWire.Reset();
+						MicCodec.Encode(reinterpret_cast<const int16*>(MicFrame.GetData()), MicFrame.Num() / (int32)sizeof(int16), MicWire);
+						Encoder.AddPcm(MicWire.GetData(), MicWire.Num());
+					}
+
+					if (Encoder.GetPendingFrames() >= Opt.AppendCoalesceFrames || f == NumFrames - 1)
+					{
+						const TArrayView<const uint8> Message = Encoder.BuildMessage();
+						Socket->Send(Message.GetData(), Message.Num(), false);
+						UpWireBytes += Message.Num();
+					}
+				}
+				UploadSec += FPlatformTime::ToSeconds(FPlatformTime::Cycles() - C0);
+			}
+
+			// ---- PTT release ----
+			const double ReleaseSec = FPlatformTime::Seconds();
+			Socket->Send(TEXT("{\"type\":\"input_audio_buffer.commit\"}"));
+			Socket->Send(TEXT("{\"type\":\"response.create\"}"));
+
+			// 송출마다 새 지터 버퍼 (RadioManager와 같음)
+			FRadioJitterBuffer Jitter(Stream, JitterSettings);
+
+			double FirstAudibleSec = 0.0;
+			double NextPump = ReleaseSec;
+			double NextRender = ReleaseSec;
+			bool bTimedOut = false;
+
+			while (!Jitter.IsDrained())
+			{
+				const double Now = FPlatformTime::Seconds();
+				if (Now - ReleaseSec > TurnTimeoutSec)
+				{
+					bTimedOut = true;
+					break;
+				}
+
+				if (Now >= NextPump)
+				{
+					const uint32 C0 = FPlatformTime::Cycles();
+					Socket->Pump();
+					FRealtimeControlEvent Event;
+					while (Decoder.PopControlEvent(Event))
+					{
+						if (Event.Type == TEXT("response.output_audio.done"))
+						{
+							Jitter.MarkEndOfStream();
+						}
+						else if (Event.Type == TEXT("error"))
+						{
+							++Errors;
+						}
+					}
+					PumpSec += FPlatformTime::ToSeconds(FPlatformTime::Cycles() - C0);
+					NextPump += FrameSec;
+				}
+
+				if (Now >= NextRender)
+				{
+					const uint32 C0 = FPlatformTime::Cycles();
+					Jitter.Render(RenderBuffer.GetData(), RenderBuffer.Num());
+					RenderCpuSec += FPlatformTime::ToSeconds(FPlatformTime::Cycles() - C0);
+
+					if (FirstAudibleSec == 0.0)
+					{
+						for (int32 i = 0; i < RenderBuffer.Num(); ++i)
+						{
+							if (RenderBuffer[i] != 0)
+							{
+								FirstAudibleSec = Now + (double)i / SampleRate;
+								break;
+							}
+						}
+					}
+					NextRender += RenderSec;
+				}
+
+				const double WaitSec = FMath::Min(NextPump, NextRender) - FPlatformTime::Seconds();
+				if (WaitSec > 0.0)
+				{
+					FPlatformProcess::Sleep((float)WaitSec);
+				}
+			}
+
+			const FMockRealtimeResponseTiming& Timing = Socket->GetLastResponseTiming();
+			const FRadioJitterStats Stats = Jitter.GetStats();
+			Jitter.Retire();
+
+			if (bTimedOut || FirstAudibleSec == 0.0 || Timing.FirstAudioSec == 0.0)
+			{
+				++Timeouts;
+				continue;
+			}
+
+			ReleaseToFirstByteMs.Add((Timing.FirstAudioSec - ReleaseSec) * 1000.0);
+			FirstByteToAudibleMs.Add((FirstAudibleSec - Timing.FirstAudioSec) * 1000.0);
+			ReleaseToAudibleMs.Add((FirstAudibleSec - ReleaseSec) * 1000.0);
+			Underruns += Stats.Underruns;
+			ReplyAudioSec += (double)Timing.AudioDeltas * Opt.Mock.AudioChunkMs / 1000.0;
+			DownWireBytes += Timing.AudioWireBytes;
+		}
+
+		const double DecodeSec = Decoder.GetBusySeconds() - DecodeBusyStart;
+		const double WallSec = FPlatformTime::Seconds() - BenchStart;
+
+		Socket->Close();
+		Socket->Pump();
+		Decoder.Shutdown();
+
+		const int32 Done = ReleaseToAudibleMs.Num();
+		const double PerTurn = 1000.0 / FMath::Max(1, Opt.Turns);
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] Realtime E2E (%d turns, %.0f s; mock: first audio %.0f ms, jitter +-%.0f ms, chunk %.0f ms x%.1f, spike %.0f%%; tick %.1f ms, render %d frames @ %d Hz, %s)"),
+			Opt.Turns, WallSec, Opt.Mock.FirstAudioDelayMs, Opt.Mock.JitterMs, Opt.Mock.AudioChunkMs, Opt.Mock.SendSpeed,
+			Opt.Mock.SpikeProbability * 100.f, Opt.GameFrameMs, Opt.RenderFrames, SampleRate, VoiceAudioCodecs::GetWireFormat(Opt.Codec));
+		UE_LOG(LogVoiceBench, Display, TEXT("  latency ms                   p50     p90     p99     max"));
+		LogLatencyRow(TEXT("release -> first byte"), ReleaseToFirstByteMs);
+		LogLatencyRow(TEXT("first byte -> audible"), FirstByteToAudibleMs);
+		LogLatencyRow(TEXT("release -> audible"), ReleaseToAudibleMs);
+		UE_LOG(LogVoiceBench, Display, TEXT("  cpu ms per turn (%.1f s speech up, %.1f s reply down)"), Opt.HoldSec, ReplyAudioSec / FMath::Max(1, Done));
+		UE_LOG(LogVoiceBench, Display, TEXT("    upload encode+send  (game)    %7.3f"), UploadSec * PerTurn);
+		UE_LOG(LogVoiceBench, Display, TEXT("    socket pump+events  (game)    %7.3f"), PumpSec * PerTurn);
+		UE_LOG(LogVoiceBench, Display, TEXT("    event decode        (worker)  %7.3f"), DecodeSec * PerTurn);
+		UE_LOG(LogVoiceBench, Display, TEXT("    jitter render       (audio)   %7.3f"), RenderCpuSec * PerTurn);
+		UE_LOG(LogVoiceBench, Display, TEXT("  wire KB per audio second: up %.1f, down %.1f (json + base64)"),
+			UpWireBytes / 1024.0 / FMath::Max(1e-3, (double)Opt.HoldSec * Opt.Turns), DownWireBytes / 1024.0 / FMath::Max(1e-3, ReplyAudioSec));
+		UE_LOG(LogVoiceBench, Display, TEXT("  underruns %d, server errors %d, incomplete turns %d"), Underruns, Errors, Timeouts);
+	}
+}
+
+namespace VoiceBench
+{
+	// 무전기 FX 체인 (렌더 스레드 비용): 블록 biquad 정확도 + 보이스/베드 한 소스당 CPU
+	void RunRadioFxBenchmark()
+	{
+		constexpr int32 SampleRate = 48000;
+		constexpr int32 BlockFrames = 480;              // 믹서 콜백 하나 (10ms)
+		constexpr int32 Seconds = 10;
+		constexpr int32 NumBlocks = Seconds * SampleRate / BlockFrames;
+
+		TArray<float> Speech;
+		Speech.SetNumUninitialized(Seconds * SampleRate);
+		{
+			FRandomStream Rng(43);
+			for (int32 i = 0; i < Speech.Num(); ++i)
+			{
+				const double T = (double)i / SampleRate;
+				Speech[i] = (float)(0.3 * FMath::Sin(2.0 * PI * 140.0 * T) + 0.15 * FMath::Sin(2.0 * PI * 420.0 * T)
+					+ 0.05 * FMath::Sin(2.0 * PI * 1850.0 * T) + 0.02 * Rng.FRandRange(-1.f, 1.f));
+			}
+		}
+
+		// 블록형 vs 직접형 1 (같은 입력, 블록 단위로 끊어서)
+		double MaxErr = 0.0;
+		{
+			FVoiceBiquad Block;
+			FVoiceBiquad Reference;
+			TArray<float> A = Speech;
+			TArray<float> B = Speech;
+			static const FVoiceBiquad::EType Types[] = { FVoiceBiquad::EType::HighPass, FVoiceBiquad::EType::LowPass };
+			static const float Cutoffs[] = { 300.f, 3000.f };
+			for (int32 t = 0; t < 2; ++t)
+			{
+				Block.Init(Types[t], Cutoffs[t], (float)SampleRate);
+				Reference.Init(Types[t], Cutoffs[t], (float)SampleRate);
+				for (int32 b = 0; b < NumBlocks; ++b)
+				{
+					Block.Process(A.GetData() + b * BlockFrames, BlockFrames);
+					Reference.ProcessReference(B.GetData() + b * BlockFrames, BlockFrames);
+				}
+			}
+			for (int32 i = 0; i < A.Num(); ++i)
+			{
+				MaxErr = FMath::Max(MaxErr, (double)FMath::Abs(A[i] - B[i]));
+			}
+		}
+
+		auto BestOf3 = [](TFunctionRef<void()> Body)
+		{
+			double Best = TNumericLimits<double>::Max();
+			for (int32 Run = 0; Run < 3; ++Run)
+			{
+				const double T0 = FPlatformTime::Seconds();
+				Body();
+				Best = FMath::Min(Best, FPlatformTime::Seconds() - T0);
+			}
+			return Best;
+		};
+
+		TArray<float> Work;
+		Work.SetNumUninitialized(Speech.Num());
+		const int32 Num = Speech.Num();
+
+		FVoiceBiquad Filters[4];
+		auto InitFilters = [&Filters]()
+		{
+			Filters[0].Init(FVoiceBiquad::EType::HighPass, 300.f, (float)SampleRate);
+			Filters[1].Init(FVoiceBiquad::EType::HighPass, 300.f, (float)SampleRate);
+			Filters[2].Init(FVoiceBiquad::EType::LowPass, 3000.f, (float)SampleRate);
+			Filters[3].Init(FVoiceBiquad::EType::LowPass, 3000.f, (float)SampleRate);
+		};
+
+		const double RefBand = BestOf3([&]()
+			{
+				FMemory::Memcpy(Work.GetData(), Speech.GetData(), Num * sizeof(float));
+				InitFilters();
+				for (int32 b = 0; b < NumBlocks; ++b)
+				{
+					for (FVoiceBiquad& F : Filters)
+					{
+						F.ProcessReference(Work.GetData() + b * BlockFrames, BlockFrames);
+					}
+				}
+			});
+		const double SimdBand = BestOf3([&]()
+			{
+				FMemory::Memcpy(Work.GetData(), Speech.GetData(), Num * sizeof(float));
+				InitFilters();
+				for (int32 b = 0; b < NumBlocks; ++b)
+				{
+					for (FVoiceBiquad& F : Filters)
+					{
+						F.Process(Work.GetData() + b * BlockFrames, BlockFrames);
+					}
+				}
+			});
+
+		// 실제 소스 이펙트와 같은 경로 (모노 / 스테레오 소스)
+		const FSourceEffectRadioSettings Settings;
+		FRadioVoiceFx Fx;
+		const double VoiceMono = BestOf3([&]()
+			{
+				FMemory::Memcpy(Work.GetData(), Speech.GetData(), Num * sizeof(float));
+				Fx.Init((float)SampleRate, Settings);
+				for (int32 b = 0; b < NumBlocks; ++b)
+				{
+					Fx.ProcessMono(Work.GetData() + b * BlockFrames, BlockFrames);
+				}
+			});
+
+		TArray<float> Stereo;
+		Stereo.SetNumUninitialized(Num * 2);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Stereo[2 * i] = Stereo[2 * i + 1] = Speech[i];
+		}
+		TArray<float> StereoOut;
+		StereoOut.SetNumUninitialized(Num * 2);
+		const double VoiceStereo = BestOf3([&]()
+			{
+				Fx.Init((float)SampleRate, Settings);
+				for (int32 b = 0; b < NumBlocks; ++b)
+				{
+					const int32 Offset = b * BlockFrames * 2;
+					Fx.ProcessInterleaved(Stereo.GetData() + Offset, StereoOut.GetData() + Offset, BlockFrames, 2);
+				}
+			});
+
+		// 스컬치 베드: 키 잡은 동안 (최악) / 유휴
+		constexpr int32 BedRate = 16000;
+		constexpr int32 BedBlock = BedRate / 100;
+		const int32 BedNum = Seconds * BedRate;
+		TArray<int16> BedPcm;
+		BedPcm.SetNumUninitialized(BedNum);
+		FRadioSquelchBed Bed;
+		Bed.Init((float)BedRate, Settings, -42.f, -20.f, 0.25f);
+
+		Bed.SetKeyed(true);
+		const double BedKeyed = BestOf3([&]()
+			{
+				for (int32 Offset = 0; Offset < BedNum; Offset += BedBlock)
+				{
+					Bed.RenderPcm16(BedPcm.GetData() + Offset, BedBlock);
+				}
+			});
+
+		Bed.SetKeyed(false);
+		Bed.RenderPcm16(BedPcm.GetData(), BedRate);     // 꼬리 소진
+		const double BedIdle = BestOf3([&]()
+			{
+				for (int32 Offset = 0; Offset < BedNum; Offset += BedBlock)
+				{
+					Bed.RenderPcm16(BedPcm.GetData() + Offset, BedBlock);
+				}
+			});
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] Radio FX chain (%d s, %d-frame blocks, block biquad max |err| vs direct form: %.2e)"),
+			Seconds, BlockFrames, MaxErr);
+		UE_LOG(LogVoiceBench, Display, TEXT("  stage                           ns/sample   %% of one core"));
+		auto Row = [](const TCHAR* Label, double Sec, int32 Samples, int32 Rate)
+		{
+			const double NsPerSample = Sec * 1e9 / Samples;
+			UE_LOG(LogVoiceBench, Display, TEXT("  %-30s  %9.2f  %14.3f"), Label, NsPerSample, NsPerSample * Rate * 1e-7);
+		};
+		Row(TEXT("band x4 direct form (48k)"), RefBand, Num, SampleRate);
+		Row(TEXT("band x4 block SIMD (48k)"), SimdBand, Num, SampleRate);
+		Row(TEXT("voice fx mono (48k)"), VoiceMono, Num, SampleRate);
+		Row(TEXT("voice fx stereo (48k frame)"), VoiceStereo, Num, SampleRate);
+		Row(TEXT("squelch bed keyed (16k)"), BedKeyed, BedNum, BedRate);
+		Row(TEXT("squelch bed idle (16k)"), BedIdle, BedNum, BedRate);
+	}
+}
+
+namespace VoiceBench
+{
+	struct FReconnectOptions
+	{
+		float DurationSec = 60.f;
+		float GameFrameMs = 16.7f;
+		float TalkEverySec = 4.f;       // 이 주기로 TalkSec 동안 20ms append (PTT를 누른 채 끊기는 경우 포함)
+		float TalkSec = 2.f;
+		FRealtimeConnectionSettings Link;
+		FMockRealtimeSettings Mock;
+	};
+
+	// 장애를 넣은 목 서버로 FRealtimeConnection을 돌려서 복구 시간 / 잃은 오디오 / 보류 전송을 측정.
+	// 세션 복구는 컴포넌트처럼 session.created -> session.update -> session.updated(MarkSessionReady). 실시간으로 돌아감
+	void RunReconnectBenchmark(const TArray<FString>& Args)
+	{
+		FReconnectOptions Opt;
+		Opt.Mock.DropAfterSec = 6.f;
+		Opt.Mock.ConnectFailureProbability = 0.3f;
+		Opt.Link.KeepaliveIntervalSec = 2.f;
+		Opt.Link.KeepaliveTimeoutSec = 2.f;
+		{
+			const FString Cmd = FString::Join(Args, TEXT(" "));
+			FParse::Value(*Cmd, TEXT("Duration="), Opt.DurationSec);
+			FParse::Value(*Cmd, TEXT("Frame="), Opt.GameFrameMs);
+			FParse::Value(*Cmd, TEXT("TalkEvery="), Opt.TalkEverySec);
+			FParse::Value(*Cmd, TEXT("Talk="), Opt.TalkSec);
+			FParse::Value(*Cmd, TEXT("Drop="), Opt.Mock.DropAfterSec);
+			FParse::Value(*Cmd, TEXT("Stall="), Opt.Mock.StallAfterSec);
+			FParse::Value(*Cmd, TEXT("Fail="), Opt.Mock.ConnectFailureProbability);
+			FParse::Value(*Cmd, TEXT("ConnectDelay="), Opt.Mock.ConnectDelayMs);
+			FParse::Value(*Cmd, TEXT("Seed="), Opt.Mock.RandomSeed);
+			FParse::Value(*Cmd, TEXT("Backoff="), Opt.Link.InitialBackoffSec);
+			FParse::Value(*Cmd, TEXT("MaxBackoff="), Opt.Link.MaxBackoffSec);
+			FParse::Value(*Cmd, TEXT("BackoffJitter="), Opt.Link.BackoffJitter);
+			FParse::Value(*Cmd, TEXT("Keepalive="), Opt.Link.KeepaliveIntervalSec);
+			FParse::Value(*Cmd, TEXT("KeepaliveTimeout="), Opt.Link.KeepaliveTimeoutSec);
+			FParse::Value(*Cmd, TEXT("Hold="), Opt.Link.OutageHoldSec);
+			Opt.DurationSec = FMath::Clamp(Opt.DurationSec, 1.f, 3600.f);
+			Opt.GameFrameMs = FMath::Max(1.f, Opt.GameFrameMs);
+		}
+
+		const double FrameSec = Opt.GameFrameMs / 1000.0;
+		constexpr double MicFrameSec = 0.02;
+
+		// 20ms 24kHz PCM16 append (내용은 무관, 크기만 실제와 같게)
+		TArray<uint8> AppendUtf8;
+		{
+			const int32 Base64Len = 4 * ((Opt.Mock.SampleRate / 50 * (int32)sizeof(int16) + 2) / 3);
+			const FString Json = FString::Printf(TEXT("{\"type\":\"input_audio_buffer.append\",\"audio\":\"%s\"}"), *FString::ChrN(Base64Len, TEXT('A')));
+			const FTCHARToUTF8 Utf8(*Json);
+			AppendUtf8.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		}
+		const FString SessionUpdate = TEXT("{\"type\":\"session.update\",\"session\":{\"type\":\"realtime\",\"instructions\":\"bench\"}}");
+
+		FRealtimeConnection Link;
+		TSharedPtr<FMockRealtimeWebSocket, ESPMode::ThreadSafe> Current;
+		Link.Configure(Opt.Link, [&Opt, &Current]() -> TSharedPtr<IWebSocket>
+			{
+				Current = MakeShared<FMockRealtimeWebSocket, ESPMode::ThreadSafe>(Opt.Mock, false);
+				return Current;
+			});
+
+		// 복구 시간: 링크를 잃은 순간 -> 세션 설정이 다시 적용된 순간
+		double LostSec = 0.0;
+		int32 GaveUp = 0;
+		TArray<double> RecoveryMs;
+		bool bSessionUpdateSent = false;
+
+		Link.OnOpened.BindLambda([&bSessionUpdateSent](bool bReconnect)
+			{
+				bSessionUpdateSent = false;
+			});
+		Link.OnLost.BindLambda([&LostSec, &GaveUp](const FString& Reason, bool bWillRetry)
+			{
+				if (LostSec == 0.0)
+				{
+					LostSec = FPlatformTime::Seconds();
+				}
+				GaveUp += bWillRetry ? 0 : 1;
+			});
+		Link.OnRawMessage.BindLambda([&](const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+			{
+				// 목 서버 메시지는 통째로 옴 (MaxFragmentBytes = 0). type만 보면 됨
+				const FUTF8ToTCHAR Conv(static_cast<const ANSICHAR*>(Data), (int32)Size);
+				const FString Text(Conv.Length(), Conv.Get());
+				if (Text.Contains(TEXT("\"session.created\"")) && !bSessionUpdateSent)
+				{
+					bSessionUpdateSent = true;
+					Link.Send(SessionUpdate);
+				}
+				else if (Text.Contains(TEXT("\"session.updated\"")))
+				{
+					Link.MarkSessionReady();
+					if (LostSec > 0.0)
+					{
+						RecoveryMs.Add((FPlatformTime::Seconds() - LostSec) * 1000.0);
+						LostSec = 0.0;
+					}
+				}
+			});
+
+		int32 FramesSent = 0, FramesHeld = 0, FramesLost = 0;
+		const double StartSec = FPlatformTime::Seconds();
+		const double EndSec = StartSec + Opt.DurationSec;
+		double NextFrame = StartSec;
+		double NextMic = StartSec;
+
+		Link.Open(StartSec);
+
+		while (FPlatformTime::Seconds() < EndSec)
+		{
+			const double Now = FPlatformTime::Seconds();
+
+			if (Now >= NextFrame)
+			{
+				if (Current.IsValid())
+				{
+					Current->Pump();
+				}
+				Link.Tick(Now);
+				NextFrame += FrameSec;
+			}
+
+			if (Now >= NextMic)
+			{
+				const bool bTalking = FMath::Fmod(Now - StartSec, (double)Opt.TalkEverySec) < Opt.TalkSec;
+				if (bTalking)
+				{
+					const bool bRecovering = Link.IsRecovering();
+					if (Link.Send(AppendUtf8.GetData(), AppendUtf8.Num(), true))
+					{
+						++(bRecovering ? FramesHeld : FramesSent);
+					}
+					else
+					{
+						++FramesLost;
+					}
+				}
+				NextMic += MicFrameSec;
+			}
+
+			const double WaitSec = FMath::Min(NextFrame, NextMic) - FPlatformTime::Seconds();
+			if (WaitSec > 0.0)
+			{
+				FPlatformProcess::Sleep((float)WaitSec);
+			}
+		}
+
+		const FRealtimeConnectionStats Stats = Link.GetStats();
+		Link.Close();
+		if (Current.IsValid())
+		{
+			Current->Pump();
+		}
+
+		const int32 Frames = FMath::Max(1, FramesSent + FramesHeld + FramesLost);
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] Realtime reconnect (%.0f s; mock: drop after %.1f s, stall after %.1f s, connect fail %.0f%%; backoff %.2f..%.1f s jitter %.0f%%, keepalive %.1f/%.1f s, hold %.1f s)"),
+			Opt.DurationSec, Opt.Mock.DropAfterSec, Opt.Mock.StallAfterSec, Opt.Mock.ConnectFailureProbability * 100.f,
+			Opt.Link.InitialBackoffSec, Opt.Link.MaxBackoffSec, Opt.Link.BackoffJitter * 100.f,
+			Opt.Link.KeepaliveIntervalSec, Opt.Link.KeepaliveTimeoutSec, Opt.Link.OutageHoldSec);
+		UE_LOG(LogVoiceBench, Display, TEXT("  connects %d, drops %d (dead links %d), failed attempts %d, refreshes %d, probes %d, gave up %d"),
+			Stats.Connects, Stats.Drops, Stats.DeadLinks, Stats.FailedAttempts, Stats.Refreshes, Stats.KeepaliveProbes, GaveUp);
+		UE_LOG(LogVoiceBench, Display, TEXT("  recovery ms                  p50     p90     p99     max   (%d outages)"), RecoveryMs.Num());
+		LogLatencyRow(TEXT("lost -> session restored"), RecoveryMs);
+		UE_LOG(LogVoiceBench, Display, TEXT("  mic frames: sent %d, held across outage %d (%.1f%%), lost %d (%.1f%%); held events flushed %d, expired %d"),
+			FramesSent, FramesHeld, 100.0 * FramesHeld / Frames, FramesLost, 100.0 * FramesLost / Frames, Stats.DeferredSent, Stats.DeferredDropped);
+	}
+}
+
+namespace VoiceBench
+{
+	struct FSttOptions
+	{
+		FString CorpusPath = TEXT("Tests/STT/corpus.tsv");
+		TArray<FString> Models;
+		TArray<int32> Threads;
+		FString Language;
+		int32 CaptureRate = 24000;      // PTT 레코더 OutputSampleRate
+		int32 Repeat = 1;
+		FString NoisePath;              // 비어 있으면 녹음 그대로
+		float SnrDb = 10.f;
+		FString CsvPath;
+	};
+
+	struct FSttUtterance
+	{
+		FString Name;
+		FString Reference;
+		FVoiceUtterancePtr Audio;
+	};
+
+	// 코퍼스 한 줄 = "<wav 경로>\t<정답 문장>" (경로는 목록 파일 기준, # 주석)
+	bool LoadSttCorpus(const FString& ManifestPath, TArray<FString>& OutWavs, TArray<FString>& OutReferences)
+	{
+		const FString FullPath = FPaths::IsRelative(ManifestPath) ? FPaths::Combine(FPaths::ProjectDir(), ManifestPath) : ManifestPath;
+
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *FullPath))
+		{
+			UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] STT corpus not found: %s"), *FullPath);
+			return false;
+		}
+
+		const FString BaseDir = FPaths::GetPath(FullPath);
+		for (const FString& Line : Lines)
+		{
+			FString Wav, Reference;
+			if (Line.IsEmpty() || Line.StartsWith(TEXT("#")) || !Line.Split(TEXT("\t"), &Wav, &Reference))
+				continue;
+
+			Wav.TrimStartAndEndInline();
+			OutWavs.Add(FPaths::IsRelative(Wav) ? FPaths::Combine(BaseDir, Wav) : Wav);
+			OutReferences.Add(Reference.TrimStartAndEnd());
+		}
+		return OutWavs.Num() > 0;
+	}
+
+	// 녹음 -> 캡처 소스(배속) -> downmix -> 폴리페이즈 리샘플: PTT 레코더와 같은 블록 단위 경로
+	bool CaptureThroughPipeline(const FString& WavPath, int32 OutRate, TArray<float>& OutMono, FString& OutError)
+	{
+		FVoiceBufferSourceSettings SourceSettings;
+		SourceSettings.Speed = 100.f;
+		SourceSettings.TailSilenceSec = 0.f;
+
+		const TSharedPtr<FVoiceBufferCaptureSource, ESPMode::ThreadSafe> Source = FVoiceBufferCaptureSource::FromWavFile(WavPath, SourceSettings, OutError);
+		if (!Source.IsValid())
+			return false;
+
+		FVoicePolyphaseResampler Resampler;
+		Resampler.Init(Source->GetExpectedSampleRate(), OutRate);
+
+		TArray<float> Mono, Resampled;
+		OutMono.Reset();
+
+		// 피더 스레드에서 호출됨. Stop이 돌아온 뒤에는 오지 않음
+		FVoiceCaptureCallback OnAudio = [&](const float* In, int32 NumFrames, int32 NumChannels, int32 SampleRate)
+			{
+				Mono.SetNumUninitialized(NumFrames, false);
+				VoiceAudioDSP::DownmixToMono(In, NumFrames, NumChannels, Mono.GetData());
+
+				Resampled.SetNumUninitialized(Resampler.GetMaxOutput(NumFrames), false);
+				const int32 NumOut = Resampler.Process(Mono.GetData(), NumFrames, Resampled.GetData());
+				OutMono.Append(Resampled.GetData(), NumOut);
+			};
+
+		if (!Source->Open(MoveTemp(OnAudio), 1024, OutError) || !Source->Start())
+		{
+			Source->Stop();
+			if (OutError.IsEmpty())
+			{
+				OutError = FString::Printf(TEXT("Failed to start capture source: %s"), *WavPath);
+			}
+			return false;
+		}
+
+		while (!Source->IsFinished())
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+		Source->Stop();
+		return OutMono.Num() > 0;
+	}
+
+	// 발화 전체 평균 전력 기준으로 SNR을 맞춰 소음을 반복해서 섞음 (Offset으로 발화마다 다른 구간)
+	void MixNoise(TArray<float>& Speech, const TArray<float>& Noise, float SnrDb, int32 Offset)
+	{
+		if (Speech.Num() == 0 || Noise.Num() == 0)
+			return;
+
+		double SpeechPower = 0.0, NoisePower = 0.0;
+		for (float S : Speech) { SpeechPower += (double)S * S; }
+		for (float N : Noise) { NoisePower += (double)N * N; }
+		SpeechPower /= Speech.Num();
+		NoisePower /= Noise.Num();
+		if (NoisePower <= 0.0)
+			return;
+
+		const float Gain = (float)FMath::Sqrt(SpeechPower / (NoisePower * FMath::Pow(10.0, SnrDb / 10.0)));
+		for (int32 i = 0; i < Speech.Num(); ++i)
+		{
+			Speech[i] += Gain * Noise[(Offset + i) % Noise.Num()];
+		}
+	}
+
+	// 소문자 + 문장부호 제거 + 공백 정리
+	FString NormalizeTranscript(const FString& Text)
+	{
+		FString Out;
+		Out.Reserve(Text.Len());
+		for (TCHAR C : Text.ToLower())
+		{
+			Out.AppendChar((FChar::IsPunct(C) || FChar::IsWhitespace(C)) ? TEXT(' ') : C);
+		}
+
+		TArray<FString> Words;
+		Out.ParseIntoArrayWS(Words);
+		return FString::Join(Words, TEXT(" "));
+	}
+
+	template<typename T>
+	int32 EditDistance(const TArray<T>& Ref, const TArray<T>& Hyp)
+	{
+		TArray<int32> Prev, Cur;
+		Prev.SetNumUninitialized(Hyp.Num() + 1);
+		Cur.SetNumUninitialized(Hyp.Num() + 1);
+		for (int32 j = 0; j <= Hyp.Num(); ++j)
+		{
+			Prev[j] = j;
+		}
+
+		for (int32 i = 1; i <= Ref.Num(); ++i)
+		{
+			Cur[0] = i;
+			for (int32 j = 1; j <= Hyp.Num(); ++j)
+			{
+				const int32 Sub = Prev[j - 1] + (Ref[i - 1] == Hyp[j - 1] ? 0 : 1);
+				Cur[j] = FMath::Min3(Sub, Prev[j] + 1, Cur[j - 1] + 1);
+			}
+			Swap(Prev, Cur);
+		}
+		return Prev[Hyp.Num()];
+	}
+
+	// 한국어는 띄어쓰기가 흔들리므로 단어(WER)와 글자(CER, 공백 제외) 둘 다 셈
+	void ScoreTranscript(const FString& Reference, const FString& Hypothesis, int32& OutWordErrors, int32& OutWords, int32& OutCharErrors, int32& OutChars)
+	{
+		const FString Ref = NormalizeTranscript(Reference);
+		const FString Hyp = NormalizeTranscript(Hypothesis);
+
+		TArray<FString> RefWords, HypWords;
+		Ref.ParseIntoArrayWS(RefWords);
+		Hyp.ParseIntoArrayWS(HypWords);
+		OutWordErrors = EditDistance(RefWords, HypWords);
+		OutWords = RefWords.Num();
+
+		TArray<TCHAR> RefChars, HypChars;
+		for (TCHAR C : Ref) { if (C != TEXT(' ')) RefChars.Add(C); }
+		for (TCHAR C : Hyp) { if (C != TEXT(' ')) HypChars.Add(C); }
+		OutCharErrors = EditDistance(RefChars, HypChars);
+		OutChars = RefChars.Num();
+	}
+
+	// 프로세스 물리 메모리 (엔진 시작 전 대비 증가분의 최대치를 봄)
+	double UsedPhysicalMB()
+	{
+		return (double)FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+
+	// 요청 하나를 보내고 끝날 때까지 기다리며 메모리를 샘플링. Wall = 제출 -> 결과 (큐 + 변환 + 추론)
+	bool TranscribeBlocking(FWhisperSpeechEngine& Engine, const FSttUtterance& Utt, const FWhisperRequestOptions& Options,
+		FWhisperSpeechResult& OutResult, double& OutWallMs, double& InOutPeakMB)
+	{
+		constexpr double RequestTimeoutSec = 120.0;
+
+		FEvent* Done = FPlatformProcess::GetSynchEventFromPool(false);
+		const double T0 = FPlatformTime::Seconds();
+
+		const uint32 Id = Engine.SubmitAnyThread(Utt.Audio, Options, [&OutResult, Done](const FWhisperSpeechResult& Result)
+			{
+				OutResult = Result;
+				Done->Trigger();
+			});
+
+		bool bCancelled = false;
+		while (!Done->Wait(20))
+		{
+			InOutPeakMB = FMath::Max(InOutPeakMB, UsedPhysicalMB());
+			if (!bCancelled && FPlatformTime::Seconds() - T0 > RequestTimeoutSec)
+			{
+				// 취소해도 콜백은 반드시 옴: 그때까지 기다려야 OutResult/Done이 안전
+				Engine.Cancel(Id);
+				bCancelled = true;
+			}
+		}
+		OutWallMs = (FPlatformTime::Seconds() - T0) * 1000.0;
+		InOutPeakMB = FMath::Max(InOutPeakMB, UsedPhysicalMB());
+
+		FPlatformProcess::ReturnSynchEventToPool(Done);
+		return OutResult.bSuccess;
+	}
+
+	// 라벨된 무전 녹음 코퍼스를 캡처/리샘플/STT 경로로 돌려서 모델 x 스레드 수마다
+	// WER/CER, RTF, 지연 백분위, 최대 메모리를 비교. 요청은 하나씩 (경합 없는 지연). 끝날 때까지 게임 스레드를 붙잡음
+	void RunSttBenchmark(const TArray<FString>& Args)
+	{
+		const UWhisperSTTSubsystem* Defaults = GetDefault<UWhisperSTTSubsystem>();
+
+		if (!FWhisperSpeechEngine::IsCompiledIn())
+		{
+			// 프로세스 폴백도 측정은 되지만 지연에 프로세스 시작 + 모델 로드가 매번 포함됨
+			UE_LOG(LogVoiceBench, Warning, TEXT("[VoiceBench] Built without whisper.cpp: measuring whisper-cli (%s); latency includes per-request model load."),
+				*UWhisperSTTSubsystem::ResolvePath(Defaults->CliPath));
+		}
+
+		FSttOptions Opt;
+		Opt.Language = Defaults->DefaultLanguage;
+		{
+			const FString Cmd = FString::Join(Args, TEXT(" "));
+			FParse::Value(*Cmd, TEXT("Corpus="), Opt.CorpusPath);
+			FParse::Value(*Cmd, TEXT("Lang="), Opt.Language);
+			FParse::Value(*Cmd, TEXT("Rate="), Opt.CaptureRate);
+			FParse::Value(*Cmd, TEXT("Repeat="), Opt.Repeat);
+			FParse::Value(*Cmd, TEXT("Noise="), Opt.NoisePath);
+			FParse::Value(*Cmd, TEXT("Snr="), Opt.SnrDb);
+			FParse::Value(*Cmd, TEXT("Csv="), Opt.CsvPath);
+
+			// Models=a.bin,b.bin Threads=1,2,4
+			FString List;
+			if (FParse::Value(*Cmd, TEXT("Models="), List, false))
+			{
+				List.ParseIntoArray(Opt.Models, TEXT(","));
+			}
+			if (FParse::Value(*Cmd, TEXT("Threads="), List, false))
+			{
+				TArray<FString> Items;
+				List.ParseIntoArray(Items, TEXT(","));
+				for (const FString& Item : Items)
+				{
+					Opt.Threads.Add(FMath::Clamp(FCString::Atoi(*Item), 0, 32));
+				}
+			}
+			if (Opt.Models.Num() == 0)
+			{
+				Opt.Models.Add(Defaults->ModelPath);
+			}
+			if (Opt.Threads.Num() == 0)
+			{
+				Opt.Threads.Add(Defaults->ThreadsPerWorker);
+			}
+			Opt.CaptureRate = FMath::Clamp(Opt.CaptureRate, 8000, 48000);
+			Opt.Repeat = FMath::Clamp(Opt.Repeat, 1, 100);
+		}
+
+		// ---- 코퍼스: 캡처 경로는 모델과 무관하니 한 번만 ----
+		TArray<FString> Wavs, References;
+		if (!LoadSttCorpus(Opt.CorpusPath, Wavs, References))
+			return;
+
+		TArray<float> Noise;
+		if (!Opt.NoisePath.IsEmpty())
+		{
+			FString Error;
+			if (!CaptureThroughPipeline(Opt.NoisePath, Opt.CaptureRate, Noise, Error))
+			{
+				UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] %s"), *Error);
+				return;
+			}
+		}
+
+		TArray<FSttUtterance> Corpus;
+		double CorpusSec = 0.0;
+		for (int32 i = 0; i < Wavs.Num(); ++i)
+		{
+			TArray<float> Mono;
+			FString Error;
+			if (!CaptureThroughPipeline(Wavs[i], Opt.CaptureRate, Mono, Error))
+			{
+				UE_LOG(LogVoiceBench, Warning, TEXT("[VoiceBench] Skipping %s: %s"), *Wavs[i], *Error);
+				continue;
+			}
+			MixNoise(Mono, Noise, Opt.SnrDb, (int32)(((int64)i * 7919) % FMath::Max(1, Noise.Num())));
+
+			TArray<uint8> Pcm = FVoiceUtterancePool::Get().Acquire(Mono.Num() * (int32)sizeof(int16));
+			Pcm.SetNumUninitialized(Mono.Num() * (int32)sizeof(int16));
+			VoiceAudioDSP::FloatToPcm16(Mono.GetData(), reinterpret_cast<int16*>(Pcm.GetData()), Mono.Num());
+
+			FSttUtterance& Utt = Corpus.AddDefaulted_GetRef();
+			Utt.Name = FPaths::GetBaseFilename(Wavs[i]);
+			Utt.Reference = References[i];
+			Utt.Audio = FVoiceUtterancePool::Get().Wrap(MoveTemp(Pcm), Opt.CaptureRate, 1);
+			CorpusSec += Utt.Audio->GetDurationSec();
+		}
+		if (Corpus.Num() == 0)
+		{
+			UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] STT corpus has no usable recordings."));
+			return;
+		}
+
+		UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] STT: %d utterances (%.1f s) from %s, captured at %d Hz%s, lang=%s, x%d"),
+			Corpus.Num(), CorpusSec, *Opt.CorpusPath, Opt.CaptureRate,
+			Noise.Num() > 0 ? *FString::Printf(TEXT(" + %s @ %.0f dB SNR"), *FPaths::GetCleanFilename(Opt.NoisePath), Opt.SnrDb) : TEXT(""),
+			*Opt.Language, Opt.Repeat);
+
+		TArray<FString> CsvRows;
+		CsvRows.Add(TEXT("model,threads,wer,cer,sentence_acc,rtf,p50_ms,p90_ms,p99_ms,max_ms,load_s,peak_mb,failed"));
+
+		for (const FString& Model : Opt.Models)
+		{
+			for (const int32 Threads : Opt.Threads)
+			{
+				FWhisperSpeechEngine::FConfig Config;
+				Config.ModelPath = UWhisperSTTSubsystem::ResolvePath(Model);
+				Config.CliPath = UWhisperSTTSubsystem::ResolvePath(Defaults->CliPath);
+				Config.Language = Opt.Language;
+				Config.NumWorkers = 1;
+				Config.ThreadsPerWorker = Threads;
+
+				const double BaselineMB = UsedPhysicalMB();
+				double PeakMB = BaselineMB;
+
+				FWhisperSpeechEngine Engine;
+				if (!Engine.Start(Config))
+					continue;
+
+				while (!Engine.IsModelLoaded() && !Engine.HasLoadFailed())
+				{
+					PeakMB = FMath::Max(PeakMB, UsedPhysicalMB());
+					FPlatformProcess::Sleep(0.02f);
+				}
+				if (Engine.HasLoadFailed())
+				{
+					UE_LOG(LogVoiceBench, Error, TEXT("[VoiceBench] Model failed to load: %s"), *Config.ModelPath);
+					continue;
+				}
+
+				FWhisperRequestOptions Options;
+				Options.Language = Opt.Language;
+
+				// 첫 추론은 연산 버퍼 할당이 섞이므로 버림
+				{
+					FWhisperSpeechResult Warmup;
+					double WarmupMs = 0.0;
+					TranscribeBlocking(Engine, Corpus[0], Options, Warmup, WarmupMs, PeakMB);
+				}
+
+				TArray<double> WallMs;
+				double AudioSec = 0.0, DecodeSec = 0.0;
+				int32 WordErrors = 0, Words = 0, CharErrors = 0, Chars = 0, Exact = 0, Failed = 0;
+
+				for (int32 Pass = 0; Pass < Opt.Repeat; ++Pass)
+				{
+					for (const FSttUtterance& Utt : Corpus)
+					{
+						FWhisperSpeechResult Result;
+						double Ms = 0.0;
+						if (!TranscribeBlocking(Engine, Utt, Options, Result, Ms, PeakMB))
+						{
+							UE_LOG(LogVoiceBench, Warning, TEXT("  %s: %s"), *Utt.Name, *Result.Error);
+							++Failed;
+							continue;
+						}
+
+						WallMs.Add(Ms);
+						AudioSec += Result.AudioSec;
+						DecodeSec += Result.DecodeSec;
+
+						// 정답/오답은 첫 회만 (반복은 지연 표본용, greedy라 결과가 같음)
+						if (Pass > 0)
+							continue;
+
+						int32 WE = 0, W = 0, CE = 0, C = 0;
+						ScoreTranscript(Utt.Reference, Result.Text, WE, W, CE, C);
+						WordErrors += WE; Words += W; CharErrors += CE; Chars += C;
+						Exact += (WE == 0) ? 1 : 0;
+
+						if (WE > 0)
+						{
+							UE_LOG(LogVoiceBench, Verbose, TEXT("  %s: ref=\"%s\" hyp=\"%s\" (%d/%d words)"), *Utt.Name, *Utt.Reference, *Result.Text, WE, W);
+						}
+					}
+				}
+
+				const double LoadSec = Engine.GetModelLoadSec();
+				Engine.Shutdown();
+
+				const double Wer = 100.0 * WordErrors / FMath::Max(1, Words);
+				const double Cer = 100.0 * CharErrors / FMath::Max(1, Chars);
+				const double SentenceAcc = 100.0 * Exact / Corpus.Num();
+				const double Rtf = AudioSec > 0.0 ? DecodeSec / AudioSec : 0.0;
+				const FString ModelName = FPaths::GetBaseFilename(Config.ModelPath);
+
+				UE_LOG(LogVoiceBench, Display, TEXT("  %s, threads %s: WER %.1f%%, CER %.1f%%, exact %.0f%%, RTF %.3f, load %.2f s, peak +%.0f MB%s"),
+					*ModelName, Threads > 0 ? *FString::FromInt(Threads) : TEXT("auto"), Wer, Cer, SentenceAcc, Rtf, LoadSec, PeakMB - BaselineMB,
+					Failed > 0 ? *FString::Printf(TEXT(", %d FAILED"), Failed) : TEXT(""));
+				UE_LOG(LogVoiceBench, Display, TEXT("  latency ms                   p50     p90     p99     max"));
+				LogLatencyRow(TEXT("submit -> text"), WallMs);
+
+				CsvRows.Add(FString::Printf(TEXT("%s,%d,%.2f,%.2f,%.1f,%.4f,%.1f,%.1f,%.1f,%.1f,%.2f,%.0f,%d"),
+					*ModelName, Threads, Wer, Cer, SentenceAcc, Rtf,
+					PercentileOf(WallMs, 0.5), PercentileOf(WallMs, 0.9), PercentileOf(WallMs, 0.99), PercentileOf(WallMs, 1.0),
+					LoadSec, PeakMB - BaselineMB, Failed));
+			}
+		}
+
+		if (!Opt.CsvPath.IsEmpty())
+		{
+			const FString CsvFull = FPaths::IsRelative(Opt.CsvPath) ? FPaths::Combine(FPaths::ProjectSavedDir(), Opt.CsvPath) : Opt.CsvPath;
+			if (FFileHelper::SaveStringArrayToFile(CsvRows, *CsvFull))
+			{
+				UE_LOG(LogVoiceBench, Display, TEXT("[VoiceBench] STT results written to %s"), *CsvFull);
+			}
+		}
+	}
+}
+
+static FAutoConsoleCommand GVoiceBenchResamplerCmd(
+	TEXT("voice.BenchResampler"),
+	TEXT("Offline quality/CPU benchmark of the PTT capture resampler (polyphase vs. legacy pick/linear)."),
+	FConsoleCommandDelegate::CreateStatic(&VoiceBench::RunResamplerBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchAppendEncoderCmd(
+	TEXT("voice.BenchAppendEncoder"),
+	TEXT("CPU/allocation benchmark of input_audio_buffer.append building (FJsonObject/FString path vs. reused UTF-8 encoder)."),
+	FConsoleCommandDelegate::CreateStatic(&VoiceBench::RunAppendEncoderBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchVadCmd(
+	TEXT("voice.BenchVAD"),
+	TEXT("Accuracy/CPU benchmark of the PTT voice activity detector on a synthetic transmission (room noise, breathing, voiced speech)."),
+	FConsoleCommandDelegate::CreateStatic(&VoiceBench::RunVadBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchRealtimeE2ECmd(
+	TEXT("voice.BenchRealtimeE2E"),
+	TEXT("End-to-end latency/CPU of PTT release -> first audio byte -> first audible sample against the local mock Realtime server. ")
+	TEXT("Args: Turns= Hold= Frame= Render= FirstAudio= Jitter= Chunk= Speed= Spike= Reply= Wav= Seed= Codec=pcm|pcmu|pcma"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&VoiceBench::RunRealtimeE2EBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchG711Cmd(
+	TEXT("voice.BenchG711"),
+	TEXT("Correctness/CPU of the vectorized G.711 kernels against the reference coder, and wire size/CPU of each Realtime transport codec."),
+	FConsoleCommandDelegate::CreateStatic(&VoiceBench::RunG711Benchmark));
+
+static FAutoConsoleCommand GVoiceBenchRadioFxCmd(
+	TEXT("voice.BenchRadioFx"),
+	TEXT("Accuracy of the block biquad against the direct form and render-thread CPU per source of the radio voice FX chain and squelch bed."),
+	FConsoleCommandDelegate::CreateStatic(&VoiceBench::RunRadioFxBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchReconnectCmd(
+	TEXT("voice.BenchReconnect"),
+	TEXT("Recovery time, lost/held mic audio and reconnect counts of the Realtime connection manager against a faulty local mock server. ")
+	TEXT("Args: Duration= Frame= TalkEvery= Talk= Drop= Stall= Fail= ConnectDelay= Seed= Backoff= MaxBackoff= BackoffJitter= Keepalive= KeepaliveTimeout= Hold="),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&VoiceBench::RunReconnectBenchmark));
+
+static FAutoConsoleCommand GVoiceBenchSttCmd(
+	TEXT("voice.BenchSTT"),
+	TEXT("WER/CER, real-time factor, latency percentiles and peak memory of the whisper.cpp STT path per model and thread count on a labelled corpus ")
+	TEXT("(TSV: <wav>\t<reference>), fed through the PTT capture/resample chain. Args: Corpus= Models=a.bin,b.bin Threads=1,2,4 Lang= Rate= Repeat= Noise= Snr= Csv="),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&VoiceBench::RunSttBenchmark));
+
+#endif // !UE_BUILD_SHIPPING
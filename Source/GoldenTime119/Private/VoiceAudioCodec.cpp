@@ -0,0 +1,223 @@
+// ============================ VoiceAudioCodec.cpp ============================
+#include "VoiceAudioCodec.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceCodec, Log, All);
+
+namespace
+{
+	constexpr int32 G711SampleRate = 8000;
+
+	class FPcm16Codec final : public IVoiceAudioCodec
+	{
+	public:
+		virtual ERealtimeAudioCodec GetId() const override { return ERealtimeAudioCodec::Pcm16; }
+		virtual const TCHAR* GetWireFormat() const override { return TEXT("audio/pcm"); }
+		virtual int32 GetWireSampleRate() const override { return 0; }
+		virtual int32 GetMaxEncodedBytes(int32 NumSamples) const override { return NumSamples * (int32)sizeof(int16); }
+		virtual int32 GetMaxDecodedSamples(int32 NumBytes) const override { return NumBytes / (int32)sizeof(int16); }
+
+		virtual int32 Encode(const int16* In, int32 NumSamples, uint8* Out) const override
+		{
+			FMemory::Memcpy(Out, In, NumSamples * sizeof(int16));
+			return NumSamples * (int32)sizeof(int16);
+		}
+
+		virtual int32 Decode(const uint8* In, int32 NumBytes, int16* Out) const override
+		{
+			const int32 NumSamples = NumBytes / (int32)sizeof(int16);
+			FMemory::Memcpy(Out, In, NumSamples * sizeof(int16));
+			return NumSamples;
+		}
+	};
+
+	class FG711UlawCodec final : public IVoiceAudioCodec
+	{
+	public:
+		virtual ERealtimeAudioCodec GetId() const override { return ERealtimeAudioCodec::G711Ulaw; }
+		virtual const TCHAR* GetWireFormat() const override { return TEXT("audio/pcmu"); }
+		virtual int32 GetWireSampleRate() const override { return G711SampleRate; }
+		virtual int32 GetMaxEncodedBytes(int32 NumSamples) const override { return NumSamples; }
+		virtual int32 GetMaxDecodedSamples(int32 NumBytes) const override { return NumBytes; }
+
+		virtual int32 Encode(const int16* In, int32 NumSamples, uint8* Out) const override
+		{
+			VoiceAudioDSP::EncodeMuLaw(In, Out, NumSamples);
+			return NumSamples;
+		}
+
+		virtual int32 Decode(const uint8* In, int32 NumBytes, int16* Out) const override
+		{
+			VoiceAudioDSP::DecodeMuLaw(In, Out, NumBytes);
+			return NumBytes;
+		}
+	};
+
+	class FG711AlawCodec final : public IVoiceAudioCodec
+	{
+	public:
+		virtual ERealtimeAudioCodec GetId() const override { return ERealtimeAudioCodec::G711Alaw; }
+		virtual const TCHAR* GetWireFormat() const override { return TEXT("audio/pcma"); }
+		virtual int32 GetWireSampleRate() const override { return G711SampleRate; }
+		virtual int32 GetMaxEncodedBytes(int32 NumSamples) const override { return NumSamples; }
+		virtual int32 GetMaxDecodedSamples(int32 NumBytes) const override { return NumBytes; }
+
+		virtual int32 Encode(const int16* In, int32 NumSamples, uint8* Out) const override
+		{
+			VoiceAudioDSP::EncodeALaw(In, Out, NumSamples);
+			return NumSamples;
+		}
+
+		virtual int32 Decode(const uint8* In, int32 NumBytes, int16* Out) const override
+		{
+			VoiceAudioDSP::DecodeALaw(In, Out, NumBytes);
+			return NumBytes;
+		}
+	};
+
+	const FPcm16Codec Pcm16Codec;
+	const FG711UlawCodec UlawCodec;
+	const FG711AlawCodec AlawCodec;
+
+	const IVoiceAudioCodec* const AllCodecs[] = { &Pcm16Codec, &UlawCodec, &AlawCodec };
+}
+
+// ===== Registry =====
+
+const IVoiceAudioCodec& VoiceAudioCodecs::Get(ERealtimeAudioCodec Id)
+{
+	for (const IVoiceAudioCodec* Codec : AllCodecs)
+	{
+		if (Codec->GetId() == Id)
+		{
+			return *Codec;
+		}
+	}
+	return Pcm16Codec;
+}
+
+const IVoiceAudioCodec* VoiceAudioCodecs::FindByWireFormat(const FString& WireFormat)
+{
+	for (const IVoiceAudioCodec* Codec : AllCodecs)
+	{
+		if (WireFormat.Equals(Codec->GetWireFormat(), ESearchCase::IgnoreCase))
+		{
+			return Codec;
+		}
+	}
+	return nullptr;
+}
+
+const TCHAR* VoiceAudioCodecs::GetWireFormat(ERealtimeAudioCodec Id)
+{
+	return Get(Id).GetWireFormat();
+}
+
+// ===== Encoder =====
+
+void FVoiceCodecEncoder::Init(ERealtimeAudioCodec InCodec, int32 InSampleRate)
+{
+	Codec = &VoiceAudioCodecs::Get(InCodec);
+	InRate = FMath::Max(1, InSampleRate);
+	WireRate = (Codec->GetWireSampleRate() > 0) ? Codec->GetWireSampleRate() : InRate;
+	bPassthrough = (Codec->GetId() == ERealtimeAudioCodec::Pcm16) && (WireRate == InRate);
+
+	if (WireRate != InRate)
+	{
+		Resampler.Init(InRate, WireRate);
+	}
+
+	UE_LOG(LogVoiceCodec, Log, TEXT("[Codec] Encoder %s %d Hz -> %d Hz"), Codec->GetWireFormat(), InRate, WireRate);
+}
+
+void FVoiceCodecEncoder::Reset()
+{
+	if (WireRate != InRate)
+	{
+		Resampler.Reset();
+	}
+}
+
+int32 FVoiceCodecEncoder::Encode(const int16* In, int32 NumSamples, TArray<uint8>& Out)
+{
+	if (!In || NumSamples <= 0)
+		return 0;
+
+	const int16* Wire = In;
+	int32 NumWire = NumSamples;
+
+	if (WireRate != InRate)
+	{
+		FloatIn.SetNumUninitialized(NumSamples, false);
+		FloatOut.SetNumUninitialized(Resampler.GetMaxOutput(NumSamples), false);
+		WirePcm.SetNumUninitialized(FloatOut.Num(), false);
+
+		VoiceAudioDSP::Pcm16ToFloat(In, FloatIn.GetData(), NumSamples);
+		NumWire = Resampler.Process(FloatIn.GetData(), NumSamples, FloatOut.GetData());
+		VoiceAudioDSP::FloatToPcm16(FloatOut.GetData(), WirePcm.GetData(), NumWire);
+		Wire = WirePcm.GetData();
+	}
+
+	const int32 Offset = Out.Num();
+	Out.SetNumUninitialized(Offset + Codec->GetMaxEncodedBytes(NumWire), false);
+	const int32 Written = Codec->Encode(Wire, NumWire, Out.GetData() + Offset);
+	Out.SetNum(Offset + Written, false);
+	return Written;
+}
+
+// ===== Decoder =====
+
+void FVoiceCodecDecoder::Init(ERealtimeAudioCodec InCodec, int32 InOutSampleRate)
+{
+	Codec = &VoiceAudioCodecs::Get(InCodec);
+	OutRate = FMath::Max(1, InOutSampleRate);
+
+	WireRate = (Codec->GetWireSampleRate() > 0) ? Codec->GetWireSampleRate() : OutRate;
+	bPassthrough = (Codec->GetId() == ERealtimeAudioCodec::Pcm16) && (WireRate == OutRate);
+
+	if (WireRate != OutRate)
+	{
+		Resampler.Init(WireRate, OutRate);
+	}
+
+	UE_LOG(LogVoiceCodec, Log, TEXT("[Codec] Decoder %s %d Hz -> %d Hz"), Codec->GetWireFormat(), WireRate, OutRate);
+}
+
+void FVoiceCodecDecoder::Reset()
+{
+	if (WireRate != OutRate)
+	{
+		Resampler.Reset();
+	}
+}
+
+int32 FVoiceCodecDecoder::Decode(const uint8* In, int32 NumBytes, TArray<uint8>& Out)
+{
+	Out.Reset();
+	if (!In || NumBytes <= 0)
+		return 0;
+
+	if (bPassthrough)
+	{
+		Out.Append(In, NumBytes - (NumBytes % (int32)sizeof(int16)));
+		return Out.Num();
+	}
+
+	WirePcm.SetNumUninitialized(Codec->GetMaxDecodedSamples(NumBytes), false);
+	const int32 NumWire = Codec->Decode(In, NumBytes, WirePcm.GetData());
+
+	if (WireRate == OutRate)
+	{
+		Out.Append(reinterpret_cast<const uint8*>(WirePcm.GetData()), NumWire * (int32)sizeof(int16));
+		return Out.Num();
+	}
+
+	FloatIn.SetNumUninitialized(NumWire, false);
+	FloatOut.SetNumUninitialized(Resampler.GetMaxOutput(NumWire), false);
+
+	VoiceAudioDSP::Pcm16ToFloat(WirePcm.GetData(), FloatIn.GetData(), NumWire);
+	const int32 NumOut = Resampler.Process(FloatIn.GetData(), NumWire, FloatOut.GetData());
+
+	Out.SetNumUninitialized(NumOut * (int32)sizeof(int16), false);
+	VoiceAudioDSP::FloatToPcm16(FloatOut.GetData(), reinterpret_cast<int16*>(Out.GetData()), NumOut);
+	return Out.Num();
+}
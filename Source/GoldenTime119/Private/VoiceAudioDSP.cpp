@@ -0,0 +1,1109 @@
+// ============================ VoiceAudioDSP.cpp ============================
+#include "VoiceAudioDSP.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+	#define VOICE_DSP_SSE2 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+	#include <arm_neon.h>
+	#define VOICE_DSP_NEON 1
+#endif
+
+#ifndef VOICE_DSP_SSE2
+	#define VOICE_DSP_SSE2 0
+#endif
+#ifndef VOICE_DSP_NEON
+	#define VOICE_DSP_NEON 0
+#endif
+
+// ===== Downmix / PCM16 =====
+
+void VoiceAudioDSP::DownmixToMono(const float* InInterleaved, int32 NumFrames, int32 NumChannels, float* OutMono)
+{
+	if (!InInterleaved || !OutMono || NumFrames <= 0 || NumChannels <= 0)
+		return;
+
+	if (NumChannels == 1)
+	{
+		FMemory::Memcpy(OutMono, InInterleaved, NumFrames * sizeof(float));
+		return;
+	}
+
+	if (NumChannels == 2)
+	{
+		for (int32 f = 0; f < NumFrames; ++f)
+		{
+			OutMono[f] = 0.5f * (InInterleaved[2 * f] + InInterleaved[2 * f + 1]);
+		}
+		return;
+	}
+
+	const float InvChannels = 1.f / (float)NumChannels;
+	for (int32 f = 0; f < NumFrames; ++f)
+	{
+		const float* Frame = InInterleaved + f * NumChannels;
+		float Acc = 0.f;
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			Acc += Frame[c];
+		}
+		OutMono[f] = Acc * InvChannels;
+	}
+}
+
+void VoiceAudioDSP::FloatToPcm16(const float* In, int16* Out, int32 Num)
+{
+	int32 i = 0;
+
+#if VOICE_DSP_SSE2
+	{
+		const __m128 Lo = _mm_set1_ps(-1.f);
+		const __m128 Hi = _mm_set1_ps(1.f);
+		const __m128 Scale = _mm_set1_ps(32767.f);
+
+		for (; i + 8 <= Num; i += 8)
+		{
+			// clamp 먼저: cvtps는 범위 밖 값을 INT_MIN으로 만들기 때문
+			const __m128 A = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(In + i), Lo), Hi), Scale);
+			const __m128 B = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(In + i + 4), Lo), Hi), Scale);
+			const __m128i Packed = _mm_packs_epi32(_mm_cvtps_epi32(A), _mm_cvtps_epi32(B));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+		}
+	}
+#elif VOICE_DSP_NEON
+	{
+		const float32x4_t Lo = vdupq_n_f32(-1.f);
+		const float32x4_t Hi = vdupq_n_f32(1.f);
+		const float32x4_t Scale = vdupq_n_f32(32767.f);
+
+		for (; i + 8 <= Num; i += 8)
+		{
+			const float32x4_t A = vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(In + i), Lo), Hi), Scale);
+			const float32x4_t B = vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(In + i + 4), Lo), Hi), Scale);
+			vst1q_s16(Out + i, vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(A)), vqmovn_s32(vcvtnq_s32_f32(B))));
+		}
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		const float S = FMath::Clamp(In[i], -1.0f, 1.0f);
+		Out[i] = (int16)FMath::Clamp(FMath::RoundToInt(S * 32767.0f), -32768, 32767);
+	}
+}
+
+void VoiceAudioDSP::Pcm16ToFloat(const int16* In, float* Out, int32 Num)
+{
+	constexpr float Scale = 1.f / 32768.f;
+	int32 i = 0;
+
+#if VOICE_DSP_SSE2
+	{
+		const __m128 VScale = _mm_set1_ps(Scale);
+		for (; i + 8 <= Num; i += 8)
+		{
+			const __m128i X = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + i));
+			// 부호 확장: 상위 16비트에 놓고 산술 시프트
+			const __m128i Lo = _mm_srai_epi32(_mm_unpacklo_epi16(X, X), 16);
+			const __m128i Hi = _mm_srai_epi32(_mm_unpackhi_epi16(X, X), 16);
+			_mm_storeu_ps(Out + i, _mm_mul_ps(_mm_cvtepi32_ps(Lo), VScale));
+			_mm_storeu_ps(Out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(Hi), VScale));
+		}
+	}
+#elif VOICE_DSP_NEON
+	{
+		for (; i + 8 <= Num; i += 8)
+		{
+			const int16x8_t X = vld1q_s16(In + i);
+			vst1q_f32(Out + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(X))), Scale));
+			vst1q_f32(Out + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(X))), Scale));
+		}
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		Out[i] = (float)In[i] * Scale;
+	}
+}
+
+// ===== G.711 =====
+
+namespace
+{
+	// 14비트 크기 + 0x21 바이어스. 8158에서 자르면 최상위 세그먼트가 넘치지 않음 (8159는 같은 코드)
+	constexpr int32 MuLawBias = 0x84;
+	constexpr int32 MuLawBias14 = 0x21;
+	constexpr int32 MuLawClip14 = 8158;
+	constexpr int32 ALawMaxMagnitude = 0xFFF;
+
+	FORCEINLINE uint8 EncodeMuLawSample(int32 X)
+	{
+		const int32 Pcm = X >> 2;
+		const int32 Sign = (Pcm < 0) ? 0x80 : 0;
+		const int32 Mag = FMath::Min(Sign ? -Pcm : Pcm, MuLawClip14) + MuLawBias14;
+		const int32 Exp = (int32)FMath::FloorLog2((uint32)Mag) - 5;
+		const int32 Mant = (Mag >> (Exp + 1)) & 0x0F;
+		return (uint8)~(Sign | (Exp << 4) | Mant);
+	}
+
+	FORCEINLINE int16 DecodeMuLawSample(uint8 Code)
+	{
+		const int32 U = (uint8)~Code;
+		const int32 T = ((((U & 0x0F) << 3) + MuLawBias) << ((U >> 4) & 0x07)) - MuLawBias;
+		return (int16)((U & 0x80) ? -T : T);
+	}
+
+	FORCEINLINE uint8 EncodeALawSample(int32 X)
+	{
+		int32 Pcm = X >> 3;
+		int32 Mask = 0xD5;
+		if (Pcm < 0)
+		{
+			Mask = 0x55;
+			Pcm = -Pcm - 1;
+		}
+		Pcm = FMath::Min(Pcm, ALawMaxMagnitude);
+
+		int32 Code;
+		if (Pcm < 32)
+		{
+			Code = (Pcm >> 1) & 0x0F;
+		}
+		else
+		{
+			const int32 Seg = (int32)FMath::FloorLog2((uint32)Pcm) - 4;
+			Code = (Seg << 4) | ((Pcm >> Seg) & 0x0F);
+		}
+		return (uint8)(Code ^ Mask);
+	}
+
+	FORCEINLINE int16 DecodeALawSample(uint8 Code)
+	{
+		const int32 A = Code ^ 0x55;
+		const int32 Seg = (A >> 4) & 0x07;
+		int32 T = ((A & 0x0F) << 4);
+		T = (Seg == 0) ? T + 8 : (T + 0x108) << (Seg - 1);
+		return (int16)((A & 0x80) ? T : -T);
+	}
+
+#if VOICE_DSP_SSE2
+	// SSE2엔 32비트 min/blend가 없어 비교 마스크로 고름
+	FORCEINLINE __m128i Select(const __m128i Mask, const __m128i A, const __m128i B)
+	{
+		return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+	}
+
+	FORCEINLINE __m128i MinEpi32(const __m128i A, const __m128i B)
+	{
+		return Select(_mm_cmpgt_epi32(A, B), B, A);
+	}
+
+	// 정수 -> float 변환 후 지수(= floor(log2))와 선행 1 다음 4비트
+	FORCEINLINE void ExponentAndTop4(const __m128i Mag, __m128i& OutExp, __m128i& OutTop4)
+	{
+		const __m128i Bits = _mm_castps_si128(_mm_cvtepi32_ps(Mag));
+		OutExp = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127));
+		OutTop4 = _mm_and_si128(_mm_srli_epi32(Bits, 19), _mm_set1_epi32(0x0F));
+	}
+
+	// Base * 2^Shift (Shift 0..7, 결과 < 2^24라 float에서 정확)
+	FORCEINLINE __m128i ShiftLeftVar(const __m128i Base, const __m128i Shift)
+	{
+		const __m128 Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(Shift, _mm_set1_epi32(127)), 23));
+		return _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(Base), Scale));
+	}
+
+	FORCEINLINE __m128i EncodeMuLaw4(const __m128i X)
+	{
+		const __m128i Pcm = _mm_srai_epi32(X, 2);
+		const __m128i Neg = _mm_srai_epi32(Pcm, 31);
+		const __m128i Abs = _mm_sub_epi32(_mm_xor_si128(Pcm, Neg), Neg);
+		const __m128i Mag = _mm_add_epi32(MinEpi32(Abs, _mm_set1_epi32(MuLawClip14)), _mm_set1_epi32(MuLawBias14));
+
+		__m128i Exp, Mant;
+		ExponentAndTop4(Mag, Exp, Mant);
+		Exp = _mm_sub_epi32(Exp, _mm_set1_epi32(5));
+
+		const __m128i Code = _mm_or_si128(_mm_or_si128(_mm_and_si128(Neg, _mm_set1_epi32(0x80)), _mm_slli_epi32(Exp, 4)), Mant);
+		return _mm_xor_si128(Code, _mm_set1_epi32(0xFF));
+	}
+
+	FORCEINLINE __m128i DecodeMuLaw4(const __m128i Code)
+	{
+		const __m128i U = _mm_xor_si128(Code, _mm_set1_epi32(0xFF));
+		const __m128i Exp = _mm_and_si128(_mm_srli_epi32(U, 4), _mm_set1_epi32(0x07));
+		const __m128i Base = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(U, _mm_set1_epi32(0x0F)), 3), _mm_set1_epi32(MuLawBias));
+		const __m128i T = _mm_sub_epi32(ShiftLeftVar(Base, Exp), _mm_set1_epi32(MuLawBias));
+		const __m128i Neg = _mm_cmpeq_epi32(_mm_and_si128(U, _mm_set1_epi32(0x80)), _mm_set1_epi32(0x80));
+		return _mm_sub_epi32(_mm_xor_si128(T, Neg), Neg);
+	}
+
+	FORCEINLINE __m128i EncodeALaw4(const __m128i X)
+	{
+		const __m128i Pcm = _mm_srai_epi32(X, 3);
+		const __m128i Neg = _mm_srai_epi32(Pcm, 31);
+		// 음수는 -Pcm - 1 == ~Pcm
+		const __m128i Mag = MinEpi32(_mm_xor_si128(Pcm, Neg), _mm_set1_epi32(ALawMaxMagnitude));
+
+		__m128i Exp, Top4;
+		ExponentAndTop4(Mag, Exp, Top4);
+		const __m128i Large = _mm_or_si128(_mm_slli_epi32(_mm_sub_epi32(Exp, _mm_set1_epi32(4)), 4), Top4);
+		const __m128i Small = _mm_and_si128(_mm_srli_epi32(Mag, 1), _mm_set1_epi32(0x0F));
+		const __m128i Code = Select(_mm_cmplt_epi32(Mag, _mm_set1_epi32(32)), Small, Large);
+
+		const __m128i XorMask = _mm_or_si128(_mm_set1_epi32(0x55), _mm_andnot_si128(Neg, _mm_set1_epi32(0x80)));
+		return _mm_xor_si128(Code, XorMask);
+	}
+
+	FORCEINLINE __m128i DecodeALaw4(const __m128i Code)
+	{
+		const __m128i A = _mm_xor_si128(Code, _mm_set1_epi32(0x55));
+		const __m128i Seg = _mm_and_si128(_mm_srli_epi32(A, 4), _mm_set1_epi32(0x07));
+		const __m128i SegZero = _mm_cmpeq_epi32(Seg, _mm_setzero_si128());
+		const __m128i Base = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(A, _mm_set1_epi32(0x0F)), 4),
+			Select(SegZero, _mm_set1_epi32(8), _mm_set1_epi32(0x108)));
+		const __m128i Shift = _mm_andnot_si128(SegZero, _mm_sub_epi32(Seg, _mm_set1_epi32(1)));
+		const __m128i T = ShiftLeftVar(Base, Shift);
+		const __m128i Neg = _mm_cmpeq_epi32(_mm_and_si128(A, _mm_set1_epi32(0x80)), _mm_setzero_si128());
+		return _mm_sub_epi32(_mm_xor_si128(T, Neg), Neg);
+	}
+
+	template <__m128i (*Kernel)(const __m128i)>
+	FORCEINLINE int32 EncodeG711Sse2(const int16* In, uint8* Out, int32 Num)
+	{
+		int32 i = 0;
+		for (; i + 8 <= Num; i += 8)
+		{
+			const __m128i X = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In + i));
+			const __m128i Lo = Kernel(_mm_srai_epi32(_mm_unpacklo_epi16(X, X), 16));
+			const __m128i Hi = Kernel(_mm_srai_epi32(_mm_unpackhi_epi16(X, X), 16));
+			const __m128i Bytes = _mm_packus_epi16(_mm_packs_epi32(Lo, Hi), _mm_setzero_si128());
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(Out + i), Bytes);
+		}
+		return i;
+	}
+
+	template <__m128i (*Kernel)(const __m128i)>
+	FORCEINLINE int32 DecodeG711Sse2(const uint8* In, int16* Out, int32 Num)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		int32 i = 0;
+		for (; i + 8 <= Num; i += 8)
+		{
+			const __m128i Bytes = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(In + i)), Zero);
+			const __m128i Lo = Kernel(_mm_unpacklo_epi16(Bytes, Zero));
+			const __m128i Hi = Kernel(_mm_unpackhi_epi16(Bytes, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(Lo, Hi));
+		}
+		return i;
+	}
+#elif VOICE_DSP_NEON
+	// NEON은 레인별 가변 시프트(vshlq)와 min/blend가 있어 정수 연산 그대로
+	FORCEINLINE void ExponentAndTop4(const int32x4_t Mag, int32x4_t& OutExp, int32x4_t& OutTop4)
+	{
+		const uint32x4_t Bits = vreinterpretq_u32_f32(vcvtq_f32_s32(Mag));
+		OutExp = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(Bits, 23)), vdupq_n_s32(127));
+		OutTop4 = vandq_s32(vreinterpretq_s32_u32(vshrq_n_u32(Bits, 19)), vdupq_n_s32(0x0F));
+	}
+
+	FORCEINLINE int32x4_t EncodeMuLaw4(const int32x4_t X)
+	{
+		const int32x4_t Pcm = vshrq_n_s32(X, 2);
+		const int32x4_t Neg = vshrq_n_s32(Pcm, 31);
+		const int32x4_t Mag = vaddq_s32(vminq_s32(vabsq_s32(Pcm), vdupq_n_s32(MuLawClip14)), vdupq_n_s32(MuLawBias14));
+
+		int32x4_t Exp, Mant;
+		ExponentAndTop4(Mag, Exp, Mant);
+		Exp = vsubq_s32(Exp, vdupq_n_s32(5));
+
+		const int32x4_t Code = vorrq_s32(vorrq_s32(vandq_s32(Neg, vdupq_n_s32(0x80)), vshlq_n_s32(Exp, 4)), Mant);
+		return veorq_s32(Code, vdupq_n_s32(0xFF));
+	}
+
+	FORCEINLINE int32x4_t DecodeMuLaw4(const int32x4_t Code)
+	{
+		const int32x4_t U = veorq_s32(Code, vdupq_n_s32(0xFF));
+		const int32x4_t Exp = vandq_s32(vshrq_n_s32(U, 4), vdupq_n_s32(0x07));
+		const int32x4_t Base = vaddq_s32(vshlq_n_s32(vandq_s32(U, vdupq_n_s32(0x0F)), 3), vdupq_n_s32(MuLawBias));
+		const int32x4_t T = vsubq_s32(vshlq_s32(Base, Exp), vdupq_n_s32(MuLawBias));
+		const uint32x4_t Neg = vtstq_s32(U, vdupq_n_s32(0x80));
+		return vbslq_s32(Neg, vnegq_s32(T), T);
+	}
+
+	FORCEINLINE int32x4_t EncodeALaw4(const int32x4_t X)
+	{
+		const int32x4_t Pcm = vshrq_n_s32(X, 3);
+		const int32x4_t Neg = vshrq_n_s32(Pcm, 31);
+		const int32x4_t Mag = vminq_s32(veorq_s32(Pcm, Neg), vdupq_n_s32(ALawMaxMagnitude));
+
+		int32x4_t Exp, Top4;
+		ExponentAndTop4(Mag, Exp, Top4);
+		const int32x4_t Large = vorrq_s32(vshlq_n_s32(vsubq_s32(Exp, vdupq_n_s32(4)), 4), Top4);
+		const int32x4_t Small = vandq_s32(vshrq_n_s32(Mag, 1), vdupq_n_s32(0x0F));
+		const int32x4_t Code = vbslq_s32(vcltq_s32(Mag, vdupq_n_s32(32)), Small, Large);
+
+		const int32x4_t XorMask = vorrq_s32(vdupq_n_s32(0x55), vbicq_s32(vdupq_n_s32(0x80), Neg));
+		return veorq_s32(Code, XorMask);
+	}
+
+	FORCEINLINE int32x4_t DecodeALaw4(const int32x4_t Code)
+	{
+		const int32x4_t A = veorq_s32(Code, vdupq_n_s32(0x55));
+		const int32x4_t Seg = vandq_s32(vshrq_n_s32(A, 4), vdupq_n_s32(0x07));
+		const uint32x4_t SegZero = vceqq_s32(Seg, vdupq_n_s32(0));
+		const int32x4_t Base = vaddq_s32(vshlq_n_s32(vandq_s32(A, vdupq_n_s32(0x0F)), 4),
+			vbslq_s32(SegZero, vdupq_n_s32(8), vdupq_n_s32(0x108)));
+		const int32x4_t Shift = vmaxq_s32(vsubq_s32(Seg, vdupq_n_s32(1)), vdupq_n_s32(0));
+		const int32x4_t T = vshlq_s32(Base, Shift);
+		const uint32x4_t Pos = vtstq_s32(A, vdupq_n_s32(0x80));
+		return vbslq_s32(Pos, T, vnegq_s32(T));
+	}
+
+	template <int32x4_t (*Kernel)(const int32x4_t)>
+	FORCEINLINE int32 EncodeG711Neon(const int16* In, uint8* Out, int32 Num)
+	{
+		int32 i = 0;
+		for (; i + 8 <= Num; i += 8)
+		{
+			const int16x8_t X = vld1q_s16(In + i);
+			const int32x4_t Lo = Kernel(vmovl_s16(vget_low_s16(X)));
+			const int32x4_t Hi = Kernel(vmovl_s16(vget_high_s16(X)));
+			vst1_u8(Out + i, vmovn_u16(vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(Lo)), vmovn_u32(vreinterpretq_u32_s32(Hi)))));
+		}
+		return i;
+	}
+
+	template <int32x4_t (*Kernel)(const int32x4_t)>
+	FORCEINLINE int32 DecodeG711Neon(const uint8* In, int16* Out, int32 Num)
+	{
+		int32 i = 0;
+		for (; i + 8 <= Num; i += 8)
+		{
+			const uint16x8_t Bytes = vmovl_u8(vld1_u8(In + i));
+			const int32x4_t Lo = Kernel(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Bytes))));
+			const int32x4_t Hi = Kernel(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(Bytes))));
+			vst1q_s16(Out + i, vcombine_s16(vmovn_s32(Lo), vmovn_s32(Hi)));
+		}
+		return i;
+	}
+#endif
+}
+
+void VoiceAudioDSP::EncodeMuLaw(const int16* In, uint8* Out, int32 Num)
+{
+	int32 i = 0;
+#if VOICE_DSP_SSE2
+	i = EncodeG711Sse2<&EncodeMuLaw4>(In, Out, Num);
+#elif VOICE_DSP_NEON
+	i = EncodeG711Neon<&EncodeMuLaw4>(In, Out, Num);
+#endif
+	for (; i < Num; ++i)
+	{
+		Out[i] = EncodeMuLawSample(In[i]);
+	}
+}
+
+void VoiceAudioDSP::DecodeMuLaw(const uint8* In, int16* Out, int32 Num)
+{
+	int32 i = 0;
+#if VOICE_DSP_SSE2
+	i = DecodeG711Sse2<&DecodeMuLaw4>(In, Out, Num);
+#elif VOICE_DSP_NEON
+	i = DecodeG711Neon<&DecodeMuLaw4>(In, Out, Num);
+#endif
+	for (; i < Num; ++i)
+	{
+		Out[i] = DecodeMuLawSample(In[i]);
+	}
+}
+
+void VoiceAudioDSP::EncodeALaw(const int16* In, uint8* Out, int32 Num)
+{
+	int32 i = 0;
+#if VOICE_DSP_SSE2
+	i = EncodeG711Sse2<&EncodeALaw4>(In, Out, Num);
+#elif VOICE_DSP_NEON
+	i = EncodeG711Neon<&EncodeALaw4>(In, Out, Num);
+#endif
+	for (; i < Num; ++i)
+	{
+		Out[i] = EncodeALawSample(In[i]);
+	}
+}
+
+void VoiceAudioDSP::DecodeALaw(const uint8* In, int16* Out, int32 Num)
+{
+	int32 i = 0;
+#if VOICE_DSP_SSE2
+	i = DecodeG711Sse2<&DecodeALaw4>(In, Out, Num);
+#elif VOICE_DSP_NEON
+	i = DecodeG711Neon<&DecodeALaw4>(In, Out, Num);
+#endif
+	for (; i < Num; ++i)
+	{
+		Out[i] = DecodeALawSample(In[i]);
+	}
+}
+
+// ===== VAD =====
+
+void VoiceAudioDSP::AnalyzeFrame(const float* In, int32 Num, float& PrevSample, FFrameFeatures& Out)
+{
+	if (!In || Num <= 0)
+	{
+		Out = FFrameFeatures();
+		return;
+	}
+
+	// 첫 샘플은 이전 프레임 마지막 샘플과 비교
+	float SumSq = In[0] * In[0];
+	float SumDiffSq = (In[0] - PrevSample) * (In[0] - PrevSample);
+	int32 Crossings = (In[0] * PrevSample < 0.f) ? 1 : 0;
+	int32 i = 1;
+
+#if VOICE_DSP_SSE2
+	{
+		const __m128 Zero = _mm_setzero_ps();
+		__m128 AccSq = _mm_setzero_ps();
+		__m128 AccDiff = _mm_setzero_ps();
+		__m128i AccCross = _mm_setzero_si128();
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128 X = _mm_loadu_ps(In + i);
+			const __m128 P = _mm_loadu_ps(In + i - 1);
+			const __m128 D = _mm_sub_ps(X, P);
+			AccSq = _mm_add_ps(AccSq, _mm_mul_ps(X, X));
+			AccDiff = _mm_add_ps(AccDiff, _mm_mul_ps(D, D));
+			// 비교 마스크는 -1 -> 빼면 카운트 증가
+			AccCross = _mm_sub_epi32(AccCross, _mm_castps_si128(_mm_cmplt_ps(_mm_mul_ps(X, P), Zero)));
+		}
+
+		alignas(16) float LanesSq[4];
+		alignas(16) float LanesDiff[4];
+		alignas(16) int32 LanesCross[4];
+		_mm_store_ps(LanesSq, AccSq);
+		_mm_store_ps(LanesDiff, AccDiff);
+		_mm_store_si128(reinterpret_cast<__m128i*>(LanesCross), AccCross);
+		SumSq += (LanesSq[0] + LanesSq[1]) + (LanesSq[2] + LanesSq[3]);
+		SumDiffSq += (LanesDiff[0] + LanesDiff[1]) + (LanesDiff[2] + LanesDiff[3]);
+		Crossings += LanesCross[0] + LanesCross[1] + LanesCross[2] + LanesCross[3];
+	}
+#elif VOICE_DSP_NEON
+	{
+		const float32x4_t Zero = vdupq_n_f32(0.f);
+		float32x4_t AccSq = vdupq_n_f32(0.f);
+		float32x4_t AccDiff = vdupq_n_f32(0.f);
+		uint32x4_t AccCross = vdupq_n_u32(0);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const float32x4_t X = vld1q_f32(In + i);
+			const float32x4_t P = vld1q_f32(In + i - 1);
+			const float32x4_t D = vsubq_f32(X, P);
+			AccSq = vfmaq_f32(AccSq, X, X);
+			AccDiff = vfmaq_f32(AccDiff, D, D);
+			AccCross = vsubq_u32(AccCross, vcltq_f32(vmulq_f32(X, P), Zero));
+		}
+
+		SumSq += vaddvq_f32(AccSq);
+		SumDiffSq += vaddvq_f32(AccDiff);
+		Crossings += (int32)vaddvq_u32(AccCross);
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		const float D = In[i] - In[i - 1];
+		SumSq += In[i] * In[i];
+		SumDiffSq += D * D;
+		Crossings += (In[i] * In[i - 1] < 0.f) ? 1 : 0;
+	}
+
+	PrevSample = In[Num - 1];
+
+	constexpr float Epsilon = 1e-10f;
+	Out.EnergyDb = 10.f * FMath::LogX(10.f, SumSq / (float)Num + Epsilon);
+	Out.ZeroCrossingRate = (float)Crossings / (float)Num;
+	Out.HighBandRatio = SumDiffSq / (SumSq + Epsilon);
+}
+
+void FVoiceActivityDetector::Init(const FSettings& InSettings, float InFrameDurationSec)
+{
+	// 처음엔 조용한 방 기준. 첫 무음 프레임들에서 바로 내려옴. 다시 Init해도 학습된 바닥은 유지
+	if (!IsInitialized())
+	{
+		NoiseFloorDb = InSettings.MinSpeechDb - InSettings.MarginDb;
+	}
+
+	Settings = InSettings;
+	FrameDurationSec = FMath::Max(0.001f, InFrameDurationSec);
+
+	AttackFrames = FMath::Max(1, FMath::RoundToInt(Settings.AttackSec / FrameDurationSec));
+	HangoverFrames = FMath::Max(0, FMath::RoundToInt(Settings.HangoverSec / FrameDurationSec));
+	FloorRisePerFrame = FMath::Max(0.f, Settings.FloorRiseDbPerSec) * FrameDurationSec;
+
+	Reset();
+}
+
+void FVoiceActivityDetector::Reset()
+{
+	PrevSample = 0.f;
+	SpeechRun = 0;
+	SilenceRun = 0;
+	bSpeaking = false;
+	Last = VoiceAudioDSP::FFrameFeatures();
+}
+
+uint32 FVoiceActivityDetector::Process(const float* Frame, int32 Num)
+{
+	VoiceAudioDSP::AnalyzeFrame(Frame, Num, PrevSample, Last);
+
+	const float AboveFloor = Last.EnergyDb - NoiseFloorDb;
+	bool bRaw = Last.EnergyDb > Settings.MinSpeechDb && AboveFloor > Settings.MarginDb;
+
+	// 광대역 잡음 (마스크 안 호흡, 히스): 크기와 관계없이 음성으로 치지 않음
+	const bool bNoiseLike = Last.ZeroCrossingRate > Settings.MaxZeroCrossingRate && Last.HighBandRatio > Settings.MaxHighBandRatio;
+	bRaw = bRaw && !bNoiseLike;
+
+	// 바닥: 더 조용하면 바로 내려가고, 아니면 천천히 올라감 (말하는 중엔 1/10 속도)
+	if (Last.EnergyDb < NoiseFloorDb)
+	{
+		NoiseFloorDb = Last.EnergyDb;
+	}
+	else
+	{
+		const float Rise = bRaw ? 0.1f * FloorRisePerFrame : FloorRisePerFrame;
+		NoiseFloorDb += FMath::Min(Last.EnergyDb - NoiseFloorDb, Rise);
+	}
+	NoiseFloorDb = FMath::Clamp(NoiseFloorDb, -100.f, Settings.MaxNoiseFloorDb);
+
+	if (bRaw)
+	{
+		++SpeechRun;
+		SilenceRun = 0;
+		if (SpeechRun >= AttackFrames)
+		{
+			bSpeaking = true;
+		}
+	}
+	else
+	{
+		SpeechRun = 0;
+		if (bSpeaking && ++SilenceRun > HangoverFrames)
+		{
+			bSpeaking = false;
+		}
+	}
+
+	return (bSpeaking ? FlagSpeech : 0u) | (bRaw ? FlagRawSpeech : 0u);
+}
+
+// ===== FVoicePolyphaseResampler =====
+
+namespace
+{
+	// Kaiser window 용 0차 수정 베셀 함수 (급수)
+	double BesselI0(double X)
+	{
+		double Sum = 1.0;
+		double Term = 1.0;
+		const double HalfX = 0.5 * X;
+		for (int32 k = 1; k < 64; ++k)
+		{
+			Term *= (HalfX / k) * (HalfX / k);
+			Sum += Term;
+			if (Term < Sum * 1e-12)
+				break;
+		}
+		return Sum;
+	}
+
+	int32 Gcd(int32 A, int32 B)
+	{
+		while (B != 0)
+		{
+			const int32 T = A % B;
+			A = B;
+			B = T;
+		}
+		return A;
+	}
+
+	// Num은 4의 배수
+	FORCEINLINE float DotProduct(const float* RESTRICT A, const float* RESTRICT B, int32 Num)
+	{
+		int32 i = 0;
+
+#if VOICE_DSP_SSE2
+		__m128 Acc0 = _mm_setzero_ps();
+		__m128 Acc1 = _mm_setzero_ps();
+		for (; i + 8 <= Num; i += 8)
+		{
+			Acc0 = _mm_add_ps(Acc0, _mm_mul_ps(_mm_loadu_ps(A + i), _mm_loadu_ps(B + i)));
+			Acc1 = _mm_add_ps(Acc1, _mm_mul_ps(_mm_loadu_ps(A + i + 4), _mm_loadu_ps(B + i + 4)));
+		}
+		for (; i + 4 <= Num; i += 4)
+		{
+			Acc0 = _mm_add_ps(Acc0, _mm_mul_ps(_mm_loadu_ps(A + i), _mm_loadu_ps(B + i)));
+		}
+		alignas(16) float Lanes[4];
+		_mm_store_ps(Lanes, _mm_add_ps(Acc0, Acc1));
+		float Sum = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+#elif VOICE_DSP_NEON
+		float32x4_t Acc0 = vdupq_n_f32(0.f);
+		float32x4_t Acc1 = vdupq_n_f32(0.f);
+		for (; i + 8 <= Num; i += 8)
+		{
+			Acc0 = vfmaq_f32(Acc0, vld1q_f32(A + i), vld1q_f32(B + i));
+			Acc1 = vfmaq_f32(Acc1, vld1q_f32(A + i + 4), vld1q_f32(B + i + 4));
+		}
+		for (; i + 4 <= Num; i += 4)
+		{
+			Acc0 = vfmaq_f32(Acc0, vld1q_f32(A + i), vld1q_f32(B + i));
+		}
+		float Sum = vaddvq_f32(vaddq_f32(Acc0, Acc1));
+#else
+		float Sum = 0.f;
+#endif
+
+		for (; i < Num; ++i)
+		{
+			Sum += A[i] * B[i];
+		}
+		return Sum;
+	}
+}
+
+void FVoicePolyphaseResampler::Init(int32 InSampleRate, int32 InOutSampleRate)
+{
+	InRate = FMath::Max(0, InSampleRate);
+	OutRate = FMath::Max(0, InOutSampleRate);
+	bPassthrough = (InRate == OutRate);
+
+	Coeffs.Reset();
+	History.Reset();
+
+	if (!IsInitialized() || bPassthrough)
+	{
+		L = M = 1;
+		Taps = 0;
+		return;
+	}
+
+	const int32 G = Gcd(InRate, OutRate);
+	L = OutRate / G;
+	M = InRate / G;
+
+	// 44.1k <-> 48k 처럼 위상 수가 너무 많으면 MaxPhases로 양자화 (비율 오차 < 0.1%)
+	if (L > MaxPhases)
+	{
+		M = FMath::Max(1, FMath::RoundToInt((double)InRate * MaxPhases / (double)OutRate));
+		L = MaxPhases;
+	}
+
+	// Kaiser 설계: 통과대역 0.4, 저지대역 0.5 (x min(In, Out)), 80 dB
+	constexpr double AttenuationDb = 80.0;
+	constexpr double PassEdge = 0.4;
+	constexpr double StopEdge = 0.5;
+	const double Beta = 0.1102 * (AttenuationDb - 8.7);
+
+	const double MinRate = (double)FMath::Min(InRate, OutRate);
+	const double ProtoRate = (double)InRate * L;
+	const double TransitionNorm = (StopEdge - PassEdge) * MinRate / ProtoRate;
+	const double Cutoff = 0.5 * (PassEdge + StopEdge) * MinRate / ProtoRate;
+
+	const int32 ProtoTaps = FMath::CeilToInt((AttenuationDb - 8.0) / (2.285 * 2.0 * PI * TransitionNorm));
+	Taps = Align(FMath::Max(4, FMath::DivideAndRoundUp(ProtoTaps, L)), 4);
+
+	const int32 N = Taps * L;
+	const double Center = 0.5 * (double)(N - 1);
+	const double InvI0Beta = 1.0 / BesselI0(Beta);
+
+	TArray<double> Proto;
+	Proto.SetNumUninitialized(N);
+	double ProtoSum = 0.0;
+	for (int32 n = 0; n < N; ++n)
+	{
+		const double X = (double)n - Center;
+		const double Sinc = (FMath::Abs(X) < 1e-9) ? 2.0 * Cutoff : FMath::Sin(2.0 * PI * Cutoff * X) / (PI * X);
+		const double R = 2.0 * (double)n / (double)(N - 1) - 1.0;
+		const double Window = BesselI0(Beta * FMath::Sqrt(FMath::Max(0.0, 1.0 - R * R))) * InvI0Beta;
+		Proto[n] = Sinc * Window;
+		ProtoSum += Proto[n];
+	}
+
+	// 각 위상의 DC 이득 ~1 (업샘플링은 L배 보정)
+	const double Gain = (double)L / ProtoSum;
+
+	// y[m] = sum_j x[base - j] * h[phase + j*L] -> 위상별로 뒤집어 저장해서 History와 정방향 내적
+	Coeffs.SetNumZeroed(L * Taps);
+	for (int32 p = 0; p < L; ++p)
+	{
+		float* Dst = Coeffs.GetData() + p * Taps;
+		for (int32 j = 0; j < Taps; ++j)
+		{
+			Dst[Taps - 1 - j] = (float)(Proto[p + j * L] * Gain);
+		}
+	}
+
+	History.SetNumZeroed(Taps - 1 + HistoryBlock);
+	Reset();
+}
+
+void FVoicePolyphaseResampler::Reset()
+{
+	if (bPassthrough || Taps <= 0)
+		return;
+
+	FMemory::Memzero(History.GetData(), (Taps - 1) * sizeof(float));
+	HistoryNum = Taps - 1;
+	BaseIndex = Taps - 1;
+	Phase = 0;
+}
+
+int32 FVoicePolyphaseResampler::GetMaxOutput(int32 NumIn, int32 InSampleRate, int32 OutSampleRate)
+{
+	if (InSampleRate <= 0 || OutSampleRate <= 0)
+		return NumIn + 4;
+
+	// 위상 양자화로 비율이 아주 약간 커질 수 있어 여유 4
+	return (int32)FMath::DivideAndRoundUp((int64)NumIn * OutSampleRate, (int64)InSampleRate) + 4;
+}
+
+int32 FVoicePolyphaseResampler::Process(const float* In, int32 NumIn, float* Out)
+{
+	if (!In || NumIn <= 0 || !IsInitialized())
+		return 0;
+
+	if (bPassthrough)
+	{
+		FMemory::Memcpy(Out, In, NumIn * sizeof(float));
+		return NumIn;
+	}
+
+	float* H = History.GetData();
+	const float* C = Coeffs.GetData();
+	int32 NumOut = 0;
+
+	while (NumIn > 0)
+	{
+		const int32 Take = FMath::Min(NumIn, History.Num() - HistoryNum);
+		FMemory::Memcpy(H + HistoryNum, In, Take * sizeof(float));
+		HistoryNum += Take;
+		In += Take;
+		NumIn -= Take;
+
+		while (BaseIndex < HistoryNum)
+		{
+			Out[NumOut++] = DotProduct(H + BaseIndex - (Taps - 1), C + Phase * Taps, Taps);
+
+			Phase += M;
+			BaseIndex += Phase / L;
+			Phase %= L;
+		}
+
+		// 다음 출력에 필요한 최근 Taps-1개만 앞으로 당김
+		const int32 Drop = FMath::Min(BaseIndex - (Taps - 1), HistoryNum);
+		if (Drop > 0)
+		{
+			FMemory::Memmove(H, H + Drop, (HistoryNum - Drop) * sizeof(float));
+			HistoryNum -= Drop;
+			BaseIndex -= Drop;
+		}
+	}
+
+	return NumOut;
+}
+
+// ===== Soft clip / noise =====
+
+void VoiceAudioDSP::SoftClip(float* InOut, int32 Num, float Drive, float OutGain)
+{
+	int32 i = 0;
+
+#if VOICE_DSP_SSE2
+	{
+		const __m128 VDrive = _mm_set1_ps(Drive);
+		const __m128 VGain = _mm_set1_ps(OutGain);
+		const __m128 Lo = _mm_set1_ps(-3.f);
+		const __m128 Hi = _mm_set1_ps(3.f);
+		const __m128 K27 = _mm_set1_ps(27.f);
+		const __m128 K9 = _mm_set1_ps(9.f);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128 X = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(InOut + i), VDrive), Lo), Hi);
+			const __m128 X2 = _mm_mul_ps(X, X);
+			const __m128 Num4 = _mm_mul_ps(X, _mm_add_ps(K27, X2));
+			const __m128 Den4 = _mm_add_ps(K27, _mm_mul_ps(K9, X2));
+			_mm_storeu_ps(InOut + i, _mm_mul_ps(_mm_div_ps(Num4, Den4), VGain));
+		}
+	}
+#elif VOICE_DSP_NEON
+	{
+		const float32x4_t Lo = vdupq_n_f32(-3.f);
+		const float32x4_t Hi = vdupq_n_f32(3.f);
+		const float32x4_t K27 = vdupq_n_f32(27.f);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const float32x4_t X = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(InOut + i), Drive), Lo), Hi);
+			const float32x4_t X2 = vmulq_f32(X, X);
+			const float32x4_t Num4 = vmulq_f32(X, vaddq_f32(K27, X2));
+			const float32x4_t Den4 = vmlaq_n_f32(K27, X2, 9.f);
+			vst1q_f32(InOut + i, vmulq_n_f32(vdivq_f32(Num4, Den4), OutGain));
+		}
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		const float X = FMath::Clamp(InOut[i] * Drive, -3.f, 3.f);
+		const float X2 = X * X;
+		InOut[i] = OutGain * X * (27.f + X2) / (27.f + 9.f * X2);
+	}
+}
+
+void VoiceAudioDSP::GenerateNoise(uint32* State, float* Out, int32 Num, float GainStart, float GainEnd)
+{
+	if (!State || !Out || Num <= 0)
+		return;
+
+	const float Step = (GainEnd - GainStart) / (float)Num;
+	int32 i = 0;
+
+	// 상위 23비트를 가수로: [2, 4) - 3 -> [-1, 1)
+#if VOICE_DSP_SSE2
+	{
+		__m128i S = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State));
+		const __m128i Exponent = _mm_set1_epi32(0x40000000);
+		const __m128 Three = _mm_set1_ps(3.f);
+		const __m128 GainStep = _mm_set1_ps(4.f * Step);
+		__m128 Gain = _mm_add_ps(_mm_set1_ps(GainStart), _mm_mul_ps(_mm_set_ps(3.f, 2.f, 1.f, 0.f), _mm_set1_ps(Step)));
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			S = _mm_xor_si128(S, _mm_slli_epi32(S, 13));
+			S = _mm_xor_si128(S, _mm_srli_epi32(S, 17));
+			S = _mm_xor_si128(S, _mm_slli_epi32(S, 5));
+
+			const __m128 U = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(S, 9), Exponent)), Three);
+			_mm_storeu_ps(Out + i, _mm_mul_ps(U, Gain));
+			Gain = _mm_add_ps(Gain, GainStep);
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(State), S);
+	}
+#elif VOICE_DSP_NEON
+	{
+		uint32x4_t S = vld1q_u32(State);
+		const uint32x4_t Exponent = vdupq_n_u32(0x40000000);
+		const float32x4_t Three = vdupq_n_f32(3.f);
+		const float Lanes[4] = { 0.f, 1.f, 2.f, 3.f };
+		float32x4_t Gain = vmlaq_n_f32(vdupq_n_f32(GainStart), vld1q_f32(Lanes), Step);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			S = veorq_u32(S, vshlq_n_u32(S, 13));
+			S = veorq_u32(S, vshrq_n_u32(S, 17));
+			S = veorq_u32(S, vshlq_n_u32(S, 5));
+
+			const float32x4_t U = vsubq_f32(vreinterpretq_f32_u32(vorrq_u32(vshrq_n_u32(S, 9), Exponent)), Three);
+			vst1q_f32(Out + i, vmulq_f32(U, Gain));
+			Gain = vaddq_f32(Gain, vdupq_n_f32(4.f * Step));
+		}
+
+		vst1q_u32(State, S);
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		uint32& X = State[i & 3];
+		X ^= X << 13;
+		X ^= X >> 17;
+		X ^= X << 5;
+
+		const uint32 Bits = (X >> 9) | 0x40000000u;
+		float U;
+		FMemory::Memcpy(&U, &Bits, sizeof(U));
+		Out[i] = (U - 3.f) * (GainStart + Step * (float)i);
+	}
+}
+
+// ===== Biquad =====
+
+void FVoiceBiquad::Init(EType InType, float CutoffHz, float SampleRate, float Q)
+{
+	SetCoefficients(InType, CutoffHz, SampleRate, Q);
+	Reset();
+}
+
+void FVoiceBiquad::SetCoefficients(EType InType, float CutoffHz, float SampleRate, float Q)
+{
+	// RBJ Audio EQ Cookbook
+	const double Fs = FMath::Max(1.0, (double)SampleRate);
+	const double W0 = 2.0 * PI * FMath::Clamp((double)CutoffHz, 1.0, 0.49 * Fs) / Fs;
+	const double CosW = FMath::Cos(W0);
+	const double Alpha = FMath::Sin(W0) / (2.0 * FMath::Max(0.1, (double)Q));
+	const double A0 = 1.0 + Alpha;
+
+	double Nb0, Nb1;
+	if (InType == EType::LowPass)
+	{
+		Nb0 = (1.0 - CosW) * 0.5;
+		Nb1 = 1.0 - CosW;
+	}
+	else
+	{
+		Nb0 = (1.0 + CosW) * 0.5;
+		Nb1 = -(1.0 + CosW);
+	}
+
+	const double b0 = Nb0 / A0;
+	const double b1 = Nb1 / A0;
+	const double b2 = Nb0 / A0;
+	const double a1 = -2.0 * CosW / A0;
+	const double a2 = (1.0 - Alpha) / A0;
+
+	B0 = (float)b0;
+	B1 = (float)b1;
+	B2 = (float)b2;
+	A1 = (float)a1;
+	A2 = (float)a2;
+
+	// 단위 입력 / 단위 상태 하나씩 넣고 4샘플 돌린 응답이 곧 블록 열
+	for (int32 k = 0; k < 8; ++k)
+	{
+		double In[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+		switch (k)
+		{
+		case 4:  x1 = 1.0; break;
+		case 5:  x2 = 1.0; break;
+		case 6:  y1 = 1.0; break;
+		case 7:  y2 = 1.0; break;
+		default: In[k] = 1.0; break;
+		}
+
+		for (int32 n = 0; n < 4; ++n)
+		{
+			const double y = b0 * In[n] + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+			x2 = x1;
+			x1 = In[n];
+			y2 = y1;
+			y1 = y;
+			Columns[k][n] = (float)y;
+		}
+	}
+}
+
+void FVoiceBiquad::Reset()
+{
+	X1 = X2 = Y1 = Y2 = 0.f;
+}
+
+void FVoiceBiquad::Process(float* InOut, int32 Num)
+{
+	int32 i = 0;
+
+#if VOICE_DSP_SSE2
+	{
+		const __m128 C0 = _mm_loadu_ps(Columns[0]);
+		const __m128 C1 = _mm_loadu_ps(Columns[1]);
+		const __m128 C2 = _mm_loadu_ps(Columns[2]);
+		const __m128 C3 = _mm_loadu_ps(Columns[3]);
+		const __m128 Cx1 = _mm_loadu_ps(Columns[4]);
+		const __m128 Cx2 = _mm_loadu_ps(Columns[5]);
+		const __m128 Cy1 = _mm_loadu_ps(Columns[6]);
+		const __m128 Cy2 = _mm_loadu_ps(Columns[7]);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128 X = _mm_loadu_ps(InOut + i);
+
+			// 입력 항과 상태 항을 따로 더해 의존 사슬을 짧게
+			const __m128 FromIn = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(C0, _mm_shuffle_ps(X, X, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(C1, _mm_shuffle_ps(X, X, _MM_SHUFFLE(1, 1, 1, 1)))),
+				_mm_add_ps(_mm_mul_ps(C2, _mm_shuffle_ps(X, X, _MM_SHUFFLE(2, 2, 2, 2))), _mm_mul_ps(C3, _mm_shuffle_ps(X, X, _MM_SHUFFLE(3, 3, 3, 3)))));
+			const __m128 FromState = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(Cx1, _mm_set1_ps(X1)), _mm_mul_ps(Cx2, _mm_set1_ps(X2))),
+				_mm_add_ps(_mm_mul_ps(Cy1, _mm_set1_ps(Y1)), _mm_mul_ps(Cy2, _mm_set1_ps(Y2))));
+
+			X2 = InOut[i + 2];
+			X1 = InOut[i + 3];
+
+			_mm_storeu_ps(InOut + i, _mm_add_ps(FromIn, FromState));
+			Y2 = InOut[i + 2];
+			Y1 = InOut[i + 3];
+		}
+	}
+#elif VOICE_DSP_NEON
+	{
+		const float32x4_t C0 = vld1q_f32(Columns[0]);
+		const float32x4_t C1 = vld1q_f32(Columns[1]);
+		const float32x4_t C2 = vld1q_f32(Columns[2]);
+		const float32x4_t C3 = vld1q_f32(Columns[3]);
+		const float32x4_t Cx1 = vld1q_f32(Columns[4]);
+		const float32x4_t Cx2 = vld1q_f32(Columns[5]);
+		const float32x4_t Cy1 = vld1q_f32(Columns[6]);
+		const float32x4_t Cy2 = vld1q_f32(Columns[7]);
+
+		for (; i + 4 <= Num; i += 4)
+		{
+			const float32x4_t X = vld1q_f32(InOut + i);
+
+			float32x4_t FromIn = vmulq_laneq_f32(C0, X, 0);
+			FromIn = vmlaq_laneq_f32(FromIn, C1, X, 1);
+			FromIn = vmlaq_laneq_f32(FromIn, C2, X, 2);
+			FromIn = vmlaq_laneq_f32(FromIn, C3, X, 3);
+
+			float32x4_t FromState = vmulq_n_f32(Cx1, X1);
+			FromState = vmlaq_n_f32(FromState, Cx2, X2);
+			FromState = vmlaq_n_f32(FromState, Cy1, Y1);
+			FromState = vmlaq_n_f32(FromState, Cy2, Y2);
+
+			X2 = vgetq_lane_f32(X, 2);
+			X1 = vgetq_lane_f32(X, 3);
+
+			const float32x4_t Y = vaddq_f32(FromIn, FromState);
+			vst1q_f32(InOut + i, Y);
+			Y2 = vgetq_lane_f32(Y, 2);
+			Y1 = vgetq_lane_f32(Y, 3);
+		}
+	}
+#endif
+
+	for (; i < Num; ++i)
+	{
+		const float X = InOut[i];
+		const float Y = B0 * X + B1 * X1 + B2 * X2 - A1 * Y1 - A2 * Y2;
+		X2 = X1;
+		X1 = X;
+		Y2 = Y1;
+		Y1 = Y;
+		InOut[i] = Y;
+	}
+
+	// 무음이 이어질 때 denormal로 떨어지지 않게
+	if (FMath::Abs(Y1) < 1e-20f && FMath::Abs(Y2) < 1e-20f)
+	{
+		Y1 = Y2 = 0.f;
+	}
+}
+
+void FVoiceBiquad::ProcessReference(float* InOut, int32 Num)
+{
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float X = InOut[i];
+		const float Y = B0 * X + B1 * X1 + B2 * X2 - A1 * Y1 - A2 * Y2;
+		X2 = X1;
+		X1 = X;
+		Y2 = Y1;
+		Y1 = Y;
+		InOut[i] = Y;
+	}
+}
@@ -0,0 +1,209 @@
+// ============================ VoiceCaptureSource.cpp ============================
+#include "VoiceCaptureSource.h"
+#include "VoiceAudioDSP.h"
+
+#include "Audio.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceCapture, Log, All);
+
+// ===== Device =====
+
+int32 FVoiceDeviceCaptureSource::GetExpectedSampleRate() const
+{
+	Audio::FCaptureDeviceInfo DeviceInfo;
+	if (AudioCapture.GetCaptureDeviceInfo(DeviceInfo) && DeviceInfo.PreferredSampleRate > 0)
+	{
+		return DeviceInfo.PreferredSampleRate;
+	}
+	return 0;
+}
+
+bool FVoiceDeviceCaptureSource::Open(FVoiceCaptureCallback&& OnAudio, int32 NumFramesDesired, FString& OutError)
+{
+	Audio::FAudioCaptureDeviceParams Params;
+	Params.DeviceIndex = INDEX_NONE;
+
+	Audio::FOnAudioCaptureFunction OnCapture =
+		[OnAudio = MoveTemp(OnAudio)](const void* InAudio, int32 NumFrames, int32 NumChannels, int32 SampleRate, double /*StreamTime*/, bool /*bOverflow*/)
+		{
+			OnAudio(static_cast<const float*>(InAudio), NumFrames, NumChannels, SampleRate);
+		};
+
+	if (!AudioCapture.OpenAudioCaptureStream(Params, MoveTemp(OnCapture), (uint32)NumFramesDesired))
+	{
+		OutError = TEXT("Failed to open audio capture stream");
+		return false;
+	}
+
+	bOpen = true;
+	return true;
+}
+
+bool FVoiceDeviceCaptureSource::Start()
+{
+	return bOpen && AudioCapture.StartStream();
+}
+
+void FVoiceDeviceCaptureSource::Stop()
+{
+	if (!bOpen)
+		return;
+
+	AudioCapture.StopStream();
+	AudioCapture.CloseStream();
+	bOpen = false;
+}
+
+// ===== Buffer =====
+
+FVoiceBufferCaptureSource::FVoiceBufferCaptureSource(const FVoiceUtterancePtr& InClip, const FVoiceBufferSourceSettings& InSettings)
+	: Clip(InClip)
+	, Settings(InSettings)
+{
+	Settings.Speed = FMath::Clamp(Settings.Speed, 0.1f, 100.f);
+	Settings.TailSilenceSec = FMath::Max(0.f, Settings.TailSilenceSec);
+}
+
+FVoiceBufferCaptureSource::~FVoiceBufferCaptureSource()
+{
+	Stop();
+}
+
+TSharedPtr<FVoiceBufferCaptureSource, ESPMode::ThreadSafe> FVoiceBufferCaptureSource::FromWavFile(const FString& Path, const FVoiceBufferSourceSettings& InSettings, FString& OutError)
+{
+	const FVoiceUtterancePtr Clip = LoadWavClip(Path, OutError);
+	if (!Clip.IsValid())
+		return nullptr;
+
+	return MakeShared<FVoiceBufferCaptureSource, ESPMode::ThreadSafe>(Clip, InSettings);
+}
+
+FVoiceUtterancePtr FVoiceBufferCaptureSource::LoadWavClip(const FString& Path, FString& OutError)
+{
+	const FString FullPath = FPaths::IsRelative(Path) ? FPaths::Combine(FPaths::ProjectDir(), Path) : Path;
+
+	TArray<uint8> WavBytes;
+	if (!FFileHelper::LoadFileToArray(WavBytes, *FullPath, FILEREAD_Silent))
+	{
+		OutError = FString::Printf(TEXT("Capture WAV not found: %s"), *FullPath);
+		return nullptr;
+	}
+
+	FWaveModInfo WaveInfo;
+	if (!WaveInfo.ReadWaveInfo(WavBytes.GetData(), WavBytes.Num()) || *WaveInfo.pBitsPerSample != 16 ||
+		*WaveInfo.pChannels == 0 || *WaveInfo.pSamplesPerSec == 0)
+	{
+		OutError = FString::Printf(TEXT("Capture WAV must be PCM16: %s"), *FullPath);
+		return nullptr;
+	}
+
+	TArray<uint8> Pcm = FVoiceUtterancePool::Get().Acquire((int32)WaveInfo.SampleDataSize);
+	Pcm.Append(WaveInfo.SampleDataStart, (int32)WaveInfo.SampleDataSize);
+	const FVoiceUtterancePtr Clip = FVoiceUtterancePool::Get().Wrap(MoveTemp(Pcm), (int32)*WaveInfo.pSamplesPerSec, (int32)*WaveInfo.pChannels);
+
+	UE_LOG(LogVoiceCapture, Log, TEXT("[VoiceCapture] Loaded %s: %.2fs @ %dHz/%dch"),
+		*FullPath, Clip->GetDurationSec(), Clip->SampleRate, Clip->NumChannels);
+
+	return Clip;
+}
+
+bool FVoiceBufferCaptureSource::Open(FVoiceCaptureCallback&& OnAudio, int32 NumFramesDesired, FString& OutError)
+{
+	if (!Clip.IsValid() || Clip->GetNumFrames() == 0 || Clip->SampleRate <= 0)
+	{
+		OutError = TEXT("Capture buffer is empty");
+		return false;
+	}
+
+	if (Thread)
+	{
+		OutError = TEXT("Capture buffer is already running");
+		return false;
+	}
+
+	Callback = MoveTemp(OnAudio);
+	BlockFrames = FMath::Clamp(NumFramesDesired, 64, 16384);
+	return true;
+}
+
+bool FVoiceBufferCaptureSource::Start()
+{
+	if (Thread || !Callback)
+		return false;
+
+	bStopRequested.store(false, std::memory_order_release);
+	bFinished.store(false, std::memory_order_release);
+
+	Thread = FRunnableThread::Create(&Feeder, TEXT("VoiceBufferCapture"), 0, TPri_AboveNormal);
+	return Thread != nullptr;
+}
+
+void FVoiceBufferCaptureSource::Stop()
+{
+	if (Thread)
+	{
+		Feeder.Stop();
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	Callback = nullptr;
+}
+
+void FVoiceBufferCaptureSource::FeedLoop()
+{
+	const int32 Rate = Clip->SampleRate;
+	const int32 Channels = FMath::Max(1, Clip->NumChannels);
+	const int16* Pcm = reinterpret_cast<const int16*>(Clip->Pcm16LE.GetData());
+	const int64 ClipFrames = Clip->GetNumFrames();
+	const int64 TotalFrames = ClipFrames + (int64)FMath::RoundToInt(Settings.TailSilenceSec * Rate);
+
+	TArray<float> Block;
+	Block.SetNumUninitialized(BlockFrames * Channels);
+
+	// 장치처럼 블록 길이만큼 지난 뒤에 전달. 늦어진 만큼은 다음 블록에서 따라잡음 (누적 오차 없음)
+	double DueSec = FPlatformTime::Seconds();
+	int64 Pos = 0;
+
+	while (!bStopRequested.load(std::memory_order_acquire))
+	{
+		if (Pos >= TotalFrames)
+		{
+			if (!Settings.bLoop)
+			{
+				bFinished.store(true, std::memory_order_release);
+				return;
+			}
+			Pos = 0;
+		}
+
+		const int32 Num = (int32)FMath::Min<int64>(BlockFrames, TotalFrames - Pos);
+		const int32 FromClip = (int32)FMath::Clamp<int64>(ClipFrames - Pos, 0, Num);
+		if (FromClip > 0)
+		{
+			VoiceAudioDSP::Pcm16ToFloat(Pcm + Pos * Channels, Block.GetData(), FromClip * Channels);
+		}
+		if (FromClip < Num)
+		{
+			FMemory::Memzero(Block.GetData() + FromClip * Channels, (Num - FromClip) * Channels * sizeof(float));
+		}
+
+		DueSec += (double)Num / ((double)Rate * Settings.Speed);
+		for (double Wait = DueSec - FPlatformTime::Seconds(); Wait > 0.0; Wait = DueSec - FPlatformTime::Seconds())
+		{
+			// Stop이 블록 하나만큼 기다리지 않게 짧게 나눠 잠
+			if (bStopRequested.load(std::memory_order_acquire))
+				return;
+			FPlatformProcess::Sleep((float)FMath::Min(Wait, 0.005));
+		}
+
+		Callback(Block.GetData(), Num, Channels, Rate);
+		Pos += Num;
+	}
+}
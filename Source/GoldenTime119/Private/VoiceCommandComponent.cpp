@@ -0,0 +1,153 @@
+// ============================ VoiceCommandComponent.cpp ============================
+#include "VoiceCommandComponent.h"
+
+#include "RadioManager.h"
+#include "RadioLineData.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceCommand, Log, All);
+
+UVoiceCommandComponent::UVoiceCommandComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UVoiceCommandComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	SetGrammar(Grammar);
+}
+
+void UVoiceCommandComponent::SetGrammar(UVoiceCommandGrammar* InGrammar)
+{
+	Grammar = InGrammar;
+	Matcher.Compile(Grammar);
+
+	LastFireTimeSec.Init(-1.0e9, Matcher.GetNumCommands());
+	HandledCommand = INDEX_NONE;
+	PendingResponse = nullptr;
+}
+
+void UVoiceCommandComponent::BeginUtterance()
+{
+	HandledCommand = INDEX_NONE;
+	PendingResponse = nullptr;
+}
+
+FName UVoiceCommandComponent::GetHandledCommandId() const
+{
+	if (!Grammar || !Grammar->Commands.IsValidIndex(HandledCommand))
+		return NAME_None;
+
+	return Grammar->Commands[HandledCommand].CommandId;
+}
+
+bool UVoiceCommandComponent::HandlePartialTranscript(const FString& StableText, const FString& UnstableText)
+{
+	if (!bEnabled || !Grammar || Matcher.IsEmpty() || HasHandledUtterance())
+		return false;
+
+	PartialScratch.Reset();
+	PartialScratch += StableText;
+	PartialScratch += UnstableText;
+
+	// 부분 결과는 뒤가 바뀔 수 있어서 점수는 더 엄격하게
+	const FVoiceCommandMatch Match = Matcher.Match(PartialScratch, Grammar->MinPartialScore, Grammar->MinCoverage);
+	if (!Match.IsValid() || !Grammar->Commands[Match.CommandIndex].bAllowOnPartial)
+		return false;
+
+	return Dispatch(Match, PartialScratch, true);
+}
+
+bool UVoiceCommandComponent::HandleFinalTranscript(const FString& Text)
+{
+	if (!bEnabled || !Grammar || Matcher.IsEmpty())
+		return false;
+
+	const FVoiceCommandMatch Match = Matcher.Match(Text, Grammar->MinScore, Grammar->MinCoverage,
+		Grammar->ShortPhraseAllowedEdits, Grammar->ShortPhraseMaxLen);
+
+	if (HasHandledUtterance())
+	{
+		// 부분 인식으로 이미 실행함. 키를 뗐으니 미뤄둔 응답 송출
+		if (URadioLineData* Response = PendingResponse.Get())
+		{
+			PendingResponse = nullptr;
+			EnqueueResponse(Response);
+		}
+
+		// 최종도 명령뿐이면 끝, 뒤에 자유 발화가 붙었으면 원격으로
+		if (Match.IsValid())
+			return true;
+
+		if (bLogMatches)
+		{
+			UE_LOG(LogVoiceCommand, Log, TEXT("[VoiceCommand] '%s' already handled, rest is open speech -> remote: %s"),
+				*GetHandledCommandId().ToString(), *Text);
+		}
+		return false;
+	}
+
+	if (!Match.IsValid())
+		return false;
+
+	return Dispatch(Match, Text, false);
+}
+
+bool UVoiceCommandComponent::Dispatch(const FVoiceCommandMatch& Match, const FString& Transcript, bool bFromPartial)
+{
+	const FVoiceCommandDef& Def = Grammar->Commands[Match.CommandIndex];
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// 쿨다운 중이면 명령으로는 소비하되 다시 실행하지 않음 (같은 말 반복 -> 원격으로 새지 않게)
+	const bool bCoolingDown = LastFireTimeSec.IsValidIndex(Match.CommandIndex)
+		&& (Now - LastFireTimeSec[Match.CommandIndex]) < (double)Def.CooldownSec;
+
+	HandledCommand = Match.CommandIndex;
+
+	if (bLogMatches)
+	{
+		UE_LOG(LogVoiceCommand, Log, TEXT("[VoiceCommand] %s%s (phrase #%d score=%.2f coverage=%.2f %s): %s"),
+			*Def.CommandId.ToString(), bCoolingDown ? TEXT(" [cooldown]") : TEXT(""), Match.PhraseIndex,
+			Match.Score, Match.Coverage, bFromPartial ? TEXT("partial") : TEXT("final"), *Transcript);
+	}
+
+	if (bCoolingDown)
+		return true;
+
+	LastFireTimeSec[Match.CommandIndex] = Now;
+
+	// 게임플레이는 바로. 무전 응답은 반이중이라 키를 뗀 뒤에 (누르는 중에 채널이 busy가 되면 PTT가 끊김)
+	if (Def.Response)
+	{
+		if (bFromPartial)
+		{
+			PendingResponse = Def.Response;
+		}
+		else
+		{
+			EnqueueResponse(Def.Response);
+		}
+	}
+
+	OnVoiceCommand.Broadcast(Def.CommandId, Transcript, bFromPartial);
+	return true;
+}
+
+void UVoiceCommandComponent::EnqueueResponse(URadioLineData* Response)
+{
+	ARadioManager* RM = RadioManager.Get();
+	if (!RM)
+	{
+		RM = ARadioManager::GetRadioManager(this);
+		RadioManager = RM;
+	}
+
+	if (RM)
+	{
+		RM->EnqueueRadioLine(Response);
+	}
+}
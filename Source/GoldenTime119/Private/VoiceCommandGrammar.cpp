@@ -0,0 +1,205 @@
+// ============================ VoiceCommandGrammar.cpp ============================
+#include "VoiceCommandGrammar.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceCommand, Log, All);
+
+namespace
+{
+	bool IsSeparator(TCHAR C)
+	{
+		if (FChar::IsWhitespace(C))
+			return true;
+
+		// ASCII 문장부호/기호
+		if (C < 128)
+			return !FChar::IsAlnum(C);
+
+		// Whisper가 내는 전각/CJK 문장부호
+		switch (C)
+		{
+		case 0x00B7: case 0x2018: case 0x2019: case 0x201C: case 0x201D: case 0x2026:     // · ‘ ’ “ ” …
+		case 0x3001: case 0x3002: case 0xFF01: case 0xFF0C: case 0xFF0E: case 0xFF1F:     // 、 。 ！ ， ． ？
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+void FVoiceCommandMatcher::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+	OutTokens.Reset();
+
+	FString Current;
+	for (const TCHAR C : Text)
+	{
+		if (IsSeparator(C))
+		{
+			if (!Current.IsEmpty())
+			{
+				OutTokens.Add(MoveTemp(Current));
+				Current.Reset();
+			}
+			continue;
+		}
+		Current.AppendChar(FChar::ToLower(C));
+	}
+
+	if (!Current.IsEmpty())
+	{
+		OutTokens.Add(MoveTemp(Current));
+	}
+}
+
+void FVoiceCommandMatcher::Reset()
+{
+	Phrases.Reset();
+	Fillers.Reset();
+	NumCommands = 0;
+}
+
+void FVoiceCommandMatcher::Compile(const UVoiceCommandGrammar* Grammar)
+{
+	Reset();
+
+	if (!Grammar)
+		return;
+
+	TArray<FString> Tokens;
+
+	for (const FString& Filler : Grammar->FillerWords)
+	{
+		Tokenize(Filler, Tokens);
+		for (FString& T : Tokens)
+		{
+			Fillers.Add(MoveTemp(T));
+		}
+	}
+
+	NumCommands = Grammar->Commands.Num();
+	for (int32 c = 0; c < NumCommands; ++c)
+	{
+		const FVoiceCommandDef& Def = Grammar->Commands[c];
+		if (Def.CommandId.IsNone())
+		{
+			UE_LOG(LogVoiceCommand, Warning, TEXT("[VoiceCommand] %s: command #%d has no CommandId, skipped"), *GetNameSafe(Grammar), c);
+			continue;
+		}
+
+		for (int32 p = 0; p < Def.Phrases.Num(); ++p)
+		{
+			Tokenize(Def.Phrases[p], Tokens);
+
+			FPhrase& Phrase = Phrases.AddDefaulted_GetRef();
+			Phrase.CommandIndex = c;
+			Phrase.PhraseIndex = p;
+			for (const FString& T : Tokens)
+			{
+				Phrase.Compact += T;
+			}
+
+			if (Phrase.Compact.IsEmpty())
+			{
+				Phrases.Pop(false);
+			}
+		}
+	}
+
+	// 긴 표현부터: 점수가 같으면 더 구체적인 명령이 이김 ("문 닫아" vs "문")
+	Phrases.StableSort([](const FPhrase& A, const FPhrase& B) { return A.Compact.Len() > B.Compact.Len(); });
+
+	UE_LOG(LogVoiceCommand, Log, TEXT("[VoiceCommand] Compiled %s: commands=%d phrases=%d fillers=%d"),
+		*GetNameSafe(Grammar), NumCommands, Phrases.Num(), Fillers.Num());
+}
+
+int32 FVoiceCommandMatcher::BestSubstringDistance(const FString& Pattern, const FString& Text) const
+{
+	// Sellers: 첫 행을 0으로 두면 Text의 아무 위치에서나 시작 가능
+	const int32 M = Pattern.Len();
+	const int32 N = Text.Len();
+
+	RowPrev.SetNumUninitialized(N + 1, false);
+	RowCur.SetNumUninitialized(N + 1, false);
+	FMemory::Memzero(RowPrev.GetData(), (N + 1) * sizeof(int32));
+
+	const TCHAR* P = *Pattern;
+	const TCHAR* T = *Text;
+
+	for (int32 i = 1; i <= M; ++i)
+	{
+		RowCur[0] = i;
+		const TCHAR Pc = P[i - 1];
+		for (int32 j = 1; j <= N; ++j)
+		{
+			const int32 Sub = RowPrev[j - 1] + (Pc == T[j - 1] ? 0 : 1);
+			const int32 Del = RowPrev[j] + 1;
+			const int32 Ins = RowCur[j - 1] + 1;
+			RowCur[j] = FMath::Min3(Sub, Del, Ins);
+		}
+		Swap(RowPrev, RowCur);
+	}
+
+	int32 Best = M;
+	for (int32 j = 0; j <= N; ++j)
+	{
+		Best = FMath::Min(Best, RowPrev[j]);
+	}
+	return Best;
+}
+
+FVoiceCommandMatch FVoiceCommandMatcher::Match(const FString& Transcript, float MinScore, float MinCoverage,
+	int32 ShortPhraseEdits, int32 ShortPhraseMaxLen) const
+{
+	FVoiceCommandMatch Best;
+
+	if (Phrases.Num() == 0)
+		return Best;
+
+	Tokenize(Transcript, TokenScratch);
+
+	TranscriptScratch.Reset();
+	for (const FString& T : TokenScratch)
+	{
+		if (!Fillers.Contains(T))
+		{
+			TranscriptScratch += T;
+		}
+	}
+
+	const int32 TextLen = TranscriptScratch.Len();
+	if (TextLen == 0)
+		return Best;
+
+	for (const FPhrase& Phrase : Phrases)
+	{
+		const int32 PhraseLen = Phrase.Compact.Len();
+
+		// 발화가 표현보다 훨씬 짧으면 볼 필요 없음
+		if (TextLen < PhraseLen / 2)
+			continue;
+
+		const float Coverage = FMath::Min(1.f, (float)PhraseLen / (float)TextLen);
+		if (Coverage < MinCoverage)
+			continue;
+
+		// 비율 기준 허용 편집 수. 짧은 표현은 비율로는 0이 되므로 따로 보장 (2음절 이하는 제외)
+		int32 AllowedEdits = FMath::FloorToInt((1.f - MinScore) * PhraseLen + UE_KINDA_SMALL_NUMBER);
+		if (PhraseLen >= 3 && PhraseLen <= ShortPhraseMaxLen)
+		{
+			AllowedEdits = FMath::Max(AllowedEdits, ShortPhraseEdits);
+		}
+
+		const int32 Distance = BestSubstringDistance(Phrase.Compact, TranscriptScratch);
+		const float Score = 1.f - (float)Distance / (float)PhraseLen;
+
+		if (Distance <= AllowedEdits && Score > Best.Score)
+		{
+			Best.CommandIndex = Phrase.CommandIndex;
+			Best.PhraseIndex = Phrase.PhraseIndex;
+			Best.Score = Score;
+			Best.Coverage = Coverage;
+		}
+	}
+
+	return Best;
+}
@@ -0,0 +1,396 @@
+// ============================ VoiceContextPublisher.cpp ============================
+#include "VoiceContextPublisher.h"
+
+#include "RealtimeVoiceComponent.h"
+#include "GameManager.h"
+#include "MissionObjective.h"
+#include "RoomActor.h"
+#include "VitalComponent.h"
+
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceContext, Log, All);
+
+namespace
+{
+	// 직전 버킷 중심에서 (0.5 + Margin)칸 넘게 벗어나야 바뀜 -> 경계에서 흔들리는 값이 텍스트를 바꾸지 않음
+	int32 QuantizeSticky(float Value, float Step, float Margin, int32 Prev)
+	{
+		const int32 Raw = FMath::RoundToInt(Value / Step);
+		if (Prev == INDEX_NONE || Raw == Prev)
+			return Raw;
+
+		return (FMath::Abs(Value - Prev * Step) > Step * (0.5f + Margin)) ? Raw : Prev;
+	}
+
+	int32 ToPercent(int32 Bucket, float Step01)
+	{
+		return FMath::Clamp(FMath::RoundToInt(Bucket * Step01 * 100.f), 0, 100);
+	}
+
+	const TCHAR* RoomStateTag(ERoomState State)
+	{
+		switch (State)
+		{
+		case ERoomState::Fire: return TEXT("FIRE");
+		case ERoomState::Risk: return TEXT("RISK");
+		default:               return TEXT("IDLE");
+		}
+	}
+
+	// 디자이너가 붙인 첫 태그를 방 이름으로 (예: "Kitchen"), 없으면 오브젝트 이름
+	FString RoomLabel(const ARoomActor* Room)
+	{
+		if (!Room)
+			return TEXT("unknown");
+
+		return (Room->Tags.Num() > 0 && !Room->Tags[0].IsNone()) ? Room->Tags[0].ToString() : Room->GetName();
+	}
+
+	struct FContextLine
+	{
+		int32 Priority = 0;     // 작을수록 먼저, 예산이 모자라면 큰 것부터 빠짐
+		FString Text;
+	};
+}
+
+UVoiceContextPublisherComponent::UVoiceContextPublisherComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+}
+
+void UVoiceContextPublisherComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	SetComponentTickInterval(SampleIntervalSec);
+
+	if (!Realtime)
+	{
+		if (AActor* Owner = GetOwner())
+		{
+			Realtime = Owner->FindComponentByClass<URealtimeVoiceComponent>();
+		}
+	}
+
+	if (!Realtime)
+	{
+		UE_LOG(LogVoiceContext, Warning, TEXT("[Context] No URealtimeVoiceComponent on %s. Nothing will be published."), *GetNameSafe(GetOwner()));
+	}
+}
+
+void UVoiceContextPublisherComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Sample(false);
+}
+
+void UVoiceContextPublisherComponent::SetExtraContext(const FString& Text)
+{
+	FString Trimmed = Text.TrimStartAndEnd();
+	if (Trimmed.Equals(ExtraContext, ESearchCase::CaseSensitive))
+		return;
+
+	ExtraContext = MoveTemp(Trimmed);
+	Sample(false);
+}
+
+void UVoiceContextPublisherComponent::FlushPending()
+{
+	Sample(true);
+}
+
+FString UVoiceContextPublisherComponent::BuildContextNow()
+{
+	FString Text;
+	uint32 Signature = 0;
+	BuildContext(Text, Signature);
+	return Text;
+}
+
+// ===== Sources =====
+
+void UVoiceContextPublisherComponent::ResolveSources()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	// 방/매니저는 레벨 배치 액터라 한 번만 찾음
+	if (!bWorldScanned)
+	{
+		bWorldScanned = true;
+
+		for (TActorIterator<AGameManager> It(World); It; ++It)
+		{
+			GameManager = *It;
+			break;
+		}
+
+		Rooms.Reset();
+		for (TActorIterator<ARoomActor> It(World); It; ++It)
+		{
+			Rooms.Add(*It);
+		}
+	}
+
+	// 플레이어는 리스폰/빙의로 바뀔 수 있음
+	if (!PlayerVitals.IsValid())
+	{
+		if (APawn* Pawn = UGameplayStatics::GetPlayerPawn(this, 0))
+		{
+			PlayerVitals = Pawn->FindComponentByClass<UVitalComponent>();
+		}
+	}
+}
+
+// ===== Build =====
+
+void UVoiceContextPublisherComponent::BuildContext(FString& OutText, uint32& OutSignature)
+{
+	OutText.Reset();
+	OutSignature = GetTypeHash(ExtraContext);
+
+	TArray<FContextLine> Lines;
+
+	if (bIncludeWorldState)
+	{
+		ResolveSources();
+
+		// --- player ---
+		const ARoomActor* PlayerRoom = nullptr;
+		if (const UVitalComponent* Vitals = PlayerVitals.Get())
+		{
+			PlayerRoom = Vitals->GetCurrentRoom();
+
+			HpBucket = QuantizeSticky(Vitals->GetHp01(), Step01, Hysteresis, HpBucket);
+			TempBucket = QuantizeSticky(Vitals->GetTemp01(), Step01, Hysteresis, TempBucket);
+			O2Bucket = QuantizeSticky(Vitals->GetO201(), Step01, Hysteresis, O2Bucket);
+
+			FString Line = FString::Printf(TEXT("player: room=%s hp=%d%% temp=%d%% o2=%d%%"),
+				*RoomLabel(PlayerRoom), ToPercent(HpBucket, Step01), ToPercent(TempBucket, Step01), ToPercent(O2Bucket, Step01));
+
+			// critical은 원값 기준 (버킷 반올림으로 늦게/일찍 뜨지 않게)
+			const bool bHpCritical = Vitals->GetHp01() <= CriticalVital01;
+			const bool bTempCritical = Vitals->GetTemp01() >= 1.f - CriticalVital01;
+			const bool bO2Critical = Vitals->GetO201() <= CriticalVital01;
+			if (bHpCritical || bTempCritical || bO2Critical)
+			{
+				Line += TEXT(" CRITICAL:");
+				if (bHpCritical)   Line += TEXT(" hp");
+				if (bTempCritical) Line += TEXT(" temp");
+				if (bO2Critical)   Line += TEXT(" o2");
+			}
+
+			Lines.Add({ 0, MoveTemp(Line) });
+
+			OutSignature = HashCombine(OutSignature, GetTypeHash(PlayerRoom));
+			OutSignature = HashCombine(OutSignature, (bHpCritical ? 1u : 0u) | (bTempCritical ? 2u : 0u) | (bO2Critical ? 4u : 0u));
+		}
+
+		// --- rooms: 플레이어가 있는 방, 그다음 위험한 방 순 ---
+		struct FRoomEntry
+		{
+			const ARoomActor* Room = nullptr;
+			int32 Rank = 0;         // 3 = 화재/백드래프트, 2 = 위험, 0 = 평온
+			float Heat = 0.f;
+		};
+		TArray<FRoomEntry> Hazards;
+		int32 NumQuietRooms = 0;
+
+		for (const TWeakObjectPtr<ARoomActor>& Weak : Rooms)
+		{
+			const ARoomActor* Room = Weak.Get();
+			if (!Room)
+				continue;
+
+			const bool bBackdraft = Room->IsBackdraftReady();
+			OutSignature = HashCombine(OutSignature, HashCombine(GetTypeHash(Room), (uint32)Room->State | (bBackdraft ? 0x10u : 0u)));
+
+			const int32 Rank = (Room->State == ERoomState::Fire || bBackdraft) ? 3 : (Room->State == ERoomState::Risk ? 2 : 0);
+			if (Rank == 0 && Room != PlayerRoom)
+			{
+				++NumQuietRooms;
+				continue;
+			}
+			Hazards.Add({ Room, Rank, Room->Heat });
+		}
+
+		Hazards.Sort([PlayerRoom](const FRoomEntry& A, const FRoomEntry& B)
+		{
+			if ((A.Room == PlayerRoom) != (B.Room == PlayerRoom))
+				return A.Room == PlayerRoom;
+			if (A.Rank != B.Rank)
+				return A.Rank > B.Rank;
+			return A.Heat > B.Heat;
+		});
+
+		for (const FRoomEntry& Entry : Hazards)
+		{
+			const ARoomActor* Room = Entry.Room;
+			const FRoomEnvSnapshot Env = Room->GetEnvSnapshot();
+
+			FRoomBuckets& B = RoomBuckets.FindOrAdd(TObjectKey<ARoomActor>(Room));
+			B.Heat = QuantizeSticky(Env.Heat, HeatStep, Hysteresis, B.Heat);
+			B.Smoke = QuantizeSticky(Env.Smoke, Step01, Hysteresis, B.Smoke);
+			B.Oxygen = QuantizeSticky(Env.Oxygen, Step01, Hysteresis, B.Oxygen);
+
+			FString Line = FString::Printf(TEXT("room %s: %s heat=%d smoke=%d%% o2=%d%%"),
+				*RoomLabel(Room), RoomStateTag(Env.State), FMath::RoundToInt(B.Heat * HeatStep), ToPercent(B.Smoke, Step01), ToPercent(B.Oxygen, Step01));
+
+			const int32 NumFires = Room->GetActiveFireCount();
+			if (NumFires > 0)
+			{
+				Line += FString::Printf(TEXT(" fires=%d"), NumFires);
+			}
+			if (Room->IsBackdraftReady())
+			{
+				Line += TEXT(" BACKDRAFT_READY");
+			}
+
+			Lines.Add({ (Room == PlayerRoom) ? 1 : (Entry.Rank == 3 ? 3 : 4), MoveTemp(Line) });
+		}
+
+		if (NumQuietRooms > 0)
+		{
+			Lines.Add({ 6, FString::Printf(TEXT("other rooms: %d quiet"), NumQuietRooms) });
+		}
+
+		// --- objectives ---
+		if (const AGameManager* GM = GameManager.Get())
+		{
+			for (const UMissionObjective* Obj : GM->ActiveObjectives)
+			{
+				if (!Obj)
+					continue;
+
+				OutSignature = HashCombine(OutSignature, HashCombine(GetTypeHash(Obj), (uint32)Obj->Status));
+
+				if (Obj->Status != EMissionObjectiveStatus::InProgress)
+					continue;
+
+				// 진행도는 단조 증가라 내림만으로 떨림 없음
+				const FString Title = Obj->ObjectiveTitle.IsEmpty() ? Obj->ObjectiveID : Obj->ObjectiveTitle.ToString();
+				FString Line = FString::Printf(TEXT("objective: %s %d%%"),
+					*Title, ToPercent(FMath::FloorToInt(Obj->Progress01 / Step01), Step01));
+				if (Obj->TargetCount > 1)
+				{
+					Line += FString::Printf(TEXT(" (%d/%d)"), Obj->CurrentCount, Obj->TargetCount);
+				}
+				Lines.Add({ 2, MoveTemp(Line) });
+			}
+
+			if (GM->ActiveObjectives.Num() > 0)
+			{
+				Lines.Add({ 5, FString::Printf(TEXT("objectives: done=%d/%d failed=%d"),
+					GM->CompletedObjectives.Num(), GM->ActiveObjectives.Num(), GM->FailedObjectives.Num()) });
+			}
+		}
+	}
+
+	// --- budget ---
+	Lines.StableSort([](const FContextLine& A, const FContextLine& B) { return A.Priority < B.Priority; });
+
+	const int32 Budget = FMath::Max(64, MaxContextChars);
+	int32 NumOmitted = 0;
+	for (const FContextLine& Line : Lines)
+	{
+		const int32 Needed = Line.Text.Len() + (OutText.IsEmpty() ? 0 : 1);
+		if (OutText.Len() + Needed > Budget)
+		{
+			++NumOmitted;
+			continue;
+		}
+		if (!OutText.IsEmpty())
+		{
+			OutText += TEXT('\n');
+		}
+		OutText += Line.Text;
+	}
+
+	// 외부 텍스트는 가장 낮은 우선순위: 남은 예산만큼만 (잘라서라도) 붙임
+	if (!ExtraContext.IsEmpty())
+	{
+		const int32 Remaining = Budget - OutText.Len() - (OutText.IsEmpty() ? 0 : 1) - 6;   // "note: "
+		if (Remaining >= 16)
+		{
+			if (!OutText.IsEmpty())
+			{
+				OutText += TEXT('\n');
+			}
+			OutText += TEXT("note: ");
+			OutText += (ExtraContext.Len() <= Remaining) ? ExtraContext : ExtraContext.Left(Remaining - 3) + TEXT("...");
+		}
+		else
+		{
+			++NumOmitted;
+		}
+	}
+
+	if (NumOmitted > 0)
+	{
+		const FString Tail = FString::Printf(TEXT("(+%d lines omitted)"), NumOmitted);
+		if (OutText.Len() + Tail.Len() + 1 <= Budget)
+		{
+			OutText += TEXT('\n');
+			OutText += Tail;
+		}
+	}
+}
+
+// ===== Publish =====
+
+void UVoiceContextPublisherComponent::Sample(bool bIgnoreWindow)
+{
+	if (!Realtime)
+		return;
+
+	FString Text;
+	uint32 Signature = 0;
+	BuildContext(Text, Signature);
+
+	if (Text.Equals(PublishedText, ESearchCase::CaseSensitive))
+	{
+		// 창이 열리기 전에 원래대로 돌아왔으면 보낼 것 없음
+		bPending = false;
+		CoalescedSamples = 0;
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const bool bUrgent = (Signature != PublishedSignature);
+	const double Window = bUrgent ? UrgentPublishIntervalSec : MinPublishIntervalSec;
+
+	if (bIgnoreWindow || Now - LastPublishTimeSec >= Window)
+	{
+		Publish(Text, Signature, Now, bIgnoreWindow ? TEXT("flush") : (bUrgent ? TEXT("state") : TEXT("values")));
+		return;
+	}
+
+	// 창 안: 다음 샘플이 최신 상태로 다시 만들어 보냄
+	bPending = true;
+	++CoalescedSamples;
+}
+
+void UVoiceContextPublisherComponent::Publish(const FString& Text, uint32 Signature, double NowSec, const TCHAR* Reason)
+{
+	if (bLogPublishes)
+	{
+		UE_LOG(LogVoiceContext, Log, TEXT("[Context] publish #%d (%s) len=%d coalesced=%d since=%.1fs"),
+			PublishCount + 1, Reason, Text.Len(), CoalescedSamples, FMath::Min(NowSec - LastPublishTimeSec, 9999.0));
+	}
+
+	PublishedText = Text;
+	PublishedSignature = Signature;
+	LastPublishTimeSec = NowSec;
+	bPending = false;
+	CoalescedSamples = 0;
+	++PublishCount;
+
+	Realtime->UpdateDynamicContext(PublishedText);
+}
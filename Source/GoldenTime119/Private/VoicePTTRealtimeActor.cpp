@@ -3,6 +3,8 @@
 
 #include "PTTAudioRecorderComponent.h"
 #include "RealtimeVoiceComponent.h"
+#include "WhisperSTTComponent.h"
+#include "VoiceContextPublisher.h"
 #include "RadioManager.h"
 
 #include "Components/SceneComponent.h"
@@ -22,6 +24,7 @@ AVoicePTTRealtimeActor::AVoicePTTRealtimeActor()
 
 	PTT = CreateDefaultSubobject<UPTTAudioRecorderComponent>(TEXT("PTT"));
 	Realtime = CreateDefaultSubobject<URealtimeVoiceComponent>(TEXT("Realtime"));
+	Context = CreateDefaultSubobject<UVoiceContextPublisherComponent>(TEXT("Context"));
 }
 
 void AVoicePTTRealtimeActor::BeginPlay()
@@ -37,6 +40,9 @@ void AVoicePTTRealtimeActor::BeginPlay()
 		return;
 	}
 
+	//  Ʈ (  STT  )
+	Whisper = FindComponentByClass<UWhisperSTTComponent>();
+
 	// Bind capture events
 	PTT->OnPcm16FrameReady.AddUniqueDynamic(this, &AVoicePTTRealtimeActor::HandlePcm16FrameReady);
 	PTT->OnCaptureFinalized.AddUniqueDynamic(this, &AVoicePTTRealtimeActor::HandleCaptureFinalized);
@@ -51,6 +57,9 @@ void AVoicePTTRealtimeActor::BeginPlay()
 	{
 		RadioManager = RM;
 		RM->OnBusyChanged.AddUniqueDynamic(this, &AVoicePTTRealtimeActor::HandleRadioBusyChanged);
+
+		//   ڴ Ŀ -> RadioManager  (OnOutputAudioDelta   )
+		Realtime->SetOutputAudioStream(RM->GetRealtimePcmStream());
 	}
 
 	if (bAutoConnectOnBeginPlay)
@@ -112,10 +121,13 @@ ARadioManager* AVoicePTTRealtimeActor::GetRadioManagerCached()
 
 void AVoicePTTRealtimeActor::UpdateGameStateForAI(const FString& NewSnapshot)
 {
-	CachedGameState = NewSnapshot;
-	if (Realtime && Realtime->IsConnected())
+	if (Context)
 	{
-		Realtime->UpdateDynamicContext(CachedGameState);
+		Context->SetExtraContext(NewSnapshot);
+	}
+	else if (Realtime)
+	{
+		Realtime->UpdateDynamicContext(NewSnapshot);
 	}
 }
 
@@ -150,10 +162,10 @@ void AVoicePTTRealtimeActor::StartPTT()
 	// New user turn: cancel old response, clear buffers
 	Realtime->BeginUserTurn(true, true);
 
-	// Push latest game-state
-	if (!CachedGameState.IsEmpty())
+	// ̷       (ٲ   session.update )
+	if (Context)
 	{
-		Realtime->UpdateDynamicContext(CachedGameState);
+		Context->FlushPending();
 	}
 
 	// capture delay (/  )
@@ -187,6 +199,11 @@ void AVoicePTTRealtimeActor::StartCaptureInternal()
 		return;
 	}
 
+	if (Whisper)
+	{
+		Whisper->BeginStreaming(PTT->OutputSampleRate, 1);
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("[VoicePTT-RT] Calling PTT->StartPTT"));
 	PTT->StartPTT();
 }
@@ -221,12 +238,24 @@ void AVoicePTTRealtimeActor::StopPTT()
 		PTT->StopPTT(); // <- WAV , Ʈ 
 	}
 
+	if (Whisper && Whisper->IsStreaming())
+	{
+		Whisper->FinishStreaming();
+	}
+
 	StopStaticLoop();
 	PlayPTTEndSfx();
 
+	// VAD   ã (ư  /ȣ) -> ø   Ŀ/ 
+	if (PTT && !PTT->WasSpeechDetected())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[VoicePTT-RT] No speech detected. Skipping commit/response"));
+		return;
+	}
+
 	// ⼭ "AI  " 
 	// (RadioManager  ؾ Ʈ )
-	if (Realtime && Realtime->IsConnected())
+	if (Realtime && Realtime->IsAvailable())
 	{
 		BeginRadioRealtime();
 
@@ -266,8 +295,13 @@ void AVoicePTTRealtimeActor::EndRadioRealtime()
 
 void AVoicePTTRealtimeActor::HandlePcm16FrameReady(const TArray<uint8>& Pcm16BytesLE, int32 SampleRate, int32 NumChannels, float FrameDurationSec)
 {
+	if (Whisper)
+	{
+		Whisper->FeedStreamingPcm16Raw(Pcm16BytesLE.GetData(), Pcm16BytesLE.Num());
+	}
+
 	// streaming append
-	if (!Realtime || !Realtime->IsConnected())
+	if (!Realtime || !Realtime->IsAvailable())
 		return;
 
 	Realtime->AppendInputAudioPCM16(Pcm16BytesLE);
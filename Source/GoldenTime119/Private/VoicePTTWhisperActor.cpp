@@ -2,6 +2,9 @@
 
 #include "PTTAudioRecorderComponent.h"
 #include "RealtimeVoiceComponent.h"
+#include "WhisperSTTComponent.h"
+#include "VoiceContextPublisher.h"
+#include "VoiceCommandComponent.h"
 #include "RadioManager.h"
 
 #include "Components/SceneComponent.h"
@@ -11,17 +14,6 @@
 
 #include "TimerManager.h"
 #include "Engine/World.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-
-static uint32 ReadLE32(const uint8* P)
-{
-	return (uint32)P[0] | ((uint32)P[1] << 8) | ((uint32)P[2] << 16) | ((uint32)P[3] << 24);
-}
-static uint16 ReadLE16(const uint8* P)
-{
-	return (uint16)P[0] | ((uint16)P[1] << 8);
-}
 
 AVoicePTTWhisperActor::AVoicePTTWhisperActor()
 {
@@ -32,6 +24,8 @@ AVoicePTTWhisperActor::AVoicePTTWhisperActor()
 
 	PTT = CreateDefaultSubobject<UPTTAudioRecorderComponent>(TEXT("PTT"));
 	Realtime = CreateDefaultSubobject<URealtimeVoiceComponent>(TEXT("Realtime"));
+	Whisper = CreateDefaultSubobject<UWhisperSTTComponent>(TEXT("Whisper"));
+	Commands = CreateDefaultSubobject<UVoiceCommandComponent>(TEXT("Commands"));
 }
 
 void AVoicePTTWhisperActor::BeginPlay()
@@ -47,7 +41,14 @@ void AVoicePTTWhisperActor::BeginPlay()
 		return;
 	}
 
-	PTT->OnWavReady.AddUniqueDynamic(this, &AVoicePTTWhisperActor::HandleWavReady);
+	PTT->OnUtteranceReady.AddUObject(this, &AVoicePTTWhisperActor::HandleUtteranceReady);
+	PTT->OnPcm16FrameReady.AddUniqueDynamic(this, &AVoicePTTWhisperActor::HandlePcm16FrameReady);
+
+	if (Whisper)
+	{
+		Whisper->OnFinished.AddUniqueDynamic(this, &AVoicePTTWhisperActor::HandleTranscriptFinal);
+		Whisper->OnPartialTranscript.AddUniqueDynamic(this, &AVoicePTTWhisperActor::HandleTranscriptPartial);
+	}
 
 	// Radio busy
 	RadioManager = nullptr;
@@ -68,13 +69,18 @@ void AVoicePTTWhisperActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		W->GetTimerManager().ClearTimer(StartCaptureTimer);
 	}
 
+	if (PTT)
+	{
+		PTT->OnUtteranceReady.RemoveAll(this);
+	}
+
 	StopStaticLoop();
 	Super::EndPlay(EndPlayReason);
 }
 
 void AVoicePTTWhisperActor::EnsureComponentsBound()
 {
-	if (PTT && Realtime)
+	if (PTT && Realtime && Whisper)
 		return;
 
 	if (!PTT)
@@ -93,14 +99,27 @@ void AVoicePTTWhisperActor::EnsureComponentsBound()
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] EnsureComponentsBound: this=%s PTT=%s Realtime=%s"),
-		*GetNameSafe(this), *GetNameSafe(PTT), *GetNameSafe(Realtime));
+	if (!Whisper)
+	{
+		if (UWhisperSTTComponent* Found = FindComponentByClass<UWhisperSTTComponent>())
+		{
+			Whisper = Found;
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] EnsureComponentsBound: this=%s PTT=%s Realtime=%s Whisper=%s"),
+		*GetNameSafe(this), *GetNameSafe(PTT), *GetNameSafe(Realtime), *GetNameSafe(Whisper));
 }
 
 void AVoicePTTWhisperActor::UpdateRealtimeGameState(const FString& ContextTextOrJson)
 {
 	EnsureComponentsBound();
-	if (Realtime)
+	// 컨텍스트 퍼블리셔를 붙였으면 그쪽으로 (변화 감지 + 스로틀), 아니면 바로
+	if (UVoiceContextPublisherComponent* Context = FindComponentByClass<UVoiceContextPublisherComponent>())
+	{
+		Context->SetExtraContext(ContextTextOrJson);
+	}
+	else if (Realtime)
 	{
 		Realtime->UpdateDynamicContext(ContextTextOrJson);
 	}
@@ -130,7 +149,7 @@ void AVoicePTTWhisperActor::StartPTT()
 	}
 
 	// Realtime: 새 턴 시작(입력/출력 버퍼 정리)
-	if (Realtime && Realtime->IsConnected())
+	if (Realtime && Realtime->IsAvailable())
 	{
 		Realtime->BeginUserTurn(true, true);
 	}
@@ -179,6 +198,21 @@ void AVoicePTTWhisperActor::StartCaptureInternal()
 	}
 
 	bCaptureStarted = true;
+	bAudioSkippedForCommand = false;
+	bAudioAwaitingTranscript = false;
+	bFinalTranscriptReceived = false;
+
+	if (Commands)
+	{
+		Commands->BeginUtterance();
+	}
+
+	// 누르는 동안 부분 디코드 -> 릴리스 때는 남은 구간만 디코드
+	if (Whisper && bStreamingTranscript)
+	{
+		Whisper->BeginStreaming(PTT->OutputSampleRate, 1);
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Calling PTT->StartPTT"));
 	PTT->StartPTT();
 }
@@ -202,14 +236,20 @@ void AVoicePTTWhisperActor::StopPTT()
 
 	if (PTT)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Calling PTT->StopPTTAndSave"));
-		PTT->StopPTTAndSave(TEXT(""));
+		// 남은 프레임은 StopPTT 안에서 동기로 방출됨 -> 그 다음에 최종 디코드
+		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Calling PTT->StopPTT"));
+		PTT->StopPTT();
 	}
 	else
 	{
 		UE_LOG(LogTemp, Error, TEXT("[VoicePTT] StopPTT: PTT is null"));
 	}
 
+	if (Whisper && Whisper->IsStreaming())
+	{
+		Whisper->FinishStreaming();
+	}
+
 	StopStaticLoop();
 	PlayPTTEndSfx();
 }
@@ -223,142 +263,143 @@ void AVoicePTTWhisperActor::HandleRadioBusyChanged(bool bBusy)
 	StopPTT();
 }
 
-void AVoicePTTWhisperActor::HandleWavReady(bool bSuccess, const FString& WavPathOrError)
+void AVoicePTTWhisperActor::HandlePcm16FrameReady(const TArray<uint8>& Pcm16BytesLE, int32 SampleRate, int32 NumChannels, float FrameDurationSec)
 {
-	if (!bSuccess)
+	if (Whisper)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[VoicePTT] WAV failed: %s"), *WavPathOrError);
-		return;
+		Whisper->FeedStreamingPcm16Raw(Pcm16BytesLE.GetData(), Pcm16BytesLE.Num());
 	}
+}
+
+void AVoicePTTWhisperActor::HandleTranscriptFinal(bool bSuccess, const FString& TextOrError)
+{
+	bFinalTranscriptReceived = true;
 
 	EnsureComponentsBound();
 
-	if (!Realtime || !Realtime->IsConnected())
+	const bool bAudioHeld = bAudioAwaitingTranscript;
+	bAudioAwaitingTranscript = false;
+
+	if (!bSuccess)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Realtime not connected. wav=%s"), *WavPathOrError);
+		UE_LOG(LogTemp, Error, TEXT("[VoicePTT] STT failed: %s"), *TextOrError);
+
+		// 명령인지 알 수 없으니 올려둔 오디오로 원격 응답
+		if (bAudioHeld)
+		{
+			CommitHeldAudio();
+		}
 		return;
 	}
 
-	TArray<uint8> Pcm16Bytes;
-	int32 SampleRate = 0;
-	int32 NumChannels = 0;
-	FString Err;
+	UE_LOG(LogTemp, Log, TEXT("[VoicePTT] STT: %s"), *TextOrError);
 
-	if (!ExtractPcm16FromWavFile(WavPathOrError, Pcm16Bytes, SampleRate, NumChannels, Err))
+	// 오디오를 이미 올리고 응답까지 요청함 (보류 없이 보낸 경우)
+	const bool bAudioSent = bSendAudioToRealtime && !bAudioSkippedForCommand && !bAudioHeld;
+
+	// 고정 명령이면 로컬에서 끝 (게임 이벤트 + 준비된 무전 응답)
+	if (Commands && Commands->HandleFinalTranscript(TextOrError))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[VoicePTT] WAV parse failed: %s"), *Err);
+		// 올려둔 오디오는 commit하지 않고 버림 -> 원격 응답이 생기지 않음
+		if (bAudioHeld && Realtime && Realtime->IsAvailable())
+		{
+			Realtime->BeginUserTurn(false, false);
+			UE_LOG(LogTemp, Log, TEXT("[VoicePTT] Local command '%s' handled on final. held audio discarded"), *Commands->GetHandledCommandId().ToString());
+		}
+
+		if (bRecordLocalCommandsInRealtime && !bAudioSent && Realtime && Realtime->IsAvailable())
+		{
+			Realtime->SendUserText(TextOrError);
+		}
 		return;
 	}
 
-	// (중요) session.update 입력 포맷과 SampleRate가 같아야 함.
-	// 여기서는 RealtimeVoiceComponent 기본 InputSampleRate=48000로 맞춰둠.
-
-	Realtime->AppendInputAudioPCM16(Pcm16Bytes);
-	Realtime->CommitInputAudio(); // VAD 꺼져있으면 수동 :contentReference[oaicite:15]{index=15}
-	Realtime->CreateResponse();   // VAD 꺼져있으면 수동 :contentReference[oaicite:16]{index=16}
+	if (bAudioHeld)
+	{
+		CommitHeldAudio();
+		return;
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("[VoicePTT] Sent PCM16 to Realtime. bytes=%d sr=%d ch=%d"),
-		Pcm16Bytes.Num(), SampleRate, NumChannels);
-}
+	if (!bSendTranscriptToRealtime || bAudioSent || TextOrError.IsEmpty())
+		return;
 
-bool AVoicePTTWhisperActor::ExtractPcm16FromWavFile(
-	const FString& WavPath,
-	TArray<uint8>& OutPcm16Bytes,
-	int32& OutSampleRate,
-	int32& OutNumChannels,
-	FString& OutError)
-{
-	TArray<uint8> Bytes;
-	if (!FFileHelper::LoadFileToArray(Bytes, *WavPath))
+	if (!Realtime || !Realtime->IsAvailable())
 	{
-		OutError = FString::Printf(TEXT("Failed to read wav: %s"), *WavPath);
-		return false;
+		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Realtime not connected. text dropped"));
+		return;
 	}
 
-	if (Bytes.Num() < 44)
+	Realtime->SendUserText(TextOrError);
+	Realtime->CreateResponse();
+}
+
+void AVoicePTTWhisperActor::HandleTranscriptPartial(const FString& StableText, const FString& UnstableText)
+{
+	if (Commands)
 	{
-		OutError = TEXT("WAV too small");
-		return false;
+		Commands->HandlePartialTranscript(StableText, UnstableText);
 	}
+}
 
-	// RIFF header
-	if (!(Bytes[0] == 'R' && Bytes[1] == 'I' && Bytes[2] == 'F' && Bytes[3] == 'F' &&
-		Bytes[8] == 'W' && Bytes[9] == 'A' && Bytes[10] == 'V' && Bytes[11] == 'E'))
+void AVoicePTTWhisperActor::HandleUtteranceReady(const FVoiceUtterancePtr& Utterance)
+{
+	// 같은 버퍼를 STT와 Realtime이 나눠 읽음 (디스크/복사 없음)
+	if (Whisper && !bStreamingTranscript)
 	{
-		OutError = TEXT("Not a RIFF/WAVE");
-		return false;
+		Whisper->SubmitUtterance(Utterance);
 	}
 
-	int32 Cursor = 12;
-
-	uint16 AudioFormat = 0;
-	uint16 NumChannels = 0;
-	uint32 SampleRate = 0;
-	uint16 BitsPerSample = 0;
+	if (!bSendAudioToRealtime)
+		return;
 
-	int32 DataOffset = -1;
-	int32 DataSize = 0;
+	EnsureComponentsBound();
 
-	while (Cursor + 8 <= Bytes.Num())
+	// 누르는 동안 이미 명령으로 처리됨: 같은 말에 원격 응답까지 오지 않게
+	if (Commands && Commands->HasHandledUtterance())
 	{
-		const uint8* P = Bytes.GetData() + Cursor;
-		const uint32 ChunkId = ReadLE32(P);
-		const uint32 ChunkSize = ReadLE32(P + 4);
-		Cursor += 8;
-
-		if (Cursor + (int32)ChunkSize > Bytes.Num())
-			break;
-
-		// 'fmt '
-		if (ChunkId == 0x20746D66)
-		{
-			const uint8* F = Bytes.GetData() + Cursor;
-			if (ChunkSize < 16)
-			{
-				OutError = TEXT("fmt chunk too small");
-				return false;
-			}
-			AudioFormat = ReadLE16(F + 0);
-			NumChannels = ReadLE16(F + 2);
-			SampleRate = ReadLE32(F + 4);
-			BitsPerSample = ReadLE16(F + 14);
-		}
-		// 'data'
-		else if (ChunkId == 0x61746164)
-		{
-			DataOffset = Cursor;
-			DataSize = (int32)ChunkSize;
-			break;
-		}
-
-		// chunk alignment: pad to even
-		Cursor += (int32)ChunkSize;
-		if (Cursor & 1) Cursor++;
+		bAudioSkippedForCommand = true;
+		UE_LOG(LogTemp, Log, TEXT("[VoicePTT] Local command '%s' handled. audio not sent"), *Commands->GetHandledCommandId().ToString());
+		return;
 	}
 
-	if (DataOffset < 0 || DataSize <= 0)
+	if (!Realtime || !Realtime->IsAvailable())
 	{
-		OutError = TEXT("No data chunk found");
-		return false;
+		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Realtime not connected. audio dropped (%.2fs)"), Utterance->GetDurationSec());
+		return;
 	}
 
-	if (AudioFormat != 1 || BitsPerSample != 16)
+	// (중요) session.update 입력 포맷과 SampleRate가 같아야 함 (PTT OutputSampleRate == Realtime InputSampleRate)
+	// 긴 발화도 append 메시지가 커지지 않게 잘라서 보냄
+	const int32 ChunkBytes = FMath::Max(2, Utterance->SampleRate / 5) * (int32)sizeof(int16) * Utterance->NumChannels;
+	const TArray<uint8>& Pcm = Utterance->Pcm16LE;
+	for (int32 Offset = 0; Offset < Pcm.Num(); Offset += ChunkBytes)
 	{
-		OutError = FString::Printf(TEXT("Unsupported WAV format. AudioFormat=%d Bits=%d (need PCM16)"), AudioFormat, BitsPerSample);
-		return false;
+		Realtime->AppendInputAudioPCM16Raw(Pcm.GetData() + Offset, FMath::Min(ChunkBytes, Pcm.Num() - Offset));
 	}
 
-	OutSampleRate = (int32)SampleRate;
-	OutNumChannels = (int32)NumChannels;
+	UE_LOG(LogTemp, Log, TEXT("[VoicePTT] Sent PCM16 to Realtime. bytes=%d sr=%d ch=%d"),
+		Pcm.Num(), Utterance->SampleRate, Utterance->NumChannels);
+
+	// 최종 인식이 아직이면 명령 여부를 본 뒤 commit (HandleTranscriptFinal)
+	if (Whisper && Commands && !bFinalTranscriptReceived)
+	{
+		bAudioAwaitingTranscript = true;
+		return;
+	}
 
-	// Realtime에 보내는 건 “PCM16 raw bytes” (WAV 헤더 제외)
-	OutPcm16Bytes.Reset();
-	OutPcm16Bytes.Append(Bytes.GetData() + DataOffset, DataSize);
+	CommitHeldAudio();
+}
 
-	// 만약 스테레오라면 여기서 mono downmix가 필요하지만,
-	// 당신 PTT는 이미 mono로 저장 중(DesiredNumChannels=1)이라 그대로 가정.
+void AVoicePTTWhisperActor::CommitHeldAudio()
+{
+	if (!Realtime || !Realtime->IsAvailable())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[VoicePTT] Realtime not connected. held audio dropped"));
+		return;
+	}
 
-	return true;
+	Realtime->CommitInputAudio();
+	Realtime->CreateResponse();
 }
 
 // ------------------- SFX -------------------
@@ -0,0 +1,224 @@
+// ============================ VoiceUtterance.cpp ============================
+#include "VoiceUtterance.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoiceUtterance, Log, All);
+
+// ===== Pool =====
+
+FVoiceUtterancePool& FVoiceUtterancePool::Get()
+{
+	static FVoiceUtterancePool Instance;
+	return Instance;
+}
+
+TArray<uint8> FVoiceUtterancePool::Acquire(int32 MinCapacityBytes)
+{
+	NumAcquired.fetch_add(1, std::memory_order_relaxed);
+
+	TArray<uint8> Out;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		// 충분히 큰 것 우선, 없으면 아무거나 꺼내서 키움
+		int32 Pick = INDEX_NONE;
+		for (int32 i = FreeBuffers.Num() - 1; i >= 0; --i)
+		{
+			if (FreeBuffers[i].Max() >= MinCapacityBytes)
+			{
+				Pick = i;
+				break;
+			}
+		}
+		if (Pick == INDEX_NONE && FreeBuffers.Num() > 0)
+		{
+			Pick = FreeBuffers.Num() - 1;
+		}
+
+		if (Pick != INDEX_NONE)
+		{
+			Out = MoveTemp(FreeBuffers[Pick]);
+			FreeBuffers.RemoveAtSwap(Pick, 1, false);
+			NumReused.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	Out.Reset(MinCapacityBytes);
+	return Out;
+}
+
+void FVoiceUtterancePool::Release(TArray<uint8>&& Buffer)
+{
+	if (Buffer.Max() == 0 || Buffer.Max() > MaxPooledBytes)
+		return;
+
+	Buffer.Reset();
+
+	FScopeLock ScopeLock(&Lock);
+	if (FreeBuffers.Num() < MaxFreeBuffers)
+	{
+		FreeBuffers.Add(MoveTemp(Buffer));
+	}
+}
+
+FVoiceUtterancePtr FVoiceUtterancePool::Wrap(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels)
+{
+	FVoiceUtterance* Utterance = new FVoiceUtterance();
+	Utterance->Pcm16LE = MoveTemp(Pcm16LE);
+	Utterance->SampleRate = SampleRate;
+	Utterance->NumChannels = FMath::Max(1, NumChannels);
+	Utterance->Serial = NextSerial.fetch_add(1, std::memory_order_relaxed);
+
+	NumLive.fetch_add(1, std::memory_order_relaxed);
+
+	// 마지막 참조가 풀리는 스레드(보통 STT 워커)에서 버퍼를 돌려받음
+	return MakeShareable(Utterance, [this](FVoiceUtterance* Dead)
+		{
+			Release(MoveTemp(Dead->Pcm16LE));
+			delete Dead;
+			NumLive.fetch_sub(1, std::memory_order_relaxed);
+		});
+}
+
+// ===== Builder =====
+
+void FVoiceUtteranceBuilder::Begin(int32 InSampleRate, int32 InNumChannels, float ExpectedSec, float InMaxSec)
+{
+	Reset();
+
+	SampleRate = FMath::Max(1, InSampleRate);
+	NumChannels = FMath::Max(1, InNumChannels);
+
+	const int32 BytesPerSec = SampleRate * NumChannels * (int32)sizeof(int16);
+	const int32 BytesPerFrame = NumChannels * (int32)sizeof(int16);
+	MaxBytes = (InMaxSec > 0.f) ? (int32)FMath::Min<int64>((int64)(InMaxSec * BytesPerSec), MAX_int32) : MAX_int32;
+	MaxBytes -= MaxBytes % BytesPerFrame;
+
+	Buffer = FVoiceUtterancePool::Get().Acquire(FMath::Min(MaxBytes, (int32)(FMath::Max(0.f, ExpectedSec) * BytesPerSec)));
+	bTruncated = false;
+	bActive = true;
+}
+
+void FVoiceUtteranceBuilder::Append(const uint8* Data, int32 NumBytes)
+{
+	if (!bActive || !Data || NumBytes <= 0)
+		return;
+
+	const int32 Room = MaxBytes - Buffer.Num();
+	if (NumBytes > Room)
+	{
+		if (!bTruncated)
+		{
+			UE_LOG(LogVoiceUtterance, Warning, TEXT("[Utterance] Max length reached (%.1fs). Remaining audio is not kept."),
+				(double)MaxBytes / (double)(SampleRate * NumChannels * sizeof(int16)));
+		}
+		bTruncated = true;
+		NumBytes = Room;
+	}
+
+	if (NumBytes > 0)
+	{
+		Buffer.Append(Data, NumBytes);
+	}
+}
+
+FVoiceUtterancePtr FVoiceUtteranceBuilder::Finish()
+{
+	if (!bActive)
+		return nullptr;
+
+	bActive = false;
+
+	if (Buffer.Num() == 0)
+	{
+		FVoiceUtterancePool::Get().Release(MoveTemp(Buffer));
+		return nullptr;
+	}
+
+	return FVoiceUtterancePool::Get().Wrap(MoveTemp(Buffer), SampleRate, NumChannels);
+}
+
+void FVoiceUtteranceBuilder::Reset()
+{
+	bActive = false;
+	if (Buffer.Max() > 0)
+	{
+		FVoiceUtterancePool::Get().Release(MoveTemp(Buffer));
+	}
+	Buffer = TArray<uint8>();
+}
+
+// ===== IO =====
+
+void VoiceUtteranceIO::BuildWavHeader(int32 SampleRate, int32 NumChannels, int32 DataBytes, TArray<uint8>& OutHeader)
+{
+	const int16 BitsPerSample = 16;
+	const int32 ByteRate = SampleRate * NumChannels * (BitsPerSample / 8);
+	const int16 BlockAlign = NumChannels * (BitsPerSample / 8);
+	const int32 RiffChunkSize = 36 + DataBytes;
+
+	auto AppendStr4 = [&](const char* S) { OutHeader.Append(reinterpret_cast<const uint8*>(S), 4); };
+	auto Append32 = [&](int32 V) { OutHeader.Append(reinterpret_cast<uint8*>(&V), 4); };
+	auto Append16 = [&](int16 V) { OutHeader.Append(reinterpret_cast<uint8*>(&V), 2); };
+
+	OutHeader.Reset(44);
+
+	AppendStr4("RIFF"); Append32(RiffChunkSize); AppendStr4("WAVE");
+
+	AppendStr4("fmt "); Append32(16);
+	Append16(1); // PCM
+	Append16((int16)NumChannels);
+	Append32(SampleRate);
+	Append32(ByteRate);
+	Append16(BlockAlign);
+	Append16(BitsPerSample);
+
+	AppendStr4("data"); Append32(DataBytes);
+}
+
+void VoiceUtteranceIO::WriteWavAsync(const FVoiceUtterancePtr& Utterance, const FString& Path, FOnWavWritten&& OnDone)
+{
+	if (!Utterance.IsValid())
+	{
+		if (OnDone)
+		{
+			OnDone(false, TEXT("No utterance"));
+		}
+		return;
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Utterance, Path, OnDone = MoveTemp(OnDone)]() mutable
+		{
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+
+			bool bOk = false;
+			if (TUniquePtr<FArchive> Writer = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*Path)))
+			{
+				TArray<uint8> Header;
+				BuildWavHeader(Utterance->SampleRate, Utterance->NumChannels, Utterance->Pcm16LE.Num(), Header);
+
+				Writer->Serialize(Header.GetData(), Header.Num());
+				Writer->Serialize(const_cast<uint8*>(Utterance->Pcm16LE.GetData()), Utterance->Pcm16LE.Num());
+				bOk = Writer->Close() && !Writer->IsError();
+			}
+
+			if (!bOk)
+			{
+				UE_LOG(LogVoiceUtterance, Warning, TEXT("[Utterance] WAV write failed: %s"), *Path);
+			}
+
+			// 버퍼 참조는 여기서 놓음 (게임 스레드까지 끌고 가지 않음)
+			Utterance.Reset();
+
+			if (OnDone)
+			{
+				AsyncTask(ENamedThreads::GameThread, [OnDone = MoveTemp(OnDone), bOk, Path]()
+					{
+						OnDone(bOk, bOk ? Path : FString::Printf(TEXT("Failed to write %s"), *Path));
+					});
+			}
+		});
+}
@@ -1,95 +1,163 @@
 ﻿#include "WhisperSTTComponent.h"
+#include "WhisperSTTSubsystem.h"
 
-#include "HAL/PlatformProcess.h"
+#include "Audio.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
-#include "TimerManager.h"
-
-void UWhisperSTTComponent::BeginPlay()
-{
-	Super::BeginPlay();
-
-	const FString ProjDir = FPaths::ProjectDir();
-	ExePathAbs = ProjDir / TEXT("Plugins/WhisperRuntime/ThirdParty/Whisper/whisper-cli.exe");
-	ModelPathAbs = ProjDir / TEXT("Plugins/WhisperRuntime/ThirdParty/Whisper/models/ggml-base-q5_1.bin");
-
-	// Saved/Whisper/out/ptt_result(.txt)
-	OutputBaseAbs = FPaths::ProjectSavedDir() / TEXT("Whisper/out/ptt_result");
-	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputBaseAbs), true);
-}
 
 void UWhisperSTTComponent::RunWhisperOnWav(const FString& WavPath)
 {
-	if (!FPaths::FileExists(ExePathAbs))
+	TArray<uint8> WavBytes;
+	if (!FFileHelper::LoadFileToArray(WavBytes, *WavPath))
 	{
-		OnFinished.Broadcast(false, FString::Printf(TEXT("Whisper exe not found: %s"), *ExePathAbs));
+		OnFinished.Broadcast(false, FString::Printf(TEXT("Wav not found: %s"), *WavPath));
 		return;
 	}
-	if (!FPaths::FileExists(ModelPathAbs))
+
+	FWaveModInfo WaveInfo;
+	FString WaveError;
+	if (!WaveInfo.ReadWaveInfo(WavBytes.GetData(), WavBytes.Num(), &WaveError))
 	{
-		OnFinished.Broadcast(false, FString::Printf(TEXT("Model not found: %s"), *ModelPathAbs));
+		OnFinished.Broadcast(false, FString::Printf(TEXT("Invalid wav (%s): %s"), *WaveError, *WavPath));
 		return;
 	}
-	if (!FPaths::FileExists(WavPath))
+
+	if (*WaveInfo.pBitsPerSample != 16)
 	{
-		OnFinished.Broadcast(false, FString::Printf(TEXT("Wav not found: %s"), *WavPath));
+		OnFinished.Broadcast(false, FString::Printf(TEXT("Only PCM16 wav is supported: %s"), *WavPath));
 		return;
 	}
-	UE_LOG(LogTemp, Warning, TEXT("[Whisper] RunWhisperOnWav: %s"), *WavPath);
-	UE_LOG(LogTemp, Warning, TEXT("[Whisper] Exe=%s"), *ExePathAbs);
-	UE_LOG(LogTemp, Warning, TEXT("[Whisper] Model=%s"), *ModelPathAbs);
-	UE_LOG(LogTemp, Warning, TEXT("[Whisper] OutBase=%s"), *OutputBaseAbs);
 
+	UE_LOG(LogTemp, Log, TEXT("[Whisper] RunWhisperOnWav: %s"), *WavPath);
 
-	const FString ResultPath = OutputBaseAbs + TEXT(".txt");
-	IFileManager::Get().Delete(*ResultPath);
+	// data 청크만 떼어냄
+	TArray<uint8> Pcm16;
+	Pcm16.Append(WaveInfo.SampleDataStart, (int32)WaveInfo.SampleDataSize);
+	SubmitPcm16(MoveTemp(Pcm16), (int32)*WaveInfo.pSamplesPerSec, (int32)*WaveInfo.pChannels);
+}
 
-	const FString Args = FString::Printf(
-		TEXT("-m \"%s\" -f \"%s\" -l %s --no-timestamps -otxt -of \"%s\""),
-		*ModelPathAbs, *WavPath, *Language, *OutputBaseAbs
-	);
+void UWhisperSTTComponent::RunWhisperOnPcm16(const TArray<uint8>& Pcm16LE, int32 SampleRate, int32 NumChannels)
+{
+	TArray<uint8> Copy = Pcm16LE;
+	SubmitPcm16(MoveTemp(Copy), SampleRate, NumChannels);
+}
 
-	FProcHandle Proc = FPlatformProcess::CreateProc(
-		*ExePathAbs, *Args,
-		true,  /* detached */
-		true,  /* hidden */
-		true,  /* really hidden */
-		nullptr, 0, nullptr, nullptr
-	);
+uint32 UWhisperSTTComponent::SubmitPcm16(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels)
+{
+	return SubmitUtterance(FVoiceUtterancePool::Get().Wrap(MoveTemp(Pcm16LE), SampleRate, NumChannels));
+}
 
-	if (!Proc.IsValid())
+uint32 UWhisperSTTComponent::SubmitUtterance(const FVoiceUtterancePtr& Utterance)
+{
+	UWhisperSTTSubsystem* Subsystem = UWhisperSTTSubsystem::Get(this);
+	const FWhisperSpeechEnginePtr Engine = Subsystem ? Subsystem->StartEngine() : nullptr;
+	if (!Engine.IsValid())
 	{
-		OnFinished.Broadcast(false, TEXT("Failed to start whisper process (CreateProc invalid)."));
-		return;
+		OnFinished.Broadcast(false, TEXT("Whisper engine not available."));
+		return 0;
 	}
 
-	StartTimeSec = FPlatformTime::Seconds();
-	GetWorld()->GetTimerManager().SetTimer(PollTimer, this, &UWhisperSTTComponent::PollResultFile, PollIntervalSeconds, true);
+	++NumInFlight;
+
+	FWhisperRequestOptions Options;
+	Options.Language = Language;
+
+	TWeakObjectPtr<UWhisperSTTComponent> WeakThis(this);
+	return Engine->Submit(Utterance, Options,
+		[WeakThis](const FWhisperSpeechResult& Result)
+		{
+			if (UWhisperSTTComponent* Self = WeakThis.Get())
+			{
+				Self->HandleResult(Result);
+			}
+		});
+}
+
+void UWhisperSTTComponent::HandleResult(const FWhisperSpeechResult& Result)
+{
+	NumInFlight = FMath::Max(0, NumInFlight - 1);
+	LastResult = Result;
+
+	OnFinished.Broadcast(Result.bSuccess, Result.bSuccess ? Result.Text : Result.Error);
 }
 
-void UWhisperSTTComponent::PollResultFile()
+void UWhisperSTTComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	const double Now = FPlatformTime::Seconds();
-	if ((Now - StartTimeSec) > TimeoutSeconds)
+	CancelStreaming();
+	Super::EndPlay(EndPlayReason);
+}
+
+// ===== Streaming =====
+
+void UWhisperSTTComponent::BeginStreaming(int32 SampleRate, int32 NumChannels)
+{
+	UWhisperSTTSubsystem* Subsystem = UWhisperSTTSubsystem::Get(this);
+	const FWhisperSpeechEnginePtr Engine = Subsystem ? Subsystem->StartEngine() : nullptr;
+	if (!Engine.IsValid())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(PollTimer);
-		OnFinished.Broadcast(false, TEXT("Whisper timeout (result file not created)."));
+		OnFinished.Broadcast(false, TEXT("Whisper engine not available."));
 		return;
 	}
 
-	const FString ResultPath = OutputBaseAbs + TEXT(".txt");
-	if (!FPaths::FileExists(ResultPath))
-		return;
+	FWhisperStreamingTranscriber::FSettings Settings;
+	Settings.Language = Language;
+	Settings.bPartials = bPartialTranscripts;
+	Settings.PartialIntervalSec = PartialIntervalSec;
+	Settings.MaxWindowSec = MaxUncommittedSec;
+
+	CancelStreaming();
+	Streaming = MakeShared<FWhisperStreamingTranscriber, ESPMode::ThreadSafe>(Engine, Settings);
+
+	TWeakObjectPtr<UWhisperSTTComponent> WeakThis(this);
+	Streaming->Begin(SampleRate, NumChannels,
+		[WeakThis](const FString& Stable, const FString& Unstable)
+		{
+			if (UWhisperSTTComponent* Self = WeakThis.Get())
+			{
+				Self->OnPartialTranscript.Broadcast(Stable, Unstable);
+			}
+		},
+		[WeakThis](const FWhisperStreamingTranscriber::FFinal& Final)
+		{
+			if (UWhisperSTTComponent* Self = WeakThis.Get())
+			{
+				Self->HandleStreamingFinal(Final);
+			}
+		});
+}
 
-	GetWorld()->GetTimerManager().ClearTimer(PollTimer);
+void UWhisperSTTComponent::FeedStreamingPcm16(const TArray<uint8>& Pcm16LE)
+{
+	FeedStreamingPcm16Raw(Pcm16LE.GetData(), Pcm16LE.Num());
+}
 
-	FString Text;
-	if (!FFileHelper::LoadFileToString(Text, *ResultPath))
+void UWhisperSTTComponent::FeedStreamingPcm16Raw(const uint8* Pcm16LE, int32 NumBytes)
+{
+	if (Streaming.IsValid())
 	{
-		OnFinished.Broadcast(false, TEXT("Failed to read whisper result file."));
-		return;
+		Streaming->AddPcm16(Pcm16LE, NumBytes);
+	}
+}
+
+void UWhisperSTTComponent::FinishStreaming()
+{
+	if (Streaming.IsValid())
+	{
+		Streaming->Finish();
 	}
+}
 
-	Text.TrimStartAndEndInline();
-	OnFinished.Broadcast(true, Text);
+void UWhisperSTTComponent::CancelStreaming()
+{
+	if (Streaming.IsValid())
+	{
+		Streaming->Cancel();
+		Streaming.Reset();
+	}
+}
+
+void UWhisperSTTComponent::HandleStreamingFinal(const FWhisperStreamingTranscriber::FFinal& Final)
+{
+	LastStreamingFinal = Final;
+	OnFinished.Broadcast(Final.bSuccess, Final.bSuccess ? Final.Text : Final.Error);
 }
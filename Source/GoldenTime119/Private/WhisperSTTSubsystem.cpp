@@ -0,0 +1,58 @@
+// ============================ WhisperSTTSubsystem.cpp ============================
+#include "WhisperSTTSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/Paths.h"
+
+UWhisperSTTSubsystem* UWhisperSTTSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	return GI ? GI->GetSubsystem<UWhisperSTTSubsystem>() : nullptr;
+}
+
+void UWhisperSTTSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (bStartOnInitialize)
+	{
+		StartEngine();
+	}
+}
+
+void UWhisperSTTSubsystem::Deinitialize()
+{
+	if (Engine.IsValid())
+	{
+		Engine->Shutdown();
+		Engine.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+FWhisperSpeechEnginePtr UWhisperSTTSubsystem::StartEngine()
+{
+	if (Engine.IsValid())
+		return Engine;
+
+	FWhisperSpeechEngine::FConfig Config;
+	Config.ModelPath = ResolvePath(ModelPath);
+	Config.CliPath = ResolvePath(CliPath);
+	Config.Language = DefaultLanguage;
+	Config.NumWorkers = NumWorkers;
+	Config.ThreadsPerWorker = ThreadsPerWorker;
+
+	FWhisperSpeechEnginePtr NewEngine = MakeShared<FWhisperSpeechEngine, ESPMode::ThreadSafe>();
+	if (!NewEngine->Start(Config))
+		return nullptr;
+
+	Engine = NewEngine;
+	return Engine;
+}
+
+FString UWhisperSTTSubsystem::ResolvePath(const FString& Path)
+{
+	return FPaths::IsRelative(Path) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Path) : Path;
+}
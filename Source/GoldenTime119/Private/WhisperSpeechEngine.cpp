@@ -0,0 +1,670 @@
+// ============================ WhisperSpeechEngine.cpp ============================
+#include "WhisperSpeechEngine.h"
+#include "VoiceAudioDSP.h"
+#include "Async/Async.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Audio.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_WHISPER_CPP
+THIRD_PARTY_INCLUDES_START
+#include "whisper.h"
+THIRD_PARTY_INCLUDES_END
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogWhisperEngine, Log, All);
+
+namespace
+{
+	constexpr int32 WhisperSampleRate = 16000;
+
+#if WITH_WHISPER_CPP
+	void WhisperLogToUE(enum ggml_log_level Level, const char* Text, void* /*UserData*/)
+	{
+		if (!Text)
+			return;
+
+		FString Line = UTF8_TO_TCHAR(Text);
+		Line.TrimEndInline();
+		if (Line.IsEmpty())
+			return;
+
+		if (Level == GGML_LOG_LEVEL_ERROR)
+		{
+			UE_LOG(LogWhisperEngine, Error, TEXT("[whisper] %s"), *Line);
+		}
+		else if (Level == GGML_LOG_LEVEL_WARN)
+		{
+			UE_LOG(LogWhisperEngine, Warning, TEXT("[whisper] %s"), *Line);
+		}
+		else
+		{
+			UE_LOG(LogWhisperEngine, Verbose, TEXT("[whisper] %s"), *Line);
+		}
+	}
+
+	template<typename TRunning>
+	bool WhisperAbortCallback(void* UserData)
+	{
+		const TRunning* Running = static_cast<const TRunning*>(UserData);
+		return Running->bCancel.load(std::memory_order_relaxed) || Running->EngineAbort->load(std::memory_order_relaxed);
+	}
+#endif
+}
+
+// ===== Job =====
+
+class FWhisperSpeechEngine::FJob : public IQueuedWork
+{
+public:
+	FJob(FWhisperSpeechEngine& InEngine, FRequest&& InRequest, bool bInLoadOnly)
+		: Engine(InEngine)
+		, Request(MoveTemp(InRequest))
+		, bLoadOnly(bInLoadOnly)
+	{
+	}
+
+	virtual void DoThreadedWork() override
+	{
+		if (bLoadOnly)
+		{
+			Engine.EnsureModelLoaded();
+		}
+		else
+		{
+			Engine.RunRequest(Request);
+			Engine.NumPending.fetch_sub(1, std::memory_order_relaxed);
+		}
+		delete this;
+	}
+
+	virtual void Abandon() override
+	{
+		if (!bLoadOnly)
+		{
+			FWhisperSpeechResult Result;
+			Result.RequestId = Request.Id;
+			Result.Error = TEXT("Whisper engine shut down before the request ran.");
+			Complete(Request, MoveTemp(Result));
+			Engine.NumPending.fetch_sub(1, std::memory_order_relaxed);
+		}
+		delete this;
+	}
+
+private:
+	FWhisperSpeechEngine& Engine;
+	FRequest Request;
+	bool bLoadOnly = false;
+};
+
+// ===== Engine =====
+
+FWhisperSpeechEngine::FWhisperSpeechEngine()
+{
+}
+
+FWhisperSpeechEngine::~FWhisperSpeechEngine()
+{
+	Shutdown();
+}
+
+bool FWhisperSpeechEngine::IsCompiledIn()
+{
+	return WITH_WHISPER_CPP != 0;
+}
+
+bool FWhisperSpeechEngine::Start(const FConfig& InConfig)
+{
+	check(IsInGameThread());
+
+	if (Pool)
+		return true;
+
+	Config = InConfig;
+	Config.NumWorkers = FMath::Clamp(Config.NumWorkers, 1, 4);
+	if (Config.ThreadsPerWorker <= 0)
+	{
+		// 게임/렌더/오디오 스레드 몫으로 코어 하나는 남김
+		const int32 Cores = FPlatformMisc::NumberOfCores();
+		Config.ThreadsPerWorker = FMath::Clamp((Cores - 1) / Config.NumWorkers, 1, 8);
+	}
+
+	bAbort.store(false);
+	bLoadFailed.store(false);
+	CliWorkDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("Whisper/cli"));
+
+#if WITH_WHISPER_CPP
+	whisper_log_set(&WhisperLogToUE, nullptr);
+#endif
+
+	Pool = FQueuedThreadPool::Allocate();
+	if (!Pool->Create(Config.NumWorkers, 1024 * 1024, TPri_BelowNormal, TEXT("WhisperSTT")))
+	{
+		delete Pool;
+		Pool = nullptr;
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] Failed to create worker pool"));
+		return false;
+	}
+
+	UE_LOG(LogWhisperEngine, Log, TEXT("[Whisper] Engine start: workers=%d threads/worker=%d model=%s (%s)"),
+		Config.NumWorkers, Config.ThreadsPerWorker, *Config.ModelPath,
+		IsCompiledIn() ? TEXT("in-process") : *FString::Printf(TEXT("whisper-cli %s"), *Config.CliPath));
+
+	// 첫 요청이 모델 로드를 기다리지 않도록 바로 로드 시작
+	Pool->AddQueuedWork(new FJob(*this, FRequest(), true));
+	return true;
+}
+
+void FWhisperSpeechEngine::Shutdown()
+{
+	if (!Pool)
+		return;
+
+	// 실행 중인 whisper_full은 abort 콜백으로 빠져나오고, 대기 중인 작업은 Abandon
+	bAbort.store(true);
+	Pool->Destroy();
+	delete Pool;
+	Pool = nullptr;
+
+#if WITH_WHISPER_CPP
+	for (void* State : AllStates)
+	{
+		whisper_free_state(static_cast<whisper_state*>(State));
+	}
+	if (Context)
+	{
+		whisper_free(static_cast<whisper_context*>(Context));
+	}
+#endif
+
+	AllStates.Reset();
+	FreeStates.Reset();
+	Context = nullptr;
+	bModelLoaded.store(false);
+}
+
+uint32 FWhisperSpeechEngine::Submit(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete)
+{
+	return Submit(FVoiceUtterancePool::Get().Wrap(MoveTemp(Pcm16LE), SampleRate, NumChannels), Options, MoveTemp(OnComplete));
+}
+
+uint32 FWhisperSpeechEngine::Submit(const FVoiceUtterancePtr& Utterance, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete)
+{
+	FRequest Request;
+	Request.Audio = Utterance;
+	Request.Options = Options;
+	Request.OnComplete = MoveTemp(OnComplete);
+	Request.bGameThreadCallback = true;
+	return SubmitInternal(MoveTemp(Request));
+}
+
+uint32 FWhisperSpeechEngine::SubmitAnyThread(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete)
+{
+	return SubmitAnyThread(FVoiceUtterancePool::Get().Wrap(MoveTemp(Pcm16LE), SampleRate, NumChannels), Options, MoveTemp(OnComplete));
+}
+
+uint32 FWhisperSpeechEngine::SubmitAnyThread(const FVoiceUtterancePtr& Utterance, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete)
+{
+	FRequest Request;
+	Request.Audio = Utterance;
+	Request.Options = Options;
+	Request.OnComplete = MoveTemp(OnComplete);
+	Request.bGameThreadCallback = false;
+	return SubmitInternal(MoveTemp(Request));
+}
+
+uint32 FWhisperSpeechEngine::SubmitInternal(FRequest&& Request)
+{
+	Request.SubmitTime = FPlatformTime::Seconds();
+	if (Request.Options.Language.IsEmpty())
+	{
+		Request.Options.Language = Config.Language;
+	}
+
+	FString Error;
+	if (!Pool)
+	{
+		Error = TEXT("Whisper engine not started.");
+	}
+	else if (bLoadFailed.load(std::memory_order_acquire))
+	{
+		Error = FString::Printf(TEXT("Whisper model failed to load: %s"), *Config.ModelPath);
+	}
+	else if (!Request.Audio.IsValid() || Request.Audio->SampleRate <= 0 || Request.Audio->GetNumFrames() <= 0)
+	{
+		Error = TEXT("Empty or invalid PCM.");
+	}
+
+	if (!Error.IsEmpty())
+	{
+		FWhisperSpeechResult Result;
+		Result.Error = Error;
+		Complete(Request, MoveTemp(Result));
+		return 0;
+	}
+
+	const uint32 Id = NextRequestId.fetch_add(1, std::memory_order_relaxed);
+	Request.Id = Id;
+
+	NumPending.fetch_add(1, std::memory_order_relaxed);
+	Pool->AddQueuedWork(new FJob(*this, MoveTemp(Request), false));
+	return Id;
+}
+
+void FWhisperSpeechEngine::Cancel(uint32 RequestId)
+{
+	if (RequestId == 0)
+		return;
+
+	FScopeLock Lock(&CancelLock);
+	for (FRunning* Running : RunningRequests)
+	{
+		if (Running->Id == RequestId)
+		{
+			Running->bCancel.store(true, std::memory_order_relaxed);
+			return;
+		}
+	}
+	CancelledIds.Add(RequestId);
+}
+
+bool FWhisperSpeechEngine::BeginRunning(FRunning& Running)
+{
+	FScopeLock Lock(&CancelLock);
+	if (CancelledIds.Remove(Running.Id) > 0)
+		return false;
+
+	Running.EngineAbort = &bAbort;
+	RunningRequests.Add(&Running);
+	return true;
+}
+
+void FWhisperSpeechEngine::EndRunning(FRunning& Running)
+{
+	FScopeLock Lock(&CancelLock);
+	RunningRequests.RemoveSingleSwap(&Running, false);
+}
+
+void FWhisperSpeechEngine::Complete(FRequest& Request, FWhisperSpeechResult&& Result)
+{
+	if (!Request.OnComplete)
+		return;
+
+	if (!Request.bGameThreadCallback || IsInGameThread())
+	{
+		Request.OnComplete(Result);
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [OnComplete = MoveTemp(Request.OnComplete), Result = MoveTemp(Result)]()
+		{
+			OnComplete(Result);
+		});
+}
+
+// ===== Worker =====
+
+bool FWhisperSpeechEngine::EnsureModelLoaded()
+{
+	if (bModelLoaded.load(std::memory_order_acquire))
+		return true;
+
+	FScopeLock Lock(&ModelLock);
+
+	if (bModelLoaded.load(std::memory_order_acquire))
+		return true;
+	if (bLoadFailed.load(std::memory_order_acquire))
+		return false;
+
+#if WITH_WHISPER_CPP
+	const double T0 = FPlatformTime::Seconds();
+
+	if (!FPaths::FileExists(Config.ModelPath))
+	{
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] Model not found: %s"), *Config.ModelPath);
+		bLoadFailed.store(true, std::memory_order_release);
+		return false;
+	}
+
+	whisper_context_params CtxParams = whisper_context_default_params();
+	CtxParams.use_gpu = false;
+
+	whisper_context* Ctx = whisper_init_from_file_with_params_no_state(TCHAR_TO_UTF8(*Config.ModelPath), CtxParams);
+	if (!Ctx)
+	{
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] whisper_init failed: %s"), *Config.ModelPath);
+		bLoadFailed.store(true, std::memory_order_release);
+		return false;
+	}
+
+	// 가중치는 컨텍스트 하나를 공유하고, 워커마다 디코더 상태(KV 캐시 등)만 따로 둠
+	for (int32 i = 0; i < Config.NumWorkers; ++i)
+	{
+		whisper_state* State = whisper_init_state(Ctx);
+		if (!State)
+			break;
+
+		AllStates.Add(State);
+		FreeStates.Add(State);
+	}
+
+	if (AllStates.Num() == 0)
+	{
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] whisper_init_state failed"));
+		whisper_free(Ctx);
+		bLoadFailed.store(true, std::memory_order_release);
+		return false;
+	}
+
+	Context = Ctx;
+	ModelLoadSec = FPlatformTime::Seconds() - T0;
+	bModelLoaded.store(true, std::memory_order_release);
+
+	UE_LOG(LogWhisperEngine, Log, TEXT("[Whisper] Model loaded in %.2f s (%d states): %s"),
+		ModelLoadSec, AllStates.Num(), *Config.ModelPath);
+	return true;
+#else
+	// 프로세스 폴백: 모델은 요청마다 whisper-cli가 읽으므로 파일 확인만
+	if (!FPaths::FileExists(Config.CliPath))
+	{
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] Built without whisper.cpp and whisper-cli not found: %s"), *Config.CliPath);
+		bLoadFailed.store(true, std::memory_order_release);
+		return false;
+	}
+	if (!FPaths::FileExists(Config.ModelPath))
+	{
+		UE_LOG(LogWhisperEngine, Error, TEXT("[Whisper] Model not found: %s"), *Config.ModelPath);
+		bLoadFailed.store(true, std::memory_order_release);
+		return false;
+	}
+
+	IFileManager::Get().MakeDirectory(*CliWorkDir, true);
+	bModelLoaded.store(true, std::memory_order_release);
+
+	UE_LOG(LogWhisperEngine, Log, TEXT("[Whisper] Built without whisper.cpp: decoding with %s (model reloaded per request)"), *Config.CliPath);
+	return true;
+#endif
+}
+
+void* FWhisperSpeechEngine::AcquireState()
+{
+	// 상태 수 == 워커 수라 빈 상태가 없을 일은 없음
+	FScopeLock Lock(&StateLock);
+	return FreeStates.Num() > 0 ? FreeStates.Pop(false) : nullptr;
+}
+
+void FWhisperSpeechEngine::ReleaseState(void* State)
+{
+	FScopeLock Lock(&StateLock);
+	FreeStates.Add(State);
+}
+
+void FWhisperSpeechEngine::ConvertTo16kMono(const FRequest& Request, TArray<float>& OutSamples) const
+{
+	const FVoiceUtterance& Audio = *Request.Audio;
+	const int32 Channels = FMath::Max(1, Audio.NumChannels);
+	const int32 NumFrames = (int32)Audio.GetNumFrames();
+	const int16* Src = reinterpret_cast<const int16*>(Audio.Pcm16LE.GetData());
+
+	TArray<float> Mono;
+	Mono.SetNumUninitialized(NumFrames);
+
+	const float Scale = 1.f / 32768.f;
+	for (int32 f = 0; f < NumFrames; ++f)
+	{
+		int32 Sum = 0;
+		for (int32 c = 0; c < Channels; ++c)
+		{
+			Sum += Src[f * Channels + c];
+		}
+		Mono[f] = (float)Sum * Scale / (float)Channels;
+	}
+
+	if (Audio.SampleRate == WhisperSampleRate)
+	{
+		OutSamples = MoveTemp(Mono);
+	}
+	else
+	{
+		FVoicePolyphaseResampler Resampler;
+		Resampler.Init(Audio.SampleRate, WhisperSampleRate);
+
+		OutSamples.SetNumUninitialized(Resampler.GetMaxOutput(NumFrames));
+		const int32 Written = Resampler.Process(Mono.GetData(), NumFrames, OutSamples.GetData());
+		OutSamples.SetNum(Written, false);
+	}
+
+	// 너무 짧은 입력은 뒤를 무음으로 채움
+	const int32 MinSamples = (int32)(Config.MinInputSec * WhisperSampleRate);
+	if (OutSamples.Num() < MinSamples)
+	{
+		OutSamples.SetNumZeroed(MinSamples);
+	}
+}
+
+void FWhisperSpeechEngine::RunCliRequest(const FRequest& Request, const TArray<float>& Samples, const FRunning& Running, FWhisperSpeechResult& Result) const
+{
+	const FString BasePath = CliWorkDir / FString::Printf(TEXT("req_%u"), Request.Id);
+	const FString WavPath = BasePath + TEXT(".wav");
+	const FString JsonPath = BasePath + TEXT(".json");
+	ON_SCOPE_EXIT
+	{
+		IFileManager::Get().Delete(*WavPath, false, true, true);
+		IFileManager::Get().Delete(*JsonPath, false, true, true);
+	};
+
+	// 16 kHz mono PCM16 WAV
+	{
+		TArray<int16> Pcm;
+		Pcm.SetNumUninitialized(Samples.Num());
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			Pcm[i] = (int16)FMath::Clamp(FMath::RoundToInt(Samples[i] * 32767.f), -32768, 32767);
+		}
+
+		TArray<uint8> Wav;
+		SerializeWaveFile(Wav, reinterpret_cast<const uint8*>(Pcm.GetData()), Pcm.Num() * (int32)sizeof(int16), 1, WhisperSampleRate);
+		if (!FFileHelper::SaveArrayToFile(Wav, *WavPath))
+		{
+			Result.Error = FString::Printf(TEXT("Failed to write %s"), *WavPath);
+			return;
+		}
+	}
+
+	FString Args = FString::Printf(TEXT("-m \"%s\" -f \"%s\" -l %s -t %d -np -oj -of \"%s\""),
+		*Config.ModelPath, *WavPath, *Request.Options.Language, Config.ThreadsPerWorker, *BasePath);
+	if (!Request.Options.Prompt.IsEmpty())
+	{
+		Args += FString::Printf(TEXT(" --prompt \"%s\""), *Request.Options.Prompt.Replace(TEXT("\""), TEXT("'")));
+	}
+
+	FProcHandle Proc = FPlatformProcess::CreateProc(*Config.CliPath, *Args, false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!Proc.IsValid())
+	{
+		Result.Error = FString::Printf(TEXT("Failed to start %s"), *Config.CliPath);
+		return;
+	}
+
+	// 취소/종료는 프로세스를 끊어서 (whisper_full의 abort 콜백 대신)
+	bool bAborted = false;
+	while (FPlatformProcess::IsProcRunning(Proc))
+	{
+		if (Running.bCancel.load(std::memory_order_relaxed) || bAbort.load(std::memory_order_relaxed))
+		{
+			FPlatformProcess::TerminateProc(Proc, true);
+			bAborted = true;
+			break;
+		}
+		FPlatformProcess::Sleep(0.005f);
+	}
+
+	int32 ReturnCode = 0;
+	FPlatformProcess::GetProcReturnCode(Proc, &ReturnCode);
+	FPlatformProcess::CloseProc(Proc);
+
+	if (bAborted)
+	{
+		Result.bCancelled = Running.bCancel.load(std::memory_order_relaxed);
+		Result.Error = TEXT("Whisper inference aborted.");
+		return;
+	}
+
+	// {"transcription":[{"offsets":{"from":ms,"to":ms},"text":"..."}, ...]}
+	FString Json;
+	TSharedPtr<FJsonObject> Root;
+	const TArray<TSharedPtr<FJsonValue>>* Transcription = nullptr;
+	if (!FFileHelper::LoadFileToString(Json, *JsonPath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid()
+		|| !Root->TryGetArrayField(TEXT("transcription"), Transcription))
+	{
+		Result.Error = FString::Printf(TEXT("whisper-cli failed (%d): no result."), ReturnCode);
+		return;
+	}
+
+	Result.Segments.Reserve(Transcription->Num());
+	for (const TSharedPtr<FJsonValue>& Value : *Transcription)
+	{
+		const TSharedPtr<FJsonObject> Item = Value.IsValid() ? Value->AsObject() : nullptr;
+		if (!Item.IsValid())
+			continue;
+
+		FWhisperSpeechSegment& Segment = Result.Segments.AddDefaulted_GetRef();
+		Segment.Text = Item->GetStringField(TEXT("text"));
+
+		const TSharedPtr<FJsonObject>* Offsets = nullptr;
+		if (Item->TryGetObjectField(TEXT("offsets"), Offsets))
+		{
+			Segment.StartSec = (float)(*Offsets)->GetNumberField(TEXT("from")) * 0.001f;
+			Segment.EndSec = (float)(*Offsets)->GetNumberField(TEXT("to")) * 0.001f;
+		}
+
+		Result.Text += Segment.Text;
+	}
+	Result.Text.TrimStartAndEndInline();
+	Result.bSuccess = true;
+}
+
+void FWhisperSpeechEngine::RunRequest(FRequest& Request)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FWhisperSpeechResult Result;
+	Result.RequestId = Request.Id;
+	Result.QueueSec = StartTime - Request.SubmitTime;
+	Result.AudioSec = Request.Audio.IsValid() ? Request.Audio->GetDurationSec() : 0.0;
+
+	if (bAbort.load(std::memory_order_relaxed))
+	{
+		Result.Error = TEXT("Whisper engine shutting down.");
+		Complete(Request, MoveTemp(Result));
+		return;
+	}
+
+	FRunning Running;
+	Running.Id = Request.Id;
+	if (!BeginRunning(Running))
+	{
+		Result.bCancelled = true;
+		Result.Error = TEXT("Cancelled.");
+		Complete(Request, MoveTemp(Result));
+		return;
+	}
+	ON_SCOPE_EXIT{ EndRunning(Running); };
+
+	if (!EnsureModelLoaded())
+	{
+		Result.Error = FString::Printf(TEXT("Whisper model not available: %s"), *Config.ModelPath);
+		Complete(Request, MoveTemp(Result));
+		return;
+	}
+
+#if WITH_WHISPER_CPP
+	TArray<float> Samples;
+	ConvertTo16kMono(Request, Samples);
+
+	// 원본 PCM은 더 필요 없음 (마지막 참조면 버퍼가 풀로 돌아감)
+	Request.Audio.Reset();
+
+	whisper_state* State = static_cast<whisper_state*>(AcquireState());
+	if (!State)
+	{
+		Result.Error = TEXT("No free whisper state.");
+		Complete(Request, MoveTemp(Result));
+		return;
+	}
+
+	const FTCHARToUTF8 LanguageUtf8(*Request.Options.Language);
+	const FTCHARToUTF8 PromptUtf8(*Request.Options.Prompt);
+
+	whisper_full_params Params = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+	Params.n_threads = Config.ThreadsPerWorker;
+	Params.language = LanguageUtf8.Get();
+	Params.translate = false;
+	Params.no_context = true;          // 무전 한 번 = 독립 발화
+	Params.no_timestamps = !Request.Options.bSegmentTimestamps;
+	Params.initial_prompt = Request.Options.Prompt.IsEmpty() ? nullptr : PromptUtf8.Get();
+	Params.single_segment = false;
+	Params.print_progress = false;
+	Params.print_realtime = false;
+	Params.print_special = false;
+	Params.print_timestamps = false;
+	Params.abort_callback = &WhisperAbortCallback<FRunning>;
+	Params.abort_callback_user_data = &Running;
+
+	whisper_context* Ctx = static_cast<whisper_context*>(Context);
+	const int Rc = whisper_full_with_state(Ctx, State, Params, Samples.GetData(), Samples.Num());
+
+	if (Rc == 0)
+	{
+		const int NumSegments = whisper_full_n_segments_from_state(State);
+		Result.Segments.Reserve(NumSegments);
+		for (int i = 0; i < NumSegments; ++i)
+		{
+			FWhisperSpeechSegment& Segment = Result.Segments.AddDefaulted_GetRef();
+			Segment.Text = UTF8_TO_TCHAR(whisper_full_get_segment_text_from_state(State, i));
+
+			// t0/t1은 10ms 단위
+			Segment.StartSec = (float)whisper_full_get_segment_t0_from_state(State, i) * 0.01f;
+			Segment.EndSec = (float)whisper_full_get_segment_t1_from_state(State, i) * 0.01f;
+
+			Result.Text += Segment.Text;
+		}
+		Result.Text.TrimStartAndEndInline();
+		Result.bSuccess = true;
+	}
+	else
+	{
+		Result.bCancelled = Running.bCancel.load(std::memory_order_relaxed);
+		Result.Error = (Result.bCancelled || bAbort.load(std::memory_order_relaxed))
+			? FString(TEXT("Whisper inference aborted."))
+			: FString::Printf(TEXT("whisper_full failed (%d)."), Rc);
+	}
+
+	ReleaseState(State);
+#else
+	TArray<float> Samples;
+	ConvertTo16kMono(Request, Samples);
+	Request.Audio.Reset();
+
+	RunCliRequest(Request, Samples, Running, Result);
+#endif
+
+	Result.DecodeSec = FPlatformTime::Seconds() - StartTime;
+	NumCompleted.fetch_add(1, std::memory_order_relaxed);
+
+	UE_LOG(LogWhisperEngine, Log, TEXT("[Whisper] #%u %s audio=%.2fs queue=%.0fms decode=%.0fms (RTF %.2f)"),
+		Result.RequestId, Result.bSuccess ? TEXT("ok") : TEXT("FAIL"), Result.AudioSec,
+		Result.QueueSec * 1000.0, Result.DecodeSec * 1000.0,
+		Result.AudioSec > 0.0 ? Result.DecodeSec / Result.AudioSec : 0.0);
+
+	Complete(Request, MoveTemp(Result));
+}
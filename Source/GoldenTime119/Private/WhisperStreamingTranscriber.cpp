@@ -0,0 +1,270 @@
+// ============================ WhisperStreamingTranscriber.cpp ============================
+#include "WhisperStreamingTranscriber.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogWhisperStreaming, Log, All);
+
+namespace
+{
+	// 릴리스 때 이보다 짧은 미확정 구간은 디코드하지 않음
+	constexpr double MinFinalWindowSec = 0.2;
+
+	int32 CommonPrefixLength(const FString& A, const FString& B)
+	{
+		const int32 Num = FMath::Min(A.Len(), B.Len());
+		int32 i = 0;
+		while (i < Num && A[i] == B[i])
+		{
+			++i;
+		}
+		return i;
+	}
+}
+
+FWhisperStreamingTranscriber::FWhisperStreamingTranscriber(const FWhisperSpeechEnginePtr& InEngine, const FSettings& InSettings)
+	: Engine(InEngine)
+	, Settings(InSettings)
+{
+	Settings.PartialIntervalSec = FMath::Max(0.25f, Settings.PartialIntervalSec);
+	Settings.MaxWindowSec = FMath::Max(2.f * Settings.PartialIntervalSec, Settings.MaxWindowSec);
+}
+
+FWhisperStreamingTranscriber::~FWhisperStreamingTranscriber()
+{
+	if (InFlightId != 0 && Engine.IsValid())
+	{
+		Engine->Cancel(InFlightId);
+	}
+}
+
+void FWhisperStreamingTranscriber::Begin(int32 InSampleRate, int32 InNumChannels, FOnPartial&& InOnPartial, FOnFinal&& InOnFinal)
+{
+	check(IsInGameThread());
+
+	if (bActive)
+	{
+		Cancel();
+	}
+
+	Reset();
+
+	SampleRate = FMath::Max(8000, InSampleRate);
+	NumChannels = FMath::Clamp(InNumChannels, 1, 2);
+	OnPartial = MoveTemp(InOnPartial);
+	OnFinal = MoveTemp(InOnFinal);
+
+	// 강제 확정 전까지 창이 자랄 수 있는 만큼 미리 잡아둠
+	Window.Reserve((int32)((Settings.MaxWindowSec + Settings.PartialIntervalSec) * SampleRate) * BytesPerFrame());
+	bActive = true;
+}
+
+void FWhisperStreamingTranscriber::AddPcm16(const uint8* Data, int32 NumBytes)
+{
+	if (!bActive || bFinishing || !Data || NumBytes <= 0)
+		return;
+
+	const int32 Frames = NumBytes / BytesPerFrame();
+	Window.Append(Data, Frames * BytesPerFrame());
+	TotalFrames += Frames;
+
+	MaybeSubmitPartial();
+}
+
+void FWhisperStreamingTranscriber::Finish()
+{
+	if (!bActive || bFinishing)
+		return;
+
+	bFinishing = true;
+	ReleaseTime = FPlatformTime::Seconds();
+
+	// 진행 중인 부분 디코드는 버리고 바로 최종 디코드
+	if (InFlightId != 0)
+	{
+		Engine->Cancel(InFlightId);
+		InFlightId = 0;
+	}
+
+	const int64 WindowFrames = Window.Num() / BytesPerFrame();
+	FinalWindowSec = FramesToSec(WindowFrames);
+
+	if (FinalWindowSec < MinFinalWindowSec)
+	{
+		FWhisperSpeechResult Empty;
+		Empty.bSuccess = true;
+		HandleResult(Generation, true, WindowStartFrame, Empty);
+		return;
+	}
+
+	InFlightId = SubmitWindow(true);
+}
+
+void FWhisperStreamingTranscriber::Cancel()
+{
+	if (InFlightId != 0 && Engine.IsValid())
+	{
+		Engine->Cancel(InFlightId);
+	}
+	Reset();
+}
+
+void FWhisperStreamingTranscriber::Reset()
+{
+	++Generation;
+
+	bActive = false;
+	bFinishing = false;
+	Window.Reset();
+	WindowStartFrame = 0;
+	TotalFrames = 0;
+	LastSubmittedEndFrame = 0;
+	CommittedText.Reset();
+	PrevUnstableText.Reset();
+	InFlightId = 0;
+	NumPartials = 0;
+	ReleaseTime = 0.0;
+	FinalWindowSec = 0.0;
+}
+
+void FWhisperStreamingTranscriber::MaybeSubmitPartial()
+{
+	if (!Settings.bPartials || !bActive || bFinishing || InFlightId != 0 || !Engine.IsValid())
+		return;
+
+	if (FramesToSec(TotalFrames - LastSubmittedEndFrame) < Settings.PartialIntervalSec)
+		return;
+
+	if (FramesToSec(Window.Num() / BytesPerFrame()) < Settings.MinPartialAudioSec)
+		return;
+
+	InFlightId = SubmitWindow(false);
+}
+
+uint32 FWhisperStreamingTranscriber::SubmitWindow(bool bFinal)
+{
+	FWhisperRequestOptions Options;
+	Options.Language = Settings.Language;
+	Options.Prompt = CommittedText.Right(Settings.MaxPromptChars);
+	Options.bSegmentTimestamps = !bFinal;
+
+	// 창은 길어야 MaxWindowSec 정도라 복사는 싸고, 게임 스레드는 계속 창에 이어 붙일 수 있음
+	TArray<uint8> Pcm = FVoiceUtterancePool::Get().Acquire(Window.Num());
+	Pcm.Append(Window);
+	LastSubmittedEndFrame = TotalFrames;
+
+	const TWeakPtr<FWhisperStreamingTranscriber, ESPMode::ThreadSafe> WeakThis = AsShared();
+	const uint32 Gen = Generation;
+	const int64 Start = WindowStartFrame;
+
+	return Engine->Submit(MoveTemp(Pcm), SampleRate, NumChannels, Options,
+		[WeakThis, Gen, bFinal, Start](const FWhisperSpeechResult& Result)
+		{
+			if (const FWhisperStreamingTranscriberPtr This = WeakThis.Pin())
+			{
+				This->HandleResult(Gen, bFinal, Start, Result);
+			}
+		});
+}
+
+void FWhisperStreamingTranscriber::HandleResult(uint32 InGeneration, bool bFinal, int64 WindowStart, const FWhisperSpeechResult& Result)
+{
+	// 이전 발화의 결과, 또는 릴리스 때 취소한 부분 디코드
+	if (InGeneration != Generation || (!bFinal && bFinishing))
+		return;
+
+	InFlightId = 0;
+
+	if (bFinal)
+	{
+		FFinal Final;
+		Final.bSuccess = Result.bSuccess || !CommittedText.IsEmpty();
+		Final.Text = (CommittedText + Result.Text).TrimStartAndEnd();
+		Final.Error = Result.Error;
+		Final.ReleaseToTextSec = FPlatformTime::Seconds() - ReleaseTime;
+		Final.AudioSec = FramesToSec(TotalFrames);
+		Final.FinalWindowSec = FinalWindowSec;
+		Final.NumPartials = NumPartials;
+
+		UE_LOG(LogWhisperStreaming, Log, TEXT("[WhisperStream] Final: audio=%.2fs finalWindow=%.2fs partials=%d release->text=%.0fms"),
+			Final.AudioSec, Final.FinalWindowSec, Final.NumPartials, Final.ReleaseToTextSec * 1000.0);
+
+		// 콜백 안에서 다음 발화를 Begin해도 되도록 먼저 정리
+		FOnFinal Callback = MoveTemp(OnFinal);
+		Reset();
+		if (Callback)
+		{
+			Callback(Final);
+		}
+		return;
+	}
+
+	if (Result.bSuccess)
+	{
+		++NumPartials;
+		ApplyPartial(WindowStart, Result);
+	}
+
+	MaybeSubmitPartial();
+}
+
+void FWhisperStreamingTranscriber::ApplyPartial(int64 WindowStart, const FWhisperSpeechResult& Result)
+{
+	if (WindowStart != WindowStartFrame)
+	{
+		PrevUnstableText.Reset();
+		return;
+	}
+
+	FString CurrentText;
+	for (const FWhisperSpeechSegment& Segment : Result.Segments)
+	{
+		CurrentText += Segment.Text;
+	}
+
+	// 직전 디코드와 일치하는 앞부분 안에서 끝나는 세그먼트까지 확정 (마지막 세그먼트는 말이 끊겼을 수 있어 제외)
+	const int32 Agreed = CommonPrefixLength(PrevUnstableText, CurrentText);
+	const bool bForce = FramesToSec(Window.Num() / BytesPerFrame()) > Settings.MaxWindowSec;
+
+	int32 CommitCount = 0;
+	int32 CommitChars = 0;
+	for (int32 i = 0, Chars = 0; i < Result.Segments.Num() - 1; ++i)
+	{
+		Chars += Result.Segments[i].Text.Len();
+		if (!bForce && Chars > Agreed)
+			break;
+
+		CommitCount = i + 1;
+		CommitChars = Chars;
+	}
+
+	FString Unstable = CurrentText;
+	if (CommitCount > 0)
+	{
+		const FWhisperSpeechSegment& Last = Result.Segments[CommitCount - 1];
+		const int64 EndFrame = WindowStart + (int64)FMath::RoundToDouble((double)Last.EndSec * SampleRate);
+
+		CommitUpTo(EndFrame, CurrentText.Left(CommitChars));
+		Unstable = CurrentText.Mid(CommitChars);
+	}
+
+	PrevUnstableText = Unstable;
+
+	if (OnPartial)
+	{
+		OnPartial(CommittedText.TrimStart(), Unstable.TrimStart());
+	}
+}
+
+void FWhisperStreamingTranscriber::CommitUpTo(int64 Frame, const FString& Text)
+{
+	const int64 WindowFrames = Window.Num() / BytesPerFrame();
+	const int64 Drop = FMath::Clamp<int64>(Frame - WindowStartFrame, 0, WindowFrames);
+
+	if (Drop > 0)
+	{
+		Window.RemoveAt(0, (int32)Drop * BytesPerFrame(), false);
+		WindowStartFrame += Drop;
+	}
+
+	CommittedText += Text;
+}
@@ -0,0 +1,99 @@
+// ============================ AudioSpscFrameRing.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Single-producer / single-consumer ring of fixed-size audio frames.
+ *  - Storage is allocated once in Init() while neither side is running.
+ *  - After that the producer (audio thread) and consumer (game thread) never allocate, lock or wait.
+ *  - Producer: BeginWrite() -> fill the slot -> CommitWrite(). BeginWrite() returns nullptr when full.
+ *  - Consumer: Peek() -> read the slot -> Pop().
+ *  - Each slot also carries a uint32 tag (e.g. VAD flags) set by the producer before CommitWrite().
+ */
+template <typename SampleType>
+class TAudioSpscFrameRing
+{
+public:
+	// Slot count is rounded up to a power of two so the indices can wrap freely
+	void Init(int32 InNumSlots, int32 InSlotSamples)
+	{
+		NumSlots = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(2, InNumSlots));
+		SlotSamples = FMath::Max(1, InSlotSamples);
+		Storage.SetNumZeroed(NumSlots * SlotSamples);
+		Tags.SetNumZeroed(NumSlots);
+		Reset();
+	}
+
+	// 양쪽 스레드가 모두 멈춰 있을 때만 호출
+	void Reset()
+	{
+		WriteIndex.store(0, std::memory_order_relaxed);
+		ReadIndex.store(0, std::memory_order_relaxed);
+	}
+
+	int32 GetNumSlots() const { return NumSlots; }
+	int32 GetSlotSamples() const { return SlotSamples; }
+
+	int32 NumQueued() const
+	{
+		return (int32)(WriteIndex.load(std::memory_order_acquire) - ReadIndex.load(std::memory_order_acquire));
+	}
+
+	// ===== Producer =====
+
+	SampleType* BeginWrite()
+	{
+		const uint32 W = WriteIndex.load(std::memory_order_relaxed);
+		const uint32 R = ReadIndex.load(std::memory_order_acquire);
+		if (NumSlots == 0 || W - R >= (uint32)NumSlots)
+			return nullptr;
+
+		return Storage.GetData() + (W & (uint32)(NumSlots - 1)) * SlotSamples;
+	}
+
+	// BeginWrite()가 돌려준 슬롯의 태그
+	void SetWriteTag(uint32 Tag)
+	{
+		Tags[WriteIndex.load(std::memory_order_relaxed) & (uint32)(NumSlots - 1)] = Tag;
+	}
+
+	void CommitWrite()
+	{
+		WriteIndex.store(WriteIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	// ===== Consumer =====
+
+	const SampleType* Peek() const
+	{
+		const uint32 R = ReadIndex.load(std::memory_order_relaxed);
+		const uint32 W = WriteIndex.load(std::memory_order_acquire);
+		if (R == W)
+			return nullptr;
+
+		return Storage.GetData() + (R & (uint32)(NumSlots - 1)) * SlotSamples;
+	}
+
+	// Peek()이 돌려준 슬롯의 태그
+	uint32 PeekTag() const
+	{
+		return Tags[ReadIndex.load(std::memory_order_relaxed) & (uint32)(NumSlots - 1)];
+	}
+
+	void Pop()
+	{
+		ReadIndex.store(ReadIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+private:
+	TArray<SampleType> Storage;
+	TArray<uint32> Tags;
+	int32 NumSlots = 0;
+	int32 SlotSamples = 0;
+
+	// 서로 다른 캐시라인에 두어 producer/consumer가 같은 라인을 두고 다투지 않게
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> WriteIndex { 0 };
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> ReadIndex { 0 };
+};
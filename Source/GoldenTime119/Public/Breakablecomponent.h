@@ -155,6 +155,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Breakable")
     float ApplyDamage(float BaseDamage, EBreakToolType ToolUsed, FVector HitLocation, FVector HitNormal);
 
+    //    ( з ).  ռ/ȿ   ״ 
+    UFUNCTION(BlueprintCallable, Category = "Breakable")
+    float ApplyBlastDamage(float Damage, FVector HitLocation, FVector HitNormal);
+
     //  ı
     UFUNCTION(BlueprintCallable, Category = "Breakable")
     void ForceBreak();
@@ -179,6 +183,8 @@ protected:
     virtual void BeginPlay() override;
 
 private:
+    // HP    ó (Ʈ/Ʈ//ı)
+    float FinishDamage(float FinalDamage, EBreakToolType ToolUsed, FVector HitLocation, FVector HitNormal);
     void UpdateBreakState();
     void SetBreakState(EBreakableState NewState);
     void ExecuteBreak(FVector HitLocation);
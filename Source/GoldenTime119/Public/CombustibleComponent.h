@@ -11,6 +11,10 @@
 
 class ARoomActor;
 class AFireActor;
+class UCombustibleComponent;
+
+// ϴ  /ȭ з ó   1ȸ (PressureVessel )
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCombustibleHeatActivity, UCombustibleComponent*, Combustible);
 
 USTRUCT(BlueprintType)
 struct FCombustibleIgnitionParams
@@ -155,6 +159,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Combustible|Debug")
     AFireActor* ForceIgnite(bool bAllowElectric = true);
 
+    // Idle -> heated edge. Not fired again until the combustible has gone quiet.
+    UPROPERTY(BlueprintAssignable, Category = "Combustible|Events")
+    FOnCombustibleHeatActivity OnHeatActivityBegin;
+
+    //  Է/ȭ /  ϳ  true
+    bool HasHeatActivity() const { return bHeatActivityActive; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -192,7 +203,10 @@ private:
     // Ƽ  
     void UpdateSmolderAudio(float DeltaTime);
 
+    void MarkHeatActivity();
+
 private:
     bool bComponentsNeedRecreation = false;
     bool bWasWaterSoundPlaying = false;
+    bool bHeatActivityActive = false;
 };
@@ -234,6 +234,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Door|VentHole")
     bool HasVentHoles() const { return VentHoles.Num() > 0; }
 
+    // ===== Blast ( ) =====
+
+    //   ̸̻   ° 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door|Blast", meta = (ClampMin = "0.0"))
+    float BlastBlowOpenPressure = 80.f;
+
+    //  -> Breakable  
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door|Blast", meta = (ClampMin = "0.0"))
+    float BlastDamageScale = 1.0f;
+
+    //  (ƴ)    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door|Blast", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float BlastClosedTransmission = 0.1f;
+
+    //   ޴´. ļ/ ó  ݴ ޵Ǵ (0..1) ȯ
+    UFUNCTION(BlueprintCallable, Category = "Door|Blast")
+    float ReceiveBlastOverpressure(float Overpressure, FVector SourceLocation);
+
     // ===== Grab feedback (Backdraft) =====
     UPROPERTY(EditAnywhere, Category = "Door|Grab|Feedback")
     bool bEnableBackdraftGrabFeedback = true;
@@ -256,7 +274,7 @@ public:
     UPROPERTY(EditAnywhere, Category = "Door|Grab|Audio", meta = (EditCondition = "bLatchGrabRandomPitch", ClampMin = "0.1"))
     float LatchPitchMax = 1.05f;
 
-    // ƽ ().  PC->PlayHapticEffect .
+    // ƽ ().  UVRHapticsSubsystem ͼ  տ  (Warning 켱).
     // (  HapticFeedbackEffect_Curve/Buffer  )
     UPROPERTY(EditAnywhere, Category = "Door|Grab|Haptics")
     TObjectPtr<class UHapticFeedbackEffect_Base> BackdraftGrabHaptic = nullptr;
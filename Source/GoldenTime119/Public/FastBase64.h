@@ -0,0 +1,26 @@
+// ============================ FastBase64.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Standard (RFC 4648, padded) Base64 straight into caller-owned ANSI buffers.
+// Unlike FBase64 there is no FString in between, so the result can go onto the wire as UTF-8 as-is.
+namespace FastBase64
+{
+	FORCEINLINE int32 GetEncodedLength(int32 NumBytes)
+	{
+		return ((NumBytes + 2) / 3) * 4;
+	}
+
+	FORCEINLINE int32 GetMaxDecodedLength(int32 NumChars)
+	{
+		return (NumChars / 4) * 3;
+	}
+
+	// Writes exactly GetEncodedLength(NumBytes) chars (no terminator). SSSE3 / NEON when available.
+	GOLDENTIME119_API void Encode(const uint8* Src, int32 NumBytes, ANSICHAR* Dst);
+
+	// Padded input only (length % 4 == 0, no whitespace). Dst needs GetMaxDecodedLength(NumChars).
+	// Returns bytes written, or INDEX_NONE on malformed input.
+	GOLDENTIME119_API int32 Decode(const ANSICHAR* Src, int32 NumChars, uint8* Dst);
+}
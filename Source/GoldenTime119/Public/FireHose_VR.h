@@ -12,6 +12,8 @@
 
 #include "FireHose_VR.generated.h"
 
+class UVRHapticsSubsystem;
+
 UENUM(BlueprintType)
 enum class EHoseMode_VR : uint8
 {
@@ -139,6 +141,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hose|Haptics")
 	float NozzleTurnPulseMinInterval = 0.05f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hose|Haptics")
+	float NozzleTurnPulseDuration = 0.05f;
+
+	// Lifetime of each spray request; refreshed every tick while spraying
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hose|Haptics")
+	float SprayHapticHoldSec = 0.1f;
+
 	// ============================================================
 	// State
 	// ============================================================
@@ -297,6 +306,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	void SetupKeyboardTest();
@@ -333,6 +343,7 @@ private:
 	void SetHandHaptics(bool bLeft, float Frequency01, float Amplitude01);
 	void StopHandHaptics(bool bLeft);
 	void PulseLeftHandOnNozzleTurn(float Strength01);
+	UVRHapticsSubsystem* GetHaptics();
 
 	// Helpers
 	float ComputePatternAlpha() const;
@@ -355,6 +366,9 @@ private:
 
 	// Haptics timing
 	float LastNozzlePulseTime = -1000.f;
+	bool bSprayHapticsActive = false;
+
+	TWeakObjectPtr<UVRHapticsSubsystem> CachedHaptics;
 
 	// Cached PC
 	TWeakObjectPtr<APlayerController> CachedPC;
@@ -3,6 +3,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "InputCoreTypes.h"
+#include "Containers/StaticArray.h"
 #include "BreakableComponent.h"
 #include "FireAxeActor.generated.h"
 
@@ -69,10 +71,33 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|VR")
     bool bTrackControllerVelocity = true;
 
-    // ӵ ø  ( )
+    // ӵ ø  ( ,   뷮 - 1 )
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|VR")
     int32 VelocitySampleCount = 5;
 
+    // =====   =====
+
+    // ϵ  ̸  ڽ ؼ Ʈ  ( ̿  ¦ ϴ  )
+    //   BladeCollision  ̺Ʈ 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Sweep")
+    bool bSweptHitDetection = true;
+
+    //    ִ ȸ ().    ȸ 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Sweep", meta = (ClampMin = "1.0"))
+    float MaxSweepStepDegrees = 15.f;
+
+    //    ִ  
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Sweep", meta = (ClampMin = "1", ClampMax = "16"))
+    int32 MaxSweepSubsteps = 8;
+
+    //   ̵ ̺ ũ ̵/    (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Sweep")
+    float MaxSweepDistance = 150.f;
+
+    //    ǥ
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Debug")
+    bool bDebugDrawSweep = false;
+
     // ===== ƽ =====
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Haptic")
@@ -81,6 +106,9 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Haptic")
     float HitHapticDuration = 0.15f;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Axe|Haptic")
+    float HitHapticFrequency = 1.0f;
+
     // ===== VFX/SFX =====
 
     UPROPERTY(EditAnywhere, Category = "Axe|Audio")
@@ -117,12 +145,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Axe|VR")
     void SetControllerVelocity(FVector Velocity);
 
+    //   ʱȭ (/, ڷƮ  ȣ)
+    UFUNCTION(BlueprintCallable, Category = "Axe|VR")
+    void ResetPoseHistory();
+
     //   (VR ׽Ʈ)
     UFUNCTION(BlueprintCallable, Category = "Axe|Debug")
     void SimulateSwing(float Speed = 500.f);
 
-    // ƽ  û (Ʈ )
-    UFUNCTION(BlueprintImplementableEvent, Category = "Axe|VR")
+    // Hit haptics. Default goes through UVRHapticsSubsystem; Blueprint may override.
+    UFUNCTION(BlueprintNativeEvent, Category = "Axe|VR")
     void PlayHitHaptic(float Intensity, float Duration);
 
 protected:
@@ -135,8 +167,13 @@ private:
     void OnBladeOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
         UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
-    //    
-    float CalculateAndApplyDamage(AActor* HitActor, const FHitResult& HitResult);
+    // ٿ/ӵ Ȯ  Ʈ ó. ϸ true
+    bool TryRegisterHit(AActor* HitActor, const FHitResult& HitResult, float ImpactSpeed, float HitTime);
+
+    //     (ImpactSpeed: Ÿ   ӵ)
+    float CalculateAndApplyDamage(AActor* HitActor, const FHitResult& HitResult, float ImpactSpeed);
+
+    float GetIntensityForSpeed(float Speed) const;
 
     // Ʈ Ʈ 
     void PlayHitEffects(const FHitResult& HitResult, EBreakableMaterial Material);
@@ -144,10 +181,40 @@ private:
     // ӵ 
     void UpdateVelocityTracking();
 
-    // ӵ 
-    TArray<FVector> VelocitySamples;
+    // پ ִ  Ʈѷ  (  ƽ).    false
+    bool GetHoldingHand(EControllerHand& OutHand) const;
+
+    // =====   ( 뷮 ) =====
+
+    struct FAxePoseSample
+    {
+        FVector BladeLocation = FVector::ZeroVector;
+        FQuat BladeRotation = FQuat::Identity;
+        double Time = 0.0;
+    };
+
+    static constexpr int32 PoseHistoryCapacity = 16;
+
+    void PushPoseSample(const FVector& BladeLocation, const FQuat& BladeRotation, double Time);
+    const FAxePoseSample& GetPoseBySerial(int32 Serial) const { return PoseHistory[Serial % PoseHistoryCapacity]; }
+
+    //    (Owner/Instigator,  θ üΰ  ,   ).  
+    void GetHolderActors(TArray<AActor*, TInlineAllocator<8>>& OutHolders) const;
+
+    //      
+    void SweepPendingPoses();
+    void SweepBetweenPoses(const FAxePoseSample& From, const FAxePoseSample& To);
+
+    TStaticArray<FAxePoseSample, PoseHistoryCapacity> PoseHistory;
+    int32 PoseCount = 0;
+    int32 PoseSerialEnd = 0;     //  ϵ  ȣ ()
+    int32 SweptSerial = -1;      //   Ϸ
+
+    //    
+    TArray<FHitResult> SweepHits;
+
     FVector CurrentVelocity = FVector::ZeroVector;
-    FVector LastPosition = FVector::ZeroVector;
+    float ControllerVelocityTime = -1.f;
 
     // ٿ
     float LastHitTime = -1.f;
@@ -9,6 +9,8 @@
 #include "FireballActor.generated.h"
 
 class UCombustibleComponent;
+class APawn;
+class ARoomActor;
 
 UENUM(BlueprintType)
 enum class EFireballPhase : uint8
@@ -29,6 +31,7 @@ class GOLDENTIME119_API AFireballActor : public AActor
 public:
     AFireballActor();
 
+    // 후보 수집이 이 값을 쓰므로 SpawnActorDeferred 후 FinishSpawning 전에 호출
     void InitFireball(float InRadius, float InDuration, float InBlastIntensity);
 
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Fireball")
@@ -70,6 +73,23 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Damage")
     float IgnitionChance = 0.8f;
 
+    // ===== Blast propagation (방/문 그래프) =====
+
+    // 과압 감쇠 거리(cm): P * 1/(1 + d/L). d=L에서 1/2, 2L에서 1/3 (쌍곡선, 지수 감쇠 아님)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Blast", meta = (ClampMin = "1.0"))
+    float BlastAttenuationLength = 600.f;
+
+    // 방에서 밖으로 열린 환기량(문 Vent01 합)에 따른 압력 해소: P / (1 + Relief * Vent)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Blast", meta = (ClampMin = "0.0"))
+    float OutsideVentRelief = 1.0f;
+
+    // 이 값보다 약해지면 더 전파하지 않음
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Blast", meta = (ClampMin = "0.0"))
+    float MinBlastPressure = 5.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Blast", meta = (ClampMin = "0"))
+    int32 MaxBlastRoomHops = 6;
+
     UPROPERTY(EditAnywhere, Category = "Fireball|VFX")
     TObjectPtr<UParticleSystem> FireballTemplate;
 
@@ -82,6 +102,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Fireball|Events")
     FOnFireballDamage OnFireballDamage;
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fireball|Debug")
+    bool bDebugDraw = false;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
@@ -111,11 +134,23 @@ private:
     UPROPERTY()
     TSet<AActor*> DamagedActors;
 
+    // Spawn 시점에 공간 인덱스에서 한 번 받아 두고, 매 스텝은 반경으로만 다시 거른다
+    TArray<TWeakObjectPtr<APawn>> CandidatePawns;
+    TArray<TWeakObjectPtr<UCombustibleComponent>> CandidateCombustibles;
+
+    void GatherCandidates();
+    float GetMaxReach() const;
+
     void UpdateExpanding(float DeltaTime);
     void UpdateRising(float DeltaTime);
     void UpdateDissipating(float DeltaTime);
 
     void ApplyBlastWave();
+    void ApplySphericalBlast(const FVector& Origin, float BlastRange);
+    void PropagateBlastThroughRooms(ARoomActor* OriginRoom, const TArray<ARoomActor*>& AllRooms, const FVector& Origin, float SourcePressure);
+    void ApplyBlastDamageTo(AActor* HitActor, float Damage);
+    float BlastFalloff(float Dist) const;
+    void GatherBlastTargets(TArray<AActor*>& OutTargets) const;
     void ApplyRadiationDamage(float DeltaTime);
     void TryIgniteNearby();
 
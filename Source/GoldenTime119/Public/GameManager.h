@@ -70,7 +70,6 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
@@ -310,15 +309,16 @@ protected:
     UFUNCTION()
     void OnBackdraftOccurred();
 
+    // 플레이어 바이탈 이벤트 핸들러 (VitalComponent::OnVitals01Changed)
+    UFUNCTION()
+    void OnPlayerVitalsChanged(float Hp01, float Temp01, float O201);
+
     // 플레이어 바이탈 체크
-    void CheckPlayerVitals(float DeltaTime);
+    void CheckPlayerVitals(float HP, float Temp, float O2);
 
-    // 미션 완료/실패 체크
+    // 미션 완료/실패 체크 (목표 상태가 바뀔 때)
     void CheckMissionCompletion();
 
-    // 모든 목표 업데이트
-    void UpdateAllObjectives(float DeltaTime);
-
     // 플레이어 찾기
     void FindPlayerCharacter();
 
@@ -326,8 +326,8 @@ protected:
     void FindSceneActors();
 
 private:
-    // 바이탈 경고 쿨다운
-    float VitalWarningCooldown = 0.f;
+    // 바이탈 경고 쿨다운 (다음 경고 가능 월드 시간)
+    float NextVitalWarningTime = 0.f;
     const float VitalWarningInterval = 2.f;
 
     // 초기화 완료 플래그
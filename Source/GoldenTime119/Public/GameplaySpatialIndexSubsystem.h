@@ -0,0 +1,88 @@
+// ============================ GameplaySpatialIndexSubsystem.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GameplaySpatialIndexSubsystem.generated.h"
+
+class APawn;
+class ARoomActor;
+class UCombustibleComponent;
+
+/**
+ * Gameplay-side index of things that hazards (fireballs, blasts) care about.
+ *  - Combustibles register themselves and are bucketed in a 2D (XY) grid.
+ *  - Pawns and rooms are tracked through the world's spawn handler; there are few of them so they stay in flat lists.
+ * Nothing here touches the physics scene, so a query costs the same no matter how much static geometry is nearby.
+ */
+UCLASS()
+class GOLDENTIME119_API UGameplaySpatialIndexSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UGameplaySpatialIndexSubsystem* Get(const UObject* WorldContextObject);
+
+    // ===== Registration =====
+
+    void RegisterCombustible(UCombustibleComponent* Comb);
+    void UnregisterCombustible(UCombustibleComponent* Comb);
+
+    // ===== Queries (sphere, distance measured to the owning actor's location) =====
+
+    void QueryPawns(const FVector& Center, float Radius, TArray<APawn*>& OutPawns);
+    void QueryCombustibles(const FVector& Center, float Radius, TArray<UCombustibleComponent*>& OutCombustibles);
+
+    // ===== Rooms =====
+
+    // First room whose bounds contain the point, or nullptr (outdoors)
+    ARoomActor* FindRoomContaining(const FVector& Point);
+    void GetRooms(TArray<ARoomActor*>& OutRooms);
+
+    // Grid cell edge in cm
+    float CellSize = 500.f;
+
+    // Movable combustibles are re-bucketed at query time once they drift this far (cm)
+    float RebucketDistance = 100.f;
+
+    // UWorldSubsystem
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FCombustibleEntry
+    {
+        TWeakObjectPtr<UCombustibleComponent> Comb;
+        TObjectKey<UCombustibleComponent> Key;     // still valid after the component is gone
+        FVector Location = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        bool bMovable = false;
+    };
+
+    FIntPoint CellOf(const FVector& Location) const;
+    void AddToCell(int32 EntryIndex);
+    void RemoveFromCell(int32 EntryIndex);
+    void RefreshMovableCombustibles();
+    void RemoveCombustibleAt(int32 EntryIndex);
+
+    void HandleActorSpawned(AActor* Actor);
+    void AddPawn(APawn* Pawn);
+    void AddRoom(ARoomActor* Room);
+    void PruneRooms();
+
+    // Dense entry storage, swap-removed; CombIndex maps component -> slot
+    TArray<FCombustibleEntry> Combustibles;
+    TMap<TObjectKey<UCombustibleComponent>, int32> CombIndex;
+    TMap<FIntPoint, TArray<int32>> Cells;
+    TArray<int32> MovableEntries;
+
+    TArray<TWeakObjectPtr<APawn>> Pawns;
+    TArray<TWeakObjectPtr<ARoomActor>> Rooms;
+
+    FDelegateHandle ActorSpawnedHandle;
+};
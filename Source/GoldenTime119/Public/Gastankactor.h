@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "PressureVesselComponent.h"
 #include "GasTankActor.generated.h"
 
 class UPressureVesselComponent;
@@ -90,6 +91,10 @@ private:
     UFUNCTION()
     void OnBLEVETriggered(FVector ExplosionLocation);
 
+    // (Venting/Critical) ¿  ƽ Ҵ
+    UFUNCTION()
+    void OnVesselStateChanged(EPressureVesselState NewState);
+
     void ApplyTankTypeParameters();
     void UpdateGasLeakAudio(float DeltaSeconds);
 
@@ -4,8 +4,14 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "RoomActor.h"
+#include "DoorActor.h"
+#include "PressureVesselComponent.h"
 #include "MissionObjective.generated.h"
 
+class AFireActor;
+class UVitalComponent;
+class APlayerController;
+
 // ǥ Ÿ
 UENUM(BlueprintType)
 enum class EMissionObjectiveType : uint8
@@ -58,6 +64,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectiveStatusChanged,
 
 /**
  * ̼ ǥ Ŭ
+ * - StartObjective ǥ ϴ Է( ȭ/ȯ, , ũ, ÷̾ Ż/ġ) ̺Ʈ ϰ
+ *   Ϸ//  
+ * - ൵  ؽƮ  Է ٲ  ٽ  (ð  ǥ 1 ð +  Ÿ̸)
  */
 UCLASS(Blueprintable, BlueprintType)
 class UMissionObjective : public UObject
@@ -186,6 +195,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Objective")
     void StartObjective(UWorld* World);
 
+    // ൵  .  ̺Ʈ ˾Ƽ θǷ  ƽ θ ʿ 
     UFUNCTION(BlueprintCallable, Category = "Objective")
     void UpdateProgress(float DeltaSeconds, UWorld* World);
 
@@ -260,11 +270,72 @@ protected:
     void UpdateProgressValue(float NewProgress, const FString& ProgressText);
     void ChangeStatus(EMissionObjectiveStatus NewStatus);
 
-    //  Room ã
+    // ൵ .  ˸  1% ̻ ٲų DisplayKey( ؽƮ  :
+    //  , HP ۹,  ...) ٲ true ( ؽƮ true   )
+    bool SetProgressValue(float NewProgress, int64 DisplayKey = 0);
+
+    //  Room ã (StartObjective    )
     void FindAllRooms(UWorld* World, TArray<ARoomActor*>& OutRooms);
 
     //  Ȳ ؽƮ 
     FString FormatProgressText(int32 Current, int32 Target) const;
     FString FormatPercentText(float Percent01) const;
     FString FormatTimeText(float Seconds) const;
+
+private:
+    // ============================ ̺Ʈ  ============================
+
+    void BindEvents(UWorld* World);
+    void UnbindEvents();
+    void BindPlayerPawn(APawn* Pawn);
+    void UnbindPlayerPawn();
+
+    // ð  ͸ ° ٲ ǥ (ð/ Ÿ̸ ʿ)
+    bool IsTimeDriven() const;
+
+    // Ÿ /ũ ¸ ٽ  (ش ̺Ʈ  )
+    void RecountDoors();
+    void RecountTanks();
+
+    void Reevaluate();
+
+    UFUNCTION() void HandleRoomFireStarted(AFireActor* Fire);
+    UFUNCTION() void HandleRoomFireExtinguished(AFireActor* Fire);
+    UFUNCTION() void HandleRoomBackdraft();
+    void HandleRoomEnvChanged(ARoomActor* Room);
+
+    UFUNCTION() void HandleDoorStateChanged(EDoorState NewState);
+    UFUNCTION() void HandleDoorVentHoleCreated(int32 TotalHoleCount);
+
+    UFUNCTION() void HandleVesselStateChanged(EPressureVesselState NewState);
+    UFUNCTION() void HandleVesselBLEVE(FVector ExplosionLocation);
+
+    UFUNCTION() void HandlePlayerVitalsChanged(float Hp01, float Temp01, float O201);
+    UFUNCTION() void HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn);
+    void HandlePlayerMoved(USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport);
+
+    void HandleClock();
+
+    //   ҽ ()
+    TWeakObjectPtr<UWorld> BoundWorld;
+    TArray<TWeakObjectPtr<ARoomActor>> ObservedRooms;
+    TArray<TWeakObjectPtr<ARoomActor>> EnvRooms;
+    TArray<TWeakObjectPtr<ADoorActor>> ObservedDoors;
+    TArray<TWeakObjectPtr<UPressureVesselComponent>> ObservedVessels;
+    TWeakObjectPtr<APlayerController> ObservedController;
+    TWeakObjectPtr<UVitalComponent> PlayerVital;
+    TWeakObjectPtr<USceneComponent> PlayerRoot;
+    FDelegateHandle PlayerMovedHandle;
+    FTimerHandle ClockTimer;
+    FTimerHandle DeadlineTimer;
+
+    //  ī (̺Ʈθ )
+    int32 RemainingFires = 0;
+    int32 DangerTankCount = 0;
+    int32 DoorVentHoles = 0;
+    int32 BreachedDoors = 0;
+
+    //  OnProgressChanged Ǹ ൵ / ؽƮ Ű (-1:    ˸ )
+    float NotifiedProgress01 = -1.f;
+    int64 NotifiedDisplayKey = 0;
 };
\ No newline at end of file
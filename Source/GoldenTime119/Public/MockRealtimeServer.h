@@ -0,0 +1,269 @@
+// ============================ MockRealtimeServer.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IWebSocket.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Math/RandomStream.h"
+#include "VoiceAudioCodec.h"
+#include <atomic>
+#include "MockRealtimeServer.generated.h"
+
+class FJsonObject;
+class FRunnableThread;
+class FEvent;
+
+// 오프라인 테스트용 Realtime 서버 흉내 설정
+USTRUCT(BlueprintType)
+struct FMockRealtimeSettings
+{
+	GENERATED_BODY()
+
+	// Connect() -> OnConnected
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	float ConnectDelayMs = 80.f;
+
+	// response.create -> 첫 output_audio.delta (서버 추론 + 망 지연)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	float FirstAudioDelayMs = 450.f;
+
+	// 제어 이벤트 응답 지연 (session.updated, input_audio_buffer.committed ...)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	float ControlReplyDelayMs = 40.f;
+
+	// 델타 하나에 담는 오디오 길이
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "10"))
+	float AudioChunkMs = 100.f;
+
+	// 송출 속도 / 재생 속도 (실제 서버는 실시간보다 빠르게 보냄)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0.25"))
+	float SendSpeed = 2.f;
+
+	// 메시지마다 +-JitterMs 균등 분포 (순서는 유지, TCP처럼 앞 메시지보다 먼저 오지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	float JitterMs = 30.f;
+
+	// 델타마다 이 확률로 SpikeMs만큼 멈춤 (재전송/혼잡 흉내)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0", ClampMax = "1"))
+	float SpikeProbability = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	float SpikeMs = 250.f;
+
+	// 녹음된 응답 (PCM16 WAV, SampleRate와 같아야 함). 상대경로면 ProjectDir 기준. 비면 합성음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock")
+	FString ReplyWavPath;
+
+	// output_audio_transcript.delta로 오디오 진행에 맞춰 단어 단위로 흘려보냄
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (MultiLine = true))
+	FString ReplyTranscript = TEXT("Copy that. Keep low, stay on the left wall and report when you reach the second room.");
+
+	// WAV가 없을 때 합성음 길이
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0.1"))
+	float SyntheticReplySec = 3.f;
+
+	// audio/pcm 응답 레이트. audio/pcmu, audio/pcma를 요청받으면 8kHz로 리샘플 + 인코딩해서 보냄
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock")
+	int32 SampleRate = 24000;
+
+	// 수신 메시지를 이 크기로 쪼개 OnRawMessage 여러 번으로 전달 (0 = 통째로)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock", meta = (ClampMin = "0"))
+	int32 MaxFragmentBytes = 0;
+
+	// 0이면 매 연결마다 다름
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock")
+	int32 RandomSeed = 0;
+
+	// ===== 장애 흉내 (재연결 테스트) =====
+	// Connect()가 이 확률로 OnConnectionError
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock|Faults", meta = (ClampMin = "0", ClampMax = "1"))
+	float ConnectFailureProbability = 0.f;
+
+	// 연결 후 이 시간이 지나면 비정상 종료 (code 1006, 망 끊김). 0 = 끔
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock|Faults", meta = (ClampMin = "0"))
+	float DropAfterSec = 0.f;
+
+	// 연결 후 이 시간이 지나면 닫힘 없이 양방향이 멈춤 (NAT 타임아웃 같은 반쯤 열린 연결). 0 = 끔
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mock|Faults", meta = (ClampMin = "0"))
+	float StallAfterSec = 0.f;
+};
+
+// 마지막 응답의 클라이언트 측 도착 시각 (FPlatformTime::Seconds, 게임 스레드 기준)
+struct FMockRealtimeResponseTiming
+{
+	uint32 ResponseSerial = 0;
+	double CreatedSec = 0.0;            // response.created 도착
+	double FirstAudioSec = 0.0;         // 첫 output_audio.delta 도착
+	double AudioDoneSec = 0.0;          // output_audio.done 도착
+	int32 AudioDeltas = 0;
+	int64 AudioWireBytes = 0;
+	bool bCancelled = false;
+};
+
+/**
+ * In-process stand-in for the Realtime service.
+ *
+ * Client events go in through Receive(); a worker parses them and answers on a timeline the way the
+ * service does: session.created on connect, session.updated / input_audio_buffer.committed / cleared,
+ * and for response.create a response.created, then after FirstAudioDelayMs the reply audio as
+ * base64 output_audio.delta events (paced by SendSpeed, each with jitter), word-level transcript deltas
+ * and the *.done / response.done tail. response.cancel drops what has not been sent yet.
+ * session.update formats are honoured: the reply goes out as audio/pcm, audio/pcmu or audio/pcma and
+ * session.updated echoes the effective formats, so codec negotiation runs offline too.
+ * The worker holds each outgoing message until its delivery time, then hands it to the socket side.
+ */
+class GOLDENTIME119_API FMockRealtimeServer : public FRunnable
+{
+public:
+	enum class EOutboundKind : uint8
+	{
+		Connected,
+		Message,
+		ResponseCreated,
+		AudioDelta,
+		AudioDone,
+		ResponseDone,
+		ResponseCancelled,
+	};
+
+	struct FOutbound
+	{
+		EOutboundKind Kind = EOutboundKind::Message;
+		uint32 ResponseSerial = 0;
+		TArray<uint8> Utf8;
+	};
+
+	explicit FMockRealtimeServer(const FMockRealtimeSettings& InSettings);
+	virtual ~FMockRealtimeServer() override;
+
+	bool Start();
+	void Shutdown();
+
+	// 클라이언트 -> 서버 (텍스트 프레임 하나, 아무 스레드)
+	void Receive(const void* Data, SIZE_T Size);
+
+	// 전달 시각이 된 메시지 (소비자 하나)
+	bool PopOutbound(FOutbound& Out) { return Outbound.Dequeue(Out); }
+
+	int32 GetReplySamples() const { return ReplyPcm.Num(); }
+
+	// ===== FRunnable =====
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FScheduled
+	{
+		double DueSec = 0.0;
+		FOutbound Item;
+	};
+
+	void LoadReply();
+	void ApplySessionUpdate(const TSharedPtr<FJsonObject>& Root, double ReplySec);
+	void PrepareReplyWire();
+	void HandleClientEvent(const TArray<uint8>& Message);
+	void ScheduleResponse(double NowSec);
+	void CancelResponse(double NowSec);
+
+	// 응답 스트림 안에서는 순서 유지 (LastResponseDueSec 이후로만)
+	double Jittered(double IdealSec);
+	void Schedule(double DueSec, EOutboundKind Kind, uint32 Serial, const FString& Json);
+	void FlushDue(double NowSec);
+
+	FMockRealtimeSettings Settings;
+	TArray<int16> ReplyPcm;
+	TArray<FString> TranscriptWords;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopRequested{ false };
+
+	// client -> worker
+	TQueue<TArray<uint8>, EQueueMode::Mpsc> Inbound;
+
+	// ----- worker only -----
+	TArray<FScheduled> Pending;         // DueSec 오름차순
+	FRandomStream Rng;
+	uint32 ResponseSerial = 0;
+	uint32 EventCounter = 0;
+	bool bResponseActive = false;
+	double LastResponseDueSec = 0.0;
+	int64 InputAudioBytes = 0;
+
+	// session.update로 정해진 전송 포맷
+	ERealtimeAudioCodec InputCodec = ERealtimeAudioCodec::Pcm16;
+	ERealtimeAudioCodec OutputCodec = ERealtimeAudioCodec::Pcm16;
+	int32 InputRate = 0;
+
+	// OutputCodec으로 인코딩한 응답 (코덱이 바뀔 때만 다시 만듦)
+	TArray<uint8> ReplyWire;
+	ERealtimeAudioCodec ReplyWireCodec = ERealtimeAudioCodec::Pcm16;
+	int32 ReplyWireRate = 0;
+
+	// worker -> socket (전달 시각이 된 것만, 순서대로)
+	TQueue<FOutbound, EQueueMode::Spsc> Outbound;
+};
+
+/**
+ * IWebSocket backed by FMockRealtimeServer, so URealtimeVoiceComponent (or a benchmark) runs the
+ * unchanged protocol and decode path without network or API key. Like the engine's WebSocket
+ * implementation, callbacks fire on the game thread: Pump() runs from the core ticker, or is called
+ * directly by a headless driver that owns the loop. Create it with MakeShared.
+ * The Faults settings inject connect failures, abrupt drops and silent stalls for FRealtimeConnection.
+ */
+class GOLDENTIME119_API FMockRealtimeWebSocket : public IWebSocket, public TSharedFromThis<FMockRealtimeWebSocket, ESPMode::ThreadSafe>
+{
+public:
+	explicit FMockRealtimeWebSocket(const FMockRealtimeSettings& InSettings, bool bInAutoTick = true);
+	virtual ~FMockRealtimeWebSocket() override;
+
+	// 전달 시각이 된 서버 메시지를 콜백으로 넘김 (게임 스레드)
+	void Pump();
+
+	const FMockRealtimeResponseTiming& GetLastResponseTiming() const { return LastResponse; }
+
+	// ===== IWebSocket =====
+	virtual void Connect() override;
+	virtual void Close(int32 Code = 1000, const FString& Reason = FString()) override;
+	virtual bool IsConnected() override { return bConnected; }
+	virtual void Send(const FString& Data) override;
+	virtual void Send(const void* Data, SIZE_T Size, bool bIsBinary = false) override;
+	virtual void SetTextMessageMemoryLimit(uint64 TextMessageMemoryLimit) override {}
+
+	virtual FWebSocketConnectedEvent& OnConnected() override { return ConnectedEvent; }
+	virtual FWebSocketConnectionErrorEvent& OnConnectionError() override { return ConnectionErrorEvent; }
+	virtual FWebSocketClosedEvent& OnClosed() override { return ClosedEvent; }
+	virtual FWebSocketMessageEvent& OnMessage() override { return MessageEvent; }
+	virtual FWebSocketBinaryMessageEvent& OnBinaryMessage() override { return BinaryMessageEvent; }
+	virtual FWebSocketRawMessageEvent& OnRawMessage() override { return RawMessageEvent; }
+	virtual FWebSocketMessageSentEvent& OnMessageSent() override { return MessageSentEvent; }
+
+private:
+	bool Tick(float DeltaTime);
+	void Deliver(const FMockRealtimeServer::FOutbound& Item);
+
+	FMockRealtimeSettings Settings;
+	TUniquePtr<FMockRealtimeServer> Server;
+	FTSTicker::FDelegateHandle TickHandle;
+	bool bAutoTick = true;
+
+	bool bConnected = false;
+	bool bPendingClosed = false;
+	bool bPendingConnectError = false;
+	bool bStalled = false;
+	double ConnectedSec = 0.0;
+	int32 PendingCloseCode = 1000;
+	FString PendingCloseReason;
+
+	FMockRealtimeResponseTiming LastResponse;
+
+	FWebSocketConnectedEvent ConnectedEvent;
+	FWebSocketConnectionErrorEvent ConnectionErrorEvent;
+	FWebSocketClosedEvent ClosedEvent;
+	FWebSocketMessageEvent MessageEvent;
+	FWebSocketBinaryMessageEvent BinaryMessageEvent;
+	FWebSocketRawMessageEvent RawMessageEvent;
+	FWebSocketMessageSentEvent MessageSentEvent;
+};
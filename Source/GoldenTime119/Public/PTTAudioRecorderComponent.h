@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
-#include "HAL/CriticalSection.h"
 
-#include "AudioCaptureCore.h"
-#include "AudioCaptureDeviceInterface.h"
+#include "AudioSpscFrameRing.h"
+#include "VoiceCaptureSource.h"
+#include "VoiceAudioDSP.h"
+#include "VoiceUtterance.h"
+#include <atomic>
 
 #include "PTTAudioRecorderComponent.generated.h"
 
@@ -32,23 +34,43 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
 	const FString&, ErrorOrInfo
 );
 
+// VAD Ʈ    (ȭ )
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+	FOnPTTVoiceActivity,
+	bool, bSpeaking
+);
+
+// ====== Utterance hand-off (C++ only) ======
+// ȭ ü PCM16. ڵ STT/Realtime/    ־  
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPTTUtteranceReady, const FVoiceUtterancePtr& /*Utterance*/);
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class GOLDENTIME119_API UPTTAudioRecorderComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
 public:
+	UPTTAudioRecorderComponent();
+
 	// ====== Realtime Events ======
+	//  忡 εĳƮ (ĸó  ->  -> TickComponent)
 	UPROPERTY(BlueprintAssignable, Category = "PTT|Events")
 	FOnPTTPcm16FrameReady OnPcm16FrameReady;
 
 	UPROPERTY(BlueprintAssignable, Category = "PTT|Events")
 	FOnPTTCaptureFinalized OnCaptureFinalized;
 
+	// bEnableVAD .  , ش  εĳƮ 
+	UPROPERTY(BlueprintAssignable, Category = "PTT|Events")
+	FOnPTTVoiceActivity OnVoiceActivity;
+
 	// ====== Legacy WAV Events ======
 	UPROPERTY(BlueprintAssignable, Category = "PTT|Events")
 	FOnPTTRecordedWavReady OnWavReady;
 
+	// Stop  OnCaptureFinalized  (bKeepUtterance )
+	FOnPTTUtteranceReady OnUtteranceReady;
+
 	// ====== BP API ======
 	UFUNCTION(BlueprintCallable, Category = "PTT")
 	void StartPTT();
@@ -57,10 +79,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PTT")
 	void StopPTT();
 
-	// Legacy: Stop + Save wav. Keeps compatibility with older pipeline.
+	// Legacy: Stop + Save wav. ޸ ȭ ׶忡 ϰ, ũ   OnWavReady
 	UFUNCTION(BlueprintCallable, Category = "PTT")
 	void StopPTTAndSave(const FString& OptionalWavPath = TEXT(""));
 
+	// ====== Capture source ======
+	//  StartPTT . null = ⺻ Է ġ ( -PTTCaptureWav=   )
+	// ũ  ȯ/ڵȭ: FVoiceBufferCaptureSource  ǽð Ǵ   
+	void SetCaptureSource(const FVoiceCaptureSourcePtr& InSource);
+
+	// PCM16 WAV ũ  (SR/ä , θ ProjectDir ). PTT ó 
+	UFUNCTION(BlueprintCallable, Category = "PTT|Capture")
+	bool UseWavCaptureSource(const FString& WavPath, float Speed = 1.f, bool bLoop = false);
+
+	UFUNCTION(BlueprintCallable, Category = "PTT|Capture")
+	void UseDeviceCaptureSource() { SetCaptureSource(nullptr); }
+
+	//  ҽ  StopPTT ( ϳ = ۽ ϳ, ڴ   ׽Ʈ)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PTT|Capture")
+	bool bStopWhenSourceEnds = false;
+
 	// ====== Config ======
 	// OpenAudioCaptureStream ϴ SR/CH,  ̽ ٸ  (ݹ SampleRate ¥ )
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Config")
@@ -81,67 +119,143 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Realtime")
 	bool bFlushRemainderOnStop = true;
 
+	// ĸó  ->     ().  尡 ̺  ߸  
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Realtime", meta = (ClampMin = "0.1", ClampMax = "5.0"))
+	float CaptureRingSeconds = 1.0f;
+
+	// ====== VAD ======
+	// ĸó 忡 Ӹ /  ( +  +  )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|VAD")
+	bool bEnableVAD = true;
+
+	//   OnPcm16FrameReady ȭ ۿ  (յ /ȣ  -> ε/STT )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|VAD")
+	bool bGateSilence = true;
+
+	//  ٴ  ̸ŭ Ŀ 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|VAD", meta = (ClampMin = "3.0", ClampMax = "30.0"))
+	float VADMarginDb = 10.0f;
+
+	//    ̸ŭ   (ù  ߸ ʰ)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|VAD", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float VADPreRollSec = 0.2f;
+
+	//    ̸ŭ    (/ª )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|VAD", meta = (ClampMin = "0.05", ClampMax = "1.5"))
+	float VADHangoverSec = 0.3f;
+
+	//  ĸó  ־ (VAD   ĸó ־ true)
+	UFUNCTION(BlueprintCallable, Category = "PTT")
+	bool WasSpeechDetected() const { return LastSpeechSec > 0.f; }
+
+	UFUNCTION(BlueprintCallable, Category = "PTT")
+	float GetLastSpeechSec() const { return LastSpeechSec; }
+
+	// ȭ ü Ǯ ۿ  OnUtteranceReady ѱ (  Ʈ)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Utterance")
+	bool bKeepUtterance = true;
+
+	// ̺   ȭ ۿ   ( Ʈ )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Utterance", meta = (ClampMin = "1.0", ClampMax = "300.0"))
+	float MaxUtteranceSec = 60.0f;
+
+	// ܿ:  ȭ WAV  (׶ ,   ٸ )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Utterance")
+	bool bSaveDiagnosticWav = false;
+
+	//   Saved/PTT
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PTT|Utterance")
+	FString DiagnosticWavDir;
+
+	// ̹ PTT  ۰     
+	UFUNCTION(BlueprintCallable, Category = "PTT")
+	int32 GetDroppedFrameCount() const;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	// ĸó ݹ 1ȸ  ũ  ó (ũġ  ũ)
+	static constexpr int32 CaptureChunkFrames = 1024;
+	static constexpr int32 MinInputSampleRate = 8000;
+
 	struct FCaptureImpl
 	{
-		Audio::FAudioCapture AudioCapture;
-		FCriticalSection Mutex;
+		// ̹ PTT Է (StartPTT )
+		FVoiceCaptureSourcePtr Source;
 
-		bool bCapturing = false;
+		// ĸó ʹ  ÷׿ FrameRingθ  ( )
+		std::atomic<bool> bCapturing { false };
 
-		// Input format (from device callback)
+		// ---- Capture thread only. StartPTT ̸ Ҵ, ݹ鿡 Ҵ  ----
 		int32 InSampleRate = 0;
 		int32 InNumChannels = 0;
 
-		// Realtime output format
-		int32 OutSampleRate = 24000;
-		int32 OutNumChannels = 1;
-
-		// Accumulator in float mono (after downmix, before resample)
-		TArray<float> MonoFloatAccum;
+		FVoicePolyphaseResampler Resampler;
+		FVoiceActivityDetector Vad;
+		bool bVadEnabled = false;
+		TArray<float> MonoScratch;         // downmix  (CaptureChunkFrames)
+		TArray<float> ResampleScratch;     //  SR ȯ 
+		TArray<float> FrameAccum;          //  SR   
+		int32 FrameAccumNum = 0;
 
-		// For duration accounting (in output samples)
-		int64 TotalOutSamples = 0;
+		// ---- Capture thread -> Game thread ----
+		TAudioSpscFrameRing<int16> FrameRing;
+		std::atomic<int64> TotalOutSamples { 0 };
+		std::atomic<int32> DroppedFrames { 0 };
 
-		// Frame size in output samples
+		// Realtime output format (StartPTT )
+		int32 OutSampleRate = 24000;
+		int32 OutNumChannels = 1;
 		int32 OutFrameSamples = 0;
 		float FrameDurationSec = 0.02f;
+
+		// ---- Game thread only ----
+		TArray<uint8> FrameBytes;          // εĳƮ  
+		FVoiceUtteranceBuilder Utterance;  // ȭ ü (bKeepUtterance)
+
+		// VAD Ʈ ( ):  ִ  ֱ  ѷ 
+		TArray<uint8> PreRoll;
+		int32 PreRollSlots = 0;
+		int32 PreRollHead = 0;
+		int32 PreRollCount = 0;
+		bool bInSpeech = false;
+		int32 SpeechFrames = 0;
+		int32 SpeechSegments = 0;
+
+		// Capture thread: downmix -> resample -> frame -> ring
+		void ProcessInput(const float* InInterleaved, int32 NumFrames, int32 NumChannels, int32 SampleRate);
+		void PushOutputSamples(const float* Samples, int32 Num);
+
+		// FrameAccum PCM16 ȯ  Խ ( á )
+		void PublishFrame();
 	};
 
 	TUniquePtr<FCaptureImpl> Capture;
 
+	// SetCaptureSource  ҽ ( ġ/)
+	FVoiceCaptureSourcePtr CaptureSourceOverride;
+	FVoiceUtterancePtr CaptureWavClip;
+	FVoiceBufferSourceSettings CaptureWavSettings;
+	bool bCaptureWavCmdLineChecked = false;
+
+	// PTT  ҽ (WAV   ڵ Ŭ ó ٽ)
+	FVoiceCaptureSourcePtr CreateCaptureSource();
+
 	// ====== Helpers ======
-	static int16 FloatToPcm16(float S);
-
-	// Downmix interleaved float -> mono float
-	static void DownmixToMono(
-		const float* InInterleaved,
-		int32 NumFrames,
-		int32 NumChannels,
-		TArray<float>& OutMono
-	);
-
-	// Resample mono float: InSR -> OutSR (48k->24k fast path + fallback linear)
-	static void ResampleMono(
-		const TArray<float>& InMono,
-		int32 InSampleRate,
-		TArray<float>& InOutMonoAccum,
-		int32 OutSampleRate
-	);
-
-	// Pop N output-samples from accum, encode to PCM16 bytes and broadcast frame
-	void EmitFrames_Locked();
-
-	// Legacy WAV writer
-	static void WriteWaveFilePCM16(
-		const TArray<int16>& Pcm16,
-		int32 SampleRate,
-		int32 NumChannels,
-		TArray<uint8>& OutWavBytes
-	);
+	// Game thread: ۿ    OnPcm16FrameReady εĳƮ (VAD Ʈ )
+	void DrainFrames();
+
+	//  ϳ ȭ ۿ ̰ εĳƮ
+	void EmitFrame(const uint8* Pcm16);
+	void FlushPreRoll();
+
+	float LastSpeechSec = 0.f;
+
+	// OptionalWavPath   DiagnosticWavDir Ʒ ð  ̸
+	FString MakeWavPath(const FString& OptionalWavPath) const;
 
 	// Internal shared stop
 	void StopInternal(bool bSaveWav, const FString& OptionalWavPath);
@@ -103,6 +103,27 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Heat")
     float LiquidCoolingFactor = 0.7f;
 
+    //    Ǵ ӵ (1/s). 4.6 =  90fps  Ӵ 0.95  
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Heat", meta = (ClampMin = "0.01"))
+    float HeatAbsorbRatePerSec = 4.6f;
+
+    //   Է   ð  " " 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Heat", meta = (ClampMin = "0.0"))
+    float HeatMemorySec = 1.0f;
+
+    // ===== ùķ̼ =====
+
+    //     ֱ (0 =  ).   ¶ ֱ ϰ  
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Simulation", meta = (ClampMin = "0.0"))
+    float SimulationHz = 20.f;
+
+    //  ̻    ġ/ƼŬ/̺Ʈ 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Simulation", meta = (ClampMin = "0.0"))
+    float SafetyValvePitchPushStep = 0.02f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|Simulation", meta = (ClampMin = "0.0"))
+    float VentStrengthPushStep = 0.02f;
+
     // ===== BLEVE  =====
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vessel|BLEVE")
@@ -178,11 +199,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Vessel")
     void ForceRupture();
 
+    //  ⸦ .   ð   ´
+    UFUNCTION(BlueprintCallable, Category = "Vessel")
+    void WakeUp();
+
+    UFUNCTION(BlueprintCallable, Category = "Vessel")
+    bool IsSleeping() const { return bSleeping; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+    UFUNCTION()
+    void HandleCombustibleHeatActivity(UCombustibleComponent* Combustible);
+
     UPROPERTY()
     TObjectPtr<UCombustibleComponent> LinkedCombustible;
 
@@ -197,14 +229,30 @@ private:
 
     float AccumulatedHeat = 0.f;
     float HeatingStartTime = -1.f;
-    float LastHeatInputTime = 0.f;
-
-    void DetectHeatFromCombustible(float DeltaTime);
-    void UpdatePressureAndTemperature(float DeltaTime);
+    float LastHeatInputTime = -BIG_NUMBER;
+
+    //    ð (  )
+    float LastSimTime = 0.f;
+    bool bSleeping = false;
+    bool bSafetyValveOpen = false;
+    float LastPushedVentStrength01 = -1.f;
+
+    //  ġ    Ʈ   (-1:  )
+    float SafetyValvePitch = -1.f;
+    float LastPushedSafetyValvePitch = -1.f;
+
+    float GetWorldTime() const;
+    float DetectHeatFromCombustible();
+    void StepSimulation(float Now);
+    void UpdatePressureAndTemperature(float Step, float HeatInputRate, bool bIsBeingHeated);
+    void CoolTowardAmbient(float Step);
     void UpdateSafetyValve(float DeltaTime);
-    void UpdateVesselState();
+    void UpdateVesselState(bool bIsBeingHeated);
     void CheckBLEVECondition();
     void ExecuteBLEVE();
     void SetVesselState(EPressureVesselState NewState);
     void EnsureComponentsCreated();
+    void ApplySimulationTickInterval();
+    bool CanSleep(bool bIsBeingHeated) const;
+    void GoToSleep(float Now);
 };
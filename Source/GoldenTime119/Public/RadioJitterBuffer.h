@@ -0,0 +1,116 @@
+// ============================ RadioJitterBuffer.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RealtimePcmStream.h"
+#include <atomic>
+
+struct FRadioJitterStats
+{
+	int32 Underruns = 0;            // 재생 중 데이터가 떨어져 다시 버퍼링한 횟수
+	float UnderrunSilenceMs = 0.f;  // 그 사이 채운 무음 길이
+	int32 OverrunChunks = 0;        // 스트림 큐가 가득 차 버려진 조각 (이 송출 시작 이후)
+	int32 RingFullEvents = 0;       // 링이 가득 차 스트림에서 더 못 꺼낸 횟수 (역압, 손실 아님)
+	float JitterMs = 0.f;           // 도착 지터 추정 (RFC 3550 방식)
+	float TargetPrebufferMs = 0.f;
+	float BufferedMs = 0.f;
+	float PeakBufferedMs = 0.f;
+};
+
+/**
+ * Jitter buffer for one realtime radio transmission, rendered on the audio render thread.
+ *
+ * Decoded chunks arrive through FRealtimePcmStream (network worker -> this). Render() is called by
+ * URadioStreamSoundWave::GeneratePCMData: it pulls chunks into an int16 ring, holds output until the
+ * adaptive prebuffer target is met, then plays. An underrun switches back to buffering and raises
+ * the target. The game thread only starts/ends the stream and reads stats, so frame time never
+ * affects playback.
+ *
+ * The target is MinPrebuffer + 3 x arrival jitter (+ an underrun boost), clamped to MaxPrebuffer.
+ * Jitter is the smoothed chunk-to-chunk change in lateness (arrival vs. media time, relative to the
+ * earliest chunk), like RTP interarrival jitter; chunks arriving early just sit in the buffer.
+ */
+class GOLDENTIME119_API FRadioJitterBuffer
+{
+public:
+	struct FSettings
+	{
+		int32 SampleRate = 24000;
+		int32 NumChannels = 1;
+		float MinPrebufferMs = 120.f;
+		float MaxPrebufferMs = 500.f;
+		float CapacitySec = 4.f;
+	};
+
+	// 생성 시점까지 스트림에 들어와 있던 조각은 이전 송출 잔여분으로 보고 버림
+	FRadioJitterBuffer(const FRealtimePcmStreamPtr& InStream, const FSettings& InSettings);
+	~FRadioJitterBuffer();
+
+	// ===== Game thread =====
+	// 응답 끝: 남은 데이터는 프리버퍼 조건 없이 끝까지 재생
+	void MarkEndOfStream() { bEndOfStream.store(true, std::memory_order_release); }
+	void ClearEndOfStream();
+
+	// EndOfStream 이후 모든 데이터가 재생됨
+	bool IsDrained() const { return bDrained.load(std::memory_order_acquire); }
+
+	// 더 이상 스트림을 소비하지 않음 (사운드 정지 후 새 버퍼로 교체할 때)
+	void Retire() { bRetired.store(true, std::memory_order_release); }
+
+	FRadioJitterStats GetStats() const;
+
+	// ===== Audio render thread =====
+	// 항상 NumSamples(인터리브 기준)를 채움. 데이터가 없으면 무음
+	void Render(int16* Out, int32 NumSamples);
+
+private:
+	void PullFromStream();
+	bool CopyChunkToRing(const FRealtimePcmChunk& Chunk, int32& InOutOffsetBytes);
+	void UpdateJitter(const FRealtimePcmChunk& Chunk);
+	int32 GetTargetSamples() const;
+
+	FORCEINLINE int32 GetBufferedSamples() const { return (int32)(WritePos - ReadPos); }
+	FORCEINLINE int32 GetFreeSamples() const { return Ring.Num() - GetBufferedSamples(); }
+	FORCEINLINE float SamplesToMs(int64 Samples) const { return (float)Samples * 1000.f / (float)(Settings.SampleRate * Settings.NumChannels); }
+
+	FRealtimePcmStreamPtr Stream;
+	FSettings Settings;
+	uint64 DiscardBeforeSerial = 0;
+	int32 DroppedAtStart = 0;
+
+	// ----- audio thread only -----
+	TArray<int16> Ring;            // 2의 거듭제곱
+	uint32 RingMask = 0;
+	uint64 WritePos = 0;
+	uint64 ReadPos = 0;
+
+	FRealtimePcmChunk* PendingChunk = nullptr;   // 링에 다 못 들어간 조각
+	int32 PendingOffsetBytes = 0;
+
+	bool bPlaying = false;
+	bool bHasPlayed = false;
+
+	bool bHaveFirstArrival = false;
+	double FirstArrival = 0.0;
+	double MediaSecondsBefore = 0.0;
+	double MinTransit = 0.0;
+	double LastLateness = 0.0;
+	double JitterSec = 0.0;
+	double UnderrunBoostSec = 0.0;
+	bool bWarnedFormat = false;
+
+	// ----- shared -----
+	std::atomic<bool> bEndOfStream{ false };
+	std::atomic<bool> bDrained{ false };
+	std::atomic<bool> bRetired{ false };
+
+	std::atomic<int32> StatUnderruns{ 0 };
+	std::atomic<int64> StatUnderrunSilenceSamples{ 0 };
+	std::atomic<int32> StatRingFull{ 0 };
+	std::atomic<int32> StatBufferedSamples{ 0 };
+	std::atomic<int32> StatPeakBufferedSamples{ 0 };
+	std::atomic<float> StatJitterMs{ 0.f };
+	std::atomic<float> StatTargetMs{ 0.f };
+};
+
+typedef TSharedPtr<FRadioJitterBuffer, ESPMode::ThreadSafe> FRadioJitterBufferPtr;
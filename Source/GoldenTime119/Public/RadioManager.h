@@ -5,12 +5,18 @@
 #include "TimerManager.h"
 
 #include "RadioSubtitleInfomation.h" // ✅ 공용 struct
+#include "RealtimePcmStream.h"
+#include "RadioJitterBuffer.h"
+#include "RadioVoiceFx.h"
 
 #include "RadioManager.generated.h"
 
 class UAudioComponent;
 class USoundBase;
-class USoundWaveProcedural;
+class URadioStreamSoundWave;
+class URadioBedSoundWave;
+class USourceEffectRadioPreset;
+class USoundEffectSourcePresetChain;
 class URadioLineData;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRadioBusyChanged, bool, bBusy);
@@ -53,6 +59,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Radio|Queue")
 	void EnqueueRadioLine(URadioLineData* LineData);
 
+	// 캐시(URadioReplyCacheSubsystem)에 있는 응답이면 클립 큐로 바로 송출하고 true.
+	// 없으면 false: 호출한 쪽이 Realtime에 요청 (완료되면 캐시에 들어감). 자막이 비어 있으면 Text
+	UFUNCTION(BlueprintCallable, Category = "Radio|Queue")
+	bool PlayReplyText(const FString& Text, const FRadioSubtitleInfomation& Subtitle);
+
 	UFUNCTION(BlueprintCallable, Category = "Radio|State")
 	bool IsBusy() const { return bIsPlaying || bRealtimeActive || CurrentLine != nullptr || Queue.Num() > 0; }
 
@@ -71,6 +82,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Radio|Realtime")
 	bool IsRealtimeTransmitting() const { return bRealtimeActive; }
 
+	// C++: 네트워크 디코더 워커가 PCM을 바로 밀어넣는 lock-free 스트림.
+	// 소비는 오디오 렌더 스레드의 지터 버퍼가 함 (게임 스레드 경유 없음)
+	FRealtimePcmStreamPtr GetRealtimePcmStream();
+
+	// 현재(또는 마지막) 송출의 지터 버퍼 통계
+	FRadioJitterStats GetRealtimeJitterStats() const;
+
 	// ===== Events =====
 	UPROPERTY(BlueprintAssignable, Category = "Radio|Events")
 	FOnRadioBusyChanged OnBusyChanged;
@@ -88,15 +106,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Audio")
 	USoundBase* EndToneSound = nullptr;
 
+	// 에셋 잡음 루프. 합성 스컬치 베드(bEnableSquelchBed)가 돌고 있으면 재생하지 않음
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Audio")
 	USoundBase* LoopNoiseSound = nullptr;
 
 	// ===== Realtime tuning =====
+	// 최소 프리버퍼. 도착 지터/언더런에 따라 RealtimeMaxPrebufferMs까지 자동으로 늘어남
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Tuning")
-	float RealtimeFlushIntervalSec = 0.02f; // 20ms
+	float RealtimePrebufferMs = 120.0f; // 80~150ms
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Tuning")
-	float RealtimePrebufferMs = 120.0f; // 80~150ms
+	float RealtimeMaxPrebufferMs = 400.0f;
+
+	// 지터 버퍼 링 용량 (서버가 실시간보다 빨리 보내는 분량을 담아둠. 넘치면 스트림 큐에서 대기)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Tuning", meta = (ClampMin = "1.0"))
+	float RealtimeJitterBufferSec = 4.0f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Tuning")
 	int32 RealtimeDefaultSampleRate = 24000;
@@ -107,6 +131,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Tuning")
 	bool bRealtimeForceMono = true;
 
+	// 송출이 끝날 때 언더런/오버런/지터 통계 로그
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Realtime|Debug")
+	bool bLogRealtimeJitterStats = true;
+
+	// ===== Radio FX (오디오 렌더 스레드에서 처리) =====
+	// 보이스 소스(클립/실시간 공통)에 대역 제한 + 소프트 클립. 게임 스레드 비용 없음
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx")
+	bool bEnableVoiceFx = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx", meta = (EditCondition = "bEnableVoiceFx"))
+	FSourceEffectRadioSettings VoiceFx;
+
+	// 송출 중 깔리는 잡음 + 키를 뗄 때 스컬치 꼬리 (합성, 에셋 불필요)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx")
+	bool bEnableSquelchBed = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx", meta = (EditCondition = "bEnableSquelchBed", ClampMin = "-80.0", ClampMax = "0.0"))
+	float BedLevelDb = -42.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx", meta = (EditCondition = "bEnableSquelchBed", ClampMin = "-80.0", ClampMax = "0.0"))
+	float TailLevelDb = -20.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Fx", meta = (EditCondition = "bEnableSquelchBed", ClampMin = "0.01", ClampMax = "2.0"))
+	float TailSec = 0.25f;
+
 private:
 	// ===== Components =====
 	UPROPERTY(VisibleAnywhere)
@@ -118,6 +167,27 @@ private:
 	UPROPERTY(VisibleAnywhere)
 	UAudioComponent* SfxAudioComp = nullptr;
 
+	UPROPERTY(VisibleAnywhere)
+	UAudioComponent* BedAudioComp = nullptr;
+
+	// ===== Radio FX =====
+	UPROPERTY()
+	USourceEffectRadioPreset* VoiceFxPreset = nullptr;
+
+	UPROPERTY()
+	USoundEffectSourcePresetChain* VoiceFxChain = nullptr;
+
+	UPROPERTY()
+	URadioBedSoundWave* BedWave = nullptr;
+
+	// 게임 스레드는 키 on/off만, 합성은 렌더 스레드
+	FRadioSquelchBedPtr SquelchBed;
+
+	void SetupRadioFx();
+
+	// 송출 중 잡음: 베드가 없을 때만 LoopNoiseSound (둘 다 켜면 잡음이 두 겹)
+	void StartLoopNoise();
+
 	// ===== Clip queue state =====
 	UPROPERTY()
 	TArray<URadioLineData*> Queue;
@@ -130,6 +200,9 @@ private:
 
 	FTimerHandle StateTimerHandle;
 
+	// PlayState는 여기로만 바꿈 (Idle이 아니면 무전 키 잡은 상태)
+	void SetPlayState(ERadioPlayState NewState);
+
 	void TryPlayNextFromQueue();
 	void PlayStartTone();
 	void OnStartToneFinished();
@@ -140,6 +213,9 @@ private:
 	UFUNCTION()
 	void OnVoiceFinished();
 
+	// 캐시 응답 클립 길이만큼 지남 (procedural이라 OnAudioFinished가 저절로 안 옴)
+	void OnClipVoiceFinished();
+
 	void PlayPostDelay();
 	void OnPostDelayFinished();
 	void PlayEndTone();
@@ -154,14 +230,20 @@ private:
 	FRadioSubtitleInfomation RealtimeSubtitle;
 
 	UPROPERTY()
-	USoundWaveProcedural* RealtimeWave = nullptr;
+	URadioStreamSoundWave* RealtimeWave = nullptr;
 
 	int32 RealtimeSampleRate = 0;
 	int32 RealtimeNumChannels = 0;
 
-	TArray<uint8> PendingPcm;
+	// 워커 -> 오디오 렌더 스레드
+	FRealtimePcmStreamPtr RealtimePcmStream;
+	FRadioJitterBufferPtr RealtimeJitter;
 
-	FTimerHandle RealtimeFlushTimerHandle;
+	// 응답 끝(EndOfStream) 후 버퍼가 다 재생될 때까지 대기
+	bool bRealtimeDraining = false;
+	float RealtimeDrainLastBufferedMs = 0.f;
+	double RealtimeDrainLastProgressSec = 0.0;
+	FTimerHandle RealtimeDrainTimerHandle;
 
 	void InterruptAllPlayback_Internal(bool bClearQueue);
 
@@ -170,17 +252,14 @@ private:
 	void PlayRealtimeEndTone();
 	void OnRealtimeEndToneFinished();
 
-	USoundWaveProcedural* EnsureRealtimeWave(int32 SampleRate, int32 NumChannels);
+	URadioStreamSoundWave* CreateRealtimeWave(int32 SampleRate, int32 NumChannels);
 
-	void StartFlushTimerIfNeeded();
-	void StopFlushTimer();
-
-	// ✅ 헤더/CPP 시그니처 일치
-	void FlushPendingPcm(bool bForceAll);
-
-	void StartRealtimeVoiceIfNeeded();
+	void StartRealtimeVoice();
 	void StopRealtimeVoice_Internal();
 
+	void PollRealtimeDrain();
+	void StopDrainTimer();
+	void FinishRealtimeVoice();
+
 	int32 GetUseChannels(int32 InChannels) const;
-	int32 CalcPrebufferBytes(int32 SampleRate, int32 NumChannels) const;
 };
@@ -0,0 +1,140 @@
+// ============================ RadioReplyCache.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "VoiceUtterance.h"
+#include "RadioReplyCache.generated.h"
+
+// 챕터별로 미리 올려둘 정형 대사 (응답 확인, 표준 경고 ...)
+UCLASS(BlueprintType)
+class GOLDENTIME119_API URadioReplySet : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Realtime 음성이 실제로 말한 텍스트와 같아야 함 (띄어쓰기/문장부호/대소문자는 무시)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Radio|Cache", meta = (MultiLine = true))
+	TArray<FString> Lines;
+};
+
+/**
+ * Content-addressed cache of synthesized radio replies.
+ *
+ * A reply is keyed by SHA-1 of its normalized text (FVoiceCommandMatcher::Tokenize, so spacing and
+ * punctuation do not split entries) plus the voice profile (model, voice, output format), so a change of
+ * voice never serves stale audio. Completed Realtime replies are stored here as PCM16 (URealtimeVoiceComponent),
+ * kept in memory under an LRU byte budget and written to Saved/<CacheDirectory>/<key>.wav in the background.
+ * Disk entries are only loaded off the game thread: either by PreloadReplySet at chapter start, or on the
+ * first FindReply miss so the next request hits. Game thread only.
+ *
+ * Settings come from DefaultGame.ini:
+ *
+ *   [/Script/GoldenTime119.RadioReplyCacheSubsystem]
+ *   MemoryBudgetMB=32
+ *   MaxDiskMB=256
+ */
+UCLASS(Config = Game)
+class GOLDENTIME119_API URadioReplyCacheSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static URadioReplyCacheSubsystem* Get(const UObject* WorldContextObject);
+
+	// 캐시 키 (소문자, 공백/문장부호 정리)
+	static FString NormalizeText(const FString& Text);
+	static FString MakeKey(const FString& Text, const FString& VoiceProfile);
+
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache")
+	bool bEnabled = true;
+
+	// 끄면 메모리에만 (세션이 끝나면 사라짐)
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache")
+	bool bPersistToDisk = true;
+
+	// Saved 기준 상대 경로
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache")
+	FString CacheDirectory = TEXT("RadioReplyCache");
+
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache", meta = (ClampMin = "1"))
+	int32 MemoryBudgetMB = 32;
+
+	// 시작할 때 오래된 파일부터 지워서 맞춤
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache", meta = (ClampMin = "1"))
+	int32 MaxDiskMB = 256;
+
+	// 이보다 긴 대사는 저장하지 않음 (정형 응답만 반복됨)
+	UPROPERTY(Config, EditAnywhere, Category = "Radio|Cache", meta = (ClampMin = "1"))
+	int32 MaxCachedChars = 120;
+
+	// UGameInstanceSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Realtime 연결 설정 (모델|보이스|출력 포맷). 바뀌면 미리 올린 대사 세트를 새 키로 다시 로드
+	void SetVoiceProfile(const FString& InProfile);
+	const FString& GetVoiceProfile() const { return VoiceProfile; }
+
+	// 메모리에 있으면 바로. 디스크에만 있으면 백그라운드 로드를 걸고 null (다음 요청부터 적중)
+	FVoiceUtterancePtr FindReply(const FString& Text);
+
+	UFUNCTION(BlueprintPure, Category = "Radio|Cache")
+	bool IsReplyCached(const FString& Text) const;
+
+	// 새 대사 저장 (메모리 + 디스크). 너무 길거나 비어 있으면 false
+	bool StoreReply(const FString& Text, TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels);
+
+	// 챕터 시작 때: 디스크에 있는 대사를 백그라운드에서 메모리로
+	UFUNCTION(BlueprintCallable, Category = "Radio|Cache")
+	void PreloadReplySet(URadioReplySet* Set);
+
+	UFUNCTION(BlueprintCallable, Category = "Radio|Cache")
+	void PreloadLines(const TArray<FString>& Lines);
+
+	UFUNCTION(BlueprintCallable, Category = "Radio|Cache")
+	void ClearMemory();
+
+	// ===== Stats =====
+	int64 GetMemoryBytes() const { return MemoryBytes; }
+	int32 GetNumEntries() const { return Entries.Num(); }
+	int64 GetHits() const { return Hits; }
+	int64 GetMisses() const { return Misses; }
+
+private:
+	struct FEntry
+	{
+		FVoiceUtterancePtr Clip;
+		uint64 LastUse = 0;
+	};
+
+	FString VoiceProfile;
+
+	TMap<FString, FEntry> Entries;
+	int64 MemoryBytes = 0;
+	uint64 UseCounter = 0;
+
+	// 디스크에 있는 키 (시작할 때 한 번 스캔 + 저장할 때 추가)
+	TSet<FString> DiskKeys;
+	bool bDiskScanned = false;
+
+	// 백그라운드 로드 중인 키 (중복 요청 방지)
+	TSet<FString> PendingLoads;
+
+	// 프로필이 바뀌면 다시 올릴 대사
+	TArray<FString> PreloadedLines;
+
+	int64 Hits = 0;
+	int64 Misses = 0;
+
+	FString GetCacheDir() const;
+	FString GetCachePath(const FString& Key) const;
+
+	void AddEntry(const FString& Key, const FVoiceUtterancePtr& Clip);
+	void EvictToBudget();
+
+	void ScanDiskAsync();
+	void LoadFromDiskAsync(const FString& Key);
+	void PreloadKeys();
+};
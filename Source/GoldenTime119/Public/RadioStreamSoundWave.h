@@ -0,0 +1,63 @@
+// ============================ RadioStreamSoundWave.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundWaveProcedural.h"
+#include "RadioJitterBuffer.h"
+#include "RadioVoiceFx.h"
+#include "VoiceUtterance.h"
+#include "RadioStreamSoundWave.generated.h"
+
+// 오디오 렌더 스레드에서 지터 버퍼를 직접 당겨 재생하는 procedural wave (QueueAudio 사용 안 함)
+UCLASS()
+class GOLDENTIME119_API URadioStreamSoundWave : public USoundWaveProcedural
+{
+	GENERATED_BODY()
+
+public:
+	// Play 전에 게임 스레드에서 한 번 설정
+	void SetJitterBuffer(const FRadioJitterBufferPtr& InBuffer) { JitterBuffer = InBuffer; }
+
+	virtual int32 GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded) override;
+
+private:
+	FRadioJitterBufferPtr JitterBuffer;
+};
+
+// 무전 채널 스컬치 잡음 (FRadioSquelchBed)을 렌더 스레드에서 합성. 키가 없으면 무음이라 계속 재생해 둠
+UCLASS()
+class GOLDENTIME119_API URadioBedSoundWave : public USoundWaveProcedural
+{
+	GENERATED_BODY()
+
+public:
+	void SetSquelchBed(const FRadioSquelchBedPtr& InBed) { Bed = InBed; }
+
+	virtual int32 GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded) override;
+
+private:
+	FRadioSquelchBedPtr Bed;
+};
+
+// 캐시된 응답 클립 (URadioReplyCacheSubsystem) 재생. 메모리의 PCM을 그대로 읽고 끝난 뒤엔 무음
+// procedural이라 스스로 끝나지 않음: RadioManager가 클립 길이만큼 지나면 Stop
+UCLASS()
+class GOLDENTIME119_API URadioClipSoundWave : public USoundWaveProcedural
+{
+	GENERATED_BODY()
+
+public:
+	// Play 전에 게임 스레드에서 한 번 (포맷도 클립에 맞춤)
+	void SetClip(const FVoiceUtterancePtr& InClip);
+
+	double GetClipDurationSec() const { return Clip.IsValid() ? Clip->GetDurationSec() : 0.0; }
+
+	virtual int32 GeneratePCMData(uint8* PCMData, const int32 SamplesNeeded) override;
+
+private:
+	// 캐시에서 밀려나도 재생이 끝날 때까지 버퍼 유지
+	FVoiceUtterancePtr Clip;
+
+	// 오디오 렌더 스레드 전용
+	int32 ReadOffsetBytes = 0;
+};
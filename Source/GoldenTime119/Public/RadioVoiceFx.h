@@ -0,0 +1,144 @@
+// ============================ RadioVoiceFx.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sound/SoundEffectSource.h"
+#include "VoiceAudioDSP.h"
+#include <atomic>
+#include "RadioVoiceFx.generated.h"
+
+USTRUCT(BlueprintType)
+struct GOLDENTIME119_API FSourceEffectRadioSettings
+{
+	GENERATED_BODY()
+
+	// 무전기 대역 하한 (2차 HP 두 단, 24 dB/oct)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radio|Fx", meta = (ClampMin = "20.0", ClampMax = "2000.0"))
+	float LowCutHz = 300.f;
+
+	// 대역 상한 (2차 LP 두 단)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radio|Fx", meta = (ClampMin = "1000.0", ClampMax = "20000.0"))
+	float HighCutHz = 3000.f;
+
+	// 소프트 클립 앞단 게인. 높을수록 찌그러짐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radio|Fx", meta = (ClampMin = "0.0", ClampMax = "30.0"))
+	float DriveDb = 9.f;
+
+	// 풀스케일 입력이 나오는 레벨 (드라이브 보정 후)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radio|Fx", meta = (ClampMin = "-30.0", ClampMax = "6.0"))
+	float OutputGainDb = -3.f;
+};
+
+/**
+ * Radio voice coloring: band-pass (HP x2 -> LP x2) then soft clip. Runs on the audio render thread.
+ * Init allocates the scratch buffer; Process never allocates. Multichannel input is folded to mono
+ * (a handheld radio is mono) and the result is written back to every channel.
+ */
+class GOLDENTIME119_API FRadioVoiceFx
+{
+public:
+	void Init(float InSampleRate, const FSourceEffectRadioSettings& InSettings);
+
+	// 재생 중 프리셋 변경: 계수만 갱신하고 필터 상태는 유지 (클릭 없음)
+	void SetSettings(const FSourceEffectRadioSettings& InSettings);
+	void Reset();
+
+	void ProcessMono(float* InOut, int32 Num);
+
+	// 대역 필터만 (클립 없이, 소신호 게인 1)
+	void ProcessBand(float* InOut, int32 Num);
+
+	// In == Out 허용
+	void ProcessInterleaved(const float* In, float* Out, int32 NumFrames, int32 NumChannels);
+
+private:
+	static constexpr int32 ScratchFrames = 512;
+
+	float SampleRate = 48000.f;
+	float Drive = 1.f;
+	float OutGain = 1.f;
+
+	FVoiceBiquad HighPass[2];
+	FVoiceBiquad LowPass[2];
+
+	TArray<float> Scratch;
+};
+
+/**
+ * Squelch noise for the radio channel, synthesized on the render thread (no asset, no allocation after Init).
+ *  - Keyed (a voice is on the air): a low band-limited hiss under the voice.
+ *  - Key released: a short squelch tail that starts at TailLevelDb and decays to -60 dB over TailSec.
+ *  - Idle: writes silence and skips the DSP.
+ * The game thread only flips SetKeyed; everything else happens inside Render.
+ */
+class GOLDENTIME119_API FRadioSquelchBed
+{
+public:
+	// 재생 전에 게임 스레드에서 한 번
+	void Init(float InSampleRate, const FSourceEffectRadioSettings& InBand, float InBedLevelDb, float InTailLevelDb, float InTailSec);
+
+	// 게임 스레드
+	void SetKeyed(bool bInKeyed) { bKeyed.store(bInKeyed, std::memory_order_release); }
+	bool IsKeyed() const { return bKeyed.load(std::memory_order_acquire); }
+
+	// 렌더 스레드. 항상 Num 샘플을 채움
+	void Render(float* Out, int32 Num);
+	void RenderPcm16(int16* Out, int32 Num);
+
+	int32 GetStatTails() const { return StatTails.load(std::memory_order_relaxed); }
+
+private:
+	static constexpr int32 ScratchFrames = 512;
+
+	std::atomic<bool> bKeyed{ false };
+	std::atomic<int32> StatTails{ 0 };
+
+	// 이하 렌더 스레드 전용
+	FRadioVoiceFx Band;
+	uint32 NoiseState[4] = { 0x9E3779B9u, 0x85EBCA6Bu, 0xC2B2AE35u, 0x27D4EB2Fu };
+
+	float SampleRate = 16000.f;
+	float BedGain = 0.f;
+	float TailGain = 0.f;
+	float TailDecayPerSample = 0.f;   // 지수 감쇠 (샘플당 배율)
+	int32 TailSamples = 0;
+
+	bool bWasKeyed = false;
+	bool bActive = false;
+	float CurrentGain = 0.f;
+	int32 TailRemaining = 0;
+
+	TArray<float> Scratch;
+};
+
+typedef TSharedPtr<FRadioSquelchBed, ESPMode::ThreadSafe> FRadioSquelchBedPtr;
+
+// ===== Source effect =====
+
+class GOLDENTIME119_API FSourceEffectRadio : public FSoundEffectSource
+{
+public:
+	virtual void Init(const FSoundEffectSourceInitData& InInitData) override;
+	virtual void OnPresetChanged() override;
+	virtual void ProcessAudio(const FSoundEffectSourceInputData& InData, float* OutAudioBufferData) override;
+
+private:
+	FRadioVoiceFx Fx;
+	int32 NumChannels = 1;
+};
+
+// 무전기 음색 소스 이펙트. ARadioManager가 보이스 소스 체인에 자동으로 붙임 (직접 에셋으로 만들어 써도 됨)
+UCLASS(ClassGroup = AudioSourceEffect, meta = (BlueprintSpawnableComponent))
+class GOLDENTIME119_API USourceEffectRadioPreset : public USoundEffectSourcePreset
+{
+	GENERATED_BODY()
+
+public:
+	EFFECT_PRESET_METHODS(SourceEffectRadio)
+
+	UFUNCTION(BlueprintCallable, Category = "Audio|Effects")
+	void SetSettings(const FSourceEffectRadioSettings& InSettings);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = SourceEffectPreset, meta = (ShowOnlyInnerProperties))
+	FSourceEffectRadioSettings Settings;
+};
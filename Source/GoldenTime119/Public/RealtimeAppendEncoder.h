@@ -0,0 +1,43 @@
+// ============================ RealtimeAppendEncoder.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Builds the Realtime `input_audio_buffer.append` event straight into a reused UTF-8 buffer:
+ *     {"type":"input_audio_buffer.append","audio":"<base64 pcm16>"}
+ * The JSON around the audio never changes, so it is a fixed prefix/suffix and no FJsonObject,
+ * FString or UTF-16 -> UTF-8 conversion is involved. PCM can be queued over several frames and
+ * sent as one larger append (coalescing). Buffers only grow, so steady state is allocation-free.
+ */
+class GOLDENTIME119_API FRealtimeAppendEncoder
+{
+public:
+	// 최대 PCM 바이트(코얼레싱 포함) 기준으로 미리 확보
+	void Reserve(int32 MaxPcmBytes);
+
+	// PCM16 LE 한 프레임을 대기열에 추가
+	void AddPcm(const uint8* Data, int32 NumBytes);
+
+	bool HasPending() const { return PendingPcm.Num() > 0; }
+	int32 GetPendingFrames() const { return PendingFrames; }
+	int32 GetPendingBytes() const { return PendingPcm.Num(); }
+	TArrayView<const uint8> GetPendingPcm() const { return PendingPcm; }
+
+	// 대기 중인 PCM 전체를 append 이벤트 하나로 인코딩하고 대기열을 비움.
+	// 반환된 뷰는 다음 BuildMessage/Reset 전까지 유효
+	TArrayView<const uint8> BuildMessage();
+
+	// 대기 PCM 버림 (턴 리셋/연결 끊김)
+	void Reset();
+
+	// 버퍼가 다시 할당된 횟수. 워밍업 이후 0에서 늘지 않아야 정상
+	int32 GetGrowthCount() const { return GrowthCount; }
+
+private:
+	TArray<uint8> PendingPcm;
+	int32 PendingFrames = 0;
+
+	TArray<uint8> Message;
+	int32 GrowthCount = 0;
+};
@@ -0,0 +1,194 @@
+// ============================ RealtimeConnection.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "RealtimeConnection.generated.h"
+
+class IWebSocket;
+
+UENUM(BlueprintType)
+enum class ERealtimeLinkState : uint8
+{
+	// Open() 전 / Close() 후 / 재시도 포기
+	Offline,
+	Connecting,
+	Open,
+	// 끊김 후 재연결 대기
+	Backoff,
+};
+
+// 연결 유지 정책 (URealtimeVoiceComponent::Connection)
+USTRUCT(BlueprintType)
+struct GOLDENTIME119_API FRealtimeConnectionSettings
+{
+	GENERATED_BODY()
+
+	// 예기치 않게 끊기면 다시 연결 (Disconnect()로 닫은 건 제외)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection")
+	bool bAutoReconnect = true;
+
+	// 재시도 간격: Initial * 2^n, 최대 Max. 실제 대기는 [1 - Jitter, 1] 배 균등 분포 (여러 클라이언트가 동시에 몰리지 않게)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.05"))
+	float InitialBackoffSec = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.1"))
+	float MaxBackoffSec = 15.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float BackoffJitter = 0.5f;
+
+	// 연속 실패 허용 횟수 (0 = 무제한). 세션이 열리면 초기화
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0"))
+	int32 MaxReconnectAttempts = 0;
+
+	// 연결 시도가 이 시간 안에 안 열리면 실패로 보고 재시도
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "1.0"))
+	float ConnectTimeoutSec = 10.f;
+
+	// 서버에서 이만큼 아무것도 안 오면 프로브 (빈 session.update -> session.updated). 0 = 끔
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.0"))
+	float KeepaliveIntervalSec = 20.f;
+
+	// 프로브 후 이 시간 안에 응답이 없으면 죽은 연결로 보고 다시 연결
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "1.0"))
+	float KeepaliveTimeoutSec = 8.f;
+
+	// 세션 최대 수명 전에 쉬는 동안 미리 새로 연결 (첫 PTT가 만료된 세션을 만나지 않게). 0 = 끔
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.0"))
+	float SessionRefreshSec = 25.f * 60.f;
+
+	// 끊긴 동안 보낸 이벤트(발화 오디오, commit, 응답 요청)를 붙잡아 두는 시간. 넘으면 버림 (늦은 답은 의미 없음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0.0"))
+	float OutageHoldSec = 5.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Connection", meta = (ClampMin = "0"))
+	int32 OutageBufferKB = 1024;
+};
+
+struct FRealtimeConnectionStats
+{
+	int32 Connects = 0;             // 열린 횟수 (재연결 포함)
+	int32 Drops = 0;                // 예기치 않은 끊김
+	int32 FailedAttempts = 0;
+	int32 KeepaliveProbes = 0;
+	int32 DeadLinks = 0;            // 프로브 무응답으로 끊은 횟수
+	int32 Refreshes = 0;
+	int32 DeferredSent = 0;         // 끊긴 동안 붙잡았다가 재연결 후 보낸 이벤트
+	int32 DeferredDropped = 0;
+	double LastConnectMs = 0.0;
+	double LastOutageSec = 0.0;     // 마지막 끊김 -> 재연결까지
+};
+
+/**
+ * Keeps the Realtime WebSocket alive for URealtimeVoiceComponent.
+ *
+ * Sockets come from a factory so the same policy runs against the service or FMockRealtimeWebSocket.
+ * Unexpected closes and connect failures are retried with exponential backoff and full jitter; an idle link
+ * is probed with an empty session.update and torn down if the probe goes unanswered; a session close to its
+ * maximum age is replaced while the radio is idle. While a dropped link is being recovered, outgoing events
+ * are held (bounded by OutageHoldSec / OutageBufferKB) and sent in order once the owner has restored the
+ * session (MarkSessionReady). Audio the dropped session had already received is gone with it; the owner
+ * re-sends that part of the turn before calling MarkSessionReady so the held events complete it in order.
+ * Game thread only; Tick drives all timers from the supplied clock so tests can run accelerated time.
+ */
+class GOLDENTIME119_API FRealtimeConnection
+{
+public:
+	typedef TFunction<TSharedPtr<IWebSocket>()> FSocketFactory;
+
+	DECLARE_DELEGATE_OneParam(FOnOpened, bool /*bReconnect*/);
+	DECLARE_DELEGATE_TwoParams(FOnLost, const FString& /*Reason*/, bool /*bWillRetry*/);
+	DECLARE_DELEGATE_ThreeParams(FOnRawMessage, const void* /*Data*/, SIZE_T /*Size*/, SIZE_T /*BytesRemaining*/);
+
+	FOnOpened OnOpened;
+	FOnLost OnLost;
+	FOnRawMessage OnRawMessage;
+
+	// 쉬는 중인지 (세션 교체는 이때만). 없으면 항상 쉬는 중으로 봄
+	TFunction<bool()> IsIdle;
+
+	~FRealtimeConnection();
+
+	void Configure(const FRealtimeConnectionSettings& InSettings, FSocketFactory&& InFactory);
+
+	// 연결 유지 시작 / 중단 (중단은 재시도 없음)
+	void Open(double NowSec);
+	void Close();
+
+	void Tick(double NowSec);
+
+	ERealtimeLinkState GetState() const { return State; }
+	bool IsOpen() const;
+
+	// Offline이 아님 (연결 중이거나 재연결 대기도 포함)
+	bool IsActive() const { return State != ERealtimeLinkState::Offline; }
+
+	// 끊겼다가 세션을 복구하는 중 (MarkSessionReady 전까지). 이 동안 bDeferIfOffline 이벤트는 붙잡아 둠
+	bool IsRecovering() const { return OutageStartSec > 0.0; }
+
+	// 지금 보내면 재연결 후 전송되는지 (복구 중이고 끊긴 지 OutageHoldSec 이내)
+	bool CanDefer() const;
+
+	// 보냈거나 붙잡아 뒀으면 true. bDeferIfOffline: 복구 중이면 세션이 돌아온 뒤에 순서대로 (오디오/commit/응답 요청)
+	// 아니면 열려 있을 때만 바로 보냄 (세션 설정, clear/cancel처럼 새 세션에서 의미 없는 것)
+	bool Send(const FString& Text, bool bDeferIfOffline = false);
+	bool Send(const void* Utf8, int32 Size, bool bDeferIfOffline = false);
+
+	// 새 턴이 시작되면 붙잡아 둔 이전 발화는 버림
+	void ClearDeferred();
+	int32 GetDeferredBytes() const { return DeferredBytes; }
+
+	// 세션 설정 복구 완료 (session.updated): 붙잡아 둔 이벤트 전송 + 재시도 횟수 초기화
+	void MarkSessionReady();
+
+	const FRealtimeConnectionStats& GetStats() const { return Stats; }
+
+private:
+	void StartAttempt(double NowSec);
+	void ReleaseSocket();
+	void HandleLost(const FString& Reason, bool bRetry);
+	void ScheduleRetry(double NowSec);
+	bool Defer(const void* Utf8, int32 Size);
+	void ExpireDeferred(double NowSec);
+	void SendProbe();
+
+	// ===== Socket callbacks =====
+	void HandleSocketConnected();
+	void HandleSocketError(const FString& Error);
+	void HandleSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
+	void HandleSocketRaw(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+
+	FRealtimeConnectionSettings Settings;
+	FSocketFactory Factory;
+	TSharedPtr<IWebSocket> Socket;
+
+	// 콜백 안에서 놓은 소켓 (다음 Tick에 해제)
+	TArray<TSharedPtr<IWebSocket>> Retired;
+
+	ERealtimeLinkState State = ERealtimeLinkState::Offline;
+	FRandomStream Rng;
+
+	// Tick이 준 시각 (소켓 콜백 안에서 씀)
+	double Now = 0.0;
+
+	double AttemptStartSec = 0.0;
+	double RetryAtSec = 0.0;
+	int32 Attempts = 0;
+
+	// 한 번이라도 세션이 열렸으면 이후 연결은 재연결
+	bool bEverOpened = false;
+	bool bSessionReady = false;
+	double OpenedSec = 0.0;
+	double LastRxSec = 0.0;
+	double ProbeSentSec = 0.0;
+	bool bProbeOutstanding = false;
+
+	// 끊긴 시각 (0 = 끊김 아님). 붙잡아 둔 이벤트의 유효 기간 기준
+	double OutageStartSec = 0.0;
+
+	TArray<TArray<uint8>> Deferred;
+	int32 DeferredBytes = 0;
+
+	FRealtimeConnectionStats Stats;
+};
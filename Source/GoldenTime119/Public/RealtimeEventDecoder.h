@@ -0,0 +1,154 @@
+// ============================ RealtimeEventDecoder.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/CircularQueue.h"
+#include "Containers/LockFreeList.h"
+#include "Containers/Queue.h"
+#include "RealtimePcmStream.h"
+#include "VoiceAudioCodec.h"
+#include <atomic>
+
+class FJsonObject;
+class FRunnableThread;
+class FEvent;
+
+// 게임 스레드로 넘어가는 이벤트 (오디오 델타 제외한 제어 이벤트 + 오디오 시작 알림)
+struct FRealtimeControlEvent
+{
+	FString Type;
+
+	// 오디오 델타 알림에는 없음
+	TSharedPtr<FJsonObject> Root;
+
+	// 오디오 델타: 스트림이 연결되지 않았을 때만 채워짐 (Blueprint OnOutputAudioDelta 호환 경로)
+	// response.done: 응답 전체 PCM (SetReplyCaptureLimit을 켰고 한도 안일 때)
+	TArray<uint8> Audio;
+
+	int32 RawBytes = 0;
+};
+
+/**
+ * Classifies and decodes incoming Realtime server events off the game thread.
+ *
+ * The game thread only copies raw UTF-8 WebSocket fragments into pooled buffers (FeedFragment).
+ * A worker scans each message for the top-level "type" without building a JSON DOM;
+ * `response.output_audio.delta` payloads are Base64-decoded straight from the message bytes
+ * into pooled chunks of the attached FRealtimePcmStream. Everything else is small, so it is
+ * parsed into a DOM on the worker and queued for the game thread (PopControlEvent).
+ */
+class GOLDENTIME119_API FRealtimeEventDecoder : public FRunnable
+{
+public:
+	struct FConfig
+	{
+		int32 OutputSampleRate = 24000;
+		int32 OutputNumChannels = 1;
+
+		// 서버 output_audio 포맷. G.711이면 워커에서 디코드 + OutputSampleRate로 리샘플
+		ERealtimeAudioCodec OutputCodec = ERealtimeAudioCodec::Pcm16;
+
+		bool bVerboseLog = false;
+		bool bLogIncomingJson = false;
+		bool bLogIncomingSummary = false;
+		int32 LogEveryNAudioDeltas = 30;
+	};
+
+	FRealtimeEventDecoder();
+	virtual ~FRealtimeEventDecoder() override;
+
+	// 워커 시작. 스트림이 없으면 오디오는 게임 스레드 이벤트로 넘어감
+	bool Start(const FConfig& InConfig, const FRealtimePcmStreamPtr& InAudioStream);
+	void Shutdown();
+	bool IsRunning() const { return Thread != nullptr; }
+
+	// ===== Game thread =====
+	// IWebSocket::OnRawMessage 조각 그대로 전달
+	void FeedFragment(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+
+	bool PopControlEvent(FRealtimeControlEvent& OutEvent);
+
+	// 조립 중인 메시지 + 대기 중인 제어 이벤트 버림 (연결 종료)
+	void DiscardPending();
+
+	// 서버 오디오 게이트 (CreateResponse 이후에만 통과)
+	void SetAcceptAudio(bool bAccept) { bAcceptAudio.store(bAccept, std::memory_order_relaxed); }
+
+	// 협상 결과 반영 (session.updated). 워커가 다음 델타에서 적용
+	void SetOutputCodec(ERealtimeAudioCodec Codec) { RequestedCodec.store((uint8)Codec, std::memory_order_relaxed); }
+
+	// 응답 오디오를 모아 response.done 이벤트에 붙임 (응답 캐시용). 더 긴 응답은 버림. 0 = 끔
+	void SetReplyCaptureLimit(int32 MaxBytes) { ReplyCaptureLimit.store(FMath::Max(0, MaxBytes), std::memory_order_relaxed); }
+
+	// ===== Stats (any thread) =====
+	int64 GetAudioDeltaCount() const { return AudioDeltaCount.load(std::memory_order_relaxed); }
+	int64 GetDecodedAudioBytes() const { return DecodedAudioBytes.load(std::memory_order_relaxed); }
+	int32 GetBacklogPeak() const { return BacklogPeak; }
+
+	// 워커가 메시지 처리에 쓴 시간 (대기 제외)
+	double GetBusySeconds() const { return FPlatformTime::ToSeconds64(BusyCycles.load(std::memory_order_relaxed)); }
+
+	// ===== FRunnable =====
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FRawMessage
+	{
+		TArray<uint8> Bytes;
+	};
+
+	FRawMessage* AcquireRaw();
+	void ReleaseRaw(FRawMessage* Msg);
+
+	// 큐가 가득 찼을 때 게임 스레드에 쌓아둔 메시지를 순서대로 다시 밀어넣음
+	void FlushBacklog();
+
+	// ===== Worker =====
+	void ProcessMessage(const uint8* Data, int32 Size);
+	void ProcessAudioDelta(const uint8* Data, int32 Size);
+	void PushControlEvent(const FString& Type, const uint8* Data, int32 Size, TArray<uint8>* AttachAudio = nullptr);
+	void CaptureReplyAudio(const uint8* Pcm, int32 NumBytes);
+
+	FConfig Config;
+	FRealtimePcmStreamPtr AudioStream;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopRequested{ false };
+
+	// game -> worker
+	FRawMessage* Assembling = nullptr;
+	TCircularQueue<FRawMessage*> Inbound;
+	TLockFreePointerListUnordered<FRawMessage, PLATFORM_CACHE_LINE_SIZE> RawPool;
+	TArray<FRawMessage*> Backlog;
+	int32 BacklogPeak = 0;
+
+	// worker -> game
+	TQueue<FRealtimeControlEvent, EQueueMode::Spsc> ControlEvents;
+
+	std::atomic<bool> bAcceptAudio{ true };
+	std::atomic<uint8> RequestedCodec{ 0 };
+	std::atomic<int32> ReplyCaptureLimit{ 0 };
+
+	// 워커 전용: 응답마다 첫 델타에서 한 번만 시작 알림
+	bool bAudioStartNotified = false;
+	int64 MessageCounter = 0;
+
+	// 이스케이프(\/)가 섞인 델타용 스크래치 (워커 전용)
+	TArray<ANSICHAR> UnescapeScratch;
+
+	// 압축 전송일 때: Base64 -> WireScratch -> CodecDecoder -> 청크 (워커 전용)
+	FVoiceCodecDecoder CodecDecoder;
+	ERealtimeAudioCodec ActiveCodec = ERealtimeAudioCodec::Pcm16;
+	TArray<uint8> WireScratch;
+
+	// response.created ~ response.done 사이 디코드된 PCM (워커 전용)
+	TArray<uint8> ReplyCapture;
+	bool bReplyCaptureOverflow = false;
+
+	std::atomic<int64> AudioDeltaCount{ 0 };
+	std::atomic<int64> DecodedAudioBytes{ 0 };
+	std::atomic<uint64> BusyCycles{ 0 };
+};
@@ -0,0 +1,68 @@
+// ============================ RealtimePcmStream.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "Containers/LockFreeList.h"
+#include <atomic>
+
+// 디코드된 PCM16 LE 조각. 풀에서 재사용되므로 Bytes 용량은 유지됨
+struct FRealtimePcmChunk
+{
+	TArray<uint8> Bytes;
+	int32 SampleRate = 0;
+	int32 NumChannels = 0;
+
+	// Push 시 채워짐: 순번(이전 송출 잔여분 구분) + 도착 시각(지터 추정)
+	uint64 Serial = 0;
+	double ArrivalTime = 0.0;
+};
+
+/**
+ * Single-producer / single-consumer hand-off of decoded realtime audio.
+ *   producer (network decode worker): AcquireChunk -> fill -> Push
+ *   consumer (radio jitter buffer, audio render thread): Pop -> consume -> Recycle
+ * Chunks live in a lock-free free list and keep their capacity, so steady state never allocates.
+ * Both sides hold it through a thread-safe shared pointer, so either can go away first.
+ */
+class GOLDENTIME119_API FRealtimePcmStream
+{
+public:
+	explicit FRealtimePcmStream(uint32 InCapacity = 256);
+	~FRealtimePcmStream();
+
+	FRealtimePcmStream(const FRealtimePcmStream&) = delete;
+	FRealtimePcmStream& operator=(const FRealtimePcmStream&) = delete;
+
+	// ===== Producer =====
+	FRealtimePcmChunk* AcquireChunk();
+
+	// false면 큐가 가득 참 (청크는 풀로 반납되고 드롭 카운트 증가)
+	bool Push(FRealtimePcmChunk* Chunk);
+
+	// ===== Consumer =====
+	FRealtimePcmChunk* Pop();
+	void Recycle(FRealtimePcmChunk* Chunk);
+
+	// 지금까지 Push된 청크 수. 이 값 이전 Serial은 "이미 들어와 있던" 조각
+	uint64 GetPushedCount() const { return NumPushed.load(std::memory_order_acquire); }
+
+	// 대기 중인 청크 전부 버림 (consumer 쪽에서만 호출)
+	int32 DiscardAll();
+
+	bool IsEmpty() const { return Queue.IsEmpty(); }
+
+	// ===== Stats =====
+	int32 GetAllocatedChunks() const { return NumAllocated.load(std::memory_order_relaxed); }
+	int32 GetDroppedChunks() const { return NumDropped.load(std::memory_order_relaxed); }
+
+private:
+	TCircularQueue<FRealtimePcmChunk*> Queue;
+	TLockFreePointerListUnordered<FRealtimePcmChunk, PLATFORM_CACHE_LINE_SIZE> FreeList;
+
+	std::atomic<int32> NumAllocated{ 0 };
+	std::atomic<int32> NumDropped{ 0 };
+	std::atomic<uint64> NumPushed{ 0 };
+};
+
+typedef TSharedPtr<FRealtimePcmStream, ESPMode::ThreadSafe> FRealtimePcmStreamPtr;
@@ -3,6 +3,11 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "RealtimeAppendEncoder.h"
+#include "RealtimeEventDecoder.h"
+#include "VoiceAudioCodec.h"
+#include "MockRealtimeServer.h"
+#include "RealtimeConnection.h"
 #include "RealtimeVoiceComponent.generated.h"
 
 // ===== Delegates =====
@@ -30,6 +35,7 @@ public:
 	// ===== Lifecycle =====
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// ===== Connection =====
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
@@ -41,7 +47,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
 	bool IsConnected() const;
 
+	// ưų ª  ϴ  (̶  ȭ/ û  ƿ ۵)
+	// PTT Է  ̰ɷ Ǵ
+	UFUNCTION(BlueprintCallable, Category = "Realtime")
+	bool IsAvailable() const;
+
+	UFUNCTION(BlueprintPure, Category = "Realtime")
+	ERealtimeLinkState GetLinkState() const { return Connection.GetState(); }
+
+	const FRealtimeConnectionStats& GetConnectionStats() const { return Connection.GetStats(); }
+
 	// ===== Session / Context =====
+	//   ƹ͵  . ٲ instructions  session.update (  ٽ  )
+	//  ٲ  ´ UVoiceContextPublisherComponent ļ (ȭ  + Ʋ +  )
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
 	void UpdateDynamicContext(const FString& NewContext);
 
@@ -53,12 +71,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
 	void AppendInputAudioPCM16(const TArray<uint8>& Pcm16Bytes);
 
+	// C++ : TArray  ٷ (ĸó   )
+	void AppendInputAudioPCM16Raw(const uint8* Pcm16Bytes, int32 NumBytes);
+
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
 	void CommitInputAudio();
 
 	UFUNCTION(BlueprintCallable, Category = "Realtime")
 	void CreateResponse();
 
+	//  STT   ؽƮ ޽ ߰ (conversation.item.create).  CreateResponse  û
+	UFUNCTION(BlueprintCallable, Category = "Realtime")
+	void SendUserText(const FString& Text);
+
+	//  縦 ״ а ϴ  û (ĳÿ  ). ϷǸ  ĳÿ 
+	//  ARadioManager::PlayReplyText ĳø Ȯ 
+	UFUNCTION(BlueprintCallable, Category = "Realtime")
+	void RequestSpokenLine(const FString& Text);
+
 	// ===== Safety gate =====
 	// CreateResponse() ȣ Ͽ output_audio.delta óϵ Ʈ
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Safety")
@@ -70,6 +100,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Realtime|Safety")
 	bool IsServerAudioAllowed() const { return bAllowServerAudio; }
 
+	// ===== Output audio stream (C++) =====
+	// Ǹ output_audio.delta Ŀ 忡 ٷ  Ʈ 
+	// OnOutputAudioDelta ȣ . Connect()   (  )
+	void SetOutputAudioStream(const FRealtimePcmStreamPtr& InStream) { OutputAudioStream = InStream; }
+
 	// ===== Events =====
 	UPROPERTY(BlueprintAssignable, Category = "Realtime|Events")
 	FOnRealtimeConnected OnConnected;
@@ -107,6 +142,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
 	int32 InputNumChannels = 1;
 
+	// N   append    (1 = Ӹ , 20ms  x5 = 100ms)
+	// commit    ׻  
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio", meta = (ClampMin = "1", ClampMax = "25"))
+	int32 AppendCoalesceFrames = 1;
+
 	// output format (Ʈ )
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
 	int32 OutputSampleRate = 24000;
@@ -114,6 +154,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
 	int32 OutputNumChannels = 1;
 
+	//  ڵ (session.audio.*.format). G.711(8kHz )̸ ۽ InputSampleRate -> 8k,  8k -> OutputSampleRate
+	// 迡 ϰ ĸó/  ״. 24kHz PCM16  뿪 1/6
+	//  session.updated ٸ  ˷ָ  
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
+	ERealtimeAudioCodec InputCodec = ERealtimeAudioCodec::Pcm16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
+	ERealtimeAudioCodec OutputCodec = ERealtimeAudioCodec::Pcm16;
+
 	// PTT 忡 VAD   Ϲ
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Audio")
 	bool bDisableVADForPTT = true;
@@ -139,6 +188,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Auth")
 	FString KeyFilePath = TEXT("Documents/key/API_DoNotMoveOrCopy.txt");
 
+	// ===== Connection =====
+	// 翬 , keepalive,  ,   ۽  (Connect()  )
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Connection")
+	FRealtimeConnectionSettings ConnectionSettings;
+
+	// ===== Offline =====
+	// Ŭ  μ     (API Ű/Ʈũ ʿ,  ̺Ʈ )
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Offline")
+	bool bUseMockServer = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Realtime|Offline", meta = (EditCondition = "bUseMockServer"))
+	FMockRealtimeSettings MockServer;
+
+	// ===== Reply cache =====
+	// Ϸ ª   URadioReplyCacheSubsystem  (    )
+	// Ű /̽/    ٲ  
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Cache")
+	bool bCacheReplies = true;
+
+	// ̺   Ŀ   ( 亯 ޸𸮿  ʰ)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Cache", meta = (EditCondition = "bCacheReplies", ClampMin = "1.0", ClampMax = "30.0"))
+	float MaxCachedReplySec = 8.f;
+
 	// ===== Logging =====
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Realtime|Debug")
 	bool bEnableVerboseLog = true;
@@ -160,25 +232,72 @@ public:
 
 private:
 	// ===== Websocket =====
-	TSharedPtr<class IWebSocket> Socket;
+	//  /翬 ⼭.  (session.update) Ʈ
+	FRealtimeConnection Connection;
 	double ConnectStartTimeSec = 0.0;
 
+	//  ۽/ ð (    )
+	double LastActivitySec = 0.0;
+
+	TSharedPtr<class IWebSocket> CreateSocket();
+	bool IsLinkIdle() const;
+
 	// ===== Counters =====
 	int64 OutgoingEventCounter = 0;
 	int64 IncomingEventCounter = 0;
 	int64 AppendCounter = 0;
-	int64 AudioDeltaCounter = 0;
 	int64 TotalAppendedPcmBytes = 0;
-	int64 TotalReceivedOutAudioBytes = 0;
 
 	// ===== State =====
 	bool bDidStartAudio = false;
 	bool bAllowServerAudio = false;
 
+	// response.created ~ response.done  (    )
+	bool bResponseActive = false;
+
 	// session.update Ÿ̹ ȭ: session.created Ŀ update
 	bool bSessionCreated = false;
 	bool bPendingInitialSessionUpdate = false;
 
+	// ===== Input audio =====
+	// append ̺Ʈ UTF-8   ( )
+	FRealtimeAppendEncoder AppendEncoder;
+
+	// ̹ Ͽ  ǿ   Է  (̾ Ʈ, commit ).
+	//     ǰ Բ Ƿ  ǿ к  ٽ append
+	TArray<uint8> TurnSentAudio;
+	bool bTurnAudioOverflow = false;
+	bool bTurnCommitDeferred = false;
+	FRealtimeAppendEncoder ReplayEncoder;
+
+	void ReplayTurnAudio();
+
+	//   ڵ (Connect  û, session.updated Ȯ)
+	ERealtimeAudioCodec ActiveInputCodec = ERealtimeAudioCodec::Pcm16;
+	ERealtimeAudioCodec ActiveOutputCodec = ERealtimeAudioCodec::Pcm16;
+	FVoiceCodecEncoder InputCodecEncoder;
+	TArray<uint8> EncodedInputScratch;
+
+	void InitInputCodec(ERealtimeAudioCodec Codec);
+	void ApplyNegotiatedCodecs(const TSharedPtr<FJsonObject>& Root);
+
+	// ===== Incoming events =====
+	//  ޽ з/ ڵ Ŀ,  ̺Ʈ Tick ó
+	TUniquePtr<FRealtimeEventDecoder> EventDecoder;
+	FRealtimePcmStreamPtr OutputAudioStream;
+
+	void StartEventDecoder();
+	void StopEventDecoder();
+	void SyncAudioGate();
+
+	// ===== Reply cache =====
+	// ̹    ؽƮ (output_audio_transcript.done). ĳ Ű
+	FString ReplyTranscript;
+
+	FString BuildReplyCacheProfile() const;
+	void SyncReplyCacheProfile();
+	void HandleResponseDone(FRealtimeControlEvent& Event);
+
 	// ===== Utils =====
 	FString BuildWebSocketUrl() const;
 	FString ResolveKeyPath(const FString& InPath) const;
@@ -192,14 +311,17 @@ private:
 	FString LoadApiKeyMaybe(FString& OutResolvedPath, FString& OutError) const;
 
 	// ===== WS handlers =====
-	void HandleWsConnected();
-	void HandleWsConnectionError(const FString& Error);
-	void HandleWsClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
-	void HandleWsMessage(const FString& Message);
+	void HandleWsConnected(bool bReconnect);
+	void HandleWsLost(const FString& Reason, bool bWillRetry);
+	void HandleWsRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+	void HandleControlEvent(FRealtimeControlEvent& Event);
 
 	// ===== Protocol helpers =====
-	void SendJsonEvent(const TSharedPtr<FJsonObject>& Obj, const TCHAR* DebugTag);
+	// bDeferIfOffline: ª  ȿ  ״ٰ  ƿ  (ȭ /commit/ û)
+	void SendJsonEvent(const TSharedPtr<FJsonObject>& Obj, const TCHAR* DebugTag, bool bDeferIfOffline = false);
+	void FlushPendingAppend();
 	void SendSessionUpdate(const TCHAR* ReasonTag);
+	void SendInstructionsUpdate(const TCHAR* ReasonTag);
 
 	void HandleServerEvent(const TSharedPtr<FJsonObject>& Root);
 
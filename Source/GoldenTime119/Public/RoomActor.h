@@ -129,6 +129,10 @@ public:
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Room|State")
     ERoomState State = ERoomState::Idle;
 
+    // ȯ ϰ ּ Risk  ( ).   Fire 켱
+    UFUNCTION(BlueprintCallable, Category = "Room|State") void SetForcedRisk(bool bInForced);
+    UFUNCTION(BlueprintCallable, Category = "Room|State") bool IsRiskForced() const { return bForcedRisk; }
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Room|Threshold") float RiskHeatThreshold = 30.f;
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Room|Threshold") float MinOxygenToSustain = 0.15f;
 
@@ -274,6 +278,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Room|Backdraft") bool CanArmBackdraft() const;
     UFUNCTION(BlueprintCallable, Category = "Room|Backdraft") bool IsBackdraftArmed() const { return bBackdraftArmed; }
 
+    //   巡Ʈ  (ȯⱸ   ). OnBackdraft   ˷ֹǷ ̰ɷ 
+    UFUNCTION(BlueprintCallable, Category = "Room|Backdraft") int32 GetBackdraftCount() const { return BackdraftCount; }
+
     UFUNCTION(BlueprintCallable, Category = "Room|Backdraft") void NotifyDoorSealed(bool bSealed);
 
     UFUNCTION(BlueprintCallable, Category = "Room|Backdraft")
@@ -317,6 +324,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Room|Event") FRoomFireEvent OnFireExtinguished;
     UPROPERTY(BlueprintAssignable, Category = "Room|Event") FRoomFireEvent OnFireSpawned;
 
+    // Smoke/Oxygen/Heat/State   ٲ  (Tick , ڰ   ). ̼ ǥ  C++ 
+    DECLARE_MULTICAST_DELEGATE_OneParam(FRoomEnvChanged, ARoomActor*);
+    FRoomEnvChanged OnEnvChanged;
+
 public:
     void RegisterCombustible(UCombustibleComponent* Comb);
     void UnregisterCombustible(UCombustibleComponent* Comb);
@@ -355,6 +366,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Room|Door")
     void UnregisterDoor(ADoorActor* Door);
 
+    const TArray<TWeakObjectPtr<ADoorActor>>& GetDoors() const { return Doors; }
+
+    // RoomBounds  (α  ,    ݺ ȣ)
+    UFUNCTION(BlueprintPure, Category = "Room|Volume")
+    bool ContainsPoint(const FVector& WorldPos) const;
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaSeconds) override;
@@ -387,6 +404,10 @@ private:
 
     // Backdraft internal
     float LastBackdraftTime = -1000.f;
+    int32 BackdraftCount = 0;
+
+    // SetForcedRisk
+    bool bForcedRisk = false;
 
     // Backdraft Ready internal
     UPROPERTY(VisibleAnywhere, Category = "Room|Backdraft")
@@ -404,6 +425,17 @@ private:
 
     void RelaxEnv(float DeltaSeconds);
 
+    //  ˸  EnvNotify* ̻  OnEnvChanged
+    void NotifyEnvIfChanged();
+
+    static constexpr float EnvNotifyStep01 = 0.01f;    // Smoke / Oxygen
+    static constexpr float EnvNotifyHeatStep = 0.5f;
+
+    float NotifiedSmoke = -1.f;
+    float NotifiedOxygen = -1.f;
+    float NotifiedHeat = -1000.f;
+    ERoomState NotifiedState = ERoomState::Idle;
+
     static bool IsInsideRoomBox(const UBoxComponent* Box, const FVector& WorldPos);
     void UpdateRoomGeometryFromBounds();
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "GameFramework/Actor.h"
 #include "Sound/SoundBase.h"     // USoundBase  ʿ
 #include "StageTypes.h"          // FStageObjective
 
@@ -39,11 +40,11 @@ enum class EStageActionType : uint8
     None,
     SetObjective,
     PlayRadio,
-    SpawnHostage,
+    SpawnHostage,          // Value=Count, HostageClass ʿ
     IgniteRoomRandomFires, // Value=Count
     IgniteRoomAllFires,
     SetRoomRisk,           // Value=0/1
-    SetRoomBackdraftReady, //  /(߰ API ʿ)
+    SetRoomBackdraftReady, //  /(߰ API ʿ,  ε    )
 };
 
 USTRUCT(BlueprintType)
@@ -58,6 +59,9 @@ struct FStageAction
     // / 
     UPROPERTY(EditAnywhere, BlueprintReadOnly) FStageObjective Objective;
     UPROPERTY(EditAnywhere, BlueprintReadOnly) TObjectPtr<USoundBase> RadioSound = nullptr;
+
+    // SpawnHostage: TargetTag  ȿ  ("NPC" ±׸ ٿ GameManager   )
+    UPROPERTY(EditAnywhere, BlueprintReadOnly) TSubclassOf<AActor> HostageClass;
 };
 
 USTRUCT(BlueprintType)
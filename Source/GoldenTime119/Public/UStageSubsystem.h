@@ -12,10 +12,62 @@
 class ARoomActor;
 class UVitalComponent;
 class AFireActor;
+class AGameManager;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectiveChanged, const FStageObjective&, NewObjective);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStageFinished, bool, bSuccess, float, FinalScore);
 
+//  ٽ 򰡵Ǿ ϴ Է ȣ
+namespace EStageSignal
+{
+    enum Type : uint8
+    {
+        None      = 0,
+        Fire      = 1 << 0,
+        Backdraft = 1 << 1,
+        Vitals    = 1 << 2,
+        Time      = 1 << 3,
+    };
+}
+
+// StartStage      . ±״ Rooms ε ؼ
+struct FStageCompiledCondition
+{
+    EStageCondType Type = EStageCondType::None;
+    int32 Room = INDEX_NONE;
+    float Value = 0.f;
+    uint8 Signals = EStageSignal::None;
+};
+
+struct FStageCompiledAction
+{
+    EStageActionType Type = EStageActionType::None;
+    int32 Room = INDEX_NONE;
+    float Value = 0.f;
+
+    //  FStageAction (Objective/RadioSound/HostageClass)
+    int32 Source = INDEX_NONE;
+};
+
+struct FStageCompiledStep
+{
+    int32 FirstAction = 0;
+    int32 NumActions = 0;
+    FStageCompiledCondition Complete;
+};
+
+struct FStageCompiledGraph
+{
+    TArray<FStageCompiledStep> Steps;
+    TArray<FStageCompiledAction> Actions;
+    TArray<TWeakObjectPtr<ARoomActor>> Rooms;
+
+    //    ȣ  ϴ (Rooms  ε)
+    TArray<uint8> RoomSignals;
+
+    void Reset() { Steps.Reset(); Actions.Reset(); Rooms.Reset(); RoomSignals.Reset(); }
+};
+
 UCLASS()
 class GOLDENTIME119_API UStageSubsystem : public UGameInstanceSubsystem
 {
@@ -25,6 +77,7 @@ public:
     UPROPERTY(BlueprintAssignable) FOnObjectiveChanged OnObjectiveChanged;
     UPROPERTY(BlueprintAssignable) FOnStageFinished OnStageFinished;
 
+    //   忡  /  .  ±װ      αϰ  
     UFUNCTION(BlueprintCallable) void StartStage(UStageDataAsset* InStage);
     UFUNCTION(BlueprintCallable) void AbortStage(bool bFail);
 
@@ -38,24 +91,35 @@ private:
     FStageObjective CurrentObjective;
 
     TWeakObjectPtr<UVitalComponent> Vital;
-    TMap<FName, TWeakObjectPtr<ARoomActor>> RoomsByTag;
+    TWeakObjectPtr<AGameManager> GameManager;
+
+    FStageCompiledGraph Graph;
 
-    float StepTimeAcc = 0.f;
-    FTimerHandle TickHandle;
+    //   Ÿ
+    bool bStepTimeReached = false;
+    int32 StepBackdraftBase = 0;
+    FTimerHandle StepTimerHandle;
+    FTimerHandle EntryEvalHandle;
 
-    UFUNCTION()
-    void TickStage();
 private:
-    void BuildAutoBindings(UWorld* World);
-    void BindRoomSignals(ARoomActor* Room);
-    void BindVitalSignals(UVitalComponent* InVital);
+    bool CompileStage(UWorld* World, const UStageDataAsset& InStage, TArray<FString>& OutErrors);
+    void BindSignals();
+    void UnbindSignals();
 
     void EnterStep(int32 NewIndex);
-    void ExecuteAction(const FStageAction& A);
+    void ExecuteAction(const FStageCompiledAction& A);
+    void SpawnHostages(ARoomActor* Room, const FStageAction& Src, int32 Count);
 
-    bool IsStepComplete(float DeltaSeconds);
+    ARoomActor* GetRoom(int32 Index) const;
+    bool IsConditionMet(const FStageCompiledCondition& C) const;
+
+    //    Signal        
+    void OnSignal(uint8 Signal);
     void AdvanceStep();
 
+    UFUNCTION() void HandleEntryEval();
+    UFUNCTION() void HandleStepTimer();
+
     UFUNCTION() void HandleVitalsChanged(float Hp01, float Temp01, float O201);
     UFUNCTION() void HandleBackdraftTriggered();
     UFUNCTION() void HandleFireExtinguished(AFireActor* Fire);
@@ -0,0 +1,125 @@
+// VRHapticsSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "Tickable.h"
+#include "InputCoreTypes.h"
+#include "VRHapticsSubsystem.generated.h"
+
+class UHapticFeedbackEffect_Base;
+class APlayerController;
+
+// Larger value wins. Lower layers are ducked while a higher one is active.
+UENUM(BlueprintType)
+enum class EVRHapticPriority : uint8
+{
+    Ambient  UMETA(DisplayName = "Ambient"),   // continuous tool feel (hose spray)
+    Feedback UMETA(DisplayName = "Feedback"),  // small pulses (nozzle detent)
+    Impact   UMETA(DisplayName = "Impact"),    // hits (axe)
+    Warning  UMETA(DisplayName = "Warning"),   // danger cues (backdraft door)
+};
+
+// One time-bounded request on one hand.
+// Same Source + Hand replaces the previous request, so continuous sources can refresh every frame
+// without piling up entries.
+USTRUCT(BlueprintType)
+struct FVRHapticRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics")
+    FName Source = NAME_None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics")
+    EVRHapticPriority Priority = EVRHapticPriority::Feedback;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float Frequency01 = 1.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float Amplitude01 = 0.5f;
+
+    // Seconds. Every request expires; continuous sources re-submit before it runs out.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics", meta = (ClampMin = "0.0"))
+    float Duration = 0.1f;
+
+    // Optional curve asset. When set, Frequency/Amplitude are sampled from it and scaled by Amplitude01.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics")
+    TObjectPtr<UHapticFeedbackEffect_Base> Effect = nullptr;
+};
+
+/**
+ * Per local player haptics mixer.
+ * Tools submit requests instead of calling APlayerController haptics directly.
+ * Once per frame the active requests are mixed per hand and the device is only touched
+ * when the mixed amplitude/frequency actually changes.
+ */
+UCLASS()
+class GOLDENTIME119_API UVRHapticsSubsystem : public ULocalPlayerSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    // First local player's mixer (single-player VR)
+    static UVRHapticsSubsystem* Get(const UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "VR|Haptics")
+    void SubmitRequest(EControllerHand Hand, const FVRHapticRequest& Request);
+
+    // Convenience for one-off pulses
+    UFUNCTION(BlueprintCallable, Category = "VR|Haptics")
+    void PlayPulse(FName Source, EControllerHand Hand, EVRHapticPriority Priority, float Frequency01, float Amplitude01, float Duration);
+
+    UFUNCTION(BlueprintCallable, Category = "VR|Haptics")
+    void PlayEffect(FName Source, EControllerHand Hand, EVRHapticPriority Priority, UHapticFeedbackEffect_Base* Effect, float Scale = 1.f);
+
+    UFUNCTION(BlueprintCallable, Category = "VR|Haptics")
+    void ClearRequest(FName Source, EControllerHand Hand);
+
+    UFUNCTION(BlueprintCallable, Category = "VR|Haptics")
+    void ClearSource(FName Source);
+
+    // Gain applied to layers below the currently highest active priority
+    UPROPERTY(BlueprintReadWrite, Category = "VR|Haptics")
+    float LowerPriorityDuck = 0.35f;
+
+    // Mixed values closer than this to the last sent value are not re-sent
+    UPROPERTY(BlueprintReadWrite, Category = "VR|Haptics")
+    float ChangeEpsilon = 0.02f;
+
+    // ULocalPlayerSubsystem
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual ETickableTickType GetTickableTickType() const override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+private:
+    struct FActiveRequest
+    {
+        FVRHapticRequest Request;   // Effect is kept weak below, not in here
+        TWeakObjectPtr<UHapticFeedbackEffect_Base> Effect;
+        float Elapsed = 0.f;
+    };
+
+    struct FHandChannel
+    {
+        TArray<FActiveRequest, TInlineAllocator<4>> Requests;
+        float SentFrequency = 0.f;
+        float SentAmplitude = 0.f;
+    };
+
+    static int32 HandIndex(EControllerHand Hand) { return Hand == EControllerHand::Left ? 0 : 1; }
+
+    void MixHand(FHandChannel& Channel, float& OutFrequency, float& OutAmplitude) const;
+    void SendToDevice(EControllerHand Hand, FHandChannel& Channel, float Frequency, float Amplitude);
+    APlayerController* GetPlayerController() const;
+
+    FHandChannel Hands[2];
+    bool bHasActiveWork = false;
+};
@@ -0,0 +1,114 @@
+// ============================ VoiceAudioCodec.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoiceAudioDSP.h"
+#include "VoiceAudioCodec.generated.h"
+
+// Realtime 세션 오디오 전송 포맷 (session.audio.input/output.format.type)
+UENUM(BlueprintType)
+enum class ERealtimeAudioCodec : uint8
+{
+	Pcm16       UMETA(DisplayName = "PCM16 (audio/pcm)"),
+	G711Ulaw    UMETA(DisplayName = "G.711 mu-law (audio/pcmu, 8 kHz)"),
+	G711Alaw    UMETA(DisplayName = "G.711 A-law (audio/pcma, 8 kHz)"),
+};
+
+/**
+ * Wire codec for the Realtime voice link. Stateless and thread-safe: encode runs on the capture path,
+ * decode on the network decode worker. A new transport (e.g. Opus) is a new enum value plus an
+ * implementation returned by VoiceAudioCodecs::Get.
+ */
+class GOLDENTIME119_API IVoiceAudioCodec
+{
+public:
+	virtual ~IVoiceAudioCodec() = default;
+
+	virtual ERealtimeAudioCodec GetId() const = 0;
+
+	// session.update에 쓰는 format.type
+	virtual const TCHAR* GetWireFormat() const = 0;
+
+	// 코덱이 고정하는 레이트 (0 = 세션에서 지정, PCM)
+	virtual int32 GetWireSampleRate() const = 0;
+
+	// mono PCM16 NumSamples -> 최대 인코딩 바이트
+	virtual int32 GetMaxEncodedBytes(int32 NumSamples) const = 0;
+
+	// 인코딩 바이트 NumBytes -> 최대 샘플 수
+	virtual int32 GetMaxDecodedSamples(int32 NumBytes) const = 0;
+
+	// 반환: 쓴 바이트 / 샘플 수
+	virtual int32 Encode(const int16* In, int32 NumSamples, uint8* Out) const = 0;
+	virtual int32 Decode(const uint8* In, int32 NumBytes, int16* Out) const = 0;
+};
+
+namespace VoiceAudioCodecs
+{
+	GOLDENTIME119_API const IVoiceAudioCodec& Get(ERealtimeAudioCodec Id);
+
+	// 서버가 알려준 format.type -> 코덱 (모르는 포맷이면 nullptr)
+	GOLDENTIME119_API const IVoiceAudioCodec* FindByWireFormat(const FString& WireFormat);
+
+	GOLDENTIME119_API const TCHAR* GetWireFormat(ERealtimeAudioCodec Id);
+}
+
+/**
+ * Mono PCM16 at the caller's rate -> codec bytes on the wire. Codecs with a fixed rate (G.711 = 8 kHz)
+ * are fed through FVoicePolyphaseResampler first, so the capture side keeps one format.
+ * Init allocates; Encode only grows the scratch buffers up to the largest chunk seen.
+ */
+class GOLDENTIME119_API FVoiceCodecEncoder
+{
+public:
+	void Init(ERealtimeAudioCodec InCodec, int32 InSampleRate);
+	void Reset();
+
+	const IVoiceAudioCodec& GetCodec() const { return *Codec; }
+	int32 GetWireSampleRate() const { return WireRate; }
+
+	// 변환 없이 그대로 나가는 경우 (PCM, 레이트 동일)
+	bool IsPassthrough() const { return bPassthrough; }
+
+	// Out 뒤에 이어 붙임. 반환: 붙인 바이트 수
+	int32 Encode(const int16* In, int32 NumSamples, TArray<uint8>& Out);
+
+private:
+	const IVoiceAudioCodec* Codec = &VoiceAudioCodecs::Get(ERealtimeAudioCodec::Pcm16);
+	int32 InRate = 0;
+	int32 WireRate = 0;
+	bool bPassthrough = true;
+
+	FVoicePolyphaseResampler Resampler;
+	TArray<float> FloatIn;
+	TArray<float> FloatOut;
+	TArray<int16> WirePcm;
+};
+
+/**
+ * Codec bytes from the wire -> mono PCM16 at the consumer's rate (the mirror of FVoiceCodecEncoder).
+ * Reset() between responses so the resampler history of the previous reply does not bleed in.
+ */
+class GOLDENTIME119_API FVoiceCodecDecoder
+{
+public:
+	void Init(ERealtimeAudioCodec InCodec, int32 InOutSampleRate);
+	void Reset();
+
+	const IVoiceAudioCodec& GetCodec() const { return *Codec; }
+	bool IsPassthrough() const { return bPassthrough; }
+
+	// Out을 PCM16 LE로 덮어씀. 반환: 바이트 수
+	int32 Decode(const uint8* In, int32 NumBytes, TArray<uint8>& Out);
+
+private:
+	const IVoiceAudioCodec* Codec = &VoiceAudioCodecs::Get(ERealtimeAudioCodec::Pcm16);
+	int32 WireRate = 0;
+	int32 OutRate = 0;
+	bool bPassthrough = true;
+
+	FVoicePolyphaseResampler Resampler;
+	TArray<int16> WirePcm;
+	TArray<float> FloatIn;
+	TArray<float> FloatOut;
+};
@@ -0,0 +1,125 @@
+// ============================ VoiceCaptureSource.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AudioCaptureCore.h"
+#include "HAL/Runnable.h"
+#include "VoiceUtterance.h"
+#include <atomic>
+
+class FRunnableThread;
+
+// float interleaved 입력 (캡처 스레드 또는 피더 스레드). 할당/락 없이 처리할 것
+typedef TFunction<void(const float* Interleaved, int32 NumFrames, int32 NumChannels, int32 SampleRate)> FVoiceCaptureCallback;
+
+/**
+ * Where UPTTAudioRecorderComponent gets its microphone samples.
+ *
+ * The recorder only sees interleaved float blocks on a non-game thread, so the same capture, resample,
+ * VAD, framing and upload path runs whether the blocks come from the default input device or from a
+ * recorded WAV fed by a thread at real or accelerated speed (headless automation, machines without a mic).
+ * Open/Start/Stop are called on the game thread; after Stop returns no more callbacks arrive.
+ */
+class GOLDENTIME119_API IVoiceCaptureSource
+{
+public:
+	virtual ~IVoiceCaptureSource() {}
+
+	virtual const TCHAR* GetName() const = 0;
+
+	// 리샘플러를 미리 만들 입력 SR (모르면 0). 콜백의 SampleRate가 진짜 값
+	virtual int32 GetExpectedSampleRate() const = 0;
+
+	virtual bool Open(FVoiceCaptureCallback&& OnAudio, int32 NumFramesDesired, FString& OutError) = 0;
+	virtual bool Start() = 0;
+
+	// 정지 + 닫기
+	virtual void Stop() = 0;
+
+	// 더 보낼 입력이 없음 (녹음 재생이 끝남). 장치는 항상 false
+	virtual bool IsFinished() const { return false; }
+};
+
+typedef TSharedPtr<IVoiceCaptureSource, ESPMode::ThreadSafe> FVoiceCaptureSourcePtr;
+
+// 기본 입력 장치 (Audio::FAudioCapture)
+class GOLDENTIME119_API FVoiceDeviceCaptureSource : public IVoiceCaptureSource
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("device"); }
+	virtual int32 GetExpectedSampleRate() const override;
+	virtual bool Open(FVoiceCaptureCallback&& OnAudio, int32 NumFramesDesired, FString& OutError) override;
+	virtual bool Start() override;
+	virtual void Stop() override;
+
+private:
+	mutable Audio::FAudioCapture AudioCapture;
+	bool bOpen = false;
+};
+
+struct FVoiceBufferSourceSettings
+{
+	// 재생 속도 (1 = 실시간, 4 = 4배속). 빠를수록 게임 스레드가 자주 비워줘야 함 (CaptureRingSeconds)
+	float Speed = 1.f;
+
+	// 끝나면 처음부터 다시 (IsFinished가 오지 않음)
+	bool bLoop = false;
+
+	// 녹음 끝에 붙이는 무음 (VAD 행오버가 닫히게)
+	float TailSilenceSec = 0.5f;
+};
+
+/**
+ * Feeds a recorded buffer to the recorder from its own thread in NumFramesDesired blocks, paced to
+ * Speed x real time, the way a device would deliver them. Construct from an utterance (PCM16, any rate
+ * and channel count) or load a PCM16 WAV with FromWavFile.
+ */
+class GOLDENTIME119_API FVoiceBufferCaptureSource : public IVoiceCaptureSource
+{
+public:
+	FVoiceBufferCaptureSource(const FVoiceUtterancePtr& InClip, const FVoiceBufferSourceSettings& InSettings);
+	virtual ~FVoiceBufferCaptureSource() override;
+
+	FVoiceBufferCaptureSource(const FVoiceBufferCaptureSource&) = delete;
+	FVoiceBufferCaptureSource& operator=(const FVoiceBufferCaptureSource&) = delete;
+
+	// 상대경로면 ProjectDir 기준. 실패하면 null + OutError
+	static TSharedPtr<FVoiceBufferCaptureSource, ESPMode::ThreadSafe> FromWavFile(const FString& Path, const FVoiceBufferSourceSettings& InSettings, FString& OutError);
+
+	// PCM16 WAV를 클립으로만 디코딩 (여러 소스가 같은 클립을 공유해 재생할 때)
+	static FVoiceUtterancePtr LoadWavClip(const FString& Path, FString& OutError);
+
+	// ===== IVoiceCaptureSource =====
+	virtual const TCHAR* GetName() const override { return TEXT("buffer"); }
+	virtual int32 GetExpectedSampleRate() const override { return Clip.IsValid() ? Clip->SampleRate : 0; }
+	virtual bool Open(FVoiceCaptureCallback&& OnAudio, int32 NumFramesDesired, FString& OutError) override;
+	virtual bool Start() override;
+	virtual void Stop() override;
+	virtual bool IsFinished() const override { return bFinished.load(std::memory_order_acquire); }
+
+private:
+	// 피더 스레드 (IVoiceCaptureSource::Stop과 FRunnable::Stop이 겹치지 않게 따로 둠)
+	class FFeeder : public FRunnable
+	{
+	public:
+		explicit FFeeder(FVoiceBufferCaptureSource& InOwner) : Owner(InOwner) {}
+		virtual uint32 Run() override { Owner.FeedLoop(); return 0; }
+		virtual void Stop() override { Owner.bStopRequested.store(true, std::memory_order_release); }
+
+	private:
+		FVoiceBufferCaptureSource& Owner;
+	};
+
+	void FeedLoop();
+
+	FVoiceUtterancePtr Clip;
+	FVoiceBufferSourceSettings Settings;
+
+	FVoiceCaptureCallback Callback;
+	int32 BlockFrames = 1024;
+
+	FFeeder Feeder{ *this };
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopRequested{ false };
+	std::atomic<bool> bFinished{ false };
+};
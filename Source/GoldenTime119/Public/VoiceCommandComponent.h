@@ -0,0 +1,85 @@
+// ============================ VoiceCommandComponent.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "VoiceCommandGrammar.h"
+#include "VoiceCommandComponent.generated.h"
+
+class ARadioManager;
+class URadioLineData;
+
+// bFromPartial: PTT를 누르고 있는 동안 부분 인식으로 실행됨
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnVoiceCommand, FName, CommandId, const FString&, Transcript, bool, bFromPartial);
+
+/**
+ * Local recognizer for fixed radio commands. Transcripts from the on-device STT (partial while PTT is held,
+ * then final) are matched against a UVoiceCommandGrammar; a hit fires OnVoiceCommand right away and queues
+ * the command's canned radio response once the key is released (the channel is half-duplex), with no round
+ * trip to the cloud. Anything that does not match is left to the caller to forward to the remote agent
+ * (HandleFinalTranscript returns false).
+ * One command per utterance: a command fired from a partial is not fired again by the final transcript.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class GOLDENTIME119_API UVoiceCommandComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVoiceCommandComponent();
+
+	virtual void BeginPlay() override;
+
+	UPROPERTY(BlueprintAssignable, Category = "Voice|Command")
+	FOnVoiceCommand OnVoiceCommand;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	TObjectPtr<UVoiceCommandGrammar> Grammar = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Command")
+	bool bEnabled = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Command|Debug")
+	bool bLogMatches = true;
+
+	// 런타임에 문법 교체 (스테이지별 명령 세트 등)
+	UFUNCTION(BlueprintCallable, Category = "Voice|Command")
+	void SetGrammar(UVoiceCommandGrammar* InGrammar);
+
+	// PTT 캡처 시작마다 (발화당 명령 하나)
+	UFUNCTION(BlueprintCallable, Category = "Voice|Command")
+	void BeginUtterance();
+
+	// UWhisperSTTComponent::OnPartialTranscript 시그니처와 같음
+	UFUNCTION(BlueprintCallable, Category = "Voice|Command")
+	bool HandlePartialTranscript(const FString& StableText, const FString& UnstableText);
+
+	// true: 로컬에서 처리됨 (원격 에이전트에 응답 요청하지 말 것)
+	UFUNCTION(BlueprintCallable, Category = "Voice|Command")
+	bool HandleFinalTranscript(const FString& Text);
+
+	// 이번 발화에서 이미 명령을 실행했는지 (부분 인식 포함)
+	UFUNCTION(BlueprintPure, Category = "Voice|Command")
+	bool HasHandledUtterance() const { return HandledCommand != INDEX_NONE; }
+
+	UFUNCTION(BlueprintPure, Category = "Voice|Command")
+	FName GetHandledCommandId() const;
+
+private:
+	FVoiceCommandMatcher Matcher;
+
+	// 명령별 마지막 실행 시각 (쿨다운)
+	TArray<double> LastFireTimeSec;
+
+	int32 HandledCommand = INDEX_NONE;
+
+	TWeakObjectPtr<ARadioManager> RadioManager;
+
+	// 부분 인식으로 실행한 명령의 응답 (최종 인식 = 키를 뗀 뒤 송출)
+	TWeakObjectPtr<URadioLineData> PendingResponse;
+
+	FString PartialScratch;
+
+	bool Dispatch(const FVoiceCommandMatch& Match, const FString& Transcript, bool bFromPartial);
+	void EnqueueResponse(URadioLineData* Response);
+};
@@ -0,0 +1,129 @@
+// ============================ VoiceCommandGrammar.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "VoiceCommandGrammar.generated.h"
+
+class URadioLineData;
+
+// 고정 무전 명령 하나 ("방수 시작", "문 개방", "요구조자 발견" ...)
+USTRUCT(BlueprintType)
+struct GOLDENTIME119_API FVoiceCommandDef
+{
+	GENERATED_BODY()
+
+	// 게임플레이 쪽에서 받는 이름 (OnVoiceCommand)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	FName CommandId;
+
+	// 같은 뜻의 표현들. 띄어쓰기/문장부호/대소문자는 무시하고 비교
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	TArray<FString> Phrases;
+
+	// 즉시 재생할 무전 응답 (없으면 이벤트만)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	TObjectPtr<URadioLineData> Response = nullptr;
+
+	// PTT를 누르고 있는 동안 부분 인식만으로도 실행
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	bool bAllowOnPartial = true;
+
+	// 같은 명령 재실행 최소 간격
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "0.0"))
+	float CooldownSec = 2.f;
+};
+
+// 로컬 명령 문법. 여기 없는 말(자유 발화)은 원격 에이전트로 넘어감
+UCLASS(BlueprintType)
+class GOLDENTIME119_API UVoiceCommandGrammar : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	TArray<FVoiceCommandDef> Commands;
+
+	// 비교 전에 지우는 말 (호출부호, "오버", "어", "음" ...)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command")
+	TArray<FString> FillerWords;
+
+	// 1 - 편집거리/표현 길이. 최종 인식 기준
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "0.5", ClampMax = "1.0"))
+	float MinScore = 0.8f;
+
+	// 짧은 표현(3~4음절)은 MinScore로는 한 글자 오인식도 못 넘음 (3음절 1글자 = 0.67).
+	// 최종 인식에서 이 길이 이하 표현은 이만큼의 편집을 허용. 2음절 이하는 항상 정확히 일치해야 함
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "0", ClampMax = "2"))
+	int32 ShortPhraseAllowedEdits = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "3"))
+	int32 ShortPhraseMaxLen = 4;
+
+	// 부분 인식은 뒤가 바뀔 수 있어서 더 엄격하게
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "0.5", ClampMax = "1.0"))
+	float MinPartialScore = 0.9f;
+
+	// 발화 중 명령 표현이 차지하는 비율. 이보다 작으면 명령이 섞인 자유 발화로 보고 원격으로
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Command", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinCoverage = 0.6f;
+};
+
+struct FVoiceCommandMatch
+{
+	int32 CommandIndex = INDEX_NONE;
+	int32 PhraseIndex = INDEX_NONE;
+	float Score = 0.f;          // 1 = 정확히 포함
+	float Coverage = 0.f;       // 표현 길이 / 발화 길이 (필러 제외)
+
+	bool IsValid() const { return CommandIndex != INDEX_NONE; }
+};
+
+/**
+ * Compiled form of a UVoiceCommandGrammar. Phrases are normalized once (lower case, no spaces or
+ * punctuation, so "물 뿌려" == "물뿌려." and Whisper's spacing does not matter); a transcript is normalized
+ * the same way with filler words removed and each phrase is located in it by approximate substring
+ * matching (edit distance against the best-matching span). A phrase matches when the distance is within
+ * (1 - MinScore) x its length, or within the caller's short-phrase allowance for 3-4 syllable phrases,
+ * whose single-syllable STT errors the ratio alone would reject.
+ * Cost is O(phrase chars x transcript chars) per phrase with reused buffers: microseconds for a radio
+ * grammar, cheap enough to run on every partial transcript.
+ */
+class GOLDENTIME119_API FVoiceCommandMatcher
+{
+public:
+	void Compile(const UVoiceCommandGrammar* Grammar);
+	void Reset();
+
+	bool IsEmpty() const { return Phrases.Num() == 0; }
+	int32 GetNumCommands() const { return NumCommands; }
+
+	// 점수/커버리지 기준을 넘는 가장 좋은 명령 (없으면 IsValid() == false)
+	// ShortPhraseEdits: 3음절 이상 ShortPhraseMaxLen 이하 표현에 MinScore와 별개로 허용하는 편집 수
+	FVoiceCommandMatch Match(const FString& Transcript, float MinScore, float MinCoverage,
+		int32 ShortPhraseEdits = 0, int32 ShortPhraseMaxLen = 4) const;
+
+	// 소문자, 공백/문장부호 제거. 필러 제거 전 토큰 단위로 쓰려고 공개
+	static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+
+private:
+	struct FPhrase
+	{
+		int32 CommandIndex = INDEX_NONE;
+		int32 PhraseIndex = INDEX_NONE;
+		FString Compact;
+	};
+
+	TArray<FPhrase> Phrases;
+	TSet<FString> Fillers;
+	int32 NumCommands = 0;
+
+	// Match 안에서 재사용 (게임 스레드 전용)
+	mutable TArray<FString> TokenScratch;
+	mutable FString TranscriptScratch;
+	mutable TArray<int32> RowPrev;
+	mutable TArray<int32> RowCur;
+
+	// Pattern이 Text의 어떤 구간과 가장 가까운지: 최소 편집거리
+	int32 BestSubstringDistance(const FString& Pattern, const FString& Text) const;
+};
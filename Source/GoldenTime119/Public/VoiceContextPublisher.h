@@ -0,0 +1,132 @@
+// ============================ VoiceContextPublisher.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
+#include "VoiceContextPublisher.generated.h"
+
+class ARoomActor;
+class AGameManager;
+class UVitalComponent;
+class URealtimeVoiceComponent;
+
+/**
+ * Builds the [GAME_STATE] block for the Realtime voice agent straight from the world (player vitals, room
+ * snapshots, mission objectives) and hands it to URealtimeVoiceComponent::UpdateDynamicContext.
+ *  - Values are quantized into coarse buckets with hysteresis, so drifting sensors do not change the text.
+ *  - Nothing is sent unless the text changed. Discrete changes (room state, backdraft ready, critical vitals,
+ *    objective status, player room) go out after UrgentPublishIntervalSec, numeric ones after MinPublishIntervalSec.
+ *    Changes inside the window coalesce: each sample rebuilds, so only the latest state is sent when it opens.
+ *  - Lines are emitted in priority order and cut at MaxContextChars, so a large level cannot inflate every turn.
+ * Sampling is a component tick every SampleIntervalSec (no per-frame work).
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class GOLDENTIME119_API UVoiceContextPublisherComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVoiceContextPublisherComponent();
+
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// 외부에서 주는 자유 텍스트 (UpdateGameStateForAI 등). 같은 diff/스로틀을 거쳐 맨 끝 줄로 붙음
+	UFUNCTION(BlueprintCallable, Category = "Voice|Context")
+	void SetExtraContext(const FString& Text);
+
+	// PTT 누를 때: 미뤄진 변경이 있으면 창을 무시하고 바로 보냄 (바뀐 게 없으면 아무것도 안 보냄)
+	UFUNCTION(BlueprintCallable, Category = "Voice|Context")
+	void FlushPending();
+
+	// 디버그: 지금 상태로 만든 텍스트 (보내지 않음)
+	UFUNCTION(BlueprintCallable, Category = "Voice|Context")
+	FString BuildContextNow();
+
+	// 기본은 같은 액터의 URealtimeVoiceComponent
+	void SetTarget(URealtimeVoiceComponent* InRealtime) { Realtime = InRealtime; }
+
+	const FString& GetPublishedContext() const { return PublishedText; }
+	int32 GetPublishCount() const { return PublishCount; }
+
+	// ===== Config =====
+	// false면 월드를 읽지 않고 SetExtraContext 텍스트만 다룸
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context")
+	bool bIncludeWorldState = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Context", meta = (ClampMin = "0.1", ClampMax = "5.0"))
+	float SampleIntervalSec = 0.5f;
+
+	// 수치(버킷) 변화만 있을 때 최소 간격
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "0.0"))
+	float MinPublishIntervalSec = 5.f;
+
+	// 상태 변화(불 붙음/꺼짐, 백드래프트, 위험 바이탈, 목표 완료/실패, 방 이동)일 때 최소 간격
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "0.0"))
+	float UrgentPublishIntervalSec = 1.f;
+
+	// [GAME_STATE] 본문 최대 길이. 우선순위 낮은 줄부터 빠짐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "64"))
+	int32 MaxContextChars = 600;
+
+	// 0..1 값(바이탈, 연기, 산소, 목표 진행도) 버킷 폭
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "0.01", ClampMax = "0.5"))
+	float Step01 = 0.1f;
+
+	// 방 Heat 버킷 폭
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "1.0"))
+	float HeatStep = 25.f;
+
+	// 버킷 폭 대비 히스테리시스 (0.25 = 경계에서 1/4칸 더 넘어가야 바뀜)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float Hysteresis = 0.25f;
+
+	// HP/O2가 이 이하(Temp는 1-이 값 이상)면 critical 표시 + 상태 변화로 취급
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float CriticalVital01 = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice|Context|Debug")
+	bool bLogPublishes = true;
+
+private:
+	struct FRoomBuckets
+	{
+		int32 Heat = INDEX_NONE;
+		int32 Smoke = INDEX_NONE;
+		int32 Oxygen = INDEX_NONE;
+	};
+
+	UPROPERTY(Transient)
+	TObjectPtr<URealtimeVoiceComponent> Realtime = nullptr;
+
+	TWeakObjectPtr<AGameManager> GameManager;
+	TWeakObjectPtr<UVitalComponent> PlayerVitals;
+	TArray<TWeakObjectPtr<ARoomActor>> Rooms;
+	bool bWorldScanned = false;
+
+	// 직전 버킷 (히스테리시스 기준)
+	int32 HpBucket = INDEX_NONE;
+	int32 TempBucket = INDEX_NONE;
+	int32 O2Bucket = INDEX_NONE;
+	TMap<TObjectKey<ARoomActor>, FRoomBuckets> RoomBuckets;
+
+	FString ExtraContext;
+
+	// 마지막으로 보낸 것
+	FString PublishedText;
+	uint32 PublishedSignature = 0;
+	double LastPublishTimeSec = -1.0e9;
+	bool bPending = false;
+
+	int32 PublishCount = 0;
+	int32 CoalescedSamples = 0;     // 창 안이라 미뤄진 샘플 수 (다음 publish 로그용)
+
+	void ResolveSources();
+
+	// OutSignature: 상태(이산) 필드만의 해시. 바뀌면 Urgent 창 적용
+	void BuildContext(FString& OutText, uint32& OutSignature);
+
+	void Sample(bool bIgnoreWindow);
+	void Publish(const FString& Text, uint32 Signature, double NowSec, const TCHAR* Reason);
+};
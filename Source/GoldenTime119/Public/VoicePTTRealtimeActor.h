@@ -8,6 +8,8 @@
 
 class UPTTAudioRecorderComponent;
 class URealtimeVoiceComponent;
+class UWhisperSTTComponent;
+class UVoiceContextPublisherComponent;
 class ARadioManager;
 class USoundBase;
 class UAudioComponent;
@@ -27,7 +29,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voice")
 	void StopPTT();
 
-	// Ȳ  (ϸ ܺο )
+	// Ȳ  (ϸ ܺο ).    ڿ پ  Ʋ 
 	UFUNCTION(BlueprintCallable, Category = "Voice")
 	void UpdateGameStateForAI(const FString& NewSnapshot);
 
@@ -91,6 +93,14 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<URealtimeVoiceComponent> Realtime = nullptr;
 
+	// /ǥ/Ż -> [GAME_STATE] (ٲ , Ʋ)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UVoiceContextPublisherComponent> Context = nullptr;
+
+	// : BP UWhisperSTTComponent ̸    κ ڸ(OnPartialTranscript)
+	UPROPERTY(Transient)
+	TObjectPtr<UWhisperSTTComponent> Whisper = nullptr;
+
 	// Radio
 	UPROPERTY()
 	TWeakObjectPtr<ARadioManager> RadioManager;
@@ -102,9 +112,6 @@ private:
 	// Start delay timer
 	FTimerHandle StartCaptureTimer;
 
-	// Cached snapshot
-	FString CachedGameState;
-
 	// ===== internal =====
 	void EnsureComponentsBound();
 	ARadioManager* GetRadioManagerCached();
@@ -3,10 +3,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
+#include "VoiceUtterance.h"
 #include "VoicePTTWhisperActor.generated.h"
 
 class UPTTAudioRecorderComponent;
 class URealtimeVoiceComponent;
+class UWhisperSTTComponent;
+class UVoiceCommandComponent;
 class ARadioManager;
 class USoundBase;
 class UAudioComponent;
@@ -38,6 +41,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Radio")
 	bool bBlockPTTWhenRadioBusy = true;
 
+	// 로컬 Whisper 최종 텍스트를 Realtime에 user 메시지로 보내고 응답 요청
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Config")
+	bool bSendTranscriptToRealtime = true;
+
+	// false면 누르는 동안 디코드하지 않고, 떼었을 때 발화 전체를 한 번에 STT
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Config")
+	bool bStreamingTranscript = true;
+
+	// 발화 오디오 자체를 Realtime에 올리고 응답 요청 (켜면 텍스트는 보내지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Config")
+	bool bSendAudioToRealtime = false;
+
+	// 로컬 명령(Commands)으로 처리한 발화도 Realtime 대화 기록에 남김 (응답 요청 없이, 맥락 유지용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|Config")
+	bool bRecordLocalCommandsInRealtime = true;
+
 	// ===== SFX =====
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice|SFX")
 	TObjectPtr<USoundBase> SfxPTTStart = nullptr;
@@ -65,12 +84,28 @@ private:
 	bool bPTTActive = false;
 	bool bCaptureStarted = false;
 
+	// 부분 인식으로 명령을 이미 처리해서 발화 오디오를 올리지 않음 (최종이 자유 발화면 텍스트로 보냄)
+	bool bAudioSkippedForCommand = false;
+
+	// 발화 오디오는 올렸지만 commit/응답 요청은 최종 인식 결과를 본 뒤에 (최종에서야 명령으로 잡혀도 원격 응답이 겹치지 않게)
+	bool bAudioAwaitingTranscript = false;
+	bool bFinalTranscriptReceived = false;
+
+	void CommitHeldAudio();
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UPTTAudioRecorderComponent> PTT = nullptr;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<URealtimeVoiceComponent> Realtime = nullptr;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UWhisperSTTComponent> Whisper = nullptr;
+
+	// 고정 무전 명령은 여기서 바로 처리, 나머지만 Realtime으로
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Voice", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UVoiceCommandComponent> Commands = nullptr;
+
 	UPROPERTY()
 	TObjectPtr<ARadioManager> RadioManager = nullptr;
 
@@ -83,9 +118,18 @@ private:
 
 	void StartCaptureInternal();
 
-	// PTT Recorder callback
+	// PTT Recorder callback (메모리 발화 핸들)
+	void HandleUtteranceReady(const FVoiceUtterancePtr& Utterance);
+
+	// 누르는 동안 프레임을 Whisper 스트리밍에 넘김
 	UFUNCTION()
-	void HandleWavReady(bool bSuccess, const FString& WavPathOrError);
+	void HandlePcm16FrameReady(const TArray<uint8>& Pcm16BytesLE, int32 SampleRate, int32 NumChannels, float FrameDurationSec);
+
+	UFUNCTION()
+	void HandleTranscriptPartial(const FString& StableText, const FString& UnstableText);
+
+	UFUNCTION()
+	void HandleTranscriptFinal(bool bSuccess, const FString& TextOrError);
 
 	// Radio busy changed
 	UFUNCTION()
@@ -97,7 +141,4 @@ private:
 	void StartStaticLoop();
 	void StopStaticLoop();
 	void PlayBusyWarning();
-
-	// WAV -> PCM16 bytes (data chunk) 추출
-	static bool ExtractPcm16FromWavFile(const FString& WavPath, TArray<uint8>& OutPcm16Bytes, int32& OutSampleRate, int32& OutNumChannels, FString& OutError);
 };
@@ -0,0 +1,97 @@
+// ============================ VoiceUtterance.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+/**
+ * One captured PTT utterance as PCM16 LE in memory.
+ *
+ * Consumers (local STT, Realtime upload, diagnostics WAV) share it read-only through FVoiceUtterancePtr,
+ * so a transmission is never copied or round-tripped through disk. The byte storage is borrowed from
+ * FVoiceUtterancePool and returned there when the last handle goes away, on whatever thread that is.
+ */
+struct FVoiceUtterance
+{
+	TArray<uint8> Pcm16LE;
+	int32 SampleRate = 0;
+	int32 NumChannels = 1;
+	uint32 Serial = 0;
+
+	int64 GetNumFrames() const { return Pcm16LE.Num() / ((int32)sizeof(int16) * FMath::Max(1, NumChannels)); }
+	double GetDurationSec() const { return SampleRate > 0 ? (double)GetNumFrames() / (double)SampleRate : 0.0; }
+};
+
+typedef TSharedPtr<const FVoiceUtterance, ESPMode::ThreadSafe> FVoiceUtterancePtr;
+
+class GOLDENTIME119_API FVoiceUtterancePool
+{
+public:
+	static FVoiceUtterancePool& Get();
+
+	// 최소 MinCapacityBytes를 담을 수 있는 빈 버퍼 (풀에 있으면 재사용)
+	TArray<uint8> Acquire(int32 MinCapacityBytes);
+	void Release(TArray<uint8>&& Buffer);
+
+	// 버퍼 소유권을 넘겨 핸들 생성. 마지막 참조가 사라지면 버퍼는 풀로 돌아옴
+	FVoiceUtterancePtr Wrap(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels);
+
+	// ===== Stats (any thread) =====
+	int64 GetNumAcquired() const { return NumAcquired.load(std::memory_order_relaxed); }
+	int64 GetNumReused() const { return NumReused.load(std::memory_order_relaxed); }
+	int32 GetNumLive() const { return NumLive.load(std::memory_order_relaxed); }
+
+private:
+	// 동시에 살아 있는 발화는 보통 1~2개 (캡처 중 + 이전 발화 STT)
+	static constexpr int32 MaxFreeBuffers = 4;
+	// 이보다 큰 버퍼는 풀에 두지 않음 (1분 넘는 발화 한 번에 메모리가 묶이지 않게)
+	static constexpr int32 MaxPooledBytes = 8 * 1024 * 1024;
+
+	FCriticalSection Lock;
+	TArray<TArray<uint8>> FreeBuffers;
+
+	std::atomic<uint32> NextSerial{ 1 };
+	std::atomic<int64> NumAcquired{ 0 };
+	std::atomic<int64> NumReused{ 0 };
+	std::atomic<int32> NumLive{ 0 };
+};
+
+// 게임 스레드에서 캡처 프레임을 이어 붙여 발화 하나를 만듦
+class GOLDENTIME119_API FVoiceUtteranceBuilder
+{
+public:
+	~FVoiceUtteranceBuilder() { Reset(); }
+
+	// ExpectedMaxSec 분량을 미리 확보. MaxSec를 넘는 뒤쪽은 버림 (0 = 제한 없음)
+	void Begin(int32 InSampleRate, int32 InNumChannels, float ExpectedSec, float InMaxSec);
+	void Append(const uint8* Data, int32 NumBytes);
+
+	// 핸들을 넘기고 비움. 시작 안 했거나 비어 있으면 null
+	FVoiceUtterancePtr Finish();
+
+	// 결과 없이 버퍼를 풀에 반환
+	void Reset();
+
+	bool IsActive() const { return bActive; }
+	bool WasTruncated() const { return bTruncated; }
+
+private:
+	TArray<uint8> Buffer;
+	int32 SampleRate = 0;
+	int32 NumChannels = 1;
+	int32 MaxBytes = 0;
+	bool bActive = false;
+	bool bTruncated = false;
+};
+
+namespace VoiceUtteranceIO
+{
+	typedef TFunction<void(bool bSuccess, const FString& PathOrError)> FOnWavWritten;
+
+	// 백그라운드 스레드에서 WAV로 저장 (핸들이 버퍼를 붙잡고 있어 복사 없음). OnDone은 게임 스레드
+	GOLDENTIME119_API void WriteWavAsync(const FVoiceUtterancePtr& Utterance, const FString& Path, FOnWavWritten&& OnDone);
+
+	// RIFF/WAVE PCM16 헤더 44바이트
+	GOLDENTIME119_API void BuildWavHeader(int32 SampleRate, int32 NumChannels, int32 DataBytes, TArray<uint8>& OutHeader);
+}
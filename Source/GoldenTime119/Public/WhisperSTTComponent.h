@@ -2,10 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WhisperSpeechEngine.h"
+#include "WhisperStreamingTranscriber.h"
 #include "WhisperSTTComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWhisperSTTFinished, bool, bSuccess, const FString&, Text);
 
+// StableText: 더 이상 바뀌지 않는 앞부분 / UnstableText: 다음 디코드에서 바뀔 수 있는 뒷부분
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWhisperSTTPartial, const FString&, StableText, const FString&, UnstableText);
+
+// UWhisperSTTSubsystem의 상주 whisper.cpp 엔진으로 STT. 결과는 게임 스레드에서 OnFinished로 옴
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class GOLDENTIME119_API UWhisperSTTComponent : public UActorComponent
 {
@@ -15,27 +21,76 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Whisper|Events")
 	FOnWhisperSTTFinished OnFinished;
 
+	// 스트리밍 중 부분 인식 결과
+	UPROPERTY(BlueprintAssignable, Category = "Whisper|Events")
+	FOnWhisperSTTPartial OnPartialTranscript;
+
+	// 호환용: WAV 파일을 읽어서 메모리 경로로 넘김
 	UFUNCTION(BlueprintCallable, Category = "Whisper")
 	void RunWhisperOnWav(const FString& WavPath);
 
+	// PCM16 LE (interleaved, 아무 샘플레이트) -> 워커에서 16k mono로 변환 후 추론
+	UFUNCTION(BlueprintCallable, Category = "Whisper")
+	void RunWhisperOnPcm16(const TArray<uint8>& Pcm16LE, int32 SampleRate, int32 NumChannels);
+
+	// C++: 버퍼 소유권을 넘김 (복사 없음). 요청 ID 반환 (0 = 즉시 실패, OnFinished는 호출됨)
+	uint32 SubmitPcm16(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels);
+
+	// C++: PTT 캡처 발화를 다른 소비자(Realtime, 진단 WAV)와 공유한 채로 추론
+	uint32 SubmitUtterance(const FVoiceUtterancePtr& Utterance);
+
+	// ===== Streaming (PTT를 누르고 있는 동안) =====
+	// 캡처 시작 시 호출. 이후 프레임을 FeedStreamingPcm16으로 넘기고, 버튼을 떼면 FinishStreaming
+	// 최종 텍스트는 OnFinished로 옴
+	UFUNCTION(BlueprintCallable, Category = "Whisper|Streaming")
+	void BeginStreaming(int32 SampleRate, int32 NumChannels);
+
+	UFUNCTION(BlueprintCallable, Category = "Whisper|Streaming")
+	void FeedStreamingPcm16(const TArray<uint8>& Pcm16LE);
+
+	void FeedStreamingPcm16Raw(const uint8* Pcm16LE, int32 NumBytes);
+
+	UFUNCTION(BlueprintCallable, Category = "Whisper|Streaming")
+	void FinishStreaming();
+
+	UFUNCTION(BlueprintCallable, Category = "Whisper|Streaming")
+	void CancelStreaming();
+
+	UFUNCTION(BlueprintPure, Category = "Whisper|Streaming")
+	bool IsStreaming() const { return Streaming.IsValid() && Streaming->IsActive(); }
+
+	UFUNCTION(BlueprintPure, Category = "Whisper")
+	bool IsBusy() const { return NumInFlight > 0 || IsStreaming(); }
+
+	// 마지막 결과 (타이밍 포함)
+	const FWhisperSpeechResult& GetLastResult() const { return LastResult; }
+	const FWhisperStreamingTranscriber::FFinal& GetLastStreamingFinal() const { return LastStreamingFinal; }
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Config")
 	FString Language = TEXT("ko");
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Config")
-	float PollIntervalSeconds = 0.05f;
+	// false면 누르는 동안 부분 디코드 없이 떼었을 때 한 번만 디코드
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Streaming")
+	bool bPartialTranscripts = true;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Config")
-	float TimeoutSeconds = 20.0f;
+	// 새 오디오가 이만큼 쌓일 때마다 부분 디코드 (추론이 더 오래 걸리면 끝나는 대로 다음 것)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Streaming", meta = (ClampMin = "0.25", ClampMax = "5.0"))
+	float PartialIntervalSec = 1.0f;
+
+	// 확정되지 않은 구간의 최대 길이. 릴리스 후 최종 디코드 시간의 상한이 됨
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Whisper|Streaming", meta = (ClampMin = "2.0", ClampMax = "30.0"))
+	float MaxUncommittedSec = 12.0f;
 
 protected:
-	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	FString ExePathAbs;
-	FString ModelPathAbs;
-	FString OutputBaseAbs;
-	double StartTimeSec = 0.0;
-	FTimerHandle PollTimer;
+	int32 NumInFlight = 0;
+	FWhisperSpeechResult LastResult;
+
+	FWhisperStreamingTranscriberPtr Streaming;
+	FWhisperStreamingTranscriber::FFinal LastStreamingFinal;
 
-	void PollResultFile();
+	void HandleResult(const FWhisperSpeechResult& Result);
+	void HandleStreamingFinal(const FWhisperStreamingTranscriber::FFinal& Final);
 };
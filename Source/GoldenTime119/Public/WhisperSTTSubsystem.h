@@ -0,0 +1,66 @@
+// ============================ WhisperSTTSubsystem.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "WhisperSpeechEngine.h"
+#include "WhisperSTTSubsystem.generated.h"
+
+/**
+ * Owns the process-wide whisper.cpp engine for the game instance, so the model is loaded once at
+ * startup and survives level changes. Settings come from DefaultGame.ini:
+ *
+ *   [/Script/GoldenTime119.WhisperSTTSubsystem]
+ *   ModelPath=Plugins/WhisperRuntime/ThirdParty/Whisper/models/ggml-base-q5_1.bin
+ *   NumWorkers=1
+ */
+UCLASS(Config = Game)
+class GOLDENTIME119_API UWhisperSTTSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWhisperSTTSubsystem* Get(const UObject* WorldContextObject);
+
+	// 시작 안 됐으면 null
+	FWhisperSpeechEnginePtr GetEngine() const { return Engine; }
+
+	UFUNCTION(BlueprintCallable, Category = "Whisper")
+	bool IsModelLoaded() const { return Engine.IsValid() && Engine->IsModelLoaded(); }
+
+	// 프로젝트 디렉터리 기준 상대 경로 또는 절대 경로
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper")
+	FString ModelPath = TEXT("Plugins/WhisperRuntime/ThirdParty/Whisper/models/ggml-base-q5_1.bin");
+
+	// whisper.cpp 라이브러리 없이 빌드됐을 때 쓰는 실행 파일 (같은 기준의 경로)
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper")
+	FString CliPath = TEXT("Plugins/WhisperRuntime/ThirdParty/Whisper/whisper-cli.exe");
+
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper")
+	FString DefaultLanguage = TEXT("ko");
+
+	// 동시에 추론할 수 있는 발화 수 (워커마다 디코더 상태 메모리가 따로 듦)
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper", meta = (ClampMin = "1", ClampMax = "4"))
+	int32 NumWorkers = 1;
+
+	// 워커 하나가 쓰는 ggml 스레드 수. 0 = 자동
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 ThreadsPerWorker = 0;
+
+	// false면 첫 STT 요청 때 로드
+	UPROPERTY(Config, EditAnywhere, Category = "Whisper")
+	bool bStartOnInitialize = true;
+
+	// UGameInstanceSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 엔진이 없으면 만들고 모델 로드 시작
+	FWhisperSpeechEnginePtr StartEngine();
+
+	// 프로젝트 기준 상대 경로면 절대 경로로
+	static FString ResolvePath(const FString& Path);
+
+private:
+	FWhisperSpeechEnginePtr Engine;
+};
@@ -0,0 +1,169 @@
+// ============================ WhisperSpeechEngine.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "VoiceUtterance.h"
+#include <atomic>
+
+class FQueuedThreadPool;
+
+struct FWhisperSpeechSegment
+{
+	FString Text;
+	float StartSec = 0.f;       // 요청 오디오 기준
+	float EndSec = 0.f;
+};
+
+struct FWhisperRequestOptions
+{
+	FString Language;           // 비어 있으면 FConfig::Language
+	FString Prompt;             // 앞 문맥 (스트리밍에서 이미 확정된 텍스트)
+	bool bSegmentTimestamps = false;
+};
+
+struct FWhisperSpeechResult
+{
+	bool bSuccess = false;
+	bool bCancelled = false;
+	FString Text;
+	FString Error;
+
+	// bSegmentTimestamps일 때만 시간 값이 유효
+	TArray<FWhisperSpeechSegment> Segments;
+
+	uint32 RequestId = 0;
+	double AudioSec = 0.0;      // 입력 길이
+	double QueueSec = 0.0;      // Submit -> 워커 시작
+	double DecodeSec = 0.0;     // 리샘플 + 추론
+};
+
+/**
+ * In-process whisper.cpp speech-to-text (CPU inference).
+ *
+ * The model is loaded once (Start queues the load, so it overlaps with level startup) and shared by
+ * NumWorkers decoder states, each driven by its own thread of a private FQueuedThreadPool. Submit takes
+ * PCM16 straight from memory (a shared FVoiceUtterance handle, so the capture buffer is read in place);
+ * downmix + resampling to 16 kHz happens on the worker. Completion callbacks run on the game thread.
+ *
+ * Built without whisper.cpp (WITH_WHISPER_CPP=0) the same workers fall back to the bundled whisper-cli
+ * executable: each request is written to a 16 kHz WAV under Saved/Whisper/cli and decoded by one process
+ * run (the model is reloaded per request, so expect higher latency). Cancel/Shutdown terminate the process.
+ */
+class GOLDENTIME119_API FWhisperSpeechEngine
+{
+public:
+	struct FConfig
+	{
+		FString ModelPath;
+		FString Language = TEXT("ko");
+
+		// WITH_WHISPER_CPP=0일 때 쓰는 whisper-cli 실행 파일
+		FString CliPath;
+
+		int32 NumWorkers = 1;
+		int32 ThreadsPerWorker = 0;     // 0 = 코어 수 기준 자동
+
+		// whisper가 1초 미만 입력은 버리므로 무음으로 채움
+		float MinInputSec = 1.1f;
+	};
+
+	typedef TFunction<void(const FWhisperSpeechResult&)> FOnComplete;
+
+	FWhisperSpeechEngine();
+	~FWhisperSpeechEngine();
+
+	// 워커 풀 생성 + 모델 로드 예약 (게임 스레드)
+	bool Start(const FConfig& InConfig);
+
+	// 진행 중인 추론은 abort, 대기 중인 요청은 실패로 완료됨
+	void Shutdown();
+
+	bool IsStarted() const { return Pool != nullptr; }
+	bool IsModelLoaded() const { return bModelLoaded.load(std::memory_order_acquire); }
+	bool HasLoadFailed() const { return bLoadFailed.load(std::memory_order_acquire); }
+
+	// false면 whisper-cli 프로세스로 디코드 (요청마다 모델 로드)
+	static bool IsCompiledIn();
+
+	// PCM16 LE interleaved. 반환값은 요청 ID (0 = 거절, OnComplete는 그래도 호출됨)
+	uint32 Submit(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete);
+
+	// 캡처 발화를 복사 없이 공유 (워커가 끝나면 참조를 놓음)
+	uint32 Submit(const FVoiceUtterancePtr& Utterance, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete);
+
+	// 게임 스레드 없이 결과를 받음 (벤치마크/툴). 워커 스레드에서 호출됨
+	uint32 SubmitAnyThread(TArray<uint8>&& Pcm16LE, int32 SampleRate, int32 NumChannels, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete);
+	uint32 SubmitAnyThread(const FVoiceUtterancePtr& Utterance, const FWhisperRequestOptions& Options, FOnComplete&& OnComplete);
+
+	// 대기 중이면 실행하지 않고, 실행 중이면 abort. 결과는 bCancelled로 완료됨 (any thread)
+	void Cancel(uint32 RequestId);
+
+	// ===== Stats (any thread) =====
+	int32 GetNumPending() const { return NumPending.load(std::memory_order_relaxed); }
+	int64 GetNumCompleted() const { return NumCompleted.load(std::memory_order_relaxed); }
+	double GetModelLoadSec() const { return ModelLoadSec; }
+
+private:
+	class FJob;
+	friend class FJob;
+
+	struct FRequest
+	{
+		uint32 Id = 0;
+		FVoiceUtterancePtr Audio;
+		FWhisperRequestOptions Options;
+		FOnComplete OnComplete;
+		bool bGameThreadCallback = true;
+		double SubmitTime = 0.0;
+	};
+
+	// 워커에서 실행 중인 요청 (Cancel이 abort 플래그를 찾는 데 사용)
+	struct FRunning
+	{
+		uint32 Id = 0;
+		std::atomic<bool> bCancel{ false };
+		const std::atomic<bool>* EngineAbort = nullptr;
+	};
+
+	uint32 SubmitInternal(FRequest&& Request);
+	bool BeginRunning(FRunning& Running);
+	void EndRunning(FRunning& Running);
+	static void Complete(FRequest& Request, FWhisperSpeechResult&& Result);
+
+	// ----- worker -----
+	void RunRequest(FRequest& Request);
+	bool EnsureModelLoaded();
+	void* AcquireState();
+	void ReleaseState(void* State);
+	void ConvertTo16kMono(const FRequest& Request, TArray<float>& OutSamples) const;
+	void RunCliRequest(const FRequest& Request, const TArray<float>& Samples, const FRunning& Running, FWhisperSpeechResult& Result) const;
+
+	FConfig Config;
+	FQueuedThreadPool* Pool = nullptr;
+
+	// whisper-cli 입출력 임시 파일 위치
+	FString CliWorkDir;
+
+	// whisper_context* / whisper_state* (헤더에 whisper.h를 노출하지 않음)
+	void* Context = nullptr;
+	TArray<void*> FreeStates;
+	TArray<void*> AllStates;
+	FCriticalSection ModelLock;
+	FCriticalSection StateLock;
+
+	FCriticalSection CancelLock;
+	TSet<uint32> CancelledIds;          // 아직 시작 안 한 요청
+	TArray<FRunning*> RunningRequests;
+
+	double ModelLoadSec = 0.0;
+	std::atomic<bool> bModelLoaded{ false };
+	std::atomic<bool> bLoadFailed{ false };
+	std::atomic<bool> bAbort{ false };
+
+	std::atomic<uint32> NextRequestId{ 1 };
+	std::atomic<int32> NumPending{ 0 };
+	std::atomic<int64> NumCompleted{ 0 };
+};
+
+typedef TSharedPtr<FWhisperSpeechEngine, ESPMode::ThreadSafe> FWhisperSpeechEnginePtr;
@@ -0,0 +1,98 @@
+// ============================ WhisperStreamingTranscriber.h ============================
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WhisperSpeechEngine.h"
+
+/**
+ * Incremental transcription of one push-to-talk utterance while the button is held (game thread).
+ *
+ * Every PartialIntervalSec of new audio, the uncommitted window is re-decoded with segment timestamps.
+ * Text that two consecutive passes agree on (local agreement) is committed at a segment boundary:
+ * it becomes the stable prefix, its audio is dropped from the window, and it is passed as the prompt
+ * for the following passes. So the window, and with it the final decode on release, stays a few seconds
+ * long no matter how long the trainee talks. Only one decode is in flight per utterance; on release an
+ * in-flight partial is cancelled and the final pass over the remaining window is submitted at once.
+ */
+class GOLDENTIME119_API FWhisperStreamingTranscriber : public TSharedFromThis<FWhisperStreamingTranscriber, ESPMode::ThreadSafe>
+{
+public:
+	struct FSettings
+	{
+		FString Language;
+		bool bPartials = true;              // false면 릴리스 때 전체를 한 번만 디코드
+		float PartialIntervalSec = 1.0f;    // 새 오디오가 이만큼 쌓이면 다음 부분 디코드
+		float MinPartialAudioSec = 1.0f;    // 첫 부분 디코드 전 최소 길이
+		float MaxWindowSec = 12.0f;         // 미확정 구간이 이보다 길면 마지막 세그먼트만 남기고 강제 확정
+		int32 MaxPromptChars = 200;
+	};
+
+	struct FFinal
+	{
+		bool bSuccess = false;
+		FString Text;
+		FString Error;
+		double ReleaseToTextSec = 0.0;      // Finish() -> 최종 텍스트
+		double AudioSec = 0.0;              // 전체 발화 길이
+		double FinalWindowSec = 0.0;        // 릴리스 때 실제로 디코드한 길이
+		int32 NumPartials = 0;
+	};
+
+	typedef TFunction<void(const FString& StableText, const FString& UnstableText)> FOnPartial;
+	typedef TFunction<void(const FFinal& Final)> FOnFinal;
+
+	FWhisperStreamingTranscriber(const FWhisperSpeechEnginePtr& InEngine, const FSettings& InSettings);
+	~FWhisperStreamingTranscriber();
+
+	void Begin(int32 InSampleRate, int32 InNumChannels, FOnPartial&& InOnPartial, FOnFinal&& InOnFinal);
+	void AddPcm16(const uint8* Data, int32 NumBytes);
+
+	// 버튼을 뗌: 남은 구간만 최종 디코드 (OnFinal은 나중에 게임 스레드에서)
+	void Finish();
+
+	// 결과 없이 종료
+	void Cancel();
+
+	bool IsActive() const { return bActive; }
+	bool IsFinishing() const { return bFinishing; }
+
+private:
+	void MaybeSubmitPartial();
+	uint32 SubmitWindow(bool bFinal);
+	void HandleResult(uint32 Generation, bool bFinal, int64 WindowStart, const FWhisperSpeechResult& Result);
+	void ApplyPartial(int64 WindowStart, const FWhisperSpeechResult& Result);
+	void CommitUpTo(int64 Frame, const FString& Text);
+	void Reset();
+
+	int32 BytesPerFrame() const { return NumChannels * (int32)sizeof(int16); }
+	double FramesToSec(int64 Frames) const { return (double)Frames / (double)SampleRate; }
+
+	FWhisperSpeechEnginePtr Engine;
+	FSettings Settings;
+
+	FOnPartial OnPartial;
+	FOnFinal OnFinal;
+
+	int32 SampleRate = 16000;
+	int32 NumChannels = 1;
+
+	bool bActive = false;
+	bool bFinishing = false;
+	uint32 Generation = 0;
+
+	// 미확정 오디오 (WindowStartFrame부터)
+	TArray<uint8> Window;
+	int64 WindowStartFrame = 0;
+	int64 TotalFrames = 0;
+	int64 LastSubmittedEndFrame = 0;
+
+	FString CommittedText;
+	FString PrevUnstableText;   // 직전 부분 디코드의 미확정 텍스트 (WindowStartFrame 기준)
+
+	uint32 InFlightId = 0;
+	int32 NumPartials = 0;
+	double ReleaseTime = 0.0;
+	double FinalWindowSec = 0.0;
+};
+
+typedef TSharedPtr<FWhisperStreamingTranscriber, ESPMode::ThreadSafe> FWhisperStreamingTranscriberPtr;